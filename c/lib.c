@@ -5,8 +5,16 @@
  *  @date       January 16, 2024
  *  @copyright  Copyright (c) 2024
  */
+// Strict `-std=c99` builds hide `madvise` and the `MADV_*` constants on glibc, unless explicitly requested.
+#if !defined(_WIN32) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE
+#endif
+
 #if defined(_WIN32) || defined(__CYGWIN__)
-#include <windows.h> // `DllMain`
+#include <windows.h> // `DllMain`, `PrefetchVirtualMemory`
+#elif !SZ_AVOID_LIBC
+#include <sys/mman.h> // `madvise`
+#include <unistd.h>   // `sysconf`
 #endif
 
 // When enabled, this library will override the symbols usually provided by the C standard library.
@@ -16,6 +24,12 @@
 #define SZ_OVERRIDE_LIBC SZ_AVOID_LIBC
 #endif
 
+// When enabled, every dispatched function counts its calls and input bytes, readable with `sz_dispatch_stats`.
+// The counters are relaxed atomics, cheap but not free on the hottest paths, so they are disabled by default.
+#if !defined(SZ_ENABLE_STATS)
+#define SZ_ENABLE_STATS (0)
+#endif
+
 // Overwrite `SZ_DYNAMIC_DISPATCH` before including StringZilla.
 #ifdef SZ_DYNAMIC_DISPATCH
 #undef SZ_DYNAMIC_DISPATCH
@@ -23,6 +37,10 @@
 #define SZ_DYNAMIC_DISPATCH 1
 #include <stringzilla/stringzilla.h>
 
+#if SZ_USE_ARM_SVE && defined(__linux__) && !SZ_AVOID_LIBC
+#include <sys/auxv.h> // `getauxval`
+#endif
+
 #if SZ_AVOID_LIBC
 // If we don't have the LibC, the `malloc` definition in `stringzilla.h` will be illformed.
 #ifdef _MSC_VER
@@ -100,11 +118,17 @@ SZ_DYNAMIC sz_capability_t sz_capabilities(void) {
     unsigned supports_neon = 1;
     unsigned supports_sve = 0;
     unsigned supports_sve2 = 0;
-    sz_unused(supports_sve);
     sz_unused(supports_sve2);
 
+#if SZ_USE_ARM_SVE && defined(__linux__) && !SZ_AVOID_LIBC
+    // Linux reports the SVE support in the auxiliary vector: `HWCAP_SVE` and `HWCAP2_SVE2` bits.
+    supports_sve = (getauxval(AT_HWCAP) & (1ul << 22)) != 0;
+    supports_sve2 = (getauxval(AT_HWCAP2) & (1ul << 1)) != 0;
+#endif
+
     return (sz_capability_t)(                 //
         (sz_cap_arm_neon_k * supports_neon) | //
+        (sz_cap_arm_sve_k * supports_sve) |   //
         (sz_cap_serial_k));
 
 #endif // SIMSIMD_TARGET_ARM
@@ -112,138 +136,354 @@ SZ_DYNAMIC sz_capability_t sz_capabilities(void) {
     return sz_cap_serial_k;
 }
 
-typedef struct sz_implementations_t {
-    sz_equal_t equal;
-    sz_order_t order;
-
-    sz_move_t copy;
-    sz_move_t move;
-    sz_fill_t fill;
-    sz_look_up_transform_t look_up_transform;
-    sz_checksum_t checksum;
-
-    sz_find_byte_t find_byte;
-    sz_find_byte_t rfind_byte;
-    sz_find_t find;
-    sz_find_t rfind;
-    sz_find_set_t find_from_set;
-    sz_find_set_t rfind_from_set;
-
-    sz_edit_distance_t edit_distance;
-    sz_alignment_score_t alignment_score;
-    sz_hashes_t hashes;
+/**
+ *  @brief  Every operation routed through the dispatch table, as pairs of the kernel signature and the field name.
+ *          Used to derive the table itself, the names of the active kernels, and the optional call statistics.
+ */
+#define _SZ_DISPATCHED_OPERATIONS(X)                                                                                 \
+    X(sz_equal_t, equal)                                                                                             \
+    X(sz_order_t, order)                                                                                             \
+    X(sz_move_t, copy)                                                                                               \
+    X(sz_move_t, move)                                                                                               \
+    X(sz_fill_t, fill)                                                                                               \
+    X(sz_look_up_transform_t, look_up_transform)                                                                     \
+    X(sz_checksum_t, checksum)                                                                                       \
+    X(sz_hash_t, hash)                                                                                               \
+    X(sz_hash_batch_t, hash_batch)                                                                                   \
+    X(sz_utf8_validate_t, utf8_validate)                                                                             \
+    X(sz_utf8_count_t, utf8_count)                                                                                   \
+    X(sz_utf8_to_utf32_t, utf8_to_utf32)                                                                             \
+    X(sz_utf8_find_nth_t, utf8_find_nth)                                                                             \
+    X(sz_find_byte_t, find_byte)                                                                                     \
+    X(sz_find_byte_t, rfind_byte)                                                                                    \
+    X(sz_find_t, find)                                                                                               \
+    X(sz_find_t, rfind)                                                                                              \
+    X(sz_find_t, find_caseless)                                                                                      \
+    X(sz_find_t, rfind_caseless)                                                                                     \
+    X(sz_find_set_t, find_from_set)                                                                                  \
+    X(sz_find_set_t, rfind_from_set)                                                                                 \
+    X(sz_find_multi_t, find_multi)                                                                                   \
+    X(sz_find_all_t, find_all)                                                                                       \
+    X(sz_find_all_set_t, find_all_from_set)                                                                          \
+    X(sz_edit_distance_t, edit_distance)                                                                             \
+    X(sz_edit_distances_t, edit_distances)                                                                           \
+    X(sz_alignment_score_t, alignment_score)                                                                         \
+    X(sz_alignment_score_t, local_alignment_score)                                                                   \
+    X(sz_alignment_scores_t, alignment_scores)                                                                       \
+    X(sz_hashes_t, hashes)                                                                                           \
+    X(sz_hashes_minhash_t, hashes_minhash)
+
+#define _SZ_DISPATCH_FIELD(type, name) type name;
+#define _SZ_DISPATCH_INDEX(type, name) _sz_dispatch_##name##_k,
+#define _SZ_DISPATCH_NAME(type, name) #name,
 
+typedef struct sz_implementations_t {
+    _SZ_DISPATCHED_OPERATIONS(_SZ_DISPATCH_FIELD)
 } sz_implementations_t;
 
+typedef enum { _SZ_DISPATCHED_OPERATIONS(_SZ_DISPATCH_INDEX) _sz_dispatch_count_k } _sz_dispatch_index_t;
+
+static sz_cptr_t const sz_dispatch_operations[_sz_dispatch_count_k] = {_SZ_DISPATCHED_OPERATIONS(_SZ_DISPATCH_NAME)};
+
 #if defined(_MSC_VER)
 __declspec(align(64)) static sz_implementations_t sz_dispatch_table;
 #else
 __attribute__((aligned(64))) static sz_implementations_t sz_dispatch_table;
 #endif
 
+/// Names of the kernels currently in the `sz_dispatch_table`, like "sz_find_avx512", indexed by operation.
+static sz_cptr_t sz_dispatch_kernels[_sz_dispatch_count_k];
+/// Capabilities the `sz_dispatch_table` was last populated with.
+static sz_capability_t sz_dispatch_capabilities_in_use;
+
+// The table can be re-populated at runtime, so every entry is published and read with a pointer-sized atomic,
+// which compiles to plain loads and stores on all supported platforms.
+#if defined(_MSC_VER)
+#define _sz_dispatch_load(field) (field) // Aligned word-sized loads are atomic on every MSVC target
+#define _sz_dispatch_store(field, value) InterlockedExchangePointer((PVOID volatile *)&(field), (PVOID)(value))
+#define _sz_dispatch_store_capabilities(value)                                                                       \
+    InterlockedExchange((LONG volatile *)&sz_dispatch_capabilities_in_use, (LONG)(value))
+#else
+#define _sz_dispatch_load(field) __atomic_load_n(&(field), __ATOMIC_ACQUIRE)
+#define _sz_dispatch_store(field, value) __atomic_store_n(&(field), (value), __ATOMIC_RELEASE)
+#define _sz_dispatch_store_capabilities(value) __atomic_store_n(&sz_dispatch_capabilities_in_use, value, __ATOMIC_RELEASE)
+#endif
+
+#if SZ_ENABLE_STATS
+/// Per-operation call and byte counters, incremented with relaxed atomics on every dispatched call.
+static sz_u64_t sz_dispatch_calls[_sz_dispatch_count_k];
+static sz_u64_t sz_dispatch_bytes[_sz_dispatch_count_k];
+
+#if defined(_MSC_VER)
+#define _sz_dispatch_counter_add(counter, value) _InterlockedExchangeAdd64((__int64 volatile *)&(counter), (__int64)(value))
+#define _sz_dispatch_counter_load(counter) ((sz_u64_t)(*(__int64 volatile *)&(counter)))
+#define _sz_dispatch_counter_store(counter, value) _InterlockedExchange64((__int64 volatile *)&(counter), (__int64)(value))
+#else
+#define _sz_dispatch_counter_add(counter, value) __atomic_fetch_add(&(counter), (sz_u64_t)(value), __ATOMIC_RELAXED)
+#define _sz_dispatch_counter_load(counter) __atomic_load_n(&(counter), __ATOMIC_RELAXED)
+#define _sz_dispatch_counter_store(counter, value) __atomic_store_n(&(counter), (sz_u64_t)(value), __ATOMIC_RELAXED)
+#endif
+
+#define _sz_dispatch_count(name, length)                                                                             \
+    (_sz_dispatch_counter_add(sz_dispatch_calls[_sz_dispatch_##name##_k], 1),                                        \
+     _sz_dispatch_counter_add(sz_dispatch_bytes[_sz_dispatch_##name##_k], length))
+#else
+#define _sz_dispatch_count(name, length) ((void)0)
+#endif // SZ_ENABLE_STATS
+
 /**
- *  @brief  Initializes a global static "virtual table" of supported backends
- *          Run it just once to avoiding unnecessary `if`-s.
+ *  @brief  Batched hashing for backends without a dedicated kernel, reusing the best single-string one.
  */
-static void sz_dispatch_table_init(void) {
-    sz_implementations_t *impl = &sz_dispatch_table;
-    sz_capability_t caps = sz_capabilities();
-    sz_unused(caps); //< Unused when compiling on pre-SIMD machines.
-
-    impl->equal = sz_equal_serial;
-    impl->order = sz_order_serial;
-    impl->copy = sz_copy_serial;
-    impl->move = sz_move_serial;
-    impl->fill = sz_fill_serial;
-    impl->look_up_transform = sz_look_up_transform_serial;
-    impl->checksum = sz_checksum_serial;
-
-    impl->find = sz_find_serial;
-    impl->rfind = sz_rfind_serial;
-    impl->find_byte = sz_find_byte_serial;
-    impl->rfind_byte = sz_rfind_byte_serial;
-    impl->find_from_set = sz_find_charset_serial;
-    impl->rfind_from_set = sz_rfind_charset_serial;
-
-    impl->edit_distance = sz_edit_distance_serial;
-    impl->alignment_score = sz_alignment_score_serial;
-    impl->hashes = sz_hashes_serial;
+static void _sz_hash_batch_dispatched(sz_sequence_t const *sequence, sz_u64_t *hashes) {
+    for (sz_size_t i = 0; i != sequence->count; ++i)
+        hashes[i] = _sz_dispatch_load(sz_dispatch_table.hash)(sequence->get_start(sequence, i), sequence->get_length(sequence, i));
+}
+
+/**
+ *  @brief  Populates the global static "virtual table" with the most advanced kernels among the given capabilities.
+ *          Run it once on startup and only again on explicit overrides, to avoid unnecessary `if`-s on the hot path.
+ *          The kernels are first resolved into a local table, and then published entry by entry, so concurrent
+ *          callers only ever see the previous or the final kernel of every operation, never the serial defaults.
+ */
+static void sz_dispatch_table_init(sz_capability_t caps) {
+    sz_implementations_t table, *impl = &table;
+    sz_cptr_t kernels[_sz_dispatch_count_k];
+
+#define sz_dispatch_set(name, kernel) (impl->name = kernel, kernels[_sz_dispatch_##name##_k] = #kernel)
+
+    sz_dispatch_set(equal, sz_equal_serial);
+    sz_dispatch_set(order, sz_order_serial);
+    sz_dispatch_set(copy, sz_copy_serial);
+    sz_dispatch_set(move, sz_move_serial);
+    sz_dispatch_set(fill, sz_fill_serial);
+    sz_dispatch_set(look_up_transform, sz_look_up_transform_serial);
+    sz_dispatch_set(checksum, sz_checksum_serial);
+    sz_dispatch_set(hash, sz_hash_serial);
+    sz_dispatch_set(hash_batch, _sz_hash_batch_dispatched);
+
+    sz_dispatch_set(utf8_validate, sz_utf8_validate_serial);
+    sz_dispatch_set(utf8_count, sz_utf8_count_serial);
+    sz_dispatch_set(utf8_to_utf32, sz_utf8_to_utf32_serial);
+    sz_dispatch_set(utf8_find_nth, sz_utf8_find_nth_serial);
+
+    sz_dispatch_set(find, sz_find_serial);
+    sz_dispatch_set(rfind, sz_rfind_serial);
+    sz_dispatch_set(find_caseless, sz_find_caseless_serial);
+    sz_dispatch_set(rfind_caseless, sz_rfind_caseless_serial);
+    sz_dispatch_set(find_byte, sz_find_byte_serial);
+    sz_dispatch_set(rfind_byte, sz_rfind_byte_serial);
+    sz_dispatch_set(find_from_set, sz_find_charset_serial);
+    sz_dispatch_set(rfind_from_set, sz_rfind_charset_serial);
+    sz_dispatch_set(find_multi, sz_find_multi_serial);
+    sz_dispatch_set(find_all, sz_find_all_serial);
+    sz_dispatch_set(find_all_from_set, sz_find_all_charset_serial);
+
+    sz_dispatch_set(edit_distance, sz_edit_distance_serial);
+    sz_dispatch_set(edit_distances, sz_edit_distances_serial);
+    sz_dispatch_set(alignment_score, sz_alignment_score_serial);
+    sz_dispatch_set(local_alignment_score, sz_local_alignment_score_serial);
+    sz_dispatch_set(alignment_scores, sz_alignment_scores_serial);
+    sz_dispatch_set(hashes, sz_hashes_serial);
+    sz_dispatch_set(hashes_minhash, sz_hashes_minhash_serial);
 
 #if SZ_USE_X86_AVX2
     if (caps & sz_cap_x86_avx2_k) {
-        impl->equal = sz_equal_avx2;
-        impl->order = sz_order_avx2;
-
-        impl->copy = sz_copy_avx2;
-        impl->move = sz_move_avx2;
-        impl->fill = sz_fill_avx2;
-        impl->look_up_transform = sz_look_up_transform_avx2;
-        impl->checksum = sz_checksum_avx2;
-
-        impl->find_byte = sz_find_byte_avx2;
-        impl->rfind_byte = sz_rfind_byte_avx2;
-        impl->find = sz_find_avx2;
-        impl->rfind = sz_rfind_avx2;
-        impl->find_from_set = sz_find_charset_avx2;
-        impl->rfind_from_set = sz_rfind_charset_avx2;
+        sz_dispatch_set(equal, sz_equal_avx2);
+        sz_dispatch_set(order, sz_order_avx2);
+
+        sz_dispatch_set(copy, sz_copy_avx2);
+        sz_dispatch_set(move, sz_move_avx2);
+        sz_dispatch_set(fill, sz_fill_avx2);
+        sz_dispatch_set(look_up_transform, sz_look_up_transform_avx2);
+        sz_dispatch_set(checksum, sz_checksum_avx2);
+        sz_dispatch_set(hash, sz_hash_avx2);
+
+        sz_dispatch_set(utf8_validate, sz_utf8_validate_avx2);
+        sz_dispatch_set(utf8_count, sz_utf8_count_avx2);
+        sz_dispatch_set(utf8_to_utf32, sz_utf8_to_utf32_avx2);
+        sz_dispatch_set(utf8_find_nth, sz_utf8_find_nth_avx2);
+
+        sz_dispatch_set(find_byte, sz_find_byte_avx2);
+        sz_dispatch_set(rfind_byte, sz_rfind_byte_avx2);
+        sz_dispatch_set(find, sz_find_avx2);
+        sz_dispatch_set(rfind, sz_rfind_avx2);
+        sz_dispatch_set(find_caseless, sz_find_caseless_avx2);
+        sz_dispatch_set(rfind_caseless, sz_rfind_caseless_avx2);
+        sz_dispatch_set(find_from_set, sz_find_charset_avx2);
+        sz_dispatch_set(rfind_from_set, sz_rfind_charset_avx2);
+        sz_dispatch_set(find_multi, sz_find_multi_avx2);
+        sz_dispatch_set(find_all, sz_find_all_avx2);
+        sz_dispatch_set(find_all_from_set, sz_find_all_charset_avx2);
+
+        sz_dispatch_set(hashes, sz_hashes_avx2);
+        sz_dispatch_set(hashes_minhash, sz_hashes_minhash_avx2);
+
+        sz_dispatch_set(alignment_score, sz_alignment_score_avx2);
+        sz_dispatch_set(local_alignment_score, sz_local_alignment_score_avx2);
+        sz_dispatch_set(alignment_scores, sz_alignment_scores_avx2);
     }
 #endif
 
 #if SZ_USE_X86_AVX512
     if (caps & sz_cap_x86_avx512f_k) {
-        impl->equal = sz_equal_avx512;
-        impl->order = sz_order_avx512;
+        sz_dispatch_set(equal, sz_equal_avx512);
+        sz_dispatch_set(order, sz_order_avx512);
 
-        impl->copy = sz_copy_avx512;
-        impl->move = sz_move_avx512;
-        impl->fill = sz_fill_avx512;
+        sz_dispatch_set(copy, sz_copy_avx512);
+        sz_dispatch_set(move, sz_move_avx512);
+        sz_dispatch_set(fill, sz_fill_avx512);
 
-        impl->find = sz_find_avx512;
-        impl->rfind = sz_rfind_avx512;
-        impl->find_byte = sz_find_byte_avx512;
-        impl->rfind_byte = sz_rfind_byte_avx512;
+        sz_dispatch_set(find, sz_find_avx512);
+        sz_dispatch_set(rfind, sz_rfind_avx512);
+        sz_dispatch_set(find_byte, sz_find_byte_avx512);
+        sz_dispatch_set(rfind_byte, sz_rfind_byte_avx512);
+        sz_dispatch_set(find_multi, sz_find_multi_avx512);
 
-        impl->edit_distance = sz_edit_distance_avx512;
+        sz_dispatch_set(edit_distance, sz_edit_distance_avx512);
+        sz_dispatch_set(edit_distances, sz_edit_distances_avx512);
     }
 
     if ((caps & sz_cap_x86_avx512f_k) && (caps & sz_cap_x86_avx512vl_k) && (caps & sz_cap_x86_avx512vbmi2_k) &&
         (caps & sz_cap_x86_avx512bw_k) && (caps & sz_cap_x86_avx512vbmi_k)) {
-        impl->find_from_set = sz_find_charset_avx512;
-        impl->rfind_from_set = sz_rfind_charset_avx512;
-        impl->alignment_score = sz_alignment_score_avx512;
-        impl->look_up_transform = sz_look_up_transform_avx512;
-        impl->checksum = sz_checksum_avx512;
+        sz_dispatch_set(find_from_set, sz_find_charset_avx512);
+        sz_dispatch_set(rfind_from_set, sz_rfind_charset_avx512);
+        sz_dispatch_set(find_all_from_set, sz_find_all_charset_avx512);
+        sz_dispatch_set(look_up_transform, sz_look_up_transform_avx512);
+        sz_dispatch_set(checksum, sz_checksum_avx512);
+    }
+
+    // The hashing kernels also use AVX-512DQ, which all CPUs with AVX-512BW support.
+    if ((caps & sz_cap_x86_avx512f_k) && (caps & sz_cap_x86_avx512vl_k) && (caps & sz_cap_x86_avx512bw_k)) {
+        sz_dispatch_set(hash, sz_hash_avx512);
+        sz_dispatch_set(hash_batch, sz_hash_batch_avx512);
+        sz_dispatch_set(hashes, sz_hashes_avx512);
+        sz_dispatch_set(hashes_minhash, sz_hashes_minhash_avx512);
+
+        sz_dispatch_set(utf8_validate, sz_utf8_validate_avx512);
+        sz_dispatch_set(utf8_count, sz_utf8_count_avx512);
+        sz_dispatch_set(utf8_to_utf32, sz_utf8_to_utf32_avx512);
+        sz_dispatch_set(utf8_find_nth, sz_utf8_find_nth_avx512);
+
+        sz_dispatch_set(find_caseless, sz_find_caseless_avx512);
+        sz_dispatch_set(rfind_caseless, sz_rfind_caseless_avx512);
+        sz_dispatch_set(find_all, sz_find_all_avx512);
     }
 #endif
 
 #if SZ_USE_ARM_NEON
     if (caps & sz_cap_arm_neon_k) {
-        impl->equal = sz_equal_neon;
-
-        impl->copy = sz_copy_neon;
-        impl->move = sz_move_neon;
-        impl->fill = sz_fill_neon;
-        impl->look_up_transform = sz_look_up_transform_neon;
-        impl->checksum = sz_checksum_neon;
-
-        impl->find = sz_find_neon;
-        impl->rfind = sz_rfind_neon;
-        impl->find_byte = sz_find_byte_neon;
-        impl->rfind_byte = sz_rfind_byte_neon;
-        impl->find_from_set = sz_find_charset_neon;
-        impl->rfind_from_set = sz_rfind_charset_neon;
+        sz_dispatch_set(equal, sz_equal_neon);
+
+        sz_dispatch_set(copy, sz_copy_neon);
+        sz_dispatch_set(move, sz_move_neon);
+        sz_dispatch_set(fill, sz_fill_neon);
+        sz_dispatch_set(look_up_transform, sz_look_up_transform_neon);
+        sz_dispatch_set(checksum, sz_checksum_neon);
+        sz_dispatch_set(hash, sz_hash_neon);
+        sz_dispatch_set(hashes, sz_hashes_neon);
+        sz_dispatch_set(hashes_minhash, sz_hashes_minhash_neon);
+
+        sz_dispatch_set(utf8_validate, sz_utf8_validate_neon);
+        sz_dispatch_set(utf8_count, sz_utf8_count_neon);
+        sz_dispatch_set(utf8_to_utf32, sz_utf8_to_utf32_neon);
+        sz_dispatch_set(utf8_find_nth, sz_utf8_find_nth_neon);
+
+        sz_dispatch_set(find, sz_find_neon);
+        sz_dispatch_set(rfind, sz_rfind_neon);
+        sz_dispatch_set(find_caseless, sz_find_caseless_neon);
+        sz_dispatch_set(rfind_caseless, sz_rfind_caseless_neon);
+        sz_dispatch_set(find_byte, sz_find_byte_neon);
+        sz_dispatch_set(rfind_byte, sz_rfind_byte_neon);
+        sz_dispatch_set(find_from_set, sz_find_charset_neon);
+        sz_dispatch_set(rfind_from_set, sz_rfind_charset_neon);
+        sz_dispatch_set(find_all, sz_find_all_neon);
+        sz_dispatch_set(find_all_from_set, sz_find_all_charset_neon);
+
+        sz_dispatch_set(alignment_score, sz_alignment_score_neon);
+        sz_dispatch_set(local_alignment_score, sz_local_alignment_score_neon);
+        sz_dispatch_set(alignment_scores, sz_alignment_scores_neon);
+    }
+#endif
+
+#if SZ_USE_ARM_SVE
+    if (caps & sz_cap_arm_sve_k) {
+        sz_dispatch_set(look_up_transform, sz_look_up_transform_sve);
+        sz_dispatch_set(hashes, sz_hashes_sve);
+    }
+#endif
+
+#undef sz_dispatch_set
+
+#define _SZ_DISPATCH_PUBLISH(type, name)                                                                             \
+    _sz_dispatch_store(sz_dispatch_table.name, table.name);                                                          \
+    _sz_dispatch_store(sz_dispatch_kernels[_sz_dispatch_##name##_k], kernels[_sz_dispatch_##name##_k]);
+    _SZ_DISPATCHED_OPERATIONS(_SZ_DISPATCH_PUBLISH)
+#undef _SZ_DISPATCH_PUBLISH
+    _sz_dispatch_store_capabilities(caps);
+}
+
+SZ_DYNAMIC sz_capability_t sz_dispatch_use(sz_capability_t caps) {
+    caps = (sz_capability_t)((caps & sz_capabilities()) | sz_cap_serial_k);
+    sz_dispatch_table_init(caps);
+    return caps;
+}
+
+SZ_DYNAMIC sz_capability_t sz_dispatch_capabilities(void) {
+    return (sz_capability_t)_sz_dispatch_load(sz_dispatch_capabilities_in_use);
+}
+
+SZ_DYNAMIC sz_size_t sz_dispatch_count(void) { return _sz_dispatch_count_k; }
+
+SZ_DYNAMIC sz_cptr_t sz_dispatch_operation(sz_size_t index) {
+    return index < _sz_dispatch_count_k ? sz_dispatch_operations[index] : SZ_NULL;
+}
+
+SZ_DYNAMIC sz_cptr_t sz_dispatch_kernel(sz_size_t index) {
+    return index < _sz_dispatch_count_k ? _sz_dispatch_load(sz_dispatch_kernels[index]) : SZ_NULL;
+}
+
+SZ_DYNAMIC sz_bool_t sz_dispatch_stats(sz_size_t index, sz_u64_t *calls, sz_u64_t *bytes) {
+#if SZ_ENABLE_STATS
+    if (index >= _sz_dispatch_count_k) return sz_false_k;
+    if (calls) *calls = _sz_dispatch_counter_load(sz_dispatch_calls[index]);
+    if (bytes) *bytes = _sz_dispatch_counter_load(sz_dispatch_bytes[index]);
+    return sz_true_k;
+#else
+    sz_unused(index && calls && bytes);
+    return sz_false_k;
+#endif
+}
+
+SZ_DYNAMIC void sz_dispatch_stats_reset(void) {
+#if SZ_ENABLE_STATS
+    for (sz_size_t i = 0; i != _sz_dispatch_count_k; ++i) {
+        _sz_dispatch_counter_store(sz_dispatch_calls[i], 0);
+        _sz_dispatch_counter_store(sz_dispatch_bytes[i], 0);
     }
 #endif
 }
 
+/**
+ *  @brief  Populates the dispatch table on startup, limiting the backends to `SZ_BACKEND` environment variable,
+ *          like `SZ_BACKEND=avx2`, if it's set to a valid list of names.
+ */
+static void sz_dispatch_table_init_on_startup(void) {
+    sz_capability_t caps = sz_capabilities();
+#if !SZ_AVOID_LIBC
+    sz_capability_t requested = sz_capabilities_from_names(getenv("SZ_BACKEND"));
+    if (requested) caps = (sz_capability_t)((caps & requested) | sz_cap_serial_k);
+#endif
+    sz_dispatch_table_init(caps);
+}
+
 #if defined(_MSC_VER)
 #pragma section(".CRT$XCU", read)
-__declspec(allocate(".CRT$XCU")) void (*_sz_dispatch_table_init)() = sz_dispatch_table_init;
+__declspec(allocate(".CRT$XCU")) void (*_sz_dispatch_table_init)() = sz_dispatch_table_init_on_startup;
 
 BOOL WINAPI DllMain(HINSTANCE hints, DWORD forward_reason, LPVOID lp) {
     switch (forward_reason) {
     case DLL_PROCESS_ATTACH:
-        sz_dispatch_table_init(); // Ensure initialization
+        sz_dispatch_table_init_on_startup(); // Ensure initialization
         return TRUE;
     case DLL_THREAD_ATTACH: return TRUE;
     case DLL_THREAD_DETACH: return TRUE;
@@ -253,57 +493,161 @@ BOOL WINAPI DllMain(HINSTANCE hints, DWORD forward_reason, LPVOID lp) {
 }
 
 #else
-__attribute__((constructor)) static void sz_dispatch_table_init_on_gcc_or_clang(void) { sz_dispatch_table_init(); }
+__attribute__((constructor)) static void sz_dispatch_table_init_on_gcc_or_clang(void) {
+    sz_dispatch_table_init_on_startup();
+}
 #endif
 
-SZ_DYNAMIC sz_u64_t sz_checksum(sz_cptr_t text, sz_size_t length) { return sz_dispatch_table.checksum(text, length); }
+SZ_DYNAMIC sz_u64_t sz_checksum(sz_cptr_t text, sz_size_t length) {
+    _sz_dispatch_count(checksum, length);
+    return _sz_dispatch_load(sz_dispatch_table.checksum)(text, length);
+}
+
+SZ_DYNAMIC sz_u64_t sz_hash(sz_cptr_t text, sz_size_t length) {
+    _sz_dispatch_count(hash, length);
+    return _sz_dispatch_load(sz_dispatch_table.hash)(text, length);
+}
+
+SZ_DYNAMIC void sz_hash_batch(sz_sequence_t const *sequence, sz_u64_t *hashes) {
+    _sz_dispatch_count(hash_batch, 0);
+    _sz_dispatch_load(sz_dispatch_table.hash_batch)(sequence, hashes);
+}
+
+SZ_DYNAMIC void sz_sort(sz_sequence_t *sequence) { sz_sort_serial(sequence); }
+
+SZ_DYNAMIC void sz_sort_partial(sz_sequence_t *sequence, sz_size_t n) { sz_sort_partial_serial(sequence, n); }
+
+SZ_DYNAMIC void sz_sort_parallel(sz_sequence_t *sequence, sz_parallel_for_t parallel_for, void *executor) {
+    sz_sort_parallel_serial(sequence, parallel_for, executor);
+}
+
+SZ_DYNAMIC sz_bool_t sz_utf8_validate(sz_cptr_t text, sz_size_t length) {
+    _sz_dispatch_count(utf8_validate, length);
+    return _sz_dispatch_load(sz_dispatch_table.utf8_validate)(text, length);
+}
+
+SZ_DYNAMIC sz_size_t sz_utf8_count(sz_cptr_t text, sz_size_t length) {
+    _sz_dispatch_count(utf8_count, length);
+    return _sz_dispatch_load(sz_dispatch_table.utf8_count)(text, length);
+}
+
+SZ_DYNAMIC sz_size_t sz_utf8_to_utf32(sz_cptr_t text, sz_size_t length, sz_rune_t *runes) {
+    _sz_dispatch_count(utf8_to_utf32, length);
+    return _sz_dispatch_load(sz_dispatch_table.utf8_to_utf32)(text, length, runes);
+}
+
+SZ_DYNAMIC sz_cptr_t sz_utf8_find_nth(sz_cptr_t text, sz_size_t length, sz_size_t n) {
+    _sz_dispatch_count(utf8_find_nth, length);
+    return _sz_dispatch_load(sz_dispatch_table.utf8_find_nth)(text, length, n);
+}
 
 SZ_DYNAMIC sz_bool_t sz_equal(sz_cptr_t a, sz_cptr_t b, sz_size_t length) {
-    return sz_dispatch_table.equal(a, b, length);
+    _sz_dispatch_count(equal, length);
+    return _sz_dispatch_load(sz_dispatch_table.equal)(a, b, length);
 }
 
 SZ_DYNAMIC sz_ordering_t sz_order(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length) {
-    return sz_dispatch_table.order(a, a_length, b, b_length);
+    _sz_dispatch_count(order, a_length + b_length);
+    return _sz_dispatch_load(sz_dispatch_table.order)(a, a_length, b, b_length);
 }
 
 SZ_DYNAMIC void sz_copy(sz_ptr_t target, sz_cptr_t source, sz_size_t length) {
-    sz_dispatch_table.copy(target, source, length);
+    _sz_dispatch_count(copy, length);
+    _sz_dispatch_load(sz_dispatch_table.copy)(target, source, length);
 }
 
 SZ_DYNAMIC void sz_move(sz_ptr_t target, sz_cptr_t source, sz_size_t length) {
-    sz_dispatch_table.move(target, source, length);
+    _sz_dispatch_count(move, length);
+    _sz_dispatch_load(sz_dispatch_table.move)(target, source, length);
 }
 
 SZ_DYNAMIC void sz_fill(sz_ptr_t target, sz_size_t length, sz_u8_t value) {
-    sz_dispatch_table.fill(target, length, value);
+    _sz_dispatch_count(fill, length);
+    _sz_dispatch_load(sz_dispatch_table.fill)(target, length, value);
 }
 
 SZ_DYNAMIC void sz_look_up_transform(sz_cptr_t source, sz_size_t length, sz_cptr_t lut, sz_ptr_t target) {
-    sz_dispatch_table.look_up_transform(source, length, lut, target);
+    _sz_dispatch_count(look_up_transform, length);
+    _sz_dispatch_load(sz_dispatch_table.look_up_transform)(source, length, lut, target);
+}
+
+SZ_DYNAMIC void sz_tolower(sz_cptr_t text, sz_size_t length, sz_ptr_t result) {
+    _sz_dispatch_count(look_up_transform, length);
+    _sz_dispatch_load(sz_dispatch_table.look_up_transform)(text, length, (sz_cptr_t)_sz_lut_lowered, result);
+}
+
+SZ_DYNAMIC void sz_toupper(sz_cptr_t text, sz_size_t length, sz_ptr_t result) {
+    _sz_dispatch_count(look_up_transform, length);
+    _sz_dispatch_load(sz_dispatch_table.look_up_transform)(text, length, (sz_cptr_t)_sz_lut_upped, result);
+}
+
+SZ_DYNAMIC void sz_toascii(sz_cptr_t text, sz_size_t length, sz_ptr_t result) {
+    _sz_dispatch_count(look_up_transform, length);
+    _sz_dispatch_load(sz_dispatch_table.look_up_transform)(text, length, (sz_cptr_t)_sz_lut_ascii, result);
 }
 
 SZ_DYNAMIC sz_cptr_t sz_find_byte(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle) {
-    return sz_dispatch_table.find_byte(haystack, h_length, needle);
+    _sz_dispatch_count(find_byte, h_length);
+    return _sz_dispatch_load(sz_dispatch_table.find_byte)(haystack, h_length, needle);
 }
 
 SZ_DYNAMIC sz_cptr_t sz_rfind_byte(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle) {
-    return sz_dispatch_table.rfind_byte(haystack, h_length, needle);
+    _sz_dispatch_count(rfind_byte, h_length);
+    return _sz_dispatch_load(sz_dispatch_table.rfind_byte)(haystack, h_length, needle);
 }
 
 SZ_DYNAMIC sz_cptr_t sz_find(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length) {
-    return sz_dispatch_table.find(haystack, h_length, needle, n_length);
+    _sz_dispatch_count(find, h_length);
+    return _sz_dispatch_load(sz_dispatch_table.find)(haystack, h_length, needle, n_length);
 }
 
 SZ_DYNAMIC sz_cptr_t sz_rfind(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length) {
-    return sz_dispatch_table.rfind(haystack, h_length, needle, n_length);
+    _sz_dispatch_count(rfind, h_length);
+    return _sz_dispatch_load(sz_dispatch_table.rfind)(haystack, h_length, needle, n_length);
+}
+
+SZ_DYNAMIC sz_cptr_t sz_find_caseless(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length) {
+    _sz_dispatch_count(find_caseless, h_length);
+    return _sz_dispatch_load(sz_dispatch_table.find_caseless)(haystack, h_length, needle, n_length);
+}
+
+SZ_DYNAMIC sz_cptr_t sz_rfind_caseless(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length) {
+    _sz_dispatch_count(rfind_caseless, h_length);
+    return _sz_dispatch_load(sz_dispatch_table.rfind_caseless)(haystack, h_length, needle, n_length);
 }
 
 SZ_DYNAMIC sz_cptr_t sz_find_charset(sz_cptr_t text, sz_size_t length, sz_charset_t const *set) {
-    return sz_dispatch_table.find_from_set(text, length, set);
+    _sz_dispatch_count(find_from_set, length);
+    return _sz_dispatch_load(sz_dispatch_table.find_from_set)(text, length, set);
 }
 
 SZ_DYNAMIC sz_cptr_t sz_rfind_charset(sz_cptr_t text, sz_size_t length, sz_charset_t const *set) {
-    return sz_dispatch_table.rfind_from_set(text, length, set);
+    _sz_dispatch_count(rfind_from_set, length);
+    return _sz_dispatch_load(sz_dispatch_table.rfind_from_set)(text, length, set);
+}
+
+SZ_DYNAMIC sz_cptr_t sz_find_multi(sz_multi_matcher_t const *matcher, sz_cptr_t text, sz_size_t length,
+                                   sz_size_t *needle_index) {
+    _sz_dispatch_count(find_multi, length);
+    return _sz_dispatch_load(sz_dispatch_table.find_multi)(matcher, text, length, needle_index);
+}
+
+SZ_DYNAMIC sz_size_t sz_find_all(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length,
+                                 sz_bool_t allow_overlap, sz_size_t *offsets, sz_size_t capacity) {
+    _sz_dispatch_count(find_all, h_length);
+    return _sz_dispatch_load(sz_dispatch_table.find_all)(haystack, h_length, needle, n_length, allow_overlap, offsets, capacity);
+}
+
+SZ_DYNAMIC sz_size_t sz_find_all_charset(sz_cptr_t text, sz_size_t length, sz_charset_t const *set, sz_size_t *offsets,
+                                         sz_size_t capacity) {
+    _sz_dispatch_count(find_all_from_set, length);
+    return _sz_dispatch_load(sz_dispatch_table.find_all_from_set)(text, length, set, offsets, capacity);
+}
+
+SZ_DYNAMIC sz_size_t sz_count(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length,
+                              sz_bool_t allow_overlap) {
+    _sz_dispatch_count(find_all, h_length);
+    return _sz_dispatch_load(sz_dispatch_table.find_all)(haystack, h_length, needle, n_length, allow_overlap, SZ_NULL, SZ_SIZE_MAX);
 }
 
 SZ_DYNAMIC sz_size_t sz_hamming_distance( //
@@ -324,7 +668,14 @@ SZ_DYNAMIC sz_size_t sz_edit_distance( //
     sz_cptr_t a, sz_size_t a_length,   //
     sz_cptr_t b, sz_size_t b_length,   //
     sz_size_t bound, sz_memory_allocator_t *alloc) {
-    return sz_dispatch_table.edit_distance(a, a_length, b, b_length, bound, alloc);
+    _sz_dispatch_count(edit_distance, a_length + b_length);
+    return _sz_dispatch_load(sz_dispatch_table.edit_distance)(a, a_length, b, b_length, bound, alloc);
+}
+
+SZ_DYNAMIC sz_bool_t sz_edit_distances(sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates,
+                                       sz_size_t bound, sz_memory_allocator_t *alloc, sz_size_t *distances) {
+    _sz_dispatch_count(edit_distances, query_length);
+    return _sz_dispatch_load(sz_dispatch_table.edit_distances)(query, query_length, candidates, bound, alloc, distances);
 }
 
 SZ_DYNAMIC sz_size_t sz_edit_distance_utf8( //
@@ -337,12 +688,34 @@ SZ_DYNAMIC sz_size_t sz_edit_distance_utf8( //
 SZ_DYNAMIC sz_ssize_t sz_alignment_score(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length,
                                          sz_error_cost_t const *subs, sz_error_cost_t gap,
                                          sz_memory_allocator_t *alloc) {
-    return sz_dispatch_table.alignment_score(a, a_length, b, b_length, subs, gap, alloc);
+    _sz_dispatch_count(alignment_score, a_length + b_length);
+    return _sz_dispatch_load(sz_dispatch_table.alignment_score)(a, a_length, b, b_length, subs, gap, alloc);
+}
+
+SZ_DYNAMIC sz_ssize_t sz_local_alignment_score(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length,
+                                               sz_error_cost_t const *subs, sz_error_cost_t gap,
+                                               sz_memory_allocator_t *alloc) {
+    _sz_dispatch_count(local_alignment_score, a_length + b_length);
+    return _sz_dispatch_load(sz_dispatch_table.local_alignment_score)(a, a_length, b, b_length, subs, gap, alloc);
+}
+
+SZ_DYNAMIC sz_bool_t sz_alignment_scores(sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates,
+                                         sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local,
+                                         sz_memory_allocator_t *alloc, sz_ssize_t *scores) {
+    _sz_dispatch_count(alignment_scores, query_length);
+    return _sz_dispatch_load(sz_dispatch_table.alignment_scores)(query, query_length, candidates, subs, gap, local, alloc, scores);
+}
+
+SZ_DYNAMIC void sz_hashes_minhash(sz_cptr_t text, sz_size_t length, sz_size_t window_length, sz_size_t count, //
+                                  sz_u32_t *signatures) {
+    _sz_dispatch_count(hashes_minhash, length);
+    _sz_dispatch_load(sz_dispatch_table.hashes_minhash)(text, length, window_length, count, signatures);
 }
 
 SZ_DYNAMIC void sz_hashes(sz_cptr_t text, sz_size_t length, sz_size_t window_length, sz_size_t step, //
                           sz_hash_callback_t callback, void *callback_handle) {
-    sz_dispatch_table.hashes(text, length, window_length, step, callback, callback_handle);
+    _sz_dispatch_count(hashes, length);
+    _sz_dispatch_load(sz_dispatch_table.hashes)(text, length, window_length, step, callback, callback_handle);
 }
 
 SZ_DYNAMIC sz_cptr_t sz_find_char_from(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
@@ -390,6 +763,41 @@ SZ_DYNAMIC void sz_generate(sz_cptr_t alphabet, sz_size_t alphabet_size, sz_ptr_
     sz_generate_serial(alphabet, alphabet_size, result, result_length, generator, generator_user_data);
 }
 
+SZ_DYNAMIC sz_bool_t sz_memory_advise(sz_cptr_t start, sz_size_t length, sz_memory_advice_t advice) {
+    if (!start || !length) return sz_false_k;
+
+#if defined(_WIN32) && !defined(__CYGWIN__) && defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+    // Windows has no access-pattern hints for views, but since Windows 8 it can prefetch them.
+    if (advice != sz_memory_advice_willneed_k && advice != sz_memory_advice_sequential_k) return sz_false_k;
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = (PVOID)start;
+    range.NumberOfBytes = (SIZE_T)length;
+    return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) ? sz_true_k : sz_false_k;
+
+#elif !defined(_WIN32) && !defined(__CYGWIN__) && !SZ_AVOID_LIBC
+    int native_advice;
+    switch (advice) {
+    case sz_memory_advice_normal_k: native_advice = MADV_NORMAL; break;
+    case sz_memory_advice_sequential_k: native_advice = MADV_SEQUENTIAL; break;
+    case sz_memory_advice_random_k: native_advice = MADV_RANDOM; break;
+    case sz_memory_advice_willneed_k: native_advice = MADV_WILLNEED; break;
+#if defined(MADV_HUGEPAGE)
+    case sz_memory_advice_hugepages_k: native_advice = MADV_HUGEPAGE; break;
+#endif
+    default: return sz_false_k;
+    }
+    // The `madvise` requires a page-aligned start, so we extend the region backwards.
+    sz_size_t page_size = (sz_size_t)sysconf(_SC_PAGESIZE);
+    sz_size_t misalignment = (sz_size_t)start % page_size;
+    void *aligned_start = (void *)(start - misalignment);
+    return madvise(aligned_start, length + misalignment, native_advice) == 0 ? sz_true_k : sz_false_k;
+
+#else
+    sz_unused(advice);
+    return sz_false_k;
+#endif
+}
+
 // Provide overrides for the libc mem* functions
 #if SZ_OVERRIDE_LIBC && !(defined(__CYGWIN__))
 
@@ -36,6 +36,12 @@ def parse_arguments():
         help="Read input from the files specified by NUL-terminated names in file F;"
         " If F is - then read names from standard input",
     )
+    parser.add_argument(
+        "--threads",
+        type=int,
+        default=0,
+        help="number of threads to scan each file with, 0 for all cores",
+    )
 
     parser.add_argument("--version", action="version", version=stringzilla.__version__)
     return parser.parse_args()
@@ -54,21 +60,19 @@ def wc(file_path, args):
 
     counts = {}
     if args.lines:
-        counts["line_count"] = mapped_bytes.count("\n")
+        counts["line_count"] = mapped_bytes.count("\n", threads=args.threads)
     if args.words:
-        counts["word_count"] = mapped_bytes.count(" ") + 1
+        counts["word_count"] = mapped_bytes.count(" ", threads=args.threads) + 1
     if args.chars:
-        counts["char_count"] = mapped_bytes.__len__()
+        counts["char_count"] = mapped_bytes.utf8_count()
 
     if args.max_line_length:
-        max_line_length = max(len(line) for line in mapped_bytes.split("\n"))
+        lines = mapped_bytes.split("\n", threads=args.threads)
+        max_line_length = max(len(line) for line in lines)
         counts["max_line_length"] = max_line_length
 
     if args.bytes:
-        if args.chars:
-            counts["byte_count"] = counts["char_count"]
-        else:
-            counts["byte_count"] = mapped_bytes.__len__()
+        counts["byte_count"] = mapped_bytes.__len__()
 
     return counts, True
 
@@ -26,10 +26,25 @@ package sz
 // #cgo nocallback sz_find_char_from
 // #cgo noescape sz_rfind_char_from
 // #cgo nocallback sz_rfind_char_from
+// #cgo noescape sz_find_all
+// #cgo nocallback sz_find_all
+// #cgo noescape sz_count
+// #cgo nocallback sz_count
+// #cgo noescape sz_find_batch
+// #cgo nocallback sz_find_batch
+// #cgo noescape sz_count_batch
+// #cgo nocallback sz_count_batch
+// #cgo noescape sz_edit_distances
+// #cgo nocallback sz_edit_distances
+// #cgo nocallback sz_sequence_from_views
 // #define SZ_DYNAMIC_DISPATCH 1
 // #include <stringzilla/stringzilla.h>
 import "C"
-import "unsafe"
+import (
+	"errors"
+	"runtime"
+	"unsafe"
+)
 
 // Contains reports whether `substr` is within `str`.
 // https://pkg.go.dev/strings#Contains
@@ -171,3 +186,121 @@ func Count(str string, substr string, overlap bool) int64 {
 
 	return count
 }
+
+// IndexAll returns the indexes of all overlapping or non-overlapping instances of `substr` in `str`.
+// The offsets are exported in bulk, with just two calls into C, instead of one per match.
+// If `substr` is an empty string, returns an empty slice.
+func IndexAll(str string, substr string, overlap bool) []int64 {
+	strPtr := (*C.char)(unsafe.Pointer(unsafe.StringData(str)))
+	strLen := C.ulong(len(str))
+	substrPtr := (*C.char)(unsafe.Pointer(unsafe.StringData(substr)))
+	substrLen := C.ulong(len(substr))
+	overlapFlag := C.sz_bool_t(0)
+	if overlap {
+		overlapFlag = 1
+	}
+
+	count := C.sz_count(strPtr, strLen, substrPtr, substrLen, overlapFlag)
+	if count == 0 {
+		return []int64{}
+	}
+	offsets := make([]int64, count)
+	C.sz_find_all(strPtr, strLen, substrPtr, substrLen, overlapFlag, (*C.sz_size_t)(unsafe.Pointer(&offsets[0])), count)
+	return offsets
+}
+
+// Split slices `str` into all substrings separated by `sep`, without copying them.
+// If `sep` is an empty string, returns a slice with just the `str`, unlike `strings.Split`.
+// https://pkg.go.dev/strings#Split
+func Split(str string, sep string) []string {
+	separators := IndexAll(str, sep, false)
+	parts := make([]string, 0, len(separators)+1)
+	start := int64(0)
+	for _, offset := range separators {
+		parts = append(parts, str[start:offset])
+		start = offset + int64(len(sep))
+	}
+	return append(parts, str[start:])
+}
+
+// IndexBatch returns the index of the first instance of `substr` in every string of `strs`, in one call into C.
+// Each index is -1 if `substr` is not present in that string.
+func IndexBatch(strs []string, substr string) []int64 {
+	indexes := make([]int64, len(strs))
+	if len(strs) == 0 {
+		return indexes
+	}
+	substrPtr := (*C.char)(unsafe.Pointer(unsafe.StringData(substr)))
+	withSequence(strs, func(sequence *C.sz_sequence_t) {
+		C.sz_find_batch(sequence, substrPtr, C.ulong(len(substr)), (*C.sz_size_t)(unsafe.Pointer(&indexes[0])))
+	})
+	// The missing matches are reported as `SZ_SIZE_MAX`, which wraps around to -1
+	return indexes
+}
+
+// CountBatch returns the number of overlapping or non-overlapping instances of `substr` in every string of `strs`,
+// in one call into C. If `substr` is an empty string, the count for each non-empty string is 1 + its length,
+// like in `Count`.
+func CountBatch(strs []string, substr string, overlap bool) []int64 {
+	counts := make([]int64, len(strs))
+	if len(strs) == 0 {
+		return counts
+	}
+	if len(substr) == 0 {
+		for i, str := range strs {
+			if len(str) != 0 {
+				counts[i] = 1 + int64(len(str))
+			}
+		}
+		return counts
+	}
+	substrPtr := (*C.char)(unsafe.Pointer(unsafe.StringData(substr)))
+	overlapFlag := C.sz_bool_t(0)
+	if overlap {
+		overlapFlag = 1
+	}
+	withSequence(strs, func(sequence *C.sz_sequence_t) {
+		C.sz_count_batch(sequence, substrPtr, C.ulong(len(substr)), overlapFlag, (*C.sz_size_t)(unsafe.Pointer(&counts[0])))
+	})
+	return counts
+}
+
+// EditDistances returns the Levenshtein distances in bytes between the `query` and every string of `candidates`,
+// in one call into C. A non-zero `bound` caps the distances, allowing to exit early on dissimilar strings.
+func EditDistances(query string, candidates []string, bound uint64) ([]uint64, error) {
+	distances := make([]uint64, len(candidates))
+	if len(candidates) == 0 {
+		return distances, nil
+	}
+	queryPtr := (*C.char)(unsafe.Pointer(unsafe.StringData(query)))
+	success := C.sz_bool_t(0)
+	withSequence(candidates, func(sequence *C.sz_sequence_t) {
+		success = C.sz_edit_distances(queryPtr, C.ulong(len(query)), sequence, C.sz_size_t(bound), nil,
+			(*C.sz_size_t)(unsafe.Pointer(&distances[0])))
+	})
+	if success == 0 {
+		return nil, errors.New("sz: memory allocation failed")
+	}
+	return distances, nil
+}
+
+// withSequence exposes `strs` to C as a sequence of views, pinning the strings for the duration of `body`,
+// so that their pointers can be stored in the views, without copying the strings into C memory.
+func withSequence(strs []string, body func(sequence *C.sz_sequence_t)) {
+	var pinner runtime.Pinner
+	defer pinner.Unpin()
+	views := make([]C.sz_string_view_t, len(strs))
+	pinner.Pin(&views[0])
+	for i, str := range strs {
+		if len(str) == 0 {
+			continue
+		}
+		strPtr := unsafe.StringData(str)
+		pinner.Pin(strPtr)
+		views[i].start = (*C.char)(unsafe.Pointer(strPtr))
+		views[i].length = C.sz_size_t(len(str))
+	}
+	var sequence C.sz_sequence_t
+	C.sz_sequence_from_views(&views[0], C.sz_size_t(len(views)), &sequence)
+	body(&sequence)
+}
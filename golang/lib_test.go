@@ -1,6 +1,7 @@
 package sz_test
 
 import (
+	"slices"
 	"strings"
 	"testing"
 
@@ -167,3 +168,55 @@ func TestCount(t *testing.T) {
 		}
 	}
 }
+
+// TestIndexAll compares our binding's IndexAll and Split against repeated strings.Index calls and strings.Split.
+func TestIndexAll(t *testing.T) {
+	tests := []struct {
+		s, substr string
+		overlap   bool
+		want      []int64
+	}{
+		{"aaaaa", "aa", false, []int64{0, 2}},
+		{"aaaaa", "aa", true, []int64{0, 1, 2, 3}},
+		{"a,b,,c", ",", false, []int64{1, 3, 4}},
+		{"test", "z", false, []int64{}},
+		{"test", "", false, []int64{}},
+	}
+
+	for _, tt := range tests {
+		got := sz.IndexAll(tt.s, tt.substr, tt.overlap)
+		if !slices.Equal(got, tt.want) {
+			t.Errorf("IndexAll(%q, %q, %v) = %v, want %v", tt.s, tt.substr, tt.overlap, got, tt.want)
+		}
+	}
+
+	for _, s := range []string{"a,b,,c", ",", "", "abc", ",a,"} {
+		if got, want := sz.Split(s, ","), strings.Split(s, ","); !slices.Equal(got, want) {
+			t.Errorf("Split(%q, \",\") = %q, want %q", s, got, want)
+		}
+	}
+}
+
+// TestBatches verifies that the batched functions match the individual calls on every string.
+func TestBatches(t *testing.T) {
+	strs := []string{"", "test", "west east", strings.Repeat("0123456789", 1000) + "est", "aaaaa"}
+
+	for _, substr := range []string{"", "a", "est", "aa", "zzz"} {
+		indexes := sz.IndexBatch(strs, substr)
+		counts := sz.CountBatch(strs, substr, true)
+		for i, s := range strs {
+			if want := int64(strings.Index(s, substr)); indexes[i] != want {
+				t.Errorf("IndexBatch(..., %q)[%d] = %d, want %d", substr, i, indexes[i], want)
+			}
+			if want := sz.Count(s, substr, true); counts[i] != want {
+				t.Errorf("CountBatch(..., %q, true)[%d] = %d, want %d", substr, i, counts[i], want)
+			}
+		}
+	}
+
+	distances, err := sz.EditDistances("east", strs, 0)
+	want := []uint64{4, 2, 5, 10001, 4}
+	if err != nil || !slices.Equal(distances, want) {
+		t.Errorf("EditDistances(\"east\", ...) = %v, %v, want %v", distances, err, want)
+	}
+}
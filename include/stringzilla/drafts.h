@@ -599,353 +599,6 @@ SZ_PUBLIC sz_cptr_t sz_find_neon_too_smart(sz_cptr_t h, sz_size_t h_length, sz_c
     return sz_find_serial(h, h_length, n, n_length);
 }
 
-SZ_INTERNAL void interleave_uint32x4_to_uint64x2(uint32x4_t in_low, uint32x4_t in_high, uint64x2_t *out_first_second,
-                                                 uint64x2_t *out_third_fourth) {
-    // Interleave elements
-    uint32x4x2_t interleaved = vzipq_u32(in_low, in_high);
-
-    // The results are now in two uint32x4_t vectors, which we need to cast to uint64x2_t
-    *out_first_second = vreinterpretq_u64_u32(interleaved.val[0]);
-    *out_third_fourth = vreinterpretq_u64_u32(interleaved.val[1]);
-}
-
-/*  Arm NEON has several very relevant extensions for 32-bit FMA we can use for rolling hashes:
- *  * vmlaq_u32 - vector "fused-multiply-add"
- *  * vmlaq_n_u32 - vector-scalar "fused-multiply-add"
- *  * vmlsq_u32 - vector "fused-multiply-subtract"
- *  * vmlsq_n_u32 - vector-scalar "fused-multiply-subtract"
- *  Other basic intrinsics worth remembering:
- *  * vbslq_u32 - bitwise select to avoid branching
- *  * vld1q_dup_u32 - broadcast a 32-bit word into all 4 lanes of a 128-bit register
- */
-
-SZ_PUBLIC void sz_hashes_neon_naive(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t step, //
-                                    sz_hash_callback_t callback, void *callback_handle) {
-
-    if (length < window_length || !window_length) return;
-    if (length < 2 * window_length) {
-        sz_hashes_serial(start, length, window_length, step, callback, callback_handle);
-        return;
-    }
-
-    // Using NEON, we can perform 4 integer multiplications and additions within one register.
-    // So let's slice the entire string into 4 overlapping windows, to slide over them in parallel.
-    sz_u8_t const *text = (sz_u8_t const *)start;
-    sz_u8_t const *text_end = text + length;
-
-    // Prepare the `prime ^ window_length` values, that we are going to use for modulo arithmetic.
-    sz_u32_t prime_power_low = 1, prime_power_high = 1;
-    for (sz_size_t i = 0; i + 1 < window_length; ++i)
-        prime_power_low = (prime_power_low * 31ull) % SZ_U32_MAX_PRIME,
-        prime_power_high = (prime_power_high * 257ull) % SZ_U32_MAX_PRIME;
-
-    sz_u128_vec_t hash_low_vec, hash_high_vec, hash_mix01_vec, hash_mix23_vec;
-    uint8_t high_shift = 77u;
-    uint32_t prime = SZ_U32_MAX_PRIME;
-
-    sz_u128_vec_t chars_outgoing_vec, chars_incoming_vec, chars_outgoing_shifted_vec, chars_incoming_shifted_vec;
-    // Let's skip the first window, as we are going to compute it in the loop.
-    sz_size_t cycles = 0;
-    sz_size_t step_mask = step - 1;
-    sz_u32_t one = 1;
-
-    // In every iteration we process 4 consecutive sliding windows.
-    // Once each of them computes separate values, we step forward (W-1) times,
-    // computing all interleaving values. That way the byte spilled from the second
-    // hash, can be added to the first one. That way we minimize the number of separate loads.
-    for (; text + window_length * 4 + (window_length - 1) <= text_end; text += window_length * 4) {
-        hash_low_vec.u32x4 = vld1q_dup_u32(&one);
-        hash_high_vec.u32x4 = vld1q_dup_u32(&one);
-        for (sz_size_t i = 0; i != window_length; ++i) {
-            chars_incoming_vec.u32s[0] = *(uint8_t const *)(text + window_length * 0 + i);
-            chars_incoming_vec.u32s[1] = *(uint8_t const *)(text + window_length * 1 + i);
-            chars_incoming_vec.u32s[2] = *(uint8_t const *)(text + window_length * 2 + i);
-            chars_incoming_vec.u32s[3] = *(uint8_t const *)(text + window_length * 3 + i);
-            chars_incoming_shifted_vec.u8x16 = vaddq_u8(chars_incoming_vec.u8x16, vld1q_dup_u8(&high_shift));
-
-            // Append new data.
-            hash_low_vec.u32x4 = vmlaq_n_u32(chars_incoming_vec.u32x4, hash_low_vec.u32x4, 31u);
-            hash_high_vec.u32x4 = vmlaq_n_u32(chars_incoming_shifted_vec.u32x4, hash_high_vec.u32x4, 257u);
-            hash_low_vec.u32x4 = vbslq_u32(hash_low_vec.u32x4, vsubq_u32(hash_low_vec.u32x4, vld1q_dup_u32(&prime)),
-                                           vcgtq_u32(hash_low_vec.u32x4, vld1q_dup_u32(&prime)));
-            hash_high_vec.u32x4 = vbslq_u32(hash_high_vec.u32x4, vsubq_u32(hash_high_vec.u32x4, vld1q_dup_u32(&prime)),
-                                            vcgtq_u32(hash_high_vec.u32x4, vld1q_dup_u32(&prime)));
-        }
-
-        if ((cycles & step_mask) == 0) {
-            interleave_uint32x4_to_uint64x2(hash_low_vec.u32x4, hash_high_vec.u32x4, &hash_mix01_vec.u64x2,
-                                            &hash_mix23_vec.u64x2);
-            callback((sz_cptr_t)(text + window_length * 0), window_length, hash_mix01_vec.u64s[0], callback_handle);
-            callback((sz_cptr_t)(text + window_length * 1), window_length, hash_mix01_vec.u64s[1], callback_handle);
-            callback((sz_cptr_t)(text + window_length * 2), window_length, hash_mix23_vec.u64s[0], callback_handle);
-            callback((sz_cptr_t)(text + window_length * 3), window_length, hash_mix23_vec.u64s[1], callback_handle);
-        }
-        ++cycles;
-
-        for (sz_size_t i = 0; i + 1 != window_length; ++i, ++cycles) {
-            // Now, to compute 4 hashes per iteration, instead of loading 8 separate bytes (4 incoming and 4 outgoing)
-            // we can limit ourselves to only 5 values, 3 of which will be reused for both append and erase operations.
-            chars_outgoing_vec.u32s[0] = *(uint8_t const *)(text + window_length * 0 + i);
-            chars_outgoing_vec.u32s[1] = chars_incoming_vec.u32s[0] = *(uint8_t const *)(text + window_length * 1 + i);
-            chars_outgoing_vec.u32s[2] = chars_incoming_vec.u32s[1] = *(uint8_t const *)(text + window_length * 2 + i);
-            chars_outgoing_vec.u32s[3] = chars_incoming_vec.u32s[2] = *(uint8_t const *)(text + window_length * 3 + i);
-            chars_incoming_vec.u32s[3] = *(uint8_t const *)(text + window_length * 4 + i);
-            chars_incoming_shifted_vec.u8x16 = vaddq_u8(chars_incoming_vec.u8x16, vld1q_dup_u8(&high_shift));
-            chars_outgoing_shifted_vec.u8x16 = vaddq_u8(chars_outgoing_vec.u8x16, vld1q_dup_u8(&high_shift));
-
-            // Drop old data.
-            hash_low_vec.u32x4 = vmlsq_n_u32(hash_low_vec.u32x4, chars_outgoing_vec.u32x4, prime_power_low);
-            hash_high_vec.u32x4 = vmlsq_n_u32(hash_high_vec.u32x4, chars_outgoing_shifted_vec.u32x4, prime_power_high);
-
-            // Append new data.
-            hash_low_vec.u32x4 = vmlaq_n_u32(chars_incoming_vec.u32x4, hash_low_vec.u32x4, 31u);
-            hash_high_vec.u32x4 = vmlaq_n_u32(chars_incoming_shifted_vec.u32x4, hash_high_vec.u32x4, 257u);
-            hash_low_vec.u32x4 = vbslq_u32(hash_low_vec.u32x4, vsubq_u32(hash_low_vec.u32x4, vld1q_dup_u32(&prime)),
-                                           vcgtq_u32(hash_low_vec.u32x4, vld1q_dup_u32(&prime)));
-            hash_high_vec.u32x4 = vbslq_u32(hash_high_vec.u32x4, vsubq_u32(hash_high_vec.u32x4, vld1q_dup_u32(&prime)),
-                                            vcgtq_u32(hash_high_vec.u32x4, vld1q_dup_u32(&prime)));
-            // Mix and call the user if needed
-            if ((cycles & step_mask) == 0) {
-                interleave_uint32x4_to_uint64x2(hash_low_vec.u32x4, hash_high_vec.u32x4, &hash_mix01_vec.u64x2,
-                                                &hash_mix23_vec.u64x2);
-                callback((sz_cptr_t)(text + window_length * 0), window_length, hash_mix01_vec.u64s[0], callback_handle);
-                callback((sz_cptr_t)(text + window_length * 1), window_length, hash_mix01_vec.u64s[1], callback_handle);
-                callback((sz_cptr_t)(text + window_length * 2), window_length, hash_mix23_vec.u64s[0], callback_handle);
-                callback((sz_cptr_t)(text + window_length * 3), window_length, hash_mix23_vec.u64s[1], callback_handle);
-            }
-        }
-    }
-}
-
-SZ_PUBLIC void sz_hashes_neon_reusing_loads(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t step,
-                                            sz_hash_callback_t callback, void *callback_handle) {
-
-    if (length < window_length || !window_length) return;
-    if (length < 2 * window_length) {
-        sz_hashes_serial(start, length, window_length, step, callback, callback_handle);
-        return;
-    }
-
-    // Using NEON, we can perform 4 integer multiplications and additions within one register.
-    // So let's slice the entire string into 4 overlapping windows, to slide over them in parallel.
-    sz_u8_t const *text = (sz_u8_t const *)start;
-    sz_u8_t const *text_end = text + length;
-
-    // Prepare the `prime ^ window_length` values, that we are going to use for modulo arithmetic.
-    sz_u32_t prime_power_low = 1, prime_power_high = 1;
-    for (sz_size_t i = 0; i + 1 < window_length; ++i)
-        prime_power_low = (prime_power_low * 31ull) % SZ_U32_MAX_PRIME,
-        prime_power_high = (prime_power_high * 257ull) % SZ_U32_MAX_PRIME;
-
-    sz_u128_vec_t hash_low_vec, hash_high_vec, hash_mix01_vec, hash_mix23_vec;
-    uint8_t high_shift = 77u;
-    uint32_t prime = SZ_U32_MAX_PRIME;
-
-    sz_u128_vec_t chars_outgoing_vec, chars_incoming_vec, chars_outgoing_shifted_vec, chars_incoming_shifted_vec;
-    // Let's skip the first window, as we are going to compute it in the loop.
-    sz_size_t cycles = 0;
-    sz_size_t const step_mask = step - 1;
-    sz_u32_t const one = 1;
-
-    // In every iteration we process 4 consecutive sliding windows.
-    // Once each of them computes separate values, we step forward (W-1) times,
-    // computing all interleaving values. That way the byte spilled from the second
-    // hash, can be added to the first one. That way we minimize the number of separate loads.
-    for (; text + window_length * 4 + (window_length - 1) <= text_end; text += window_length * 4) {
-        hash_low_vec.u32x4 = vld1q_dup_u32(&one);
-        hash_high_vec.u32x4 = vld1q_dup_u32(&one);
-        for (sz_size_t i = 0; i != window_length; ++i) {
-            chars_incoming_vec.u32s[0] = *(uint8_t const *)(text + window_length * 0 + i);
-            chars_incoming_vec.u32s[1] = *(uint8_t const *)(text + window_length * 1 + i);
-            chars_incoming_vec.u32s[2] = *(uint8_t const *)(text + window_length * 2 + i);
-            chars_incoming_vec.u32s[3] = *(uint8_t const *)(text + window_length * 3 + i);
-            chars_incoming_shifted_vec.u8x16 = vaddq_u8(chars_incoming_vec.u8x16, vld1q_dup_u8(&high_shift));
-
-            // Append new data.
-            hash_low_vec.u32x4 = vmlaq_n_u32(chars_incoming_vec.u32x4, hash_low_vec.u32x4, 31u);
-            hash_high_vec.u32x4 = vmlaq_n_u32(chars_incoming_shifted_vec.u32x4, hash_high_vec.u32x4, 257u);
-            hash_low_vec.u32x4 = vbslq_u32(hash_low_vec.u32x4, vsubq_u32(hash_low_vec.u32x4, vld1q_dup_u32(&prime)),
-                                           vcgtq_u32(hash_low_vec.u32x4, vld1q_dup_u32(&prime)));
-            hash_high_vec.u32x4 = vbslq_u32(hash_high_vec.u32x4, vsubq_u32(hash_high_vec.u32x4, vld1q_dup_u32(&prime)),
-                                            vcgtq_u32(hash_high_vec.u32x4, vld1q_dup_u32(&prime)));
-        }
-
-        if ((cycles & step_mask) == 0) {
-            interleave_uint32x4_to_uint64x2(hash_low_vec.u32x4, hash_high_vec.u32x4, &hash_mix01_vec.u64x2,
-                                            &hash_mix23_vec.u64x2);
-            callback((sz_cptr_t)(text + window_length * 0), window_length, hash_mix01_vec.u64s[0], callback_handle);
-            callback((sz_cptr_t)(text + window_length * 1), window_length, hash_mix01_vec.u64s[1], callback_handle);
-            callback((sz_cptr_t)(text + window_length * 2), window_length, hash_mix23_vec.u64s[0], callback_handle);
-            callback((sz_cptr_t)(text + window_length * 3), window_length, hash_mix23_vec.u64s[1], callback_handle);
-        }
-        ++cycles;
-
-        for (sz_size_t i = 0; i + 1 != window_length; ++i, ++cycles) {
-            // Now, to compute 4 hashes per iteration, instead of loading 8 separate bytes (4 incoming and 4 outgoing)
-            // we can limit ourselves to only 5 values, 3 of which will be reused for both append and erase operations.
-            // Vectorizing these loads is a huge opportunity for performance optimizations, but naive prefetching
-            // into the register just makes things worse.
-            chars_outgoing_vec.u32s[0] = *(uint8_t const *)(text + window_length * 0 + i);
-            chars_outgoing_vec.u32s[1] = chars_incoming_vec.u32s[0] = *(uint8_t const *)(text + window_length * 1 + i);
-            chars_outgoing_vec.u32s[2] = chars_incoming_vec.u32s[1] = *(uint8_t const *)(text + window_length * 2 + i);
-            chars_outgoing_vec.u32s[3] = chars_incoming_vec.u32s[2] = *(uint8_t const *)(text + window_length * 3 + i);
-            chars_incoming_vec.u32s[3] = *(uint8_t const *)(text + window_length * 4 + i);
-            chars_incoming_shifted_vec.u8x16 = vaddq_u8(chars_incoming_vec.u8x16, vld1q_dup_u8(&high_shift));
-            chars_outgoing_shifted_vec.u8x16 = vaddq_u8(chars_outgoing_vec.u8x16, vld1q_dup_u8(&high_shift));
-
-            // Drop old data.
-            hash_low_vec.u32x4 = vmlsq_n_u32(hash_low_vec.u32x4, chars_outgoing_vec.u32x4, prime_power_low);
-            hash_high_vec.u32x4 = vmlsq_n_u32(hash_high_vec.u32x4, chars_outgoing_shifted_vec.u32x4, prime_power_high);
-
-            // Append new data.
-            hash_low_vec.u32x4 = vmlaq_n_u32(chars_incoming_vec.u32x4, hash_low_vec.u32x4, 31u);
-            hash_high_vec.u32x4 = vmlaq_n_u32(chars_incoming_shifted_vec.u32x4, hash_high_vec.u32x4, 257u);
-            hash_low_vec.u32x4 = vbslq_u32(hash_low_vec.u32x4, vsubq_u32(hash_low_vec.u32x4, vld1q_dup_u32(&prime)),
-                                           vcgtq_u32(hash_low_vec.u32x4, vld1q_dup_u32(&prime)));
-            hash_high_vec.u32x4 = vbslq_u32(hash_high_vec.u32x4, vsubq_u32(hash_high_vec.u32x4, vld1q_dup_u32(&prime)),
-                                            vcgtq_u32(hash_high_vec.u32x4, vld1q_dup_u32(&prime)));
-
-            // Mix and call the user if needed
-            if ((cycles & step_mask) == 0) {
-                interleave_uint32x4_to_uint64x2(hash_low_vec.u32x4, hash_high_vec.u32x4, &hash_mix01_vec.u64x2,
-                                                &hash_mix23_vec.u64x2);
-                callback((sz_cptr_t)(text + window_length * 0), window_length, hash_mix01_vec.u64s[0], callback_handle);
-                callback((sz_cptr_t)(text + window_length * 1), window_length, hash_mix01_vec.u64s[1], callback_handle);
-                callback((sz_cptr_t)(text + window_length * 2), window_length, hash_mix23_vec.u64s[0], callback_handle);
-                callback((sz_cptr_t)(text + window_length * 3), window_length, hash_mix23_vec.u64s[1], callback_handle);
-            }
-        }
-    }
-}
-
-SZ_PUBLIC void sz_hashes_neon_readahead(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t step,
-                                        sz_hash_callback_t callback, void *callback_handle) {
-
-    if (length < window_length || !window_length) return;
-    if (length < 2 * window_length) {
-        sz_hashes_serial(start, length, window_length, step, callback, callback_handle);
-        return;
-    }
-
-    // Using NEON, we can perform 4 integer multiplications and additions within one register.
-    // So let's slice the entire string into 4 overlapping windows, to slide over them in parallel.
-    sz_u8_t const *text = (sz_u8_t const *)start;
-    sz_u8_t const *text_end = text + length;
-
-    // Prepare the `prime ^ window_length` values, that we are going to use for modulo arithmetic.
-    sz_u32_t prime_power_low = 1, prime_power_high = 1;
-    for (sz_size_t i = 0; i + 1 < window_length; ++i)
-        prime_power_low = (prime_power_low * 31ull) % SZ_U32_MAX_PRIME,
-        prime_power_high = (prime_power_high * 257ull) % SZ_U32_MAX_PRIME;
-
-    sz_u128_vec_t hash_low_vec, hash_high_vec, hash_mix01_vec, hash_mix23_vec;
-    uint8_t high_shift = 77u;
-    uint32_t prime = SZ_U32_MAX_PRIME;
-
-    /// Primary buffers containing four upcasted characters as uint32_t values.
-    sz_u128_vec_t chars_outgoing_low_vec, chars_incoming_low_vec;
-    sz_u128_vec_t chars_outgoing_high_vec, chars_incoming_high_vec;
-    // Let's skip the first window, as we are going to compute it in the loop.
-    sz_size_t cycles = 0;
-    sz_size_t const step_mask = step - 1;
-    sz_u32_t const one = 1;
-
-    // In every iteration we process 4 consecutive sliding windows.
-    // Once each of them computes separate values, we step forward (W-1) times,
-    // computing all interleaving values. That way the byte spilled from the second
-    // hash, can be added to the first one. That way we minimize the number of separate loads.
-    sz_size_t read_ahead_length = window_length - 1 + 16; // TODO: Instead of +16 round up to 16 multiple
-    for (; text + window_length * 4 + read_ahead_length <= text_end; text += window_length * 4) {
-        hash_low_vec.u32x4 = vld1q_dup_u32(&one);
-        hash_high_vec.u32x4 = vld1q_dup_u32(&one);
-
-        for (sz_size_t i = 0; i < window_length;) {
-            sz_u128_vec_t chars_readahead_vec[4];
-            chars_readahead_vec[0].u8x16 = vld1q_u8(text + window_length * 0 + i);
-            chars_readahead_vec[1].u8x16 = vld1q_u8(text + window_length * 1 + i);
-            chars_readahead_vec[2].u8x16 = vld1q_u8(text + window_length * 2 + i);
-            chars_readahead_vec[3].u8x16 = vld1q_u8(text + window_length * 3 + i);
-
-            for (; i != window_length; ++i) {
-                chars_incoming_low_vec.u32s[0] = chars_readahead_vec[0].u8x16[i];
-                chars_incoming_low_vec.u32s[1] = chars_readahead_vec[1].u8x16[i];
-                chars_incoming_low_vec.u32s[2] = chars_readahead_vec[2].u8x16[i];
-                chars_incoming_low_vec.u32s[3] = chars_readahead_vec[3].u8x16[i];
-                chars_incoming_high_vec.u8x16 = vaddq_u8(chars_incoming_low_vec.u8x16, vld1q_dup_u8(&high_shift));
-
-                // Append new data.
-                hash_low_vec.u32x4 = vmlaq_n_u32(chars_incoming_low_vec.u32x4, hash_low_vec.u32x4, 31u);
-                hash_high_vec.u32x4 = vmlaq_n_u32(chars_incoming_high_vec.u32x4, hash_high_vec.u32x4, 257u);
-                hash_low_vec.u32x4 = vbslq_u32(hash_low_vec.u32x4, vsubq_u32(hash_low_vec.u32x4, vld1q_dup_u32(&prime)),
-                                               vcgtq_u32(hash_low_vec.u32x4, vld1q_dup_u32(&prime)));
-                hash_high_vec.u32x4 =
-                    vbslq_u32(hash_high_vec.u32x4, vsubq_u32(hash_high_vec.u32x4, vld1q_dup_u32(&prime)),
-                              vcgtq_u32(hash_high_vec.u32x4, vld1q_dup_u32(&prime)));
-            }
-        }
-
-        if ((cycles & step_mask) == 0) {
-            interleave_uint32x4_to_uint64x2(hash_low_vec.u32x4, hash_high_vec.u32x4, &hash_mix01_vec.u64x2,
-                                            &hash_mix23_vec.u64x2);
-            callback((sz_cptr_t)(text + window_length * 0), window_length, hash_mix01_vec.u64s[0], callback_handle);
-            callback((sz_cptr_t)(text + window_length * 1), window_length, hash_mix01_vec.u64s[1], callback_handle);
-            callback((sz_cptr_t)(text + window_length * 2), window_length, hash_mix23_vec.u64s[0], callback_handle);
-            callback((sz_cptr_t)(text + window_length * 3), window_length, hash_mix23_vec.u64s[1], callback_handle);
-        }
-        ++cycles;
-
-        for (sz_size_t i = 0; i + 1 < window_length; ++i, ++cycles) {
-            // Now, to compute 4 hashes per iteration, instead of loading 8 separate bytes (4 incoming and 4 outgoing)
-            // we can limit ourselves to only 5 values, 3 of which will be reused for both append and erase operations.
-            sz_u128_vec_t chars_readahead_vec[5];
-            chars_readahead_vec[0].u8x16 = vld1q_u8(text + window_length * 0 + i);
-            chars_readahead_vec[1].u8x16 = vld1q_u8(text + window_length * 1 + i);
-            chars_readahead_vec[2].u8x16 = vld1q_u8(text + window_length * 2 + i);
-            chars_readahead_vec[3].u8x16 = vld1q_u8(text + window_length * 3 + i);
-            chars_readahead_vec[4].u8x16 = vld1q_u8(text + window_length * 4 + i);
-
-            for (; i + 1 < window_length; ++i) {
-                // Transpose
-                chars_outgoing_low_vec.u32s[0] = chars_readahead_vec[0].u8x16[i];
-                chars_outgoing_low_vec.u32s[1] = chars_incoming_low_vec.u32s[0] = chars_readahead_vec[1].u8x16[i];
-                chars_outgoing_low_vec.u32s[2] = chars_incoming_low_vec.u32s[1] = chars_readahead_vec[2].u8x16[i];
-                chars_outgoing_low_vec.u32s[3] = chars_incoming_low_vec.u32s[2] = chars_readahead_vec[3].u8x16[i];
-                chars_incoming_low_vec.u32s[3] = chars_readahead_vec[4].u8x16[i];
-
-                chars_outgoing_high_vec.u8x16 = vaddq_u8(chars_outgoing_low_vec.u8x16, vld1q_dup_u8(&high_shift));
-                chars_incoming_high_vec.u8x16 = vaddq_u8(chars_incoming_low_vec.u8x16, vld1q_dup_u8(&high_shift));
-
-                // Drop old data.
-                hash_low_vec.u32x4 = vmlsq_n_u32(hash_low_vec.u32x4, chars_outgoing_low_vec.u32x4, prime_power_low);
-                hash_high_vec.u32x4 = vmlsq_n_u32(hash_high_vec.u32x4, chars_outgoing_high_vec.u32x4, prime_power_high);
-
-                // Append new data.
-                hash_low_vec.u32x4 = vmlaq_n_u32(chars_incoming_low_vec.u32x4, hash_low_vec.u32x4, 31u);
-                hash_high_vec.u32x4 = vmlaq_n_u32(chars_incoming_high_vec.u32x4, hash_high_vec.u32x4, 257u);
-                hash_low_vec.u32x4 = vbslq_u32(hash_low_vec.u32x4, vsubq_u32(hash_low_vec.u32x4, vld1q_dup_u32(&prime)),
-                                               vcgtq_u32(hash_low_vec.u32x4, vld1q_dup_u32(&prime)));
-                hash_high_vec.u32x4 =
-                    vbslq_u32(hash_high_vec.u32x4, vsubq_u32(hash_high_vec.u32x4, vld1q_dup_u32(&prime)),
-                              vcgtq_u32(hash_high_vec.u32x4, vld1q_dup_u32(&prime)));
-
-                // Mix and call the user if needed
-                if ((cycles & step_mask) == 0) {
-                    interleave_uint32x4_to_uint64x2(hash_low_vec.u32x4, hash_high_vec.u32x4, &hash_mix01_vec.u64x2,
-                                                    &hash_mix23_vec.u64x2);
-                    callback((sz_cptr_t)(text + window_length * 0), window_length, hash_mix01_vec.u64s[0],
-                             callback_handle);
-                    callback((sz_cptr_t)(text + window_length * 1), window_length, hash_mix01_vec.u64s[1],
-                             callback_handle);
-                    callback((sz_cptr_t)(text + window_length * 2), window_length, hash_mix23_vec.u64s[0],
-                             callback_handle);
-                    callback((sz_cptr_t)(text + window_length * 3), window_length, hash_mix23_vec.u64s[1],
-                             callback_handle);
-                }
-            }
-        }
-    }
-}
-
 #endif // SZ_USE_ARM_NEON
 
 #ifdef __cplusplus
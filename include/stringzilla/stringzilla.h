@@ -9,6 +9,8 @@
  *  - `SZ_DYNAMIC_DISPATCH=0` - whether to use runtime dispatching of the most advanced SIMD backend.
  *  - `SZ_USE_MISALIGNED_LOADS=0` - whether to use misaligned loads on platforms that support them.
  *  - `SZ_SWAR_THRESHOLD=24` - threshold for switching to SWAR backend over serial byte-level for-loops.
+ *  - `SZ_NON_TEMPORAL_THRESHOLD=2MB` - threshold for switching to cache-bypassing stores in `sz_copy`.
+ *  - `SZ_NON_TEMPORAL_FILL_THRESHOLD=32MB` - threshold for switching to cache-bypassing stores in `sz_fill`.
  *  - `SZ_USE_X86_AVX512=?` - whether to use AVX-512 instructions on x86_64.
  *  - `SZ_USE_X86_AVX2=?` - whether to use AVX2 instructions on x86_64.
  *  - `SZ_USE_ARM_NEON=?` - whether to use NEON instructions on ARM.
@@ -122,6 +124,25 @@
 #endif
 #endif
 
+/**
+ *  @brief  Threshold for switching to non-temporal "streaming" stores in `sz_copy` and `sz_move`.
+ *          Those bypass the cache hierarchy, which is slower for buffers that will be read again soon,
+ *          but avoids evicting the rest of the working set, when materializing huge outputs.
+ *          The default is the size of a per-core L2 cache, where they start winning in `bench_memory`.
+ */
+#ifndef SZ_NON_TEMPORAL_THRESHOLD
+#define SZ_NON_TEMPORAL_THRESHOLD (2ull * 1024ull * 1024ull) // 2 MB
+#endif
+
+/**
+ *  @brief  Threshold for switching to non-temporal "streaming" stores in `sz_fill`.
+ *          Regular stores without any loads keep up with the streaming ones until the buffer outgrows
+ *          a good part of the shared L3 cache, so the default is much higher than for copies.
+ */
+#ifndef SZ_NON_TEMPORAL_FILL_THRESHOLD
+#define SZ_NON_TEMPORAL_FILL_THRESHOLD (32ull * 1024ull * 1024ull) // 32 MB
+#endif
+
 /*  Annotation for the public API symbols:
  *
  *  - `SZ_PUBLIC` is used for functions that are part of the public API.
@@ -173,6 +194,7 @@ extern "C" {
 #include <stdint.h>           // `uint8_t`
 typedef int8_t sz_i8_t;       // Always 8 bits
 typedef uint8_t sz_u8_t;      // Always 8 bits
+typedef int16_t sz_i16_t;     // Always 16 bits
 typedef uint16_t sz_u16_t;    // Always 16 bits
 typedef int32_t sz_i32_t;     // Always 32 bits
 typedef uint32_t sz_u32_t;    // Always 32 bits
@@ -188,6 +210,7 @@ typedef ptrdiff_t sz_ssize_t; // Signed version of `sz_size_t`, 32 or 64 bits
 // ! That's why we don't define `sz_char_t` and generally use explicit `sz_i8_t` and `sz_u8_t`.
 typedef signed char sz_i8_t;         // Always 8 bits
 typedef unsigned char sz_u8_t;       // Always 8 bits
+typedef short sz_i16_t;              // Always 16 bits
 typedef unsigned short sz_u16_t;     // Always 16 bits
 typedef int sz_i32_t;                // Always 32 bits
 typedef unsigned int sz_u32_t;       // Always 32 bits
@@ -259,7 +282,7 @@ typedef enum sz_capability_t {
     sz_cap_any_k = 0x7FFFFFFF, /// Mask representing any capability
 
     sz_cap_arm_neon_k = 1 << 10, /// ARM NEON capability
-    sz_cap_arm_sve_k = 1 << 11,  /// ARM SVE capability TODO: Not yet supported or used
+    sz_cap_arm_sve_k = 1 << 11,  /// ARM SVE capability
 
     sz_cap_x86_avx2_k = 1 << 20,       /// x86 AVX2 capability
     sz_cap_x86_avx512f_k = 1 << 21,    /// x86 AVX512 F capability
@@ -278,6 +301,85 @@ typedef enum sz_capability_t {
  */
 SZ_DYNAMIC sz_capability_t sz_capabilities(void);
 
+/**
+ *  @brief  Parses a comma-separated list of backend names into a capabilities mask, where every name also implies
+ *          the backends it builds upon: "serial", "avx2", "avx512", "neon", "sve", or "any".
+ *          Same syntax as the `SZ_BACKEND` environment variable, checked by the dynamic library on startup.
+ *  @return Zero if the list is empty or contains unknown names.
+ */
+SZ_PUBLIC sz_capability_t sz_capabilities_from_names(sz_cptr_t names);
+
+#if SZ_DYNAMIC_DISPATCH
+
+/**
+ *  @brief  Re-populates the dispatch table of the dynamic library, only using the given subset of the capabilities,
+ *          detected at runtime. Handy when AVX-512 kernels are throttled on a specific CPU, or to compare backends.
+ *          Safe to call while other threads use the dispatched functions: each entry is swapped atomically from
+ *          its previous to its final kernel. Concurrent calls to `sz_dispatch_use` itself are not serialized.
+ *  @return The capabilities in use after the update, always including `sz_cap_serial_k`.
+ */
+SZ_DYNAMIC sz_capability_t sz_dispatch_use(sz_capability_t caps);
+
+/**
+ *  @brief  Capabilities the dispatch table of the dynamic library is currently populated with.
+ */
+SZ_DYNAMIC sz_capability_t sz_dispatch_capabilities(void);
+
+/**
+ *  @brief  Number of operations routed through the dispatch table, to be enumerated with `sz_dispatch_operation`,
+ *          `sz_dispatch_kernel`, and `sz_dispatch_stats`.
+ */
+SZ_DYNAMIC sz_size_t sz_dispatch_count(void);
+
+/**
+ *  @brief  Name of the dispatched operation at the given index, like "find", or NULL if out of range.
+ */
+SZ_DYNAMIC sz_cptr_t sz_dispatch_operation(sz_size_t index);
+
+/**
+ *  @brief  Name of the kernel currently serving the operation at the given index, like "sz_find_avx512".
+ */
+SZ_DYNAMIC sz_cptr_t sz_dispatch_kernel(sz_size_t index);
+
+/**
+ *  @brief  Reads the number of calls and input bytes of the operation at the given index. Only collected,
+ *          if the dynamic library is compiled with `SZ_ENABLE_STATS=1`. For binary operations the bytes
+ *          include both strings, and for batched ones - only the query.
+ *  @return `sz_false_k` if the statistics are disabled or the index is out of range.
+ */
+SZ_DYNAMIC sz_bool_t sz_dispatch_stats(sz_size_t index, sz_u64_t *calls, sz_u64_t *bytes);
+
+/**
+ *  @brief  Zeroes the counters of `sz_dispatch_stats`.
+ */
+SZ_DYNAMIC void sz_dispatch_stats_reset(void);
+
+#endif // SZ_DYNAMIC_DISPATCH
+
+/**
+ *  @brief  Expected access pattern for a memory region, typically a read-only file mapping.
+ *  @see    sz_memory_advise
+ */
+typedef enum sz_memory_advice_t {
+    sz_memory_advice_normal_k = 0,     /// Default OS heuristics
+    sz_memory_advice_sequential_k = 1, /// Aggressive read-ahead, pages can be dropped soon after use
+    sz_memory_advice_random_k = 2,     /// No read-ahead, for point lookups
+    sz_memory_advice_willneed_k = 3,   /// Asynchronously fault-in the region ahead of its use
+    sz_memory_advice_hugepages_k = 4,  /// Back the region with transparent huge pages, where supported
+} sz_memory_advice_t;
+
+#if SZ_DYNAMIC_DISPATCH
+
+/**
+ *  @brief  Forwards an access pattern hint for a memory region to the OS, using `madvise` on POSIX
+ *          and `PrefetchVirtualMemory` on Windows. The region start doesn't have to be page-aligned.
+ *          Only available in the dynamic library, as it depends on the OS APIs.
+ *  @return `sz_true_k` if the hint is supported on this platform and was accepted.
+ */
+SZ_DYNAMIC sz_bool_t sz_memory_advise(sz_cptr_t start, sz_size_t length, sz_memory_advice_t advice);
+
+#endif // SZ_DYNAMIC_DISPATCH
+
 /**
  *  @brief  Bit-set structure for 256 possible byte values. Useful for filtering and search.
  *  @see    sz_charset_init, sz_charset_add, sz_charset_contains, sz_charset_invert
@@ -326,7 +428,7 @@ typedef sz_u64_t (*sz_random_generator_t)(void *);
 /**
  *  @brief  Some complex pattern matching algorithms may require memory allocations.
  *          This structure is used to pass the memory allocator to those functions.
- *  @see    sz_memory_allocator_init_fixed
+ *  @see    sz_memory_allocator_init_fixed, sz_memory_allocator_init_arena
  */
 typedef struct sz_memory_allocator_t {
     sz_memory_allocate_t allocate;
@@ -353,6 +455,67 @@ SZ_PUBLIC void sz_memory_allocator_init_default(sz_memory_allocator_t *alloc);
  */
 SZ_PUBLIC void sz_memory_allocator_init_fixed(sz_memory_allocator_t *alloc, void *buffer, sz_size_t length);
 
+/**
+ *  @brief  Growable arena of memory chunks, borrowed from an upstream allocator.
+ *          Allocations are bump-pointer, and deallocations are no-ops, unless they release the most recent block.
+ *          All the memory is reclaimed at once with `sz_memory_arena_reset`, making it a good fit for per-request
+ *          scratch space, like the Levenshtein matrices or the buffers of temporary strings.
+ *          ! Not thread-safe, so use a separate arena per thread.
+ *  @see    sz_memory_arena_init, sz_memory_allocator_init_arena
+ */
+typedef struct sz_memory_arena_t {
+    sz_memory_allocator_t upstream; // Allocator for the chunks themselves.
+    void *chunk;                    // Most recent chunk, linked to the previous ones through its header.
+    sz_size_t chunk_capacity;       // Usable bytes in the most recent chunk.
+    sz_size_t chunk_used;           // Bytes consumed in the most recent chunk.
+    sz_size_t chunk_size;           // Minimum capacity of the next chunk, growing geometrically.
+    sz_size_t used_bytes;           // Bytes handed out since the last reset, including the alignment padding.
+    sz_size_t peak_bytes;           // Maximum of `used_bytes` over the lifetime of the arena.
+    sz_size_t chunks_count;         // Number of chunks currently held.
+} sz_memory_arena_t;
+
+/**
+ *  @brief  Initializes an empty arena. No memory is requested until the first allocation.
+ *
+ *  @param arena        Arena to initialize.
+ *  @param chunk_size   Capacity of the first chunk. Every next chunk is twice as large. Zero defaults to 4 KB.
+ *  @param upstream     Allocator for the chunks. If SZ_NULL, the system default `malloc` and `free` are used.
+ */
+SZ_PUBLIC void sz_memory_arena_init(sz_memory_arena_t *arena, sz_size_t chunk_size, sz_memory_allocator_t *upstream);
+
+/**
+ *  @brief  Allocates a 16-byte aligned block from the arena, requesting a new chunk from upstream if needed.
+ *  @return Pointer to the block, or SZ_NULL if the upstream allocator failed.
+ */
+SZ_PUBLIC void *sz_memory_arena_allocate(sz_memory_arena_t *arena, sz_size_t length);
+
+/**
+ *  @brief  Returns the block to the arena, if it was the most recent allocation. Otherwise, does nothing,
+ *          and the memory is only reclaimed on `sz_memory_arena_reset`.
+ */
+SZ_PUBLIC void sz_memory_arena_deallocate(sz_memory_arena_t *arena, void *start, sz_size_t length);
+
+/**
+ *  @brief  Invalidates all the allocations at once. Keeps the most recent (and largest) chunk for reuse,
+ *          returning the others to the upstream allocator.
+ */
+SZ_PUBLIC void sz_memory_arena_reset(sz_memory_arena_t *arena);
+
+/** @brief  Returns all the chunks to the upstream allocator. The arena can be reused afterwards. */
+SZ_PUBLIC void sz_memory_arena_free(sz_memory_arena_t *arena);
+
+/** @brief  Checks if the pointer belongs to one of the chunks, held by the arena. */
+SZ_PUBLIC sz_bool_t sz_memory_arena_owns(sz_memory_arena_t const *arena, void const *start);
+
+/**
+ *  @brief  Initializes a memory allocator to draw from an arena, so that it can be passed to any StringZilla
+ *          function, expecting a `sz_memory_allocator_t`. The arena must outlive the allocator.
+ *
+ *  @param alloc    Memory allocator to initialize.
+ *  @param arena    Initialized arena to allocate from.
+ */
+SZ_PUBLIC void sz_memory_allocator_init_arena(sz_memory_allocator_t *alloc, sz_memory_arena_t *arena);
+
 /**
  *  @brief  The number of bytes a stack-allocated string can hold, including the SZ_NULL termination character.
  *          ! This can't be changed from outside. Don't use the `#error` as it may already be included and set.
@@ -433,17 +596,18 @@ SZ_DYNAMIC sz_u64_t sz_checksum(sz_cptr_t text, sz_size_t length);
 SZ_PUBLIC sz_u64_t sz_checksum_serial(sz_cptr_t text, sz_size_t length);
 
 /**
- *  @brief  Computes the 64-bit unsigned hash of a string. Fairly fast for short strings,
- *          simple implementation, and supports rolling computation, reused in other APIs.
- *          Similar to `std::hash` in C++.
+ *  @brief  Computes the 64-bit unsigned hash of a string. Similar to `std::hash` in C++.
+ *          Strings up to 16 bytes are mixed as two words. Longer ones are split into 64-byte stripes,
+ *          accumulated in 8 independent lanes, multiplying the 32-bit halves of every word, like UMAC
+ *          and xxHash3. All backends produce identical results. Unlike `sz_hashes`, isn't rolling.
  *
  *  @param text     String to hash.
  *  @param length   Number of bytes in the text.
  *  @return         64-bit hash value.
  *
- *  @see    sz_hashes, sz_hashes_fingerprint, sz_hashes_intersection
+ *  @see    sz_hash_batch, sz_hashes, sz_hashes_fingerprint, sz_hashes_intersection
  */
-SZ_PUBLIC sz_u64_t sz_hash(sz_cptr_t text, sz_size_t length);
+SZ_DYNAMIC sz_u64_t sz_hash(sz_cptr_t text, sz_size_t length);
 
 /** @copydoc sz_hash */
 SZ_PUBLIC sz_u64_t sz_hash_serial(sz_cptr_t text, sz_size_t length);
@@ -509,11 +673,17 @@ SZ_PUBLIC void sz_look_up_transform_serial(sz_cptr_t text, sz_size_t length, sz_
  *  breaks for extended ASCII, so a different solution is needed.
  *  http://0x80.pl/notesen/2016-01-06-swar-swap-case.html
  *
+ *  Instead, a static 256-byte ISO-8859-1 (Latin-1) table is applied with ::sz_look_up_transform,
+ *  so the best available SIMD look-up kernel is used on every platform.
+ *
  *  @param text     String to be normalized.
  *  @param length   Number of bytes in the string.
- *  @param result   Output string, can point to the same address as ::text.
+ *  @param result   Output string, can point to the same address as ::text for in-place conversion.
  */
-SZ_PUBLIC void sz_tolower(sz_cptr_t text, sz_size_t length, sz_ptr_t result);
+SZ_DYNAMIC void sz_tolower(sz_cptr_t text, sz_size_t length, sz_ptr_t result);
+
+/** @copydoc sz_tolower */
+SZ_PUBLIC void sz_tolower_serial(sz_cptr_t text, sz_size_t length, sz_ptr_t result);
 
 /**
  *  @brief  Equivalent to `for (char & c : text) c = toupper(c)`.
@@ -524,20 +694,29 @@ SZ_PUBLIC void sz_tolower(sz_cptr_t text, sz_size_t length, sz_ptr_t result);
  *  breaks for extended ASCII, so a different solution is needed.
  *  http://0x80.pl/notesen/2016-01-06-swar-swap-case.html
  *
+ *  Instead, a static 256-byte ISO-8859-1 (Latin-1) table is applied with ::sz_look_up_transform,
+ *  so the best available SIMD look-up kernel is used on every platform.
+ *
  *  @param text     String to be normalized.
  *  @param length   Number of bytes in the string.
- *  @param result   Output string, can point to the same address as ::text.
+ *  @param result   Output string, can point to the same address as ::text for in-place conversion.
  */
-SZ_PUBLIC void sz_toupper(sz_cptr_t text, sz_size_t length, sz_ptr_t result);
+SZ_DYNAMIC void sz_toupper(sz_cptr_t text, sz_size_t length, sz_ptr_t result);
+
+/** @copydoc sz_toupper */
+SZ_PUBLIC void sz_toupper_serial(sz_cptr_t text, sz_size_t length, sz_ptr_t result);
 
 /**
- *  @brief  Equivalent to `for (char & c : text) c = toascii(c)`.
+ *  @brief  Equivalent to `for (char & c : text) c = toascii(c)`, clearing the top bit of every byte.
  *
  *  @param text     String to be normalized.
  *  @param length   Number of bytes in the string.
- *  @param result   Output string, can point to the same address as ::text.
+ *  @param result   Output string, can point to the same address as ::text for in-place conversion.
  */
-SZ_PUBLIC void sz_toascii(sz_cptr_t text, sz_size_t length, sz_ptr_t result);
+SZ_DYNAMIC void sz_toascii(sz_cptr_t text, sz_size_t length, sz_ptr_t result);
+
+/** @copydoc sz_toascii */
+SZ_PUBLIC void sz_toascii_serial(sz_cptr_t text, sz_size_t length, sz_ptr_t result);
 
 /**
  *  @brief  Checks if all characters in the range are valid ASCII characters.
@@ -572,6 +751,22 @@ SZ_DYNAMIC void sz_generate(sz_cptr_t alphabet, sz_size_t cardinality, sz_ptr_t
 SZ_PUBLIC void sz_generate_serial(sz_cptr_t alphabet, sz_size_t cardinality, sz_ptr_t text, sz_size_t length,
                                   sz_random_generator_t generate, void *generator);
 
+/**
+ *  @brief  Single unit of work, submitted by parallel algorithms to a user-supplied executor.
+ *
+ *  @param context      Opaque state of the parallel algorithm, shared between all tasks.
+ *  @param task_index   Index of the task in the `[0, tasks_count)` range.
+ */
+typedef void (*sz_parallel_task_t)(void *context, sz_size_t task_index);
+
+/**
+ *  @brief  User-supplied executor, like a thread-pool. Must call `task(context, i)` for every `i`
+ *          in `[0, tasks_count)`, in any order and on any threads, returning only once all of them are done.
+ *
+ *  @param executor     Opaque state of the executor itself, passed along with the callback.
+ */
+typedef void (*sz_parallel_for_t)(void *executor, sz_parallel_task_t task, void *context, sz_size_t tasks_count);
+
 /**
  *  @brief  Similar to `memcpy`, copies contents of one string into another.
  *          The behavior is undefined if the strings overlap.
@@ -614,6 +809,33 @@ SZ_PUBLIC void sz_fill_serial(sz_ptr_t target, sz_size_t length, sz_u8_t value);
 
 typedef void (*sz_fill_t)(sz_ptr_t, sz_size_t, sz_u8_t);
 
+/**
+ *  @brief  Parallel version of `sz_copy`, splitting huge buffers into cache-line-aligned chunks,
+ *          copied concurrently with the help of the user-supplied executor. Every chunk is large enough
+ *          to use streaming stores, so multiple cores can saturate the write bandwidth of the memory controllers.
+ *
+ *  @param target       String to copy into.
+ *  @param source       String to copy from.
+ *  @param length       Number of bytes to copy.
+ *  @param parallel_for Callback dispatching tasks, like a thread-pool. If NULL, falls back to `sz_copy`.
+ *  @param executor     Opaque state passed to the ::parallel_for callback.
+ */
+SZ_PUBLIC void sz_copy_parallel(sz_ptr_t target, sz_cptr_t source, sz_size_t length, //
+                                sz_parallel_for_t parallel_for, void *executor);
+
+/**
+ *  @brief  Parallel version of `sz_fill`, splitting huge buffers into cache-line-aligned chunks,
+ *          filled concurrently with the help of the user-supplied executor.
+ *
+ *  @param target       String to fill.
+ *  @param length       Number of bytes to fill.
+ *  @param value        Value to fill with.
+ *  @param parallel_for Callback dispatching tasks, like a thread-pool. If NULL, falls back to `sz_fill`.
+ *  @param executor     Opaque state passed to the ::parallel_for callback.
+ */
+SZ_PUBLIC void sz_fill_parallel(sz_ptr_t target, sz_size_t length, sz_u8_t value, //
+                                sz_parallel_for_t parallel_for, void *executor);
+
 /**
  *  @brief  Initializes a string class instance to an empty value.
  */
@@ -715,6 +937,83 @@ SZ_PUBLIC void sz_string_free(sz_string_t *string, sz_memory_allocator_t *alloca
 
 #pragma endregion
 
+#pragma region UTF8 API
+
+/**
+ *  @brief  Describes the length of a UTF8 character / codepoint / rune in bytes.
+ */
+typedef enum {
+    sz_utf8_invalid_k = 0,     //!< Invalid UTF8 character.
+    sz_utf8_rune_1byte_k = 1,  //!< 1-byte UTF8 character.
+    sz_utf8_rune_2bytes_k = 2, //!< 2-byte UTF8 character.
+    sz_utf8_rune_3bytes_k = 3, //!< 3-byte UTF8 character.
+    sz_utf8_rune_4bytes_k = 4, //!< 4-byte UTF8 character.
+} sz_rune_length_t;
+
+typedef sz_u32_t sz_rune_t;
+
+/**
+ *  @brief  Checks if the string is well-formed UTF8, rejecting stray and missing continuation bytes,
+ *          overlong encodings, UTF16 surrogates, and codepoints beyond U+10FFFF.
+ *
+ *  The vectorized backends implement the "lookup" algorithm by John Keiser and Daniel Lemire,
+ *  classifying every pair of consecutive bytes with three 16-entry nibble tables.
+ *  @see    https://arxiv.org/abs/2010.03090
+ *
+ *  @param text     String to be validated.
+ *  @param length   Number of bytes in the string.
+ *  @return         Whether the string is valid UTF8.
+ */
+SZ_DYNAMIC sz_bool_t sz_utf8_validate(sz_cptr_t text, sz_size_t length);
+
+/**
+ *  @brief  Counts the UTF8 codepoints in a string, equal to the number of bytes that are not continuation bytes.
+ *          For well-formed inputs, that's the number of runes. Corrupted inputs are counted consistently with
+ *          ::sz_utf8_to_utf32 and ::sz_utf8_find_nth, but the result isn't meaningful.
+ *
+ *  @param text     UTF8 string to be analyzed.
+ *  @param length   Number of bytes in the string.
+ *  @return         Number of runes in the string.
+ */
+SZ_DYNAMIC sz_size_t sz_utf8_count(sz_cptr_t text, sz_size_t length);
+
+/**
+ *  @brief  Decodes a UTF8 string into UTF32, one rune per non-continuation byte, assuming valid input.
+ *          Corrupted inputs never cause out-of-bounds reads, and decode identically on all backends.
+ *
+ *  @param text     UTF8 string to be decoded.
+ *  @param length   Number of bytes in the string.
+ *  @param runes    Output buffer, that must fit at least ::length runes, as all of them may be ASCII.
+ *  @return         Number of runes exported, equal to ::sz_utf8_count.
+ */
+SZ_DYNAMIC sz_size_t sz_utf8_to_utf32(sz_cptr_t text, sz_size_t length, sz_rune_t *runes);
+
+/**
+ *  @brief  Locates the first byte of the n-th rune in a UTF8 string, for codepoint-indexed slicing.
+ *
+ *  @param text     UTF8 string to be searched.
+ *  @param length   Number of bytes in the string.
+ *  @param n        Zero-based index of the rune.
+ *  @return         Address of the rune's first byte, or NULL if the string has fewer than `n + 1` runes.
+ */
+SZ_DYNAMIC sz_cptr_t sz_utf8_find_nth(sz_cptr_t text, sz_size_t length, sz_size_t n);
+
+/** @copydoc sz_utf8_validate */
+SZ_PUBLIC sz_bool_t sz_utf8_validate_serial(sz_cptr_t text, sz_size_t length);
+/** @copydoc sz_utf8_count */
+SZ_PUBLIC sz_size_t sz_utf8_count_serial(sz_cptr_t text, sz_size_t length);
+/** @copydoc sz_utf8_to_utf32 */
+SZ_PUBLIC sz_size_t sz_utf8_to_utf32_serial(sz_cptr_t text, sz_size_t length, sz_rune_t *runes);
+/** @copydoc sz_utf8_find_nth */
+SZ_PUBLIC sz_cptr_t sz_utf8_find_nth_serial(sz_cptr_t text, sz_size_t length, sz_size_t n);
+
+typedef sz_bool_t (*sz_utf8_validate_t)(sz_cptr_t, sz_size_t);
+typedef sz_size_t (*sz_utf8_count_t)(sz_cptr_t, sz_size_t);
+typedef sz_size_t (*sz_utf8_to_utf32_t)(sz_cptr_t, sz_size_t, sz_rune_t *);
+typedef sz_cptr_t (*sz_utf8_find_nth_t)(sz_cptr_t, sz_size_t, sz_size_t);
+
+#pragma endregion
+
 #pragma region Fast Substring Search API
 
 typedef sz_cptr_t (*sz_find_byte_t)(sz_cptr_t, sz_size_t, sz_cptr_t);
@@ -783,6 +1082,42 @@ SZ_DYNAMIC sz_cptr_t sz_rfind(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t
 /** @copydoc sz_rfind */
 SZ_PUBLIC sz_cptr_t sz_rfind_serial(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length);
 
+/**
+ *  @brief  Locates first matching substring, ignoring the case of ASCII letters.
+ *          Equivalent to `strcasestr(haystack, needle)` in LibC, but requires known length.
+ *
+ *  Only the 26 Latin letters are folded, every other byte must match exactly. That keeps the
+ *  search safe for UTF-8 inputs, and lets the SIMD kernels fold the haystack in-register,
+ *  without materializing a lowercase copy of it.
+ *
+ *  @param haystack Haystack - the string to search in.
+ *  @param h_length Number of bytes in the haystack.
+ *  @param needle   Needle - substring to find.
+ *  @param n_length Number of bytes in the needle.
+ *  @return         Address of the first match.
+ */
+SZ_DYNAMIC sz_cptr_t sz_find_caseless(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length);
+
+/** @copydoc sz_find_caseless */
+SZ_PUBLIC sz_cptr_t sz_find_caseless_serial(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle,
+                                            sz_size_t n_length);
+
+/**
+ *  @brief  Locates the last matching substring, ignoring the case of ASCII letters.
+ *  @see    sz_find_caseless
+ *
+ *  @param haystack Haystack - the string to search in.
+ *  @param h_length Number of bytes in the haystack.
+ *  @param needle   Needle - substring to find.
+ *  @param n_length Number of bytes in the needle.
+ *  @return         Address of the last match.
+ */
+SZ_DYNAMIC sz_cptr_t sz_rfind_caseless(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length);
+
+/** @copydoc sz_rfind_caseless */
+SZ_PUBLIC sz_cptr_t sz_rfind_caseless_serial(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle,
+                                             sz_size_t n_length);
+
 /**
  *  @brief  Finds the first character present from the ::set, present in ::text.
  *          Equivalent to `strspn(text, accepted)` and `strcspn(text, rejected)` in LibC.
@@ -823,6 +1158,265 @@ SZ_DYNAMIC sz_cptr_t sz_rfind_charset(sz_cptr_t text, sz_size_t length, sz_chars
 /** @copydoc sz_rfind_charset */
 SZ_PUBLIC sz_cptr_t sz_rfind_charset_serial(sz_cptr_t text, sz_size_t length, sz_charset_t const *set);
 
+/**
+ *  @brief  Locates all occurrences of the ::needle, exporting their offsets in bulk.
+ *          Unlike calling ::sz_find in a loop, the SIMD backends don't restart the search after every match,
+ *          and convert the bitmasks of matching positions straight into offsets.
+ *
+ *  If the ::offsets array is full, the search can be resumed from the byte after the last reported match,
+ *  or from the byte after its start, if overlaps are allowed.
+ *
+ *  @param haystack         Haystack - the string to search in.
+ *  @param h_length         Number of bytes in the haystack.
+ *  @param needle           Needle - substring to find.
+ *  @param n_length         Number of bytes in the needle.
+ *  @param allow_overlap    Whether the matches may overlap, like "aa" found twice in "aaa".
+ *                          Otherwise, the matches are greedy and non-overlapping, like in `str.count` in Python.
+ *  @param offsets          Output array for the offsets of matches from the start of the haystack.
+ *                          May be `NULL`, if only the number of matches is needed.
+ *  @param capacity         Maximum number of matches to report.
+ *  @return                 Number of reported matches, at most ::capacity.
+ */
+SZ_DYNAMIC sz_size_t sz_find_all(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length,
+                                 sz_bool_t allow_overlap, sz_size_t *offsets, sz_size_t capacity);
+
+/** @copydoc sz_find_all */
+SZ_PUBLIC sz_size_t sz_find_all_serial(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length,
+                                       sz_bool_t allow_overlap, sz_size_t *offsets, sz_size_t capacity);
+
+/**
+ *  @brief  Locates all characters from the ::set, present in ::text, exporting their offsets in bulk.
+ *  @see    sz_find_all, sz_find_charset
+ *
+ *  @param text     String to be scanned.
+ *  @param length   Number of bytes in the string.
+ *  @param set      Set of relevant characters.
+ *  @param offsets  Output array for the offsets of matching characters. May be `NULL` to only count them.
+ *  @param capacity Maximum number of matches to report.
+ *  @return         Number of reported matches, at most ::capacity.
+ */
+SZ_DYNAMIC sz_size_t sz_find_all_charset(sz_cptr_t text, sz_size_t length, sz_charset_t const *set, sz_size_t *offsets,
+                                         sz_size_t capacity);
+
+/** @copydoc sz_find_all_charset */
+SZ_PUBLIC sz_size_t sz_find_all_charset_serial(sz_cptr_t text, sz_size_t length, sz_charset_t const *set,
+                                               sz_size_t *offsets, sz_size_t capacity);
+
+/**
+ *  @brief  Counts the occurrences of the ::needle in the ::haystack, without exporting their offsets.
+ *          Equivalent to `sz_find_all(haystack, h_length, needle, n_length, allow_overlap, NULL, SZ_SIZE_MAX)`.
+ *  @see    sz_find_all
+ */
+SZ_DYNAMIC sz_size_t sz_count(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length,
+                              sz_bool_t allow_overlap);
+
+typedef sz_size_t (*sz_find_all_t)(sz_cptr_t, sz_size_t, sz_cptr_t, sz_size_t, sz_bool_t, sz_size_t *, sz_size_t);
+typedef sz_size_t (*sz_find_all_set_t)(sz_cptr_t, sz_size_t, sz_charset_t const *, sz_size_t *, sz_size_t);
+
+/**
+ *  @brief  Compiled state of a multi-pattern matcher, locating any of many needles in a single pass.
+ *          All of the needles are copied into one allocation, so the original strings can be freed.
+ *
+ *  The needles are indexed in a hash-table by their first `prefix_length` bytes, which is also used by the serial
+ *  backend. The SIMD backends additionally include a "Teddy"-like prefilter: every needle is assigned to one of 8
+ *  groups, and for each of the first 3 bytes of the needles, two 16-entry tables map the low and high nibbles of a
+ *  haystack byte into a bitmask of groups. A vectorized table look-up evaluates 32 or 64 offsets at a time, and only
+ *  the offsets where the intersection of all those bitmasks is non-empty are verified.
+ *
+ *  @see    sz_multi_matcher_init, sz_multi_matcher_free, sz_find_multi
+ */
+typedef struct sz_multi_matcher_t {
+    sz_size_t count;         // Number of needles.
+    sz_size_t min_length;    // Length of the shortest needle.
+    sz_size_t max_length;    // Length of the longest needle.
+    sz_size_t prefix_length; // Number of leading bytes used for hashing, from 1 to 4.
+    sz_size_t buckets_shift; // Right shift applied to the multiplicative hash to get the bucket index.
+
+    sz_cptr_t const *starts; // Pointers to the copies of the needles.
+    sz_size_t const *lengths;
+    sz_u32_t const *buckets; // One-based index of the first needle in every bucket, zero for empty buckets.
+    sz_u32_t const *chains;  // One-based index of the next needle in the same bucket.
+
+    sz_charset_t first_bytes; // Set of all the first bytes of the needles.
+    sz_u8_t nibbles_low[3][16];
+    sz_u8_t nibbles_high[3][16];
+
+    void *buffer;
+    sz_size_t buffer_length;
+} sz_multi_matcher_t;
+
+/**
+ *  @brief  Compiles a multi-pattern matcher for a given set of needles.
+ *
+ *  @param matcher      Matcher to initialize.
+ *  @param needles      Array of needles to search for. Empty needles are not allowed.
+ *  @param count        Number of needles.
+ *  @param alloc        Memory allocator for the compiled state. Default one used if `NULL`.
+ *  @return             Whether the operation was successful. Fails on allocation failures and empty needles.
+ *                      On failure, the matcher remains empty and doesn't need to be freed.
+ */
+SZ_PUBLIC sz_bool_t sz_multi_matcher_init(sz_multi_matcher_t *matcher, sz_string_view_t const *needles,
+                                          sz_size_t count, sz_memory_allocator_t *alloc);
+
+/**
+ *  @brief  Releases the memory of a compiled multi-pattern matcher.
+ *          Must be given the same allocator as ::sz_multi_matcher_init.
+ */
+SZ_PUBLIC void sz_multi_matcher_free(sz_multi_matcher_t *matcher, sz_memory_allocator_t *alloc);
+
+/**
+ *  @brief  Locates the first occurrence of any needle from the compiled ::matcher.
+ *          If several needles match at the same offset, the longest one is reported.
+ *          If several of those are identical, the one with the lowest index is reported.
+ *
+ *  @param matcher      Compiled matcher.
+ *  @param text         Haystack - the string to search in.
+ *  @param length       Number of bytes in the haystack.
+ *  @param needle_index Optional output for the index of the matched needle in the original array.
+ *  @return             Address of the first match or `NULL`.
+ */
+SZ_DYNAMIC sz_cptr_t sz_find_multi(sz_multi_matcher_t const *matcher, sz_cptr_t text, sz_size_t length,
+                                   sz_size_t *needle_index);
+
+/** @copydoc sz_find_multi */
+SZ_PUBLIC sz_cptr_t sz_find_multi_serial(sz_multi_matcher_t const *matcher, sz_cptr_t text, sz_size_t length,
+                                         sz_size_t *needle_index);
+
+typedef sz_cptr_t (*sz_find_multi_t)(sz_multi_matcher_t const *, sz_cptr_t, sz_size_t, sz_size_t *);
+
+/**
+ *  @brief  State of a streaming substring matcher, that locates a needle in a sequence of successive chunks,
+ *          reporting the absolute offsets of matches, including those straddling the chunk boundaries.
+ *
+ *  Only the last `needle_length - 1` bytes of the stream are carried over between the chunks, so the chunks
+ *  themselves don't have to outlive the ::sz_stream_matcher_feed call, and never have to be concatenated.
+ *
+ *  @see    sz_stream_matcher_init, sz_stream_matcher_feed, sz_stream_matcher_free
+ */
+typedef struct sz_stream_matcher_t {
+    sz_cptr_t needle; // Copy of the needle.
+    sz_size_t needle_length;
+    sz_ptr_t carry;            // Tail of the stream, with room for as many bytes of the next chunk.
+    sz_size_t carry_length;    // Number of stream bytes in the ::carry, under the ::needle_length.
+    sz_size_t offset;          // Absolute offset of the first byte of the next chunk.
+    sz_size_t next_allowed;    // Absolute offset of the earliest next match, for the non-overlapping mode.
+    sz_bool_t allow_overlaps;  // Whether the matches may overlap with each other.
+
+    void *buffer;
+    sz_size_t buffer_length;
+} sz_stream_matcher_t;
+
+/**
+ *  @brief  Callback for every match found by ::sz_stream_matcher_feed.
+ *  @param  offset  Absolute offset of the match from the start of the stream.
+ */
+typedef void (*sz_stream_match_callback_t)(void *context, sz_size_t offset);
+
+/**
+ *  @brief  Initializes a streaming matcher for a given needle, positioned at the start of the stream.
+ *
+ *  @param matcher          Matcher to initialize.
+ *  @param needle           Needle to search for. Empty needles are not allowed.
+ *  @param needle_length    Number of bytes in the needle.
+ *  @param allow_overlaps   Whether to report the overlapping matches, like "aa" twice in "aaa".
+ *  @param alloc            Memory allocator for the compiled state. Default one used if `NULL`.
+ *  @return                 Whether the operation was successful. Fails on allocation failures and empty needles.
+ *                          On failure, the matcher remains empty and doesn't need to be freed.
+ */
+SZ_PUBLIC sz_bool_t sz_stream_matcher_init(sz_stream_matcher_t *matcher, sz_cptr_t needle, sz_size_t needle_length,
+                                           sz_bool_t allow_overlaps, sz_memory_allocator_t *alloc);
+
+/**
+ *  @brief  Releases the memory of a streaming matcher.
+ *          Must be given the same allocator as ::sz_stream_matcher_init.
+ */
+SZ_PUBLIC void sz_stream_matcher_free(sz_stream_matcher_t *matcher, sz_memory_allocator_t *alloc);
+
+/**
+ *  @brief  Rewinds the streaming matcher to the start of a new stream, keeping the needle.
+ */
+SZ_PUBLIC void sz_stream_matcher_reset(sz_stream_matcher_t *matcher);
+
+/**
+ *  @brief  Feeds the next chunk of the stream into the matcher, reporting every match ending in that chunk.
+ *          The matches are reported in the increasing order of offsets.
+ *
+ *  @param matcher      Initialized matcher.
+ *  @param chunk        Next part of the stream. Can be released right after the call.
+ *  @param length       Number of bytes in the chunk. Can be zero.
+ *  @param callback     Function to call with the absolute offset of every match.
+ *  @param context      Opaque pointer forwarded to the ::callback.
+ *  @return             Number of matches reported for this chunk.
+ */
+SZ_PUBLIC sz_size_t sz_stream_matcher_feed(sz_stream_matcher_t *matcher, sz_cptr_t chunk, sz_size_t length,
+                                           sz_stream_match_callback_t callback, void *context);
+
+/**
+ *  @brief  Compiled state of a glob-style pattern matcher, checking if a whole string matches a pattern like
+ *          `GET /api/v[12]/users?id=*` or `*.log`, without a regular expression engine.
+ *
+ *  Supported syntax, operating on individual bytes rather than UTF-8 codepoints:
+ *      - `*` matches any number of bytes, including none, and consecutive stars are merged.
+ *      - `?` matches exactly one arbitrary byte.
+ *      - `[abc]`, `[a-z0-9]` match one byte from a class, and `[!abc]` or `[^abc]` - one byte outside of it.
+ *        A `]` right after the opening bracket, or a negation mark, is part of the class.
+ *        An unterminated `[` is treated as a literal.
+ *      - `\` escapes the next byte, both inside and outside of the classes.
+ *
+ *  The stars split the pattern into fixed-width pieces. The first and the last piece are anchored to the ends of
+ *  the text, and the pieces in-between are located greedily, left to right, which is enough for glob patterns.
+ *  Every piece is located with ::sz_find over its longest literal run, and the candidates are then verified in
+ *  place. The longest literal across the floating pieces serves as a prefilter, rejecting the texts it's missing
+ *  from, before any of the pieces preceding it are located. The length is the only rarity estimate used.
+ *
+ *  @see    sz_glob_matcher_init, sz_glob_matcher_free, sz_glob_match
+ */
+typedef struct sz_glob_matcher_t {
+    sz_size_t atoms_count;     // Number of single-byte atoms, excluding the stars, and the shortest match length.
+    sz_size_t pieces_count;    // Number of star-separated pieces, one more than the number of stars.
+    sz_size_t prefilter_piece; // Floating piece with the longest literal run, or zero if there is none.
+
+    sz_u32_t const *atoms;          // Literal bytes are below 256, `?` is 256, and the `i`-th class is `257 + i`.
+    sz_cptr_t literals;             // Literal bytes at their atom offsets, to be passed into ::sz_find.
+    sz_charset_t const *classes;    // Bracket expressions in the order of their appearance.
+    sz_size_t const *pieces;        // Offset of the first atom of every piece, followed by ::atoms_count.
+    sz_size_t const *runs_offsets;  // Offset of the longest literal run in every piece, relative to the piece.
+    sz_size_t const *runs_lengths;  // Length of the longest literal run in every piece, potentially zero.
+
+    void *buffer;
+    sz_size_t buffer_length;
+} sz_glob_matcher_t;
+
+/**
+ *  @brief  Compiles a glob-style pattern. An empty pattern only matches an empty string.
+ *
+ *  @param matcher          Matcher to initialize.
+ *  @param pattern          Pattern to compile, containing `*`, `?`, `[...]` and `\` escapes.
+ *  @param pattern_length   Number of bytes in the pattern.
+ *  @param alloc            Memory allocator for the compiled state. Default one used if `NULL`.
+ *  @return                 Whether the operation was successful. Fails on allocation failures only.
+ *                          On failure, the matcher remains empty, matches nothing, and doesn't need to be freed.
+ */
+SZ_PUBLIC sz_bool_t sz_glob_matcher_init(sz_glob_matcher_t *matcher, sz_cptr_t pattern, sz_size_t pattern_length,
+                                         sz_memory_allocator_t *alloc);
+
+/**
+ *  @brief  Releases the memory of a compiled glob-style pattern.
+ *          Must be given the same allocator as ::sz_glob_matcher_init.
+ */
+SZ_PUBLIC void sz_glob_matcher_free(sz_glob_matcher_t *matcher, sz_memory_allocator_t *alloc);
+
+/**
+ *  @brief  Checks if the whole ::text matches the compiled glob-style pattern, similar to `fnmatch`
+ *          without any flags, where `*` and `?` also match the `/` and leading `.` characters.
+ *
+ *  @param matcher      Compiled matcher.
+ *  @param text         String to check.
+ *  @param length       Number of bytes in the string.
+ *  @return             Whether the string matches.
+ */
+SZ_PUBLIC sz_bool_t sz_glob_match(sz_glob_matcher_t const *matcher, sz_cptr_t text, sz_size_t length);
+
 #pragma endregion
 
 #pragma region String Similarity Measures API
@@ -878,6 +1472,7 @@ typedef sz_size_t (*sz_hamming_distance_t)(sz_cptr_t, sz_size_t, sz_cptr_t, sz_s
 /**
  *  @brief  Computes the Levenshtein edit-distance between two strings using the Wagner-Fisher algorithm.
  *          Similar to the Needleman-Wunsch alignment algorithm. Often used in fuzzy string matching.
+ *          If the shorter string is up to 128 bytes long, the bit-parallel Myers' algorithm is used instead.
  *
  *  @param a        First string to compare.
  *  @param a_length Number of bytes in the first string.
@@ -967,6 +1562,36 @@ SZ_PUBLIC sz_ssize_t sz_alignment_score_serial(sz_cptr_t a, sz_size_t a_length,
 typedef sz_ssize_t (*sz_alignment_score_t)(sz_cptr_t, sz_size_t, sz_cptr_t, sz_size_t, sz_error_cost_t const *,
                                            sz_error_cost_t, sz_memory_allocator_t *);
 
+/**
+ *  @brief  Computes Smith–Waterman local alignment score for two strings, the highest score of any pair of their
+ *          substrings. Unlike `sz_alignment_score`, never goes negative, as the unmatched prefixes and suffixes
+ *          of both strings are skipped for free. Used to find similar regions, like a short read in a long genome.
+ *
+ *  @param a        First string to compare.
+ *  @param a_length Number of bytes in the first string.
+ *  @param b        Second string to compare.
+ *  @param b_length Number of bytes in the second string.
+ *  @param gap      Penalty cost for gaps - insertions and removals.
+ *  @param subs     Substitution costs matrix with 256 x 256 values for all pairs of characters.
+ *
+ *  @param alloc    Temporary memory allocator. Only some of the rows of the matrix will be allocated,
+ *                  so the memory usage is linear in relation to ::a_length and ::b_length.
+ *                  If SZ_NULL is passed, will initialize to the systems default `malloc`.
+ *  @return         Non-negative similarity score, zero for empty strings.
+ *                  If the memory allocation fails, the function returns `SZ_SSIZE_MAX`.
+ *
+ *  @see    sz_memory_allocator_init_fixed, sz_memory_allocator_init_default
+ *  @see    https://en.wikipedia.org/wiki/Smith%E2%80%93Waterman_algorithm
+ */
+SZ_DYNAMIC sz_ssize_t sz_local_alignment_score(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length, //
+                                               sz_error_cost_t const *subs, sz_error_cost_t gap,                 //
+                                               sz_memory_allocator_t *alloc);
+
+/** @copydoc sz_local_alignment_score */
+SZ_PUBLIC sz_ssize_t sz_local_alignment_score_serial(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b,
+                                                     sz_size_t b_length, sz_error_cost_t const *subs,
+                                                     sz_error_cost_t gap, sz_memory_allocator_t *alloc);
+
 typedef void (*sz_hash_callback_t)(sz_cptr_t, sz_size_t, sz_u64_t, void *user);
 
 /**
@@ -986,6 +1611,9 @@ typedef void (*sz_hash_callback_t)(sz_cptr_t, sz_size_t, sz_u64_t, void *user);
  *  With such minimalistic alphabets of just four characters (AGCT) longer windows might be needed.
  *  For protein sequences the alphabet is 20 characters long, so the window can be shorter, than for DNAs.
  *
+ *  All backends report the same windows, starting at the offsets divisible by the ::window_step, with the same
+ *  hashes, but the vectorized ones slide over several parts of the string at once, interleaving the callbacks.
+ *
  *  @param text             String to hash.
  *  @param length           Number of bytes in the string.
  *  @param window_length    Length of the rolling window in bytes.
@@ -1046,10 +1674,38 @@ SZ_PUBLIC sz_size_t sz_hashes_intersection(sz_cptr_t text, sz_size_t length, sz_
 
 typedef sz_size_t (*sz_hashes_intersection_t)(sz_cptr_t, sz_size_t, sz_size_t, sz_cptr_t, sz_size_t);
 
-#pragma endregion
-
-#pragma region Convenience API
-
+/**
+ *  @brief  Computes the @b MinHash sketch of a string, reducing its Karp-Rabin rolling hashes into ::count
+ *          signatures, each being the minimum of a different hash function over all windows of the string.
+ *          The share of equal signatures in two sketches estimates the Jaccard similarity of their window sets.
+ *
+ *  Unlike `sz_hashes`, doesn't call back for every window. The rolling hashes are produced in small batches
+ *  in an on-stack buffer, and every batch is reduced against all of the hash functions with SIMD.
+ *  The `i`-th function maps a rolling hash `h` with 32-bit halves `h_low` and `h_high` into the top 32 bits of
+ *  `a[i] * h_low + b[i] * h_high + c[i]` modulo 2^64, where `a`, `b` and `c` are derived from `i` alone,
+ *  so all backends and all calls agree on the signatures.
+ *
+ *  @param text             String to hash.
+ *  @param length           Number of bytes in the string.
+ *  @param window_length    Length of the rolling window in bytes.
+ *  @param count            Number of hash functions and output signatures.
+ *  @param signatures       Output array of ::count signatures, all set to `0xFFFFFFFF` for strings without windows.
+ *  @see                    sz_hashes, sz_hashes_fingerprint
+ *  @see                    https://en.wikipedia.org/wiki/MinHash
+ */
+SZ_DYNAMIC void sz_hashes_minhash(sz_cptr_t text, sz_size_t length, sz_size_t window_length, sz_size_t count, //
+                                  sz_u32_t *signatures);
+
+/** @copydoc sz_hashes_minhash */
+SZ_PUBLIC void sz_hashes_minhash_serial(sz_cptr_t text, sz_size_t length, sz_size_t window_length, sz_size_t count, //
+                                        sz_u32_t *signatures);
+
+typedef void (*sz_hashes_minhash_t)(sz_cptr_t, sz_size_t, sz_size_t, sz_size_t, sz_u32_t *);
+
+#pragma endregion
+
+#pragma region Convenience API
+
 /**
  *  @brief  Finds the first character in the haystack, that is present in the needle.
  *          Convenience function, reused across different language bindings.
@@ -1099,20 +1755,152 @@ typedef struct sz_sequence_t {
 } sz_sequence_t;
 
 /**
- *  @brief  Initiates the sequence structure from a tape layout, used by Apache Arrow.
+ *  @brief  Tape layout of a string collection, used by Apache Arrow: the strings are concatenated into
+ *          one buffer, and ::offsets contains `count + 1` entries, the last pointing at the end of the
+ *          last string, indicating the total length of the ::start buffer.
+ *          The sequences, initialized from a tape, reference it, so it must outlive them.
+ */
+typedef struct sz_sequence_tape_t {
+    sz_cptr_t start;      // Concatenated contents of all strings.
+    void const *offsets;  // Either `sz_u32_t` or `sz_u64_t` offsets into the ::start buffer.
+} sz_sequence_tape_t;
+
+/**
+ *  @brief  Initiates the sequence structure from a tape layout with 32-bit offsets, like the Arrow `utf8`.
  *          Expects ::offsets to contains `count + 1` entries, the last pointing at the end
- *          of the last string, indicating the total length of the ::tape.
+ *          of the last string, indicating the total length of the ::start buffer.
  */
-SZ_PUBLIC void sz_sequence_from_u32tape(sz_cptr_t *start, sz_u32_t const *offsets, sz_size_t count,
-                                        sz_sequence_t *sequence);
+SZ_PUBLIC void sz_sequence_from_u32tape(sz_sequence_tape_t *tape, sz_cptr_t start, sz_u32_t const *offsets,
+                                        sz_size_t count, sz_sequence_t *sequence);
 
 /**
- *  @brief  Initiates the sequence structure from a tape layout, used by Apache Arrow.
+ *  @brief  Initiates the sequence structure from a tape layout with 64-bit offsets, like the Arrow `large_utf8`.
  *          Expects ::offsets to contains `count + 1` entries, the last pointing at the end
- *          of the last string, indicating the total length of the ::tape.
+ *          of the last string, indicating the total length of the ::start buffer.
+ */
+SZ_PUBLIC void sz_sequence_from_u64tape(sz_sequence_tape_t *tape, sz_cptr_t start, sz_u64_t const *offsets,
+                                        sz_size_t count, sz_sequence_t *sequence);
+
+/**
+ *  @brief  Initiates the sequence structure from an array of ::count string views, scattered in memory,
+ *          like the strings passed from other languages. The ::views array must outlive the sequence.
+ */
+SZ_PUBLIC void sz_sequence_from_views(sz_string_view_t const *views, sz_size_t count, sz_sequence_t *sequence);
+
+/*
+ *  Apache Arrow C Data Interface, copied from the specification, to exchange columns without linking to Arrow.
+ *  The guard matches the one in `arrow/c/abi.h`, so both headers can be included in any order.
+ *  https://arrow.apache.org/docs/format/CDataInterface.html
+ */
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    // Array type description
+    const char *format;
+    const char *name;
+    const char *metadata;
+    sz_i64_t flags;
+    sz_i64_t n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+struct ArrowArray {
+    // Array data description
+    sz_i64_t length;
+    sz_i64_t null_count;
+    sz_i64_t offset;
+    sz_i64_t n_buffers;
+    sz_i64_t n_children;
+    const void **buffers;
+    struct ArrowArray **children;
+    struct ArrowArray *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+#endif // ARROW_C_DATA_INTERFACE
+
+/**
+ *  @brief  Initiates the sequence structure to address an Apache Arrow string column in place, without copies.
+ *          Supports the `utf8` ("u"), `large_utf8` ("U"), `string_view` ("vu") formats, and their binary
+ *          counterparts ("z", "Z", "vz"). The ::array offset is respected, and nulls are reported as empty strings.
+ *          The sequence references the ::array, so it must outlive the sequence, and must not be released.
+ *
+ *  @param format   Format string from the matching `ArrowSchema`.
+ *  @param array    Arrow array with the strings.
+ *  @param sequence Sequence to initialize, with a `SZ_NULL` order.
+ *  @return         `sz_true_k` on success, `sz_false_k` if the format or the buffers are not supported.
+ */
+SZ_PUBLIC sz_bool_t sz_sequence_from_arrow(sz_cptr_t format, struct ArrowArray const *array,
+                                           sz_sequence_t *sequence);
+
+/**
+ *  @brief  Gathers the strings of a ::sequence into a contiguous tape with 32-bit offsets, the inverse of
+ *          `sz_sequence_from_u32tape`. Useful to compact a sorted or shuffled collection of scattered strings,
+ *          so that the following passes are sequential. Follows the sequence `order`, if it's set.
+ *
+ *  Works in two steps. With a `SZ_NULL` ::tape, only the `count + 1` ::offsets are computed, and the tape length
+ *  is returned, so that the caller can allocate it. With a ::tape, the already computed ::offsets are used to
+ *  copy the strings, prefetching the following ones, potentially split between multiple threads.
+ *
+ *  @param sequence     Strings to gather.
+ *  @param offsets      Array of `count + 1` offsets into the ::tape, computed in the first step.
+ *  @param tape         Buffer of the returned length, or `SZ_NULL` in the first step.
+ *  @param parallel_for Callback dispatching tasks, like a thread-pool. If NULL, copies serially.
+ *  @param executor     Opaque state passed to the ::parallel_for callback.
+ *  @return             The total length of all strings. The offsets overflow beyond 4 GB.
+ */
+SZ_PUBLIC sz_size_t sz_sequence_to_u32tape(sz_sequence_t const *sequence, sz_u32_t *offsets, sz_ptr_t tape,
+                                           sz_parallel_for_t parallel_for, void *executor);
+
+/**
+ *  @brief  Gathers the strings of a ::sequence into a contiguous tape with 64-bit offsets, the inverse of
+ *          `sz_sequence_from_u64tape`.
+ *  @see    sz_sequence_to_u32tape
+ */
+SZ_PUBLIC sz_size_t sz_sequence_to_u64tape(sz_sequence_t const *sequence, sz_u64_t *offsets, sz_ptr_t tape,
+                                           sz_parallel_for_t parallel_for, void *executor);
+
+/**
+ *  @brief  Locates the first occurrence of the same ::needle in every string of the ::haystacks, in one call.
+ *          Meant for language bindings, where crossing into C has a fixed cost, like `cgo` calls in Go,
+ *          that dominates the search time on millions of short strings, unless the loop is moved into C.
+ *
+ *  @param haystacks    Strings to search in, addressed by indices in `[0, count)`, ignoring the `order`.
+ *  @param needle       Needle - substring to find.
+ *  @param n_length     Number of bytes in the needle. An empty needle matches at the start of every haystack.
+ *  @param offsets      Output array for `haystacks->count` offsets of the first matches, or `SZ_SIZE_MAX`.
+ *  @see    sz_find, sz_count_batch
+ */
+SZ_PUBLIC void sz_find_batch(sz_sequence_t const *haystacks, sz_cptr_t needle, sz_size_t n_length,
+                             sz_size_t *offsets);
+
+/**
+ *  @brief  Counts the occurrences of the same ::needle in every string of the ::haystacks, in one call.
+ *  @see    sz_count, sz_find_batch
+ *
+ *  @param haystacks        Strings to search in, addressed by indices in `[0, count)`, ignoring the `order`.
+ *  @param needle           Needle - substring to count. An empty needle is never counted.
+ *  @param n_length         Number of bytes in the needle.
+ *  @param allow_overlap    Whether the matches may overlap, like "aa" found twice in "aaa".
+ *  @param counts           Output array for `haystacks->count` numbers of matches.
  */
-SZ_PUBLIC void sz_sequence_from_u64tape(sz_cptr_t *start, sz_u64_t const *offsets, sz_size_t count,
-                                        sz_sequence_t *sequence);
+SZ_PUBLIC void sz_count_batch(sz_sequence_t const *haystacks, sz_cptr_t needle, sz_size_t n_length,
+                              sz_bool_t allow_overlap, sz_size_t *counts);
 
 /**
  *  @brief  Similar to `std::partition`, given a predicate splits the sequence into two parts.
@@ -1130,22 +1918,123 @@ SZ_PUBLIC sz_size_t sz_partition(sz_sequence_t *sequence, sz_sequence_predicate_
 SZ_PUBLIC void sz_merge(sz_sequence_t *sequence, sz_size_t partition, sz_sequence_comparator_t less);
 
 /**
- *  @brief  Sorting algorithm, combining Radix Sort for the first 32 bits of every word
- *          and a follow-up by a more conventional sorting procedure on equally prefixed parts.
+ *  @brief  Sorting algorithm, combining MSD Radix Sort on 32-bit chunks of every word, reloading
+ *          the next chunk for larger equally-prefixed buckets, and a follow-up by a more conventional
+ *          sorting procedure on the small ones. Handles long shared prefixes, like URLs or paths, well.
  */
-SZ_PUBLIC void sz_sort(sz_sequence_t *sequence);
+SZ_DYNAMIC void sz_sort(sz_sequence_t *sequence);
+
+/** @copydoc sz_sort */
+SZ_PUBLIC void sz_sort_serial(sz_sequence_t *sequence);
 
 /**
- *  @brief  Partial sorting algorithm, combining Radix Sort for the first 32 bits of every word
+ *  @brief  Partial sorting algorithm, combining MSD Radix Sort on 32-bit chunks of every word
  *          and a follow-up by a more conventional sorting procedure on equally prefixed parts.
+ *          Places the ::n smallest strings in sorted order at the front of `sequence->order`,
+ *          leaving the rest in an unspecified order. Radix buckets entirely past the first ::n
+ *          entries are never sorted, so picking the top-k of a huge collection costs about one pass.
+ *
+ *  @param sequence The sequence to sort, with `order` populated with the initial permutation.
+ *  @param n        The number of the smallest entries to sort. If larger than `count`, sorts everything.
+ */
+SZ_DYNAMIC void sz_sort_partial(sz_sequence_t *sequence, sz_size_t n);
+
+/** @copydoc sz_sort_partial */
+SZ_PUBLIC void sz_sort_partial_serial(sz_sequence_t *sequence, sz_size_t n);
+
+/**
+ *  @brief  Parallel version of `sz_sort`, producing exactly the same permutation.
+ *          Partitions the sequence on the top bits of the radix, forming up to 256 buckets,
+ *          and sorts them concurrently with the help of the user-supplied executor.
+ *
+ *  @param sequence     The sequence to sort, with `order` populated with the initial permutation.
+ *  @param parallel_for Callback dispatching tasks, like a thread-pool. If NULL, falls back to `sz_sort`.
+ *  @param executor     Opaque state passed to the ::parallel_for callback.
  */
-SZ_PUBLIC void sz_sort_partial(sz_sequence_t *sequence, sz_size_t n);
+SZ_DYNAMIC void sz_sort_parallel(sz_sequence_t *sequence, sz_parallel_for_t parallel_for, void *executor);
+
+/** @copydoc sz_sort_parallel */
+SZ_PUBLIC void sz_sort_parallel_serial(sz_sequence_t *sequence, sz_parallel_for_t parallel_for, void *executor);
 
 /**
  *  @brief  Intro-Sort algorithm that supports custom comparators.
  */
 SZ_PUBLIC void sz_sort_intro(sz_sequence_t *sequence, sz_sequence_comparator_t less);
 
+/**
+ *  @brief  Computes the Levenshtein edit-distances in @b bytes between one ::query and many ::candidates.
+ *          Unlike calling `sz_edit_distance` in a loop, precomputes the query-side state once, and reuses
+ *          a single scratch buffer. Queries up to 64 bytes use the bit-parallel Myers-Hyyrö algorithm,
+ *          with no allocations at all, and on AVX-512 evaluate 8 candidates at a time.
+ *
+ *  @param query        Query string to compare against every candidate.
+ *  @param query_length Number of bytes in the query.
+ *  @param candidates   Sequence of candidate strings, addressed by indices in `[0, count)`, ignoring the `order`.
+ *  @param bound        Upper bound on the distance, that allows us to exit early.
+ *                      If zero is passed, the maximum possible distance will be equal to the length of the longer input.
+ *  @param alloc        Temporary memory allocator, only used for queries longer than 64 bytes.
+ *                      If SZ_NULL is passed, will initialize to the systems default `malloc`.
+ *  @param distances    Output array for `candidates->count` distances, each capped by the `bound`, if it's set.
+ *  @return             `sz_true_k` on success, `sz_false_k` if the memory allocation failed.
+ *
+ *  @see    sz_edit_distance
+ *  @see    https://doi.org/10.1145/316542.316550
+ */
+SZ_DYNAMIC sz_bool_t sz_edit_distances(sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates,
+                                       sz_size_t bound, sz_memory_allocator_t *alloc, sz_size_t *distances);
+
+/** @copydoc sz_edit_distances */
+SZ_PUBLIC sz_bool_t sz_edit_distances_serial(sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates,
+                                             sz_size_t bound, sz_memory_allocator_t *alloc, sz_size_t *distances);
+
+typedef sz_bool_t (*sz_edit_distances_t)(sz_cptr_t, sz_size_t, sz_sequence_t const *, sz_size_t,
+                                         sz_memory_allocator_t *, sz_size_t *);
+
+/**
+ *  @brief  Computes the global `sz_alignment_score` or the `sz_local_alignment_score` between one ::query and
+ *          many ::candidates, like short reads against reference windows. Unlike calling those in a loop,
+ *          allocates a single scratch buffer for all of the candidates.
+ *
+ *  @param query        Query string to compare against every candidate, passed as the first argument.
+ *  @param query_length Number of bytes in the query.
+ *  @param candidates   Sequence of candidate strings, addressed by indices in `[0, count)`, ignoring the `order`.
+ *  @param subs         Substitution costs matrix with 256 x 256 values for all pairs of characters.
+ *  @param gap          Penalty cost for gaps - insertions and removals.
+ *  @param local        Whether to compute the Smith–Waterman local alignment instead of Needleman–Wunsch one.
+ *  @param alloc        Temporary memory allocator. If SZ_NULL is passed, will initialize to the systems default `malloc`.
+ *  @param scores       Output array for `candidates->count` scores.
+ *  @return             `sz_true_k` on success, `sz_false_k` if the memory allocation failed.
+ *
+ *  @see    sz_alignment_score, sz_local_alignment_score
+ */
+SZ_DYNAMIC sz_bool_t sz_alignment_scores(sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates,
+                                         sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local,
+                                         sz_memory_allocator_t *alloc, sz_ssize_t *scores);
+
+/** @copydoc sz_alignment_scores */
+SZ_PUBLIC sz_bool_t sz_alignment_scores_serial(sz_cptr_t query, sz_size_t query_length,
+                                               sz_sequence_t const *candidates, sz_error_cost_t const *subs,
+                                               sz_error_cost_t gap, sz_bool_t local, sz_memory_allocator_t *alloc,
+                                               sz_ssize_t *scores);
+
+typedef sz_bool_t (*sz_alignment_scores_t)(sz_cptr_t, sz_size_t, sz_sequence_t const *, sz_error_cost_t const *,
+                                           sz_error_cost_t, sz_bool_t, sz_memory_allocator_t *, sz_ssize_t *);
+
+/**
+ *  @brief  Computes the `sz_hash` of every string in a sequence, like the keys of a hash-join.
+ *          On AVX-512, groups of 8 strings up to 16 bytes long are hashed together, one per lane.
+ *
+ *  @param sequence Strings to hash, addressed by indices in `[0, count)`, ignoring the `order`.
+ *                  Use `sz_sequence_from_arrow` or `sz_sequence_from_u32tape` for Apache Arrow columns.
+ *  @param hashes   Output array for `sequence->count` hashes, equal to the individual `sz_hash` results.
+ */
+SZ_DYNAMIC void sz_hash_batch(sz_sequence_t const *sequence, sz_u64_t *hashes);
+
+/** @copydoc sz_hash_batch */
+SZ_PUBLIC void sz_hash_batch_serial(sz_sequence_t const *sequence, sz_u64_t *hashes);
+
+typedef void (*sz_hash_batch_t)(sz_sequence_t const *, sz_u64_t *);
+
 #pragma endregion
 
 /*
@@ -1216,8 +2105,8 @@ SZ_PUBLIC void sz_copy_avx512(sz_ptr_t target, sz_cptr_t source, sz_size_t lengt
 SZ_PUBLIC void sz_move_avx512(sz_ptr_t target, sz_cptr_t source, sz_size_t length);
 /** @copydoc sz_fill */
 SZ_PUBLIC void sz_fill_avx512(sz_ptr_t target, sz_size_t length, sz_u8_t value);
-/** @copydoc sz_look_up_tranform */
-SZ_PUBLIC void sz_look_up_tranform_avx512(sz_cptr_t source, sz_size_t length, sz_cptr_t table, sz_ptr_t target);
+/** @copydoc sz_look_up_transform */
+SZ_PUBLIC void sz_look_up_transform_avx512(sz_cptr_t source, sz_size_t length, sz_cptr_t table, sz_ptr_t target);
 /** @copydoc sz_find_byte */
 SZ_PUBLIC sz_cptr_t sz_find_byte_avx512(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle);
 /** @copydoc sz_rfind_byte */
@@ -1226,20 +2115,53 @@ SZ_PUBLIC sz_cptr_t sz_rfind_byte_avx512(sz_cptr_t haystack, sz_size_t h_length,
 SZ_PUBLIC sz_cptr_t sz_find_avx512(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length);
 /** @copydoc sz_rfind */
 SZ_PUBLIC sz_cptr_t sz_rfind_avx512(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length);
+/** @copydoc sz_find_caseless */
+SZ_PUBLIC sz_cptr_t sz_find_caseless_avx512(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle,
+                                            sz_size_t n_length);
+/** @copydoc sz_rfind_caseless */
+SZ_PUBLIC sz_cptr_t sz_rfind_caseless_avx512(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle,
+                                             sz_size_t n_length);
 /** @copydoc sz_find_charset */
 SZ_PUBLIC sz_cptr_t sz_find_charset_avx512(sz_cptr_t text, sz_size_t length, sz_charset_t const *set);
 /** @copydoc sz_rfind_charset */
 SZ_PUBLIC sz_cptr_t sz_rfind_charset_avx512(sz_cptr_t text, sz_size_t length, sz_charset_t const *set);
+/** @copydoc sz_find_all */
+SZ_PUBLIC sz_size_t sz_find_all_avx512(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length,
+                                       sz_bool_t allow_overlap, sz_size_t *offsets, sz_size_t capacity);
+/** @copydoc sz_find_all_charset */
+SZ_PUBLIC sz_size_t sz_find_all_charset_avx512(sz_cptr_t text, sz_size_t length, sz_charset_t const *set,
+                                               sz_size_t *offsets, sz_size_t capacity);
+/** @copydoc sz_find_multi */
+SZ_PUBLIC sz_cptr_t sz_find_multi_avx512(sz_multi_matcher_t const *matcher, sz_cptr_t text, sz_size_t length,
+                                         sz_size_t *needle_index);
 /** @copydoc sz_edit_distance */
 SZ_PUBLIC sz_size_t sz_edit_distance_avx512(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length, //
                                             sz_size_t bound, sz_memory_allocator_t *alloc);
+/** @copydoc sz_edit_distances */
+SZ_PUBLIC sz_bool_t sz_edit_distances_avx512(sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates,
+                                             sz_size_t bound, sz_memory_allocator_t *alloc, sz_size_t *distances);
 /** @copydoc sz_alignment_score */
 SZ_PUBLIC sz_ssize_t sz_alignment_score_avx512(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length, //
                                                sz_error_cost_t const *subs, sz_error_cost_t gap,                 //
                                                sz_memory_allocator_t *alloc);
+/** @copydoc sz_hash */
+SZ_PUBLIC sz_u64_t sz_hash_avx512(sz_cptr_t text, sz_size_t length);
+/** @copydoc sz_hash_batch */
+SZ_PUBLIC void sz_hash_batch_avx512(sz_sequence_t const *sequence, sz_u64_t *hashes);
 /** @copydoc sz_hashes */
 SZ_PUBLIC void sz_hashes_avx512(sz_cptr_t text, sz_size_t length, sz_size_t window_length, sz_size_t step, //
                                 sz_hash_callback_t callback, void *callback_handle);
+/** @copydoc sz_hashes_minhash */
+SZ_PUBLIC void sz_hashes_minhash_avx512(sz_cptr_t text, sz_size_t length, sz_size_t window_length, sz_size_t count, //
+                                        sz_u32_t *signatures);
+/** @copydoc sz_utf8_validate */
+SZ_PUBLIC sz_bool_t sz_utf8_validate_avx512(sz_cptr_t text, sz_size_t length);
+/** @copydoc sz_utf8_count */
+SZ_PUBLIC sz_size_t sz_utf8_count_avx512(sz_cptr_t text, sz_size_t length);
+/** @copydoc sz_utf8_to_utf32 */
+SZ_PUBLIC sz_size_t sz_utf8_to_utf32_avx512(sz_cptr_t text, sz_size_t length, sz_rune_t *runes);
+/** @copydoc sz_utf8_find_nth */
+SZ_PUBLIC sz_cptr_t sz_utf8_find_nth_avx512(sz_cptr_t text, sz_size_t length, sz_size_t n);
 #endif
 
 #if SZ_USE_X86_AVX2
@@ -1263,9 +2185,49 @@ SZ_PUBLIC sz_cptr_t sz_rfind_byte_avx2(sz_cptr_t haystack, sz_size_t h_length, s
 SZ_PUBLIC sz_cptr_t sz_find_avx2(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length);
 /** @copydoc sz_rfind */
 SZ_PUBLIC sz_cptr_t sz_rfind_avx2(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length);
+/** @copydoc sz_find_caseless */
+SZ_PUBLIC sz_cptr_t sz_find_caseless_avx2(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle,
+                                          sz_size_t n_length);
+/** @copydoc sz_rfind_caseless */
+SZ_PUBLIC sz_cptr_t sz_rfind_caseless_avx2(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle,
+                                           sz_size_t n_length);
+/** @copydoc sz_find_all */
+SZ_PUBLIC sz_size_t sz_find_all_avx2(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length,
+                                     sz_bool_t allow_overlap, sz_size_t *offsets, sz_size_t capacity);
+/** @copydoc sz_find_all_charset */
+SZ_PUBLIC sz_size_t sz_find_all_charset_avx2(sz_cptr_t text, sz_size_t length, sz_charset_t const *set,
+                                             sz_size_t *offsets, sz_size_t capacity);
+/** @copydoc sz_find_multi */
+SZ_PUBLIC sz_cptr_t sz_find_multi_avx2(sz_multi_matcher_t const *matcher, sz_cptr_t text, sz_size_t length,
+                                       sz_size_t *needle_index);
+/** @copydoc sz_hash */
+SZ_PUBLIC sz_u64_t sz_hash_avx2(sz_cptr_t text, sz_size_t length);
 /** @copydoc sz_hashes */
 SZ_PUBLIC void sz_hashes_avx2(sz_cptr_t text, sz_size_t length, sz_size_t window_length, sz_size_t step, //
                               sz_hash_callback_t callback, void *callback_handle);
+/** @copydoc sz_hashes_minhash */
+SZ_PUBLIC void sz_hashes_minhash_avx2(sz_cptr_t text, sz_size_t length, sz_size_t window_length, sz_size_t count, //
+                                      sz_u32_t *signatures);
+/** @copydoc sz_utf8_validate */
+SZ_PUBLIC sz_bool_t sz_utf8_validate_avx2(sz_cptr_t text, sz_size_t length);
+/** @copydoc sz_utf8_count */
+SZ_PUBLIC sz_size_t sz_utf8_count_avx2(sz_cptr_t text, sz_size_t length);
+/** @copydoc sz_utf8_to_utf32 */
+SZ_PUBLIC sz_size_t sz_utf8_to_utf32_avx2(sz_cptr_t text, sz_size_t length, sz_rune_t *runes);
+/** @copydoc sz_utf8_find_nth */
+SZ_PUBLIC sz_cptr_t sz_utf8_find_nth_avx2(sz_cptr_t text, sz_size_t length, sz_size_t n);
+/** @copydoc sz_alignment_score */
+SZ_PUBLIC sz_ssize_t sz_alignment_score_avx2(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length, //
+                                             sz_error_cost_t const *subs, sz_error_cost_t gap,                 //
+                                             sz_memory_allocator_t *alloc);
+/** @copydoc sz_local_alignment_score */
+SZ_PUBLIC sz_ssize_t sz_local_alignment_score_avx2(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length,
+                                                   sz_error_cost_t const *subs, sz_error_cost_t gap,
+                                                   sz_memory_allocator_t *alloc);
+/** @copydoc sz_alignment_scores */
+SZ_PUBLIC sz_bool_t sz_alignment_scores_avx2(sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates,
+                                             sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local,
+                                             sz_memory_allocator_t *alloc, sz_ssize_t *scores);
 #endif
 
 #if SZ_USE_ARM_NEON
@@ -1289,10 +2251,50 @@ SZ_PUBLIC sz_cptr_t sz_rfind_byte_neon(sz_cptr_t haystack, sz_size_t h_length, s
 SZ_PUBLIC sz_cptr_t sz_find_neon(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length);
 /** @copydoc sz_rfind */
 SZ_PUBLIC sz_cptr_t sz_rfind_neon(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length);
+/** @copydoc sz_find_caseless */
+SZ_PUBLIC sz_cptr_t sz_find_caseless_neon(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle,
+                                          sz_size_t n_length);
+/** @copydoc sz_rfind_caseless */
+SZ_PUBLIC sz_cptr_t sz_rfind_caseless_neon(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle,
+                                           sz_size_t n_length);
 /** @copydoc sz_find_charset */
 SZ_PUBLIC sz_cptr_t sz_find_charset_neon(sz_cptr_t text, sz_size_t length, sz_charset_t const *set);
 /** @copydoc sz_rfind_charset */
 SZ_PUBLIC sz_cptr_t sz_rfind_charset_neon(sz_cptr_t text, sz_size_t length, sz_charset_t const *set);
+/** @copydoc sz_find_all */
+SZ_PUBLIC sz_size_t sz_find_all_neon(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length,
+                                     sz_bool_t allow_overlap, sz_size_t *offsets, sz_size_t capacity);
+/** @copydoc sz_find_all_charset */
+SZ_PUBLIC sz_size_t sz_find_all_charset_neon(sz_cptr_t text, sz_size_t length, sz_charset_t const *set,
+                                             sz_size_t *offsets, sz_size_t capacity);
+/** @copydoc sz_hash */
+SZ_PUBLIC sz_u64_t sz_hash_neon(sz_cptr_t text, sz_size_t length);
+/** @copydoc sz_hashes */
+SZ_PUBLIC void sz_hashes_neon(sz_cptr_t text, sz_size_t length, sz_size_t window_length, sz_size_t step, //
+                              sz_hash_callback_t callback, void *callback_handle);
+/** @copydoc sz_hashes_minhash */
+SZ_PUBLIC void sz_hashes_minhash_neon(sz_cptr_t text, sz_size_t length, sz_size_t window_length, sz_size_t count, //
+                                      sz_u32_t *signatures);
+/** @copydoc sz_utf8_validate */
+SZ_PUBLIC sz_bool_t sz_utf8_validate_neon(sz_cptr_t text, sz_size_t length);
+/** @copydoc sz_utf8_count */
+SZ_PUBLIC sz_size_t sz_utf8_count_neon(sz_cptr_t text, sz_size_t length);
+/** @copydoc sz_utf8_to_utf32 */
+SZ_PUBLIC sz_size_t sz_utf8_to_utf32_neon(sz_cptr_t text, sz_size_t length, sz_rune_t *runes);
+/** @copydoc sz_utf8_find_nth */
+SZ_PUBLIC sz_cptr_t sz_utf8_find_nth_neon(sz_cptr_t text, sz_size_t length, sz_size_t n);
+/** @copydoc sz_alignment_score */
+SZ_PUBLIC sz_ssize_t sz_alignment_score_neon(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length, //
+                                             sz_error_cost_t const *subs, sz_error_cost_t gap,                 //
+                                             sz_memory_allocator_t *alloc);
+/** @copydoc sz_local_alignment_score */
+SZ_PUBLIC sz_ssize_t sz_local_alignment_score_neon(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length,
+                                                   sz_error_cost_t const *subs, sz_error_cost_t gap,
+                                                   sz_memory_allocator_t *alloc);
+/** @copydoc sz_alignment_scores */
+SZ_PUBLIC sz_bool_t sz_alignment_scores_neon(sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates,
+                                             sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local,
+                                             sz_memory_allocator_t *alloc, sz_ssize_t *scores);
 #endif
 
 #if SZ_USE_ARM_SVE
@@ -1306,6 +2308,11 @@ SZ_PUBLIC void sz_copy_sve(sz_ptr_t target, sz_cptr_t source, sz_size_t length);
 SZ_PUBLIC void sz_move_sve(sz_ptr_t target, sz_cptr_t source, sz_size_t length);
 /** @copydoc sz_fill */
 SZ_PUBLIC void sz_fill_sve(sz_ptr_t target, sz_size_t length, sz_u8_t value);
+/** @copydoc sz_look_up_transform */
+SZ_PUBLIC void sz_look_up_transform_sve(sz_cptr_t source, sz_size_t length, sz_cptr_t table, sz_ptr_t target);
+/** @copydoc sz_hashes */
+SZ_PUBLIC void sz_hashes_sve(sz_cptr_t text, sz_size_t length, sz_size_t window_length, sz_size_t step, //
+                             sz_hash_callback_t callback, void *callback_handle);
 /** @copydoc sz_find_byte */
 SZ_PUBLIC sz_cptr_t sz_find_byte_sve(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle);
 /** @copydoc sz_rfind_byte */
@@ -1371,6 +2378,15 @@ SZ_PUBLIC sz_cptr_t sz_rfind_charset_sve(sz_cptr_t text, sz_size_t length, sz_ch
  */
 #define SZ_CACHE_LINE_WIDTH (64) // bytes
 
+/**
+ *  @brief  Hints the CPU to fetch the cache line at the given address, ahead of a random access.
+ */
+#if defined(_MSC_VER) && !defined(__clang__)
+#define sz_prefetch(address) sz_unused(address)
+#else
+#define sz_prefetch(address) __builtin_prefetch(address)
+#endif
+
 /**
  *  @brief  Similar to `assert`, the `sz_assert` is used in the SZ_DEBUG mode
  *          to check the invariants of the library. It's a no-op in the SZ_RELEASE mode.
@@ -1847,10 +2863,118 @@ SZ_PUBLIC void sz_memory_allocator_init_fixed(sz_memory_allocator_t *alloc, void
     // Later use it for bounds checking.
     alloc->allocate = (sz_memory_allocate_t)_sz_memory_allocate_fixed;
     alloc->free = (sz_memory_free_t)_sz_memory_free_fixed;
-    alloc->handle = &buffer;
+    alloc->handle = buffer;
     sz_copy((sz_ptr_t)buffer, (sz_cptr_t)&length, sizeof(sz_size_t));
 }
 
+/** @brief  Header of every arena chunk, linking it to the previously allocated one. */
+typedef struct _sz_memory_arena_chunk_t {
+    struct _sz_memory_arena_chunk_t *previous;
+    sz_size_t capacity;
+} _sz_memory_arena_chunk_t;
+
+/** @brief  Size of the chunk header, padded to keep the first block 16-byte aligned. */
+#define _sz_memory_arena_header_size ((sizeof(_sz_memory_arena_chunk_t) + 15) & ~(sz_size_t)15)
+
+SZ_INTERNAL sz_size_t _sz_memory_arena_round_up(sz_size_t length) { return (length + 15) & ~(sz_size_t)15; }
+
+SZ_PUBLIC void sz_memory_arena_init(sz_memory_arena_t *arena, sz_size_t chunk_size, sz_memory_allocator_t *upstream) {
+    if (upstream) arena->upstream = *upstream;
+    else
+        sz_memory_allocator_init_default(&arena->upstream);
+    arena->chunk = SZ_NULL;
+    arena->chunk_capacity = arena->chunk_used = 0;
+    arena->chunk_size = chunk_size ? _sz_memory_arena_round_up(chunk_size) : 4096;
+    arena->used_bytes = arena->peak_bytes = arena->chunks_count = 0;
+}
+
+SZ_PUBLIC void *sz_memory_arena_allocate(sz_memory_arena_t *arena, sz_size_t length) {
+    sz_size_t const rounded = _sz_memory_arena_round_up(length ? length : 1);
+    if (arena->chunk_used + rounded > arena->chunk_capacity) {
+        // Doubling the chunk sizes keeps the number of upstream calls logarithmic in the total volume.
+        sz_size_t const capacity = sz_max_of_two(arena->chunk_size, rounded);
+        if (!arena->upstream.allocate) return SZ_NULL;
+        _sz_memory_arena_chunk_t *chunk = (_sz_memory_arena_chunk_t *)arena->upstream.allocate(
+            _sz_memory_arena_header_size + capacity, arena->upstream.handle);
+        if (!chunk) return SZ_NULL;
+        chunk->previous = (_sz_memory_arena_chunk_t *)arena->chunk;
+        chunk->capacity = capacity;
+        arena->chunk = chunk;
+        arena->chunk_capacity = capacity;
+        arena->chunk_used = 0;
+        arena->chunk_size = capacity * 2;
+        arena->chunks_count++;
+    }
+    sz_ptr_t result = (sz_ptr_t)arena->chunk + _sz_memory_arena_header_size + arena->chunk_used;
+    arena->chunk_used += rounded;
+    arena->used_bytes += rounded;
+    arena->peak_bytes = sz_max_of_two(arena->peak_bytes, arena->used_bytes);
+    return result;
+}
+
+SZ_PUBLIC void sz_memory_arena_deallocate(sz_memory_arena_t *arena, void *start, sz_size_t length) {
+    sz_size_t const rounded = _sz_memory_arena_round_up(length ? length : 1);
+    if (!arena->chunk || rounded > arena->chunk_used) return;
+    sz_ptr_t const top = (sz_ptr_t)arena->chunk + _sz_memory_arena_header_size + arena->chunk_used;
+    // Only the most recent block can be returned, the rest waits for the reset.
+    if ((sz_ptr_t)start + rounded != top) return;
+    arena->chunk_used -= rounded;
+    arena->used_bytes -= rounded;
+}
+
+SZ_PUBLIC void sz_memory_arena_reset(sz_memory_arena_t *arena) {
+    _sz_memory_arena_chunk_t *latest = (_sz_memory_arena_chunk_t *)arena->chunk;
+    if (!latest) return;
+    _sz_memory_arena_chunk_t *chunk = latest->previous;
+    while (chunk) {
+        _sz_memory_arena_chunk_t *previous = chunk->previous;
+        arena->upstream.free(chunk, _sz_memory_arena_header_size + chunk->capacity, arena->upstream.handle);
+        chunk = previous;
+    }
+    latest->previous = SZ_NULL;
+    arena->chunk_used = 0;
+    arena->used_bytes = 0;
+    arena->chunks_count = 1;
+}
+
+SZ_PUBLIC void sz_memory_arena_free(sz_memory_arena_t *arena) {
+    _sz_memory_arena_chunk_t *chunk = (_sz_memory_arena_chunk_t *)arena->chunk;
+    while (chunk) {
+        _sz_memory_arena_chunk_t *previous = chunk->previous;
+        arena->upstream.free(chunk, _sz_memory_arena_header_size + chunk->capacity, arena->upstream.handle);
+        chunk = previous;
+    }
+    arena->chunk = SZ_NULL;
+    arena->chunk_capacity = arena->chunk_used = 0;
+    arena->used_bytes = arena->chunks_count = 0;
+}
+
+SZ_PUBLIC sz_bool_t sz_memory_arena_owns(sz_memory_arena_t const *arena, void const *start) {
+    sz_cptr_t const pointer = (sz_cptr_t)start;
+    for (_sz_memory_arena_chunk_t const *chunk = (_sz_memory_arena_chunk_t const *)arena->chunk; chunk;
+         chunk = chunk->previous) {
+        sz_cptr_t const begin = (sz_cptr_t)chunk + _sz_memory_arena_header_size;
+        if (pointer >= begin && pointer < begin + chunk->capacity) return sz_true_k;
+    }
+    return sz_false_k;
+}
+
+/** @brief  Helper function, forwarding the allocation requests to an arena. */
+SZ_INTERNAL void *_sz_memory_allocate_arena(sz_size_t length, void *handle) {
+    return sz_memory_arena_allocate((sz_memory_arena_t *)handle, length);
+}
+
+/** @brief  Helper function, forwarding the deallocation requests to an arena. */
+SZ_INTERNAL void _sz_memory_free_arena(void *start, sz_size_t length, void *handle) {
+    sz_memory_arena_deallocate((sz_memory_arena_t *)handle, start, length);
+}
+
+SZ_PUBLIC void sz_memory_allocator_init_arena(sz_memory_allocator_t *alloc, sz_memory_arena_t *arena) {
+    alloc->allocate = (sz_memory_allocate_t)_sz_memory_allocate_arena;
+    alloc->free = (sz_memory_free_t)_sz_memory_free_arena;
+    alloc->handle = arena;
+}
+
 /**
  *  @brief  Byte-level equality comparison between two strings.
  *          If unaligned loads are allowed, uses a switch-table to avoid loops on short strings.
@@ -1871,6 +2995,31 @@ SZ_PUBLIC sz_bool_t sz_equal_serial(sz_cptr_t a, sz_cptr_t b, sz_size_t length)
     return (sz_bool_t)(a_end == a);
 }
 
+SZ_PUBLIC sz_capability_t sz_capabilities_from_names(sz_cptr_t names) {
+    sz_capability_t const avx2 = (sz_capability_t)(sz_cap_serial_k | sz_cap_x86_avx2_k);
+    sz_capability_t const avx512 = (sz_capability_t)(avx2 | sz_cap_x86_avx512f_k | sz_cap_x86_avx512bw_k |
+                                                     sz_cap_x86_avx512vl_k | sz_cap_x86_avx512vbmi_k |
+                                                     sz_cap_x86_avx512vbmi2_k | sz_cap_x86_gfni_k);
+    sz_capability_t const neon = (sz_capability_t)(sz_cap_serial_k | sz_cap_arm_neon_k);
+    sz_capability_t const sve = (sz_capability_t)(neon | sz_cap_arm_sve_k);
+
+    unsigned result = 0;
+    while (names && *names) {
+        sz_cptr_t end = names;
+        while (*end && *end != ',') ++end;
+        sz_size_t length = (sz_size_t)(end - names);
+        if (length == 6 && sz_equal_serial(names, "serial", 6)) result |= sz_cap_serial_k;
+        else if (length == 4 && sz_equal_serial(names, "avx2", 4)) result |= avx2;
+        else if (length == 6 && sz_equal_serial(names, "avx512", 6)) result |= avx512;
+        else if (length == 4 && sz_equal_serial(names, "neon", 4)) result |= neon;
+        else if (length == 3 && sz_equal_serial(names, "sve", 3)) result |= sve;
+        else if (length == 3 && sz_equal_serial(names, "any", 3)) result |= sz_cap_any_k;
+        else return (sz_capability_t)0;
+        names = *end ? end + 1 : end;
+    }
+    return (sz_capability_t)result;
+}
+
 SZ_PUBLIC sz_cptr_t sz_find_charset_serial(sz_cptr_t text, sz_size_t length, sz_charset_t const *set) {
     for (sz_cptr_t const end = text + length; text != end; ++text)
         if (sz_charset_contains(set, *text)) return text;
@@ -1911,7 +3060,7 @@ SZ_PUBLIC sz_ordering_t sz_order_serial(sz_cptr_t a, sz_size_t a_length, sz_cptr
     }
 #endif
     for (; a != min_end; ++a, ++b)
-        if (*a != *b) return _sz_order_scalars(*a, *b);
+        if (*a != *b) return _sz_order_scalars((sz_u8_t)*a, (sz_u8_t)*b);
 
     // If the strings are equal up to `min_end`, then the shorter string is smaller
     return _sz_order_scalars(a_length, b_length);
@@ -2437,153 +3586,961 @@ SZ_PUBLIC sz_cptr_t sz_rfind_serial(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n
         (n_length > 256)](h, h_length, n, n_length);
 }
 
-SZ_INTERNAL sz_size_t _sz_edit_distance_skewed_diagonals_serial( //
-    sz_cptr_t shorter, sz_size_t shorter_length,                 //
-    sz_cptr_t longer, sz_size_t longer_length,                   //
-    sz_size_t bound, sz_memory_allocator_t *alloc) {
-
-    // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
-    sz_memory_allocator_t global_alloc;
-    if (!alloc) {
-        sz_memory_allocator_init_default(&global_alloc);
-        alloc = &global_alloc;
-    }
-
-    // TODO: Generalize to remove the following asserts!
-    sz_assert(!bound && "For bounded search the method should only evaluate one band of the matrix.");
-    sz_assert(shorter_length == longer_length && "The method hasn't been generalized to different length inputs yet.");
-    sz_unused(longer_length && bound);
-
-    // We are going to store 3 diagonals of the matrix.
-    // The length of the longest (main) diagonal would be `n = (shorter_length + 1)`.
-    sz_size_t n = shorter_length + 1;
-    sz_size_t buffer_length = sizeof(sz_size_t) * n * 3;
-    sz_size_t *distances = (sz_size_t *)alloc->allocate(buffer_length, alloc->handle);
-    if (!distances) return SZ_SIZE_MAX;
-
-    sz_size_t *previous_distances = distances;
-    sz_size_t *current_distances = previous_distances + n;
-    sz_size_t *next_distances = previous_distances + n * 2;
+SZ_PUBLIC sz_size_t sz_find_all_serial(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length,
+                                       sz_bool_t allow_overlap, sz_size_t *offsets, sz_size_t capacity) {
 
-    // Initialize the first two diagonals:
-    previous_distances[0] = 0;
-    current_distances[0] = current_distances[1] = 1;
+    // This almost never fires, but it's better to be safe than sorry.
+    if (h_length < n_length || !n_length) return 0;
 
-    // Progress through the upper triangle of the Levenshtein matrix.
-    sz_size_t next_skew_diagonal_index = 2;
-    for (; next_skew_diagonal_index != n; ++next_skew_diagonal_index) {
-        sz_size_t const next_skew_diagonal_length = next_skew_diagonal_index + 1;
-        for (sz_size_t i = 0; i + 2 < next_skew_diagonal_length; ++i) {
-            sz_size_t cost_of_substitution = shorter[next_skew_diagonal_index - i - 2] != longer[i];
-            sz_size_t cost_if_substitution = previous_distances[i] + cost_of_substitution;
-            sz_size_t cost_if_deletion_or_insertion = sz_min_of_two(current_distances[i], current_distances[i + 1]) + 1;
-            next_distances[i + 1] = sz_min_of_two(cost_if_deletion_or_insertion, cost_if_substitution);
-        }
-        // Don't forget to populate the first row and the first column of the Levenshtein matrix.
-        next_distances[0] = next_distances[next_skew_diagonal_length - 1] = next_skew_diagonal_index;
-        // Perform a circular rotation of those buffers, to reuse the memory.
-        sz_size_t *temporary = previous_distances;
-        previous_distances = current_distances;
-        current_distances = next_distances;
-        next_distances = temporary;
+    // Counting single bytes is trivially vectorized by the compiler, unlike the chain of `sz_find_serial` calls.
+    sz_size_t count = 0;
+    if (n_length == 1 && !offsets) {
+        sz_u8_t const n_byte = *(sz_u8_t const *)n;
+        for (sz_size_t i = 0; i != h_length; ++i) count += ((sz_u8_t const *)h)[i] == n_byte;
+        return sz_min_of_two(count, capacity);
     }
 
-    // By now we've scanned through the upper triangle of the matrix, where each subsequent iteration results in a
-    // larger diagonal. From now onwards, we will be shrinking. Instead of adding value equal to the skewed diagonal
-    // index on either side, we will be cropping those values out.
-    sz_size_t total_diagonals = n + n - 1;
-    for (; next_skew_diagonal_index != total_diagonals; ++next_skew_diagonal_index) {
-        sz_size_t const next_skew_diagonal_length = total_diagonals - next_skew_diagonal_index;
-        for (sz_size_t i = 0; i != next_skew_diagonal_length; ++i) {
-            sz_size_t cost_of_substitution =
-                shorter[shorter_length - 1 - i] != longer[next_skew_diagonal_index - n + i];
-            sz_size_t cost_if_substitution = previous_distances[i] + cost_of_substitution;
-            sz_size_t cost_if_deletion_or_insertion = sz_min_of_two(current_distances[i], current_distances[i + 1]) + 1;
-            next_distances[i] = sz_min_of_two(cost_if_deletion_or_insertion, cost_if_substitution);
-        }
-        // Perform a circular rotation of those buffers, to reuse the memory, this time, with a shift,
-        // dropping the first element in the current array.
-        sz_size_t *temporary = previous_distances;
-        previous_distances = current_distances + 1;
-        current_distances = next_distances;
-        next_distances = temporary;
+    sz_size_t const skip_length = allow_overlap ? 1 : n_length;
+    for (sz_size_t offset = 0; count != capacity; ++count) {
+        sz_cptr_t match = sz_find_serial(h + offset, h_length - offset, n, n_length);
+        if (!match) break;
+        offset = (sz_size_t)(match - h);
+        if (offsets) offsets[count] = offset;
+        offset += skip_length;
     }
+    return count;
+}
 
-    // Cache scalar before `free` call.
-    sz_size_t result = current_distances[0];
-    alloc->free(distances, buffer_length, alloc->handle);
-    return result;
+SZ_PUBLIC sz_size_t sz_find_all_charset_serial(sz_cptr_t text, sz_size_t length, sz_charset_t const *set,
+                                               sz_size_t *offsets, sz_size_t capacity) {
+    sz_size_t count = 0;
+    for (sz_size_t i = 0; i != length && count != capacity; ++i) {
+        if (!sz_charset_contains(set, text[i])) continue;
+        if (offsets) offsets[count] = i;
+        ++count;
+    }
+    return count;
 }
 
 /**
- *  @brief  Describes the length of a UTF8 character / codepoint / rune in bytes.
+ *  @brief  Helper for the SIMD backends of ::sz_find_all, handing the tail of the haystack from the ::start offset
+ *          to the serial backend and rebasing the exported offsets.
+ *  @return Total number of exported offsets, including the ::count of the already exported ones.
  */
-typedef enum {
-    sz_utf8_invalid_k = 0,     //!< Invalid UTF8 character.
-    sz_utf8_rune_1byte_k = 1,  //!< 1-byte UTF8 character.
-    sz_utf8_rune_2bytes_k = 2, //!< 2-byte UTF8 character.
-    sz_utf8_rune_3bytes_k = 3, //!< 3-byte UTF8 character.
-    sz_utf8_rune_4bytes_k = 4, //!< 4-byte UTF8 character.
-} sz_rune_length_t;
+SZ_INTERNAL sz_size_t _sz_find_all_resume_serial(sz_cptr_t h, sz_size_t h_length, sz_size_t start, //
+                                                 sz_cptr_t n, sz_size_t n_length, sz_bool_t allow_overlap,
+                                                 sz_size_t *offsets, sz_size_t count, sz_size_t capacity) {
+    sz_size_t *tail_offsets = offsets ? offsets + count : SZ_NULL;
+    sz_size_t tail_count =
+        sz_find_all_serial(h + start, h_length - start, n, n_length, allow_overlap, tail_offsets, capacity - count);
+    if (tail_offsets)
+        for (sz_size_t i = 0; i != tail_count; ++i) tail_offsets[i] += start;
+    return count + tail_count;
+}
 
-typedef sz_u32_t sz_rune_t;
+/**
+ *  @brief  Helper for the SIMD backends of ::sz_find_all_charset, similar to ::_sz_find_all_resume_serial.
+ */
+SZ_INTERNAL sz_size_t _sz_find_all_charset_resume_serial(sz_cptr_t text, sz_size_t length, sz_size_t start,
+                                                         sz_charset_t const *set, sz_size_t *offsets,
+                                                         sz_size_t count, sz_size_t capacity) {
+    sz_size_t *tail_offsets = offsets ? offsets + count : SZ_NULL;
+    sz_size_t tail_count =
+        sz_find_all_charset_serial(text + start, length - start, set, tail_offsets, capacity - count);
+    if (tail_offsets)
+        for (sz_size_t i = 0; i != tail_count; ++i) tail_offsets[i] += start;
+    return count + tail_count;
+}
 
 /**
- *  @brief  Extracts just one UTF8 codepoint from a UTF8 string into a 32-bit unsigned integer.
+ *  @brief  Folds an uppercase ASCII letter into lowercase, leaving all other bytes intact.
  */
-SZ_INTERNAL void _sz_extract_utf8_rune(sz_cptr_t utf8, sz_rune_t *code, sz_rune_length_t *code_length) {
-    sz_u8_t const *current = (sz_u8_t const *)utf8;
-    sz_u8_t leading_byte = *current++;
-    sz_rune_t ch;
-    sz_rune_length_t ch_length;
+SZ_INTERNAL sz_u8_t _sz_u8_fold_ascii(sz_u8_t c) { return (sz_u8_t)(c - 'A') < 26 ? (sz_u8_t)(c | 0x20) : c; }
 
-    // TODO: This can be made entirely branchless using 32-bit SWAR.
-    if (leading_byte < 0x80) {
-        // Single-byte rune (0xxxxxxx)
-        ch = leading_byte;
-        ch_length = sz_utf8_rune_1byte_k;
-    }
-    else if ((leading_byte & 0xE0) == 0xC0) {
-        // Two-byte rune (110xxxxx 10xxxxxx)
-        ch = (leading_byte & 0x1F) << 6;
-        ch |= (*current++ & 0x3F);
-        ch_length = sz_utf8_rune_2bytes_k;
-    }
-    else if ((leading_byte & 0xF0) == 0xE0) {
-        // Three-byte rune (1110xxxx 10xxxxxx 10xxxxxx)
-        ch = (leading_byte & 0x0F) << 12;
-        ch |= (*current++ & 0x3F) << 6;
-        ch |= (*current++ & 0x3F);
-        ch_length = sz_utf8_rune_3bytes_k;
-    }
-    else if ((leading_byte & 0xF8) == 0xF0) {
-        // Four-byte rune (11110xxx 10xxxxxx 10xxxxxx 10xxxxxx)
-        ch = (leading_byte & 0x07) << 18;
-        ch |= (*current++ & 0x3F) << 12;
-        ch |= (*current++ & 0x3F) << 6;
-        ch |= (*current++ & 0x3F);
-        ch_length = sz_utf8_rune_4bytes_k;
-    }
-    else {
-        // Invalid UTF8 rune.
-        ch = 0;
-        ch_length = sz_utf8_invalid_k;
-    }
-    *code = ch;
-    *code_length = ch_length;
+/**
+ *  @brief  Folds eight bytes at a time with SWAR, equivalent to ::_sz_u8_fold_ascii applied to every byte.
+ *          The bottom 7 bits of each byte are offset to overflow into the top bit for bytes in the "A-Z" range,
+ *          without carrying into the neighboring bytes.
+ */
+SZ_INTERNAL sz_u64_vec_t _sz_u64_fold_ascii(sz_u64_vec_t vec) {
+    sz_u64_t const lows = vec.u64 & 0x7F7F7F7F7F7F7F7Full;
+    sz_u64_t const at_least_a = lows + 0x3F3F3F3F3F3F3F3Full; // 0x80 - 'A'
+    sz_u64_t const above_z = lows + 0x2525252525252525ull;    // 0x80 - 'Z' - 1
+    sz_u64_t const uppers = at_least_a & ~above_z & ~vec.u64 & 0x8080808080808080ull;
+    vec.u64 |= uppers >> 2;
+    return vec;
 }
 
 /**
- *  @brief  Exports a UTF8 string into a UTF32 buffer.
- *          ! The result is undefined id the UTF8 string is corrupted.
- *  @return The length in the number of codepoints.
+ *  @brief  Compares two equal-length strings, ignoring the case of ASCII letters.
  */
-SZ_INTERNAL sz_size_t _sz_export_utf8_to_utf32(sz_cptr_t utf8, sz_size_t utf8_length, sz_rune_t *utf32) {
-    sz_cptr_t const end = utf8 + utf8_length;
-    sz_size_t count = 0;
-    sz_rune_length_t rune_length;
-    for (; utf8 != end; utf8 += rune_length, utf32++, count++) _sz_extract_utf8_rune(utf8, utf32, &rune_length);
-    return count;
+SZ_INTERNAL sz_bool_t _sz_equal_caseless_serial(sz_cptr_t a, sz_cptr_t b, sz_size_t length) {
+    sz_cptr_t const a_end = a + length;
+    for (; a + 8 <= a_end; a += 8, b += 8)
+        if (_sz_u64_fold_ascii(sz_u64_load(a)).u64 != _sz_u64_fold_ascii(sz_u64_load(b)).u64) return sz_false_k;
+    for (; a != a_end; ++a, ++b)
+        if (_sz_u8_fold_ascii(*(sz_u8_t const *)a) != _sz_u8_fold_ascii(*(sz_u8_t const *)b)) return sz_false_k;
+    return sz_true_k;
+}
+
+SZ_PUBLIC sz_cptr_t sz_find_caseless_serial(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
+
+    // This almost never fires, but it's better to be safe than sorry.
+    if (h_length < n_length || !n_length) return SZ_NULL_CHAR;
+
+    // Compare the folded first and last characters of the needle, before checking the whole candidate.
+    sz_u8_t const n_first = _sz_u8_fold_ascii(*(sz_u8_t const *)n);
+    sz_u8_t const n_last = _sz_u8_fold_ascii(*(sz_u8_t const *)(n + n_length - 1));
+    sz_cptr_t const h_end = h + h_length - n_length + 1;
+
+#if !SZ_DETECT_BIG_ENDIAN // Use SWAR only on little-endian platforms for brevity.
+    sz_u64_vec_t h_first_vec, h_last_vec, n_first_vec, n_last_vec, matches_vec;
+    n_first_vec.u64 = (sz_u64_t)n_first * 0x0101010101010101ull;
+    n_last_vec.u64 = (sz_u64_t)n_last * 0x0101010101010101ull;
+    for (; h + 8 <= h_end; h += 8) {
+        h_first_vec = _sz_u64_fold_ascii(sz_u64_load(h));
+        h_last_vec = _sz_u64_fold_ascii(sz_u64_load(h + n_length - 1));
+        matches_vec.u64 = _sz_u64_each_byte_equal(h_first_vec, n_first_vec).u64 &
+                          _sz_u64_each_byte_equal(h_last_vec, n_last_vec).u64;
+        while (matches_vec.u64) {
+            int potential_offset = sz_u64_ctz(matches_vec.u64) / 8;
+            if (_sz_equal_caseless_serial(h + potential_offset, n, n_length)) return h + potential_offset;
+            matches_vec.u64 &= matches_vec.u64 - 1;
+        }
+    }
+#endif
+
+    for (; h < h_end; ++h)
+        if (_sz_u8_fold_ascii(*(sz_u8_t const *)h) == n_first &&
+            _sz_u8_fold_ascii(*(sz_u8_t const *)(h + n_length - 1)) == n_last &&
+            _sz_equal_caseless_serial(h, n, n_length))
+            return h;
+    return SZ_NULL_CHAR;
+}
+
+SZ_PUBLIC sz_cptr_t sz_rfind_caseless_serial(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
+
+    // This almost never fires, but it's better to be safe than sorry.
+    if (h_length < n_length || !n_length) return SZ_NULL_CHAR;
+
+    sz_u8_t const n_first = _sz_u8_fold_ascii(*(sz_u8_t const *)n);
+    sz_u8_t const n_last = _sz_u8_fold_ascii(*(sz_u8_t const *)(n + n_length - 1));
+
+    // The `h_end` points right after the last potential starting position of a match.
+    sz_cptr_t h_end = h + h_length - n_length + 1;
+
+#if !SZ_DETECT_BIG_ENDIAN // Use SWAR only on little-endian platforms for brevity.
+    sz_u64_vec_t h_first_vec, h_last_vec, n_first_vec, n_last_vec, matches_vec;
+    n_first_vec.u64 = (sz_u64_t)n_first * 0x0101010101010101ull;
+    n_last_vec.u64 = (sz_u64_t)n_last * 0x0101010101010101ull;
+    for (; h + 8 <= h_end; h_end -= 8) {
+        h_first_vec = _sz_u64_fold_ascii(sz_u64_load(h_end - 8));
+        h_last_vec = _sz_u64_fold_ascii(sz_u64_load(h_end - 8 + n_length - 1));
+        matches_vec.u64 = _sz_u64_each_byte_equal(h_first_vec, n_first_vec).u64 &
+                          _sz_u64_each_byte_equal(h_last_vec, n_last_vec).u64;
+        while (matches_vec.u64) {
+            int potential_offset = sz_u64_clz(matches_vec.u64) / 8;
+            if (_sz_equal_caseless_serial(h_end - 1 - potential_offset, n, n_length))
+                return h_end - 1 - potential_offset;
+            matches_vec.u64 &= ~(0x80ull << ((7 - potential_offset) * 8));
+        }
+    }
+#endif
+
+    while (h_end != h) {
+        --h_end;
+        if (_sz_u8_fold_ascii(*(sz_u8_t const *)h_end) == n_first &&
+            _sz_u8_fold_ascii(*(sz_u8_t const *)(h_end + n_length - 1)) == n_last &&
+            _sz_equal_caseless_serial(h_end, n, n_length))
+            return h_end;
+    }
+    return SZ_NULL_CHAR;
+}
+
+/**
+ *  @brief  Packs up to 4 leading bytes of a string into an integer, independent of the platform endianness.
+ */
+SZ_INTERNAL sz_u32_t _sz_multi_matcher_prefix(sz_cptr_t text, sz_size_t prefix_length) {
+    sz_u8_t const *bytes = (sz_u8_t const *)text;
+    sz_u32_t prefix = 0;
+    for (sz_size_t i = 0; i != prefix_length; ++i) prefix |= (sz_u32_t)bytes[i] << (i * 8);
+    return prefix;
+}
+
+SZ_INTERNAL sz_size_t _sz_multi_matcher_bucket(sz_multi_matcher_t const *matcher, sz_u32_t prefix) {
+    // Knuth's multiplicative hashing, taking the top bits of the product.
+    return (sz_size_t)((sz_u32_t)(prefix * 2654435761u) >> matcher->buckets_shift);
+}
+
+/**
+ *  @brief  Checks if any of the needles starts at the given position of the haystack.
+ *  @return The length of the longest matching needle or zero.
+ */
+SZ_INTERNAL sz_size_t _sz_multi_matcher_verify(sz_multi_matcher_t const *matcher, sz_cptr_t text, sz_size_t length,
+                                               sz_size_t *needle_index) {
+    if (length < matcher->min_length) return 0;
+    sz_u32_t prefix = _sz_multi_matcher_prefix(text, matcher->prefix_length);
+    sz_size_t best_length = 0, best_index = 0;
+    // The chains are ordered by the needle index, so the first of identical needles wins.
+    for (sz_u32_t next = matcher->buckets[_sz_multi_matcher_bucket(matcher, prefix)]; next;
+         next = matcher->chains[next - 1]) {
+        sz_size_t index = next - 1;
+        sz_size_t needle_length = matcher->lengths[index];
+        if (needle_length <= best_length || needle_length > length) continue;
+        if (sz_equal(text, matcher->starts[index], needle_length)) best_length = needle_length, best_index = index;
+    }
+    if (best_length && needle_index) *needle_index = best_index;
+    return best_length;
+}
+
+SZ_PUBLIC sz_bool_t sz_multi_matcher_init(sz_multi_matcher_t *matcher, sz_string_view_t const *needles,
+                                          sz_size_t count, sz_memory_allocator_t *alloc) {
+    sz_assert(matcher && (needles || !count) && "Matcher and needles can't be SZ_NULL.");
+    sz_fill_serial((sz_ptr_t)matcher, sizeof(sz_multi_matcher_t), 0);
+    if (!count) return sz_true_k;
+
+    // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
+    }
+
+    // The chains are addressed with 32-bit one-based indices.
+    if (count >= 0xFFFFFFFFull / 2) return sz_false_k;
+    sz_size_t total_length = 0, min_length = SZ_SIZE_MAX, max_length = 0;
+    for (sz_size_t i = 0; i != count; ++i) {
+        sz_size_t needle_length = needles[i].length;
+        if (!needle_length) return sz_false_k;
+        total_length += needle_length;
+        min_length = sz_min_of_two(min_length, needle_length);
+        max_length = sz_max_of_two(max_length, needle_length);
+    }
+
+    // Keep the load factor of the hash-table under 50%.
+    sz_size_t buckets_bits = 4;
+    while ((1ull << buckets_bits) < count * 2) ++buckets_bits;
+    sz_size_t buckets_count = (sz_size_t)1 << buckets_bits;
+
+    // Place all of the arrays into a single allocation, ordered by the alignment requirements.
+    sz_size_t buffer_length = count * sizeof(sz_cptr_t) + count * sizeof(sz_size_t) +
+                              buckets_count * sizeof(sz_u32_t) + count * sizeof(sz_u32_t) + total_length;
+    sz_ptr_t buffer = (sz_ptr_t)alloc->allocate(buffer_length, alloc->handle);
+    if (!buffer) return sz_false_k;
+
+    sz_cptr_t *starts = (sz_cptr_t *)buffer;
+    sz_size_t *lengths = (sz_size_t *)(starts + count);
+    sz_u32_t *buckets = (sz_u32_t *)(lengths + count);
+    sz_u32_t *chains = buckets + buckets_count;
+    sz_ptr_t tape = (sz_ptr_t)(chains + count);
+
+    matcher->count = count;
+    matcher->min_length = min_length;
+    matcher->max_length = max_length;
+    matcher->prefix_length = sz_min_of_two(min_length, 4);
+    matcher->buckets_shift = 32 - buckets_bits;
+    matcher->starts = starts;
+    matcher->lengths = lengths;
+    matcher->buckets = buckets;
+    matcher->chains = chains;
+    matcher->buffer = buffer;
+    matcher->buffer_length = buffer_length;
+
+    // Export the needles into the tape.
+    for (sz_size_t i = 0; i != count; ++i) {
+        sz_copy_serial(tape, needles[i].start, needles[i].length);
+        starts[i] = tape, lengths[i] = needles[i].length;
+        tape += needles[i].length;
+    }
+
+    // Populate the buckets in reverse order, so that every chain is sorted by the needle index.
+    sz_size_t const teddy_length = sz_min_of_two(matcher->prefix_length, 3);
+    for (sz_size_t i = 0; i != buckets_count; ++i) buckets[i] = 0;
+    for (sz_size_t i = count; i != 0; --i) {
+        sz_size_t index = i - 1;
+        sz_u8_t const *needle = (sz_u8_t const *)starts[index];
+        sz_size_t bucket =
+            _sz_multi_matcher_bucket(matcher, _sz_multi_matcher_prefix(starts[index], matcher->prefix_length));
+        chains[index] = buckets[bucket];
+        buckets[bucket] = (sz_u32_t)i;
+
+        // Needles with identical prefixes will always land in the same group of the SIMD prefilter.
+        sz_u8_t group_mask = (sz_u8_t)(1u << (bucket & 7u));
+        for (sz_size_t j = 0; j != teddy_length; ++j) {
+            matcher->nibbles_low[j][needle[j] & 0x0F] |= group_mask;
+            matcher->nibbles_high[j][needle[j] >> 4] |= group_mask;
+        }
+        sz_charset_add_u8(&matcher->first_bytes, needle[0]);
+    }
+    return sz_true_k;
+}
+
+SZ_PUBLIC void sz_multi_matcher_free(sz_multi_matcher_t *matcher, sz_memory_allocator_t *alloc) {
+    sz_assert(matcher && "Matcher can't be SZ_NULL.");
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
+    }
+    if (matcher->buffer) alloc->free(matcher->buffer, matcher->buffer_length, alloc->handle);
+    sz_fill_serial((sz_ptr_t)matcher, sizeof(sz_multi_matcher_t), 0);
+}
+
+SZ_PUBLIC sz_cptr_t sz_find_multi_serial(sz_multi_matcher_t const *matcher, sz_cptr_t text, sz_size_t length,
+                                         sz_size_t *needle_index) {
+
+    if (!matcher->count || length < matcher->min_length) return SZ_NULL_CHAR;
+
+    // Jump between the potential first characters of needles, and verify the candidates.
+    sz_cptr_t const end = text + length;
+    sz_cptr_t const last_start = end - matcher->min_length;
+    while (text <= last_start) {
+        text = sz_find_charset_serial(text, (sz_size_t)(last_start - text) + 1, &matcher->first_bytes);
+        if (!text) return SZ_NULL_CHAR;
+        if (_sz_multi_matcher_verify(matcher, text, (sz_size_t)(end - text), needle_index)) return text;
+        ++text;
+    }
+    return SZ_NULL_CHAR;
+}
+
+SZ_PUBLIC sz_bool_t sz_stream_matcher_init(sz_stream_matcher_t *matcher, sz_cptr_t needle, sz_size_t needle_length,
+                                           sz_bool_t allow_overlaps, sz_memory_allocator_t *alloc) {
+    sz_assert(matcher && (needle || !needle_length) && "Matcher and needle can't be SZ_NULL.");
+    sz_fill_serial((sz_ptr_t)matcher, sizeof(sz_stream_matcher_t), 0);
+    if (!needle_length) return sz_false_k;
+
+    // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
+    }
+
+    // The needle is followed by the carry-over, which may be extended with the head of the next chunk.
+    sz_size_t buffer_length = needle_length + (needle_length - 1) * 2;
+    sz_ptr_t buffer = (sz_ptr_t)alloc->allocate(buffer_length, alloc->handle);
+    if (!buffer) return sz_false_k;
+    sz_copy_serial(buffer, needle, needle_length);
+
+    matcher->needle = buffer;
+    matcher->needle_length = needle_length;
+    matcher->carry = buffer + needle_length;
+    matcher->allow_overlaps = allow_overlaps;
+    matcher->buffer = buffer;
+    matcher->buffer_length = buffer_length;
+    return sz_true_k;
+}
+
+SZ_PUBLIC void sz_stream_matcher_free(sz_stream_matcher_t *matcher, sz_memory_allocator_t *alloc) {
+    sz_assert(matcher && "Matcher can't be SZ_NULL.");
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
+    }
+    if (matcher->buffer) alloc->free(matcher->buffer, matcher->buffer_length, alloc->handle);
+    sz_fill_serial((sz_ptr_t)matcher, sizeof(sz_stream_matcher_t), 0);
+}
+
+SZ_PUBLIC void sz_stream_matcher_reset(sz_stream_matcher_t *matcher) {
+    matcher->carry_length = 0;
+    matcher->offset = 0;
+    matcher->next_allowed = 0;
+}
+
+SZ_PUBLIC sz_size_t sz_stream_matcher_feed(sz_stream_matcher_t *matcher, sz_cptr_t chunk, sz_size_t length,
+                                           sz_stream_match_callback_t callback, void *context) {
+    sz_assert(matcher && matcher->needle_length && "The matcher must be initialized.");
+    sz_cptr_t const needle = matcher->needle;
+    sz_size_t const needle_length = matcher->needle_length;
+    sz_size_t const max_carry = needle_length - 1;
+    sz_size_t matches = 0;
+
+    // Search the carry-over, extended with the head of the chunk, for the matches straddling the boundary.
+    // The matches starting in the chunk itself will be found in the second pass.
+    sz_ptr_t const carry = matcher->carry;
+    sz_size_t const carry_length = matcher->carry_length;
+    sz_size_t const head_length = sz_min_of_two(max_carry, length);
+    sz_size_t const window_length = carry_length + head_length;
+    sz_size_t const window_offset = matcher->offset - carry_length;
+    if (carry_length) {
+        sz_copy(carry + carry_length, chunk, head_length);
+        for (sz_size_t start = 0; start < carry_length;) {
+            sz_cptr_t match = sz_find(carry + start, window_length - start, needle, needle_length);
+            if (!match) break;
+            sz_size_t match_start = (sz_size_t)(match - carry);
+            if (match_start >= carry_length) break;
+            sz_size_t absolute = window_offset + match_start;
+            if (absolute >= matcher->next_allowed) {
+                callback(context, absolute), ++matches;
+                if (!matcher->allow_overlaps) matcher->next_allowed = absolute + needle_length;
+            }
+            start = match_start + 1;
+        }
+    }
+
+    // Search the chunk itself, skipping the part covered by a previous non-overlapping match.
+    sz_size_t start = matcher->next_allowed > matcher->offset ? matcher->next_allowed - matcher->offset : 0;
+    while (start < length) {
+        sz_cptr_t match = sz_find(chunk + start, length - start, needle, needle_length);
+        if (!match) break;
+        sz_size_t match_start = (sz_size_t)(match - chunk);
+        callback(context, matcher->offset + match_start), ++matches;
+        if (!matcher->allow_overlaps) {
+            matcher->next_allowed = matcher->offset + match_start + needle_length;
+            start = match_start + needle_length;
+        }
+        else { start = match_start + 1; }
+    }
+
+    // Keep the last `needle_length - 1` bytes of the stream for the next call.
+    if (length >= max_carry) {
+        sz_copy(carry, chunk + length - max_carry, max_carry);
+        matcher->carry_length = max_carry;
+    }
+    else {
+        // The whole chunk is already appended to the carry-over, only the tail of the window must remain.
+        sz_size_t new_carry_length = sz_min_of_two(max_carry, window_length);
+        if (!carry_length) sz_copy(carry, chunk, length);
+        else sz_move(carry, carry + window_length - new_carry_length, new_carry_length);
+        matcher->carry_length = new_carry_length;
+    }
+    matcher->offset += length;
+    return matches;
+}
+
+/**
+ *  @brief  Codes of the non-literal atoms of a glob-style pattern, following the 256 literal bytes.
+ *          The compiled ::sz_glob_matcher_t stores the `i`-th class as `_sz_glob_class_k + i`.
+ */
+typedef enum { _sz_glob_any_k = 256, _sz_glob_class_k = 257, _sz_glob_star_k = 258 } _sz_glob_atom_t;
+
+/**
+ *  @brief  Parses the next atom of a glob-style pattern, advancing the ::cursor past it.
+ *  @return A literal byte, `_sz_glob_any_k`, `_sz_glob_star_k`, or `_sz_glob_class_k` with the ::class_members.
+ */
+SZ_INTERNAL sz_u32_t _sz_glob_next_atom(sz_cptr_t *cursor, sz_cptr_t end, sz_charset_t *class_members) {
+    sz_u8_t const *it = (sz_u8_t const *)*cursor;
+    sz_u8_t const *const stop = (sz_u8_t const *)end;
+    sz_u8_t head = *it++;
+    if (head == '*' || head == '?') {
+        *cursor = (sz_cptr_t)it;
+        return head == '*' ? _sz_glob_star_k : _sz_glob_any_k;
+    }
+    if (head == '\\') {
+        if (it != stop) head = *it++;
+        *cursor = (sz_cptr_t)it;
+        return head;
+    }
+    if (head != '[') {
+        *cursor = (sz_cptr_t)it;
+        return head;
+    }
+
+    // A bracket expression, where the first `]` is a member rather than the terminator.
+    sz_u8_t const *member = it;
+    sz_bool_t negated = sz_false_k;
+    if (member != stop && (*member == '!' || *member == '^')) negated = sz_true_k, ++member;
+    sz_charset_init(class_members);
+    for (sz_u8_t const *first = member; member != stop && (*member != ']' || member == first);) {
+        sz_u8_t low = *member++;
+        if (low == '\\' && member != stop) low = *member++;
+        sz_u8_t high = low;
+        if (stop - member >= 2 && member[0] == '-' && member[1] != ']') {
+            high = member[1], member += 2;
+            if (high == '\\' && member != stop) high = *member++;
+        }
+        for (sz_u32_t c = low; c <= high; ++c) sz_charset_add_u8(class_members, (sz_u8_t)c);
+    }
+
+    // An unterminated bracket is just a literal.
+    if (member == stop) {
+        *cursor = (sz_cptr_t)it;
+        return '[';
+    }
+    if (negated) sz_charset_invert(class_members);
+    *cursor = (sz_cptr_t)(member + 1);
+    return _sz_glob_class_k;
+}
+
+SZ_PUBLIC sz_bool_t sz_glob_matcher_init(sz_glob_matcher_t *matcher, sz_cptr_t pattern, sz_size_t pattern_length,
+                                         sz_memory_allocator_t *alloc) {
+    sz_assert(matcher && (pattern || !pattern_length) && "Matcher and pattern can't be SZ_NULL.");
+    sz_fill_serial((sz_ptr_t)matcher, sizeof(sz_glob_matcher_t), 0);
+
+    // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
+    }
+
+    // The first pass only counts the atoms, classes, and pieces, merging the consecutive stars.
+    sz_cptr_t const end = pattern + pattern_length;
+    sz_charset_t class_members;
+    sz_size_t atoms_count = 0, classes_count = 0, pieces_count = 1;
+    sz_u32_t previous = 0;
+    for (sz_cptr_t cursor = pattern; cursor != end;) {
+        sz_u32_t atom = _sz_glob_next_atom(&cursor, end, &class_members);
+        if (atom == _sz_glob_star_k) pieces_count += previous != _sz_glob_star_k;
+        else ++atoms_count, classes_count += atom == _sz_glob_class_k;
+        previous = atom;
+    }
+
+    // Place all of the arrays into a single allocation, ordered by the alignment requirements.
+    sz_size_t buffer_length = classes_count * sizeof(sz_charset_t) + (pieces_count * 3 + 1) * sizeof(sz_size_t) +
+                              atoms_count * sizeof(sz_u32_t) + atoms_count;
+    sz_ptr_t buffer = (sz_ptr_t)alloc->allocate(buffer_length, alloc->handle);
+    if (!buffer) return sz_false_k;
+
+    sz_charset_t *classes = (sz_charset_t *)buffer;
+    sz_size_t *pieces = (sz_size_t *)(classes + classes_count);
+    sz_size_t *runs_offsets = pieces + pieces_count + 1;
+    sz_size_t *runs_lengths = runs_offsets + pieces_count;
+    sz_u32_t *atoms = (sz_u32_t *)(runs_lengths + pieces_count);
+    sz_ptr_t literals = (sz_ptr_t)(atoms + atoms_count);
+
+    // The second pass exports the atoms, zero-filling the literals at non-literal offsets.
+    sz_size_t atom_index = 0, class_index = 0, piece_index = 0;
+    pieces[0] = 0, previous = 0;
+    for (sz_cptr_t cursor = pattern; cursor != end;) {
+        sz_u32_t atom = _sz_glob_next_atom(&cursor, end, &class_members);
+        if (atom == _sz_glob_star_k) {
+            if (previous != _sz_glob_star_k) pieces[++piece_index] = atom_index;
+        }
+        else if (atom == _sz_glob_class_k) {
+            classes[class_index] = class_members;
+            atoms[atom_index] = _sz_glob_class_k + (sz_u32_t)class_index++;
+            literals[atom_index++] = 0;
+        }
+        else {
+            atoms[atom_index] = atom;
+            literals[atom_index++] = (sz_u8_t)(atom & 0xFFu);
+        }
+        previous = atom;
+    }
+    pieces[pieces_count] = atoms_count;
+
+    // Locate the longest literal run in every piece, and the longest one across the floating pieces.
+    sz_size_t prefilter_piece = 0;
+    for (sz_size_t piece = 0; piece != pieces_count; ++piece) {
+        sz_size_t best_offset = 0, best_length = 0, run_length = 0;
+        for (sz_size_t i = pieces[piece]; i != pieces[piece + 1]; ++i) {
+            run_length = atoms[i] < _sz_glob_any_k ? run_length + 1 : 0;
+            if (run_length > best_length) best_length = run_length, best_offset = i + 1 - run_length - pieces[piece];
+        }
+        runs_offsets[piece] = best_offset, runs_lengths[piece] = best_length;
+        sz_bool_t is_floating = (sz_bool_t)(piece != 0 && piece + 1 != pieces_count);
+        if (is_floating && best_length && (!prefilter_piece || best_length > runs_lengths[prefilter_piece]))
+            prefilter_piece = piece;
+    }
+
+    matcher->atoms_count = atoms_count;
+    matcher->pieces_count = pieces_count;
+    matcher->prefilter_piece = prefilter_piece;
+    matcher->atoms = atoms;
+    matcher->literals = literals;
+    matcher->classes = classes;
+    matcher->pieces = pieces;
+    matcher->runs_offsets = runs_offsets;
+    matcher->runs_lengths = runs_lengths;
+    matcher->buffer = buffer;
+    matcher->buffer_length = buffer_length;
+    return sz_true_k;
+}
+
+SZ_PUBLIC void sz_glob_matcher_free(sz_glob_matcher_t *matcher, sz_memory_allocator_t *alloc) {
+    sz_assert(matcher && "Matcher can't be SZ_NULL.");
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
+    }
+    if (matcher->buffer) alloc->free(matcher->buffer, matcher->buffer_length, alloc->handle);
+    sz_fill_serial((sz_ptr_t)matcher, sizeof(sz_glob_matcher_t), 0);
+}
+
+/**
+ *  @brief  Checks if the given piece of a glob-style pattern matches the text at its very start.
+ *          The text must be at least as long as the piece.
+ */
+SZ_INTERNAL sz_bool_t _sz_glob_verify(sz_glob_matcher_t const *matcher, sz_size_t piece, sz_cptr_t text) {
+    sz_u32_t const *atoms = matcher->atoms + matcher->pieces[piece];
+    sz_size_t const count = matcher->pieces[piece + 1] - matcher->pieces[piece];
+    sz_u8_t const *bytes = (sz_u8_t const *)text;
+    for (sz_size_t i = 0; i != count; ++i) {
+        sz_u32_t atom = atoms[i];
+        if (atom < _sz_glob_any_k) {
+            if (bytes[i] != atom) return sz_false_k;
+        }
+        else if (atom != _sz_glob_any_k &&
+                 !sz_charset_contains_u8(&matcher->classes[atom - _sz_glob_class_k], bytes[i]))
+            return sz_false_k;
+    }
+    return sz_true_k;
+}
+
+/**
+ *  @brief  Locates the leftmost occurrence of a floating piece of a glob-style pattern,
+ *          jumping between the occurrences of its longest literal run, or of its leading class.
+ */
+SZ_INTERNAL sz_cptr_t _sz_glob_find_piece(sz_glob_matcher_t const *matcher, sz_size_t piece, sz_cptr_t text,
+                                          sz_size_t length) {
+    sz_size_t const piece_length = matcher->pieces[piece + 1] - matcher->pieces[piece];
+    if (piece_length > length) return SZ_NULL_CHAR;
+    sz_size_t const last_start = length - piece_length;
+    sz_size_t const run_offset = matcher->runs_offsets[piece];
+    sz_size_t const run_length = matcher->runs_lengths[piece];
+    sz_u32_t const first_atom = matcher->atoms[matcher->pieces[piece]];
+    sz_cptr_t const run = matcher->literals + matcher->pieces[piece] + run_offset;
+
+    for (sz_size_t start = 0; start <= last_start; ++start) {
+        sz_cptr_t found;
+        if (run_length) {
+            found = sz_find(text + start + run_offset, last_start - start + run_length, run, run_length);
+            if (!found) return SZ_NULL_CHAR;
+            found -= run_offset;
+        }
+        else if (first_atom > _sz_glob_any_k) {
+            found = sz_find_charset(text + start, last_start - start + 1,
+                                    &matcher->classes[first_atom - _sz_glob_class_k]);
+            if (!found) return SZ_NULL_CHAR;
+        }
+        else { found = text + start; }
+        start = (sz_size_t)(found - text);
+        if (_sz_glob_verify(matcher, piece, found)) return found;
+    }
+    return SZ_NULL_CHAR;
+}
+
+SZ_PUBLIC sz_bool_t sz_glob_match(sz_glob_matcher_t const *matcher, sz_cptr_t text, sz_size_t length) {
+    sz_size_t const pieces_count = matcher->pieces_count;
+    sz_size_t const atoms_count = matcher->atoms_count;
+    if (!pieces_count || length < atoms_count) return sz_false_k;
+
+    // Without any stars, the pattern has a fixed width.
+    sz_size_t const *pieces = matcher->pieces;
+    if (pieces_count == 1) return (sz_bool_t)(length == atoms_count && _sz_glob_verify(matcher, 0, text));
+
+    // The head and the tail are anchored, and can't overlap, as the text is at least as long as all the atoms.
+    sz_size_t const tail_length = atoms_count - pieces[pieces_count - 1];
+    if (!_sz_glob_verify(matcher, 0, text) || !_sz_glob_verify(matcher, pieces_count - 1, text + length - tail_length))
+        return sz_false_k;
+    sz_cptr_t window = text + pieces[1];
+    sz_cptr_t const window_end = text + length - tail_length;
+
+    // Reject early if the longest literal is missing, unless it's in the first floating piece,
+    // that will be searched for right away.
+    sz_size_t const prefilter = matcher->prefilter_piece;
+    if (prefilter > 1) {
+        sz_cptr_t run = matcher->literals + pieces[prefilter] + matcher->runs_offsets[prefilter];
+        if (!sz_find(window, (sz_size_t)(window_end - window), run, matcher->runs_lengths[prefilter]))
+            return sz_false_k;
+    }
+
+    // The leftmost occurrence of every floating piece leaves the most room for the following ones.
+    for (sz_size_t piece = 1; piece + 1 < pieces_count; ++piece) {
+        sz_cptr_t found = _sz_glob_find_piece(matcher, piece, window, (sz_size_t)(window_end - window));
+        if (!found) return sz_false_k;
+        window = found + (pieces[piece + 1] - pieces[piece]);
+    }
+    return sz_true_k;
+}
+
+SZ_INTERNAL sz_size_t _sz_edit_distance_skewed_diagonals_serial( //
+    sz_cptr_t shorter, sz_size_t shorter_length,                 //
+    sz_cptr_t longer, sz_size_t longer_length,                   //
+    sz_size_t bound, sz_memory_allocator_t *alloc) {
+
+    // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
+    }
+
+    // TODO: Generalize to remove the following asserts!
+    sz_assert(!bound && "For bounded search the method should only evaluate one band of the matrix.");
+    sz_assert(shorter_length == longer_length && "The method hasn't been generalized to different length inputs yet.");
+    sz_unused(longer_length && bound);
+
+    // We are going to store 3 diagonals of the matrix.
+    // The length of the longest (main) diagonal would be `n = (shorter_length + 1)`.
+    sz_size_t n = shorter_length + 1;
+    sz_size_t buffer_length = sizeof(sz_size_t) * n * 3;
+    sz_size_t *distances = (sz_size_t *)alloc->allocate(buffer_length, alloc->handle);
+    if (!distances) return SZ_SIZE_MAX;
+
+    sz_size_t *previous_distances = distances;
+    sz_size_t *current_distances = previous_distances + n;
+    sz_size_t *next_distances = previous_distances + n * 2;
+
+    // Initialize the first two diagonals:
+    previous_distances[0] = 0;
+    current_distances[0] = current_distances[1] = 1;
+
+    // Progress through the upper triangle of the Levenshtein matrix.
+    sz_size_t next_skew_diagonal_index = 2;
+    for (; next_skew_diagonal_index != n; ++next_skew_diagonal_index) {
+        sz_size_t const next_skew_diagonal_length = next_skew_diagonal_index + 1;
+        for (sz_size_t i = 0; i + 2 < next_skew_diagonal_length; ++i) {
+            sz_size_t cost_of_substitution = shorter[next_skew_diagonal_index - i - 2] != longer[i];
+            sz_size_t cost_if_substitution = previous_distances[i] + cost_of_substitution;
+            sz_size_t cost_if_deletion_or_insertion = sz_min_of_two(current_distances[i], current_distances[i + 1]) + 1;
+            next_distances[i + 1] = sz_min_of_two(cost_if_deletion_or_insertion, cost_if_substitution);
+        }
+        // Don't forget to populate the first row and the first column of the Levenshtein matrix.
+        next_distances[0] = next_distances[next_skew_diagonal_length - 1] = next_skew_diagonal_index;
+        // Perform a circular rotation of those buffers, to reuse the memory.
+        sz_size_t *temporary = previous_distances;
+        previous_distances = current_distances;
+        current_distances = next_distances;
+        next_distances = temporary;
+    }
+
+    // By now we've scanned through the upper triangle of the matrix, where each subsequent iteration results in a
+    // larger diagonal. From now onwards, we will be shrinking. Instead of adding value equal to the skewed diagonal
+    // index on either side, we will be cropping those values out.
+    sz_size_t total_diagonals = n + n - 1;
+    for (; next_skew_diagonal_index != total_diagonals; ++next_skew_diagonal_index) {
+        sz_size_t const next_skew_diagonal_length = total_diagonals - next_skew_diagonal_index;
+        for (sz_size_t i = 0; i != next_skew_diagonal_length; ++i) {
+            sz_size_t cost_of_substitution =
+                shorter[shorter_length - 1 - i] != longer[next_skew_diagonal_index - n + i];
+            sz_size_t cost_if_substitution = previous_distances[i] + cost_of_substitution;
+            sz_size_t cost_if_deletion_or_insertion = sz_min_of_two(current_distances[i], current_distances[i + 1]) + 1;
+            next_distances[i] = sz_min_of_two(cost_if_deletion_or_insertion, cost_if_substitution);
+        }
+        // Perform a circular rotation of those buffers, to reuse the memory, this time, with a shift,
+        // dropping the first element in the current array.
+        sz_size_t *temporary = previous_distances;
+        previous_distances = current_distances + 1;
+        current_distances = next_distances;
+        next_distances = temporary;
+    }
+
+    // Cache scalar before `free` call.
+    sz_size_t result = current_distances[0];
+    alloc->free(distances, buffer_length, alloc->handle);
+    return result;
+}
+
+/**
+ *  @brief  Extracts just one UTF8 codepoint from a UTF8 string into a 32-bit unsigned integer.
+ */
+SZ_INTERNAL void _sz_extract_utf8_rune(sz_cptr_t utf8, sz_rune_t *code, sz_rune_length_t *code_length) {
+    sz_u8_t const *current = (sz_u8_t const *)utf8;
+    sz_u8_t leading_byte = *current++;
+    sz_rune_t ch;
+    sz_rune_length_t ch_length;
+
+    // TODO: This can be made entirely branchless using 32-bit SWAR.
+    if (leading_byte < 0x80) {
+        // Single-byte rune (0xxxxxxx)
+        ch = leading_byte;
+        ch_length = sz_utf8_rune_1byte_k;
+    }
+    else if ((leading_byte & 0xE0) == 0xC0) {
+        // Two-byte rune (110xxxxx 10xxxxxx)
+        ch = (leading_byte & 0x1F) << 6;
+        ch |= (*current++ & 0x3F);
+        ch_length = sz_utf8_rune_2bytes_k;
+    }
+    else if ((leading_byte & 0xF0) == 0xE0) {
+        // Three-byte rune (1110xxxx 10xxxxxx 10xxxxxx)
+        ch = (leading_byte & 0x0F) << 12;
+        ch |= (*current++ & 0x3F) << 6;
+        ch |= (*current++ & 0x3F);
+        ch_length = sz_utf8_rune_3bytes_k;
+    }
+    else if ((leading_byte & 0xF8) == 0xF0) {
+        // Four-byte rune (11110xxx 10xxxxxx 10xxxxxx 10xxxxxx)
+        ch = (leading_byte & 0x07) << 18;
+        ch |= (*current++ & 0x3F) << 12;
+        ch |= (*current++ & 0x3F) << 6;
+        ch |= (*current++ & 0x3F);
+        ch_length = sz_utf8_rune_4bytes_k;
+    }
+    else {
+        // Invalid UTF8 rune.
+        ch = 0;
+        ch_length = sz_utf8_invalid_k;
+    }
+    *code = ch;
+    *code_length = ch_length;
+}
+
+/**
+ *  @brief  Checks if the byte is a `10xxxxxx` UTF8 continuation byte, that can't start a rune.
+ */
+SZ_INTERNAL sz_bool_t _sz_utf8_is_continuation(sz_u8_t byte) { return (sz_bool_t)((byte & 0xC0) == 0x80); }
+
+/**
+ *  @brief  Nibble look-up tables for the vectorized UTF8 validation, indexed by the high and low nibbles of a byte,
+ *          and the high nibble of the byte that follows. Every bit is a class of errors, and a pair of bytes
+ *          is invalid, if a bit is set in all three looked-up values:
+ *
+ *      - 0x01: a leading byte is followed by another leading byte or an ASCII character.
+ *      - 0x02: an ASCII character is followed by a continuation byte.
+ *      - 0x04: an overlong 3-byte encoding, like `11100000 100xxxxx`.
+ *      - 0x08: a codepoint beyond U+10FFFF, like `11110100 1001xxxx` or `11110101 10xxxxxx`.
+ *      - 0x10: a UTF16 surrogate, like `11101101 101xxxxx`.
+ *      - 0x20: an overlong 2-byte encoding, like `1100000x 10xxxxxx`.
+ *      - 0x40: an overlong 4-byte encoding or a codepoint beyond U+10FFFF, like `11110000 1000xxxx`.
+ *      - 0x80: two continuation bytes in a row, expected only after 3- and 4-byte leading bytes.
+ *
+ *  @see    "Validating UTF-8 In Less Than One Instruction Per Byte" by John Keiser and Daniel Lemire, 2020.
+ */
+#if SZ_USE_X86_AVX2 || SZ_USE_X86_AVX512 || SZ_USE_ARM_NEON
+static sz_u8_t const _sz_utf8_lookup_tables[3][16] = {
+    // The high nibble of the first byte.
+    {0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x80, 0x80, 0x80, 0x80, 0x21, 0x01, 0x15, 0x49},
+    // The low nibble of the first byte.
+    {0xE7, 0xA3, 0x83, 0x83, 0x8B, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xDB, 0xCB, 0xCB},
+    // The high nibble of the second byte.
+    {0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xE6, 0xAE, 0xBA, 0xBA, 0x01, 0x01, 0x01, 0x01},
+};
+#endif
+
+/**
+ *  @brief  Decodes the rune starting at a non-continuation byte, taking the lower 6 bits of the following
+ *          bytes, as many as the leading byte implies. The bytes past the ::end are treated as zeros.
+ *          Unlike ::_sz_extract_utf8_rune, never checks the continuation bytes, matching the SIMD decoders.
+ */
+SZ_INTERNAL sz_rune_t _sz_utf8_decode_lead(sz_u8_t const *utf8, sz_u8_t const *end) {
+    sz_rune_t const lead = utf8[0];
+    if (lead < 0x80) return lead;
+    sz_size_t const following = (sz_size_t)(end - utf8) - 1;
+    sz_rune_t const first = following > 0 ? (utf8[1] & 0x3F) : 0;
+    sz_rune_t const second = following > 1 ? (utf8[2] & 0x3F) : 0;
+    sz_rune_t const third = following > 2 ? (utf8[3] & 0x3F) : 0;
+    if (lead < 0xE0) return ((lead & 0x1F) << 6) | first;
+    if (lead < 0xF0) return ((lead & 0x0F) << 12) | (first << 6) | second;
+    return ((lead & 0x07) << 18) | (first << 12) | (second << 6) | third;
+}
+
+/**
+ *  @brief  Decodes the next UTF8 rune, skipping the stray continuation bytes, consistent with ::sz_utf8_count.
+ *          The caller must make sure, that at least one more rune is present before the ::end.
+ */
+SZ_INTERNAL sz_cptr_t _sz_utf8_next_rune(sz_cptr_t utf8, sz_cptr_t end, sz_rune_t *rune) {
+    sz_u8_t const *current = (sz_u8_t const *)utf8;
+    while (_sz_utf8_is_continuation(*current)) ++current;
+    *rune = _sz_utf8_decode_lead(current, (sz_u8_t const *)end);
+    return (sz_cptr_t)(current + 1);
+}
+
+/**
+ *  @brief  Ukkonen's banded Levenshtein distance computation, evaluating only the `2 * bound + 1` diagonals
+ *          around the main one, as the cells further away can't be reached in under ::bound edits.
+ *          All the cells are saturated at ::bound, so the cells outside of the band are equivalent to it.
+ *
+ *  Uses O(bound) memory: a single row of the band, updated in-place, and for UTF8 inputs - a ring buffer
+ *  of the decoded runes of the ::shorter string, that slides along with the band.
+ *
+ *  @see    https://doi.org/10.1016/S0019-9958(85)80046-2
+ */
+SZ_INTERNAL sz_size_t _sz_edit_distance_banded_serial( //
+    sz_cptr_t longer, sz_size_t longer_length,         //
+    sz_cptr_t shorter, sz_size_t shorter_length,       //
+    sz_size_t bound, sz_bool_t can_be_unicode, sz_memory_allocator_t *alloc) {
+
+    sz_assert(bound && "The band is only defined for bounded distances.");
+
+    // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
+    }
+
+    // For UTF8 inputs, the matrix dimensions are measured in runes, rather than bytes.
+    sz_cptr_t longer_end = SZ_NULL_CHAR, shorter_end = SZ_NULL_CHAR;
+    if ((can_be_unicode == sz_true_k) &&
+        (sz_isascii(longer, longer_length) == sz_false_k || sz_isascii(shorter, shorter_length) == sz_false_k)) {
+        longer_end = longer + longer_length, shorter_end = shorter + shorter_length;
+        longer_length = sz_utf8_count(longer, longer_length);
+        shorter_length = sz_utf8_count(shorter, shorter_length);
+    }
+    else { can_be_unicode = sz_false_k; }
+
+    // If one of the strings is empty - the edit distance is equal to the length of the other one.
+    if (longer_length == 0) return sz_min_of_two(shorter_length, bound);
+    if (shorter_length == 0) return sz_min_of_two(longer_length, bound);
+    // If the difference in length is beyond the `bound`, there is no need to check at all.
+    if (longer_length > shorter_length + bound || shorter_length > longer_length + bound) return bound;
+
+    // The `band[d]` entry of the i-th row stores the distance for the `j = i + d - bound` column,
+    // with one more saturated entry at the end, to avoid bounds checks when looking up the upper cell.
+    sz_size_t const width = bound * 2 + 1;
+    sz_size_t buffer_length = sizeof(sz_size_t) * (width + 1);
+    if (can_be_unicode == sz_true_k) buffer_length += sizeof(sz_rune_t) * width * 2;
+    sz_ptr_t const buffer = (sz_ptr_t)alloc->allocate(buffer_length, alloc->handle);
+    if (!buffer) return SZ_SIZE_MAX;
+    sz_size_t *const band = (sz_size_t *)buffer;
+
+    // The ring buffer of runes is stored twice, so that any window of `width` runes is contiguous.
+    sz_rune_t *const runes = (sz_rune_t *)(band + width + 1);
+    sz_size_t decoded_runes = 0;
+    sz_cptr_t longer_cursor = longer, shorter_cursor = shorter;
+
+    // Initialize the first row of the matrix, saturating the columns outside of it.
+    for (sz_size_t d = 0; d != width; ++d) band[d] = d >= bound && d - bound <= shorter_length ? d - bound : bound;
+    band[width] = bound;
+
+    // Let's parameterize the core logic for different character types.
+#define _wagner_fisher_banded()                                                                                        \
+    for (sz_size_t d = first_diagonal; d <= last_diagonal; ++d) {                                                      \
+        sz_size_t cost_substitution = band[d] + (sz_size_t)(longer_char != (sz_rune_t)window[d - first_diagonal]);     \
+        sz_size_t cost_deletion = band[d + 1];                                                                         \
+        sz_size_t cost_insertion = left_distance;                                                                      \
+        sz_size_t distance = sz_min_of_two(cost_substitution, sz_min_of_two(cost_deletion, cost_insertion) + 1);       \
+        distance = sz_min_of_two(distance, bound);                                                                     \
+        band[d] = left_distance = distance;                                                                            \
+        min_distance = sz_min_of_two(min_distance, distance);                                                          \
+    }
+
+    for (sz_size_t i = 1; i <= longer_length; ++i) {
+        // The band covers the columns from `i - bound` to `i + bound`, clipped to the matrix.
+        sz_size_t const first_diagonal = i <= bound ? bound - i + 1 : 0;
+        sz_size_t const last_diagonal = sz_min_of_two(width - 1, shorter_length + bound - i);
+        sz_size_t const first_column = i > bound ? i - bound - 1 : 0; // Zero-based index of the first character
+
+        // The cell left of the band is either in the first column of the matrix, or outside of it.
+        sz_size_t left_distance = i <= bound ? i : bound;
+        sz_size_t min_distance = left_distance;
+        if (i <= bound) band[first_diagonal - 1] = left_distance;
+
+        if (can_be_unicode == sz_true_k) {
+            sz_rune_t longer_char;
+            longer_cursor = _sz_utf8_next_rune(longer_cursor, longer_end, &longer_char);
+            // Decode the runes entering the band, keeping two copies of each in the ring buffer.
+            for (sz_size_t last_column = sz_min_of_two(i + bound, shorter_length); decoded_runes < last_column;
+                 ++decoded_runes) {
+                sz_rune_t rune;
+                shorter_cursor = _sz_utf8_next_rune(shorter_cursor, shorter_end, &rune);
+                runes[decoded_runes % width] = runes[decoded_runes % width + width] = rune;
+            }
+            sz_rune_t const *window = runes + first_column % width;
+            _wagner_fisher_banded();
+        }
+        else {
+            sz_rune_t const longer_char = (sz_u8_t)longer[i - 1];
+            sz_u8_t const *window = (sz_u8_t const *)shorter + first_column;
+            _wagner_fisher_banded();
+        }
+
+        // If the minimum distance in this row reached the bound, return early.
+        if (min_distance >= bound) {
+            alloc->free(buffer, buffer_length, alloc->handle);
+            return bound;
+        }
+    }
+
+    // Cache scalar before `free` call.
+    sz_size_t result = band[shorter_length + bound - longer_length];
+    alloc->free(buffer, buffer_length, alloc->handle);
+    return result;
 }
 
 /**
@@ -2601,6 +4558,11 @@ SZ_INTERNAL sz_size_t _sz_edit_distance_wagner_fisher_serial( //
     sz_cptr_t shorter, sz_size_t shorter_length,              //
     sz_size_t bound, sz_bool_t can_be_unicode, sz_memory_allocator_t *alloc) {
 
+    // If the band of reachable diagonals is much narrower than the matrix, only evaluate the band.
+    if (bound && bound * 4 + 2 < shorter_length)
+        return _sz_edit_distance_banded_serial(longer, longer_length, shorter, shorter_length, bound, can_be_unicode,
+                                               alloc);
+
     // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
     sz_memory_allocator_t global_alloc;
     if (!alloc) {
@@ -2639,8 +4601,8 @@ SZ_INTERNAL sz_size_t _sz_edit_distance_wagner_fisher_serial( //
         sz_rune_t *const longer_utf32 = (sz_rune_t *)(buffer + sizeof(_distance_t) * (n * 2));
         sz_rune_t *const shorter_utf32 = longer_utf32 + longer_length;
         // Export the UTF8 sequences into the newly allocated buffer.
-        longer_length = _sz_export_utf8_to_utf32(longer, longer_length, longer_utf32);
-        shorter_length = _sz_export_utf8_to_utf32(shorter, shorter_length, shorter_utf32);
+        longer_length = sz_utf8_to_utf32(longer, longer_length, longer_utf32);
+        shorter_length = sz_utf8_to_utf32(shorter, shorter_length, shorter_utf32);
         longer = (sz_cptr_t)longer_utf32;
         shorter = (sz_cptr_t)shorter_utf32;
     }
@@ -2732,6 +4694,118 @@ SZ_INTERNAL sz_size_t _sz_edit_distance_wagner_fisher_serial( //
     }
 }
 
+/**
+ *  @brief  Populates the "pattern match" bit-vectors for the Myers-Hyyrö algorithm, where the i-th bit
+ *          of the `peq[c]` entry is set, if the i-th byte of the ::query is equal to `c`.
+ */
+SZ_INTERNAL void _sz_edit_distance_myers64_peq(sz_cptr_t query, sz_size_t query_length, sz_u64_t *peq) {
+    sz_assert(query_length <= 64 && "The query must fit into a single machine word.");
+    for (sz_size_t c = 0; c != 256; ++c) peq[c] = 0;
+    for (sz_size_t i = 0; i != query_length; ++i) peq[(sz_u8_t)query[i]] |= 1ull << i;
+}
+
+/**
+ *  @brief  Bit-parallel Levenshtein distance computation for queries up to 64 bytes long, using the
+ *          Myers' algorithm with Hyyrö's adaptation for global edit distances, evaluating a whole column
+ *          of the Wagner-Fisher matrix with a handful of bitwise operations per byte of the ::text.
+ *
+ *  The bits above the ::query_length can hold garbage, as carries and shifts only propagate upwards.
+ *
+ *  @param peq  The pattern match bit-vectors, produced by `_sz_edit_distance_myers64_peq`.
+ *  @see        https://doi.org/10.1145/316542.316550
+ */
+SZ_INTERNAL sz_size_t _sz_edit_distance_myers64_serial( //
+    sz_u64_t const *peq, sz_size_t query_length,         //
+    sz_cptr_t text, sz_size_t text_length, sz_size_t bound) {
+
+    sz_assert(query_length && query_length <= 64 && "The query must fit into a single machine word.");
+    sz_u64_t const last_bit = 1ull << (query_length - 1);
+    sz_u64_t vertical_positive = ~0ull, vertical_negative = 0;
+    sz_size_t score = query_length;
+    sz_u8_t const *text_unsigned = (sz_u8_t const *)text;
+    for (sz_size_t j = 0; j != text_length; ++j) {
+        sz_u64_t match = peq[text_unsigned[j]];
+        sz_u64_t vertical_other = match | vertical_negative;
+        sz_u64_t horizontal_other = (((match & vertical_positive) + vertical_positive) ^ vertical_positive) | match;
+        sz_u64_t horizontal_positive = vertical_negative | ~(horizontal_other | vertical_positive);
+        sz_u64_t horizontal_negative = vertical_positive & horizontal_other;
+        score += (horizontal_positive & last_bit) != 0;
+        score -= (horizontal_negative & last_bit) != 0;
+        // The top row of the matrix grows by one in every column, so we shift in a positive delta.
+        horizontal_positive = (horizontal_positive << 1) | 1;
+        horizontal_negative = horizontal_negative << 1;
+        vertical_positive = horizontal_negative | ~(vertical_other | horizontal_positive);
+        vertical_negative = horizontal_positive & vertical_other;
+        // The score can decrease by at most one per remaining byte of the text.
+        if (bound && score >= bound + (text_length - j - 1)) return bound;
+    }
+    return bound ? sz_min_of_two(score, bound) : score;
+}
+
+/**
+ *  @brief  Populates the "pattern match" bit-vector pairs for the two-word Myers-Hyyrö algorithm,
+ *          where the low word of every `peq[c]` entry covers the first 64 bytes of the ::query.
+ */
+SZ_INTERNAL void _sz_edit_distance_myers128_peq(sz_cptr_t query, sz_size_t query_length, sz_u64_t (*peq)[2]) {
+    sz_assert(query_length <= 128 && "The query must fit into two machine words.");
+    for (sz_size_t c = 0; c != 256; ++c) peq[c][0] = peq[c][1] = 0;
+    for (sz_size_t i = 0; i != query_length; ++i) peq[(sz_u8_t)query[i]][i / 64] |= 1ull << (i % 64);
+}
+
+/**
+ *  @brief  Two-word variant of `_sz_edit_distance_myers64_serial` for queries from 65 to 128 bytes long.
+ *          The column is split into two blocks, and the horizontal delta leaving the top bit of the lower
+ *          block is passed into the bottom bit of the upper one, as in Hyyrö's block-based formulation.
+ *
+ *  @param peq  The pattern match bit-vectors, produced by `_sz_edit_distance_myers128_peq`.
+ *  @see        https://doi.org/10.1145/316542.316550
+ */
+SZ_INTERNAL sz_size_t _sz_edit_distance_myers128_serial( //
+    sz_u64_t const (*peq)[2], sz_size_t query_length,     //
+    sz_cptr_t text, sz_size_t text_length, sz_size_t bound) {
+
+    sz_assert(query_length > 64 && query_length <= 128 && "The query must span exactly two machine words.");
+    sz_u64_t const last_bit = 1ull << (query_length - 65);
+    sz_u64_t vertical_positive[2] = {~0ull, ~0ull}, vertical_negative[2] = {0, 0};
+    sz_size_t score = query_length;
+    sz_u8_t const *text_unsigned = (sz_u8_t const *)text;
+    for (sz_size_t j = 0; j != text_length; ++j) {
+        sz_u64_t const *match_pair = peq[text_unsigned[j]];
+
+        // The lower block always receives a positive delta from the top row of the matrix.
+        sz_u64_t match = match_pair[0];
+        sz_u64_t vertical_other = match | vertical_negative[0];
+        sz_u64_t horizontal_other = (((match & vertical_positive[0]) + vertical_positive[0]) ^ vertical_positive[0]) |
+                                    match;
+        sz_u64_t horizontal_positive = vertical_negative[0] | ~(horizontal_other | vertical_positive[0]);
+        sz_u64_t horizontal_negative = vertical_positive[0] & horizontal_other;
+        sz_u64_t carry_positive = horizontal_positive >> 63, carry_negative = horizontal_negative >> 63;
+        horizontal_positive = (horizontal_positive << 1) | 1;
+        horizontal_negative = horizontal_negative << 1;
+        vertical_positive[0] = horizontal_negative | ~(vertical_other | horizontal_positive);
+        vertical_negative[0] = horizontal_positive & vertical_other;
+
+        // The upper block receives the delta leaving the lower one, which can be -1, 0, or +1.
+        // A negative incoming delta behaves like a match in the bottom cell of the block.
+        match = match_pair[1];
+        vertical_other = match | vertical_negative[1];
+        match |= carry_negative;
+        horizontal_other = (((match & vertical_positive[1]) + vertical_positive[1]) ^ vertical_positive[1]) | match;
+        horizontal_positive = vertical_negative[1] | ~(horizontal_other | vertical_positive[1]);
+        horizontal_negative = vertical_positive[1] & horizontal_other;
+        score += (horizontal_positive & last_bit) != 0;
+        score -= (horizontal_negative & last_bit) != 0;
+        horizontal_positive = (horizontal_positive << 1) | carry_positive;
+        horizontal_negative = (horizontal_negative << 1) | carry_negative;
+        vertical_positive[1] = horizontal_negative | ~(vertical_other | horizontal_positive);
+        vertical_negative[1] = horizontal_positive & vertical_other;
+
+        // The score can decrease by at most one per remaining byte of the text.
+        if (bound && score >= bound + (text_length - j - 1)) return bound;
+    }
+    return bound ? sz_min_of_two(score, bound) : score;
+}
+
 SZ_PUBLIC sz_size_t sz_edit_distance_serial(     //
     sz_cptr_t longer, sz_size_t longer_length,   //
     sz_cptr_t shorter, sz_size_t shorter_length, //
@@ -2761,27 +4835,98 @@ SZ_PUBLIC sz_size_t sz_edit_distance_serial(     //
     }
 
     if (shorter_length == 0) return longer_length; // If no mismatches were found - the distance is zero.
+
+    // Short strings fit into one or two machine words, and can be processed with bit-parallel kernels,
+    // evaluating a whole column of the matrix per byte of the longer string, without any allocations.
+    if (shorter_length <= 64) {
+        sz_u64_t peq[256];
+        _sz_edit_distance_myers64_peq(shorter, shorter_length, peq);
+        return _sz_edit_distance_myers64_serial(peq, shorter_length, longer, longer_length, bound);
+    }
+    if (shorter_length <= 128) {
+        sz_u64_t peq[256][2];
+        _sz_edit_distance_myers128_peq(shorter, shorter_length, peq);
+        return _sz_edit_distance_myers128_serial((sz_u64_t const(*)[2])peq, shorter_length, longer, longer_length,
+                                                 bound);
+    }
+
     if (shorter_length == longer_length && !bound)
         return _sz_edit_distance_skewed_diagonals_serial(longer, longer_length, shorter, shorter_length, bound, alloc);
     return _sz_edit_distance_wagner_fisher_serial(longer, longer_length, shorter, shorter_length, bound, sz_false_k,
                                                   alloc);
 }
 
-SZ_PUBLIC sz_ssize_t sz_alignment_score_serial(       //
-    sz_cptr_t longer, sz_size_t longer_length,        //
-    sz_cptr_t shorter, sz_size_t shorter_length,      //
-    sz_error_cost_t const *subs, sz_error_cost_t gap, //
-    sz_memory_allocator_t *alloc) {
+/**
+ *  @brief  Wagner-Fisher Levenshtein distance computation with an externally provided ::buffer
+ *          for two rows of `query_length + 1` distances, with the ::query determining the columns.
+ */
+SZ_INTERNAL sz_size_t _sz_edit_distance_wagner_fisher_reusing_serial( //
+    sz_cptr_t query, sz_size_t query_length,                          //
+    sz_cptr_t text, sz_size_t text_length,                            //
+    sz_size_t bound, sz_size_t *buffer) {
 
-    // If one of the strings is empty - the edit distance is equal to the length of the other one
-    if (longer_length == 0) return (sz_ssize_t)shorter_length * gap;
-    if (shorter_length == 0) return (sz_ssize_t)longer_length * gap;
+    // Skip the matching prefixes and suffixes, they won't affect the distance.
+    for (; query_length && text_length && *query == *text; ++query, ++text, --query_length, --text_length);
+    for (; query_length && text_length && query[query_length - 1] == text[text_length - 1];
+         --query_length, --text_length);
 
-    // Let's make sure that we use the amount proportional to the
-    // number of elements in the shorter string, not the larger.
-    if (shorter_length > longer_length) {
-        sz_pointer_swap((void **)&longer_length, (void **)&shorter_length);
-        sz_pointer_swap((void **)&longer, (void **)&shorter);
+    if (!query_length || !text_length) {
+        sz_size_t result = query_length + text_length;
+        return bound ? sz_min_of_two(result, bound) : result;
+    }
+    if (bound) {
+        sz_size_t length_difference = query_length > text_length ? query_length - text_length //
+                                                                 : text_length - query_length;
+        if (length_difference >= bound) return bound;
+    }
+
+    sz_u8_t const *query_unsigned = (sz_u8_t const *)query;
+    sz_u8_t const *text_unsigned = (sz_u8_t const *)text;
+    sz_size_t *previous_distances = buffer;
+    sz_size_t *current_distances = buffer + query_length + 1;
+    for (sz_size_t idx_query = 0; idx_query <= query_length; ++idx_query) previous_distances[idx_query] = idx_query;
+    for (sz_size_t idx_text = 0; idx_text != text_length; ++idx_text) {
+        sz_u8_t const text_char = text_unsigned[idx_text];
+        sz_size_t min_distance = current_distances[0] = idx_text + 1;
+        for (sz_size_t idx_query = 0; idx_query != query_length; ++idx_query) {
+            sz_size_t cost_substitution = previous_distances[idx_query] + (text_char != query_unsigned[idx_query]);
+            sz_size_t cost_deletion_or_insertion =
+                sz_min_of_two(previous_distances[idx_query + 1], current_distances[idx_query]) + 1;
+            current_distances[idx_query + 1] = sz_min_of_two(cost_substitution, cost_deletion_or_insertion);
+            min_distance = sz_min_of_two(min_distance, current_distances[idx_query + 1]);
+        }
+        // If the minimum distance in this row exceeded the bound, return early.
+        if (bound && min_distance >= bound) return bound;
+        sz_size_t *temporary = previous_distances;
+        previous_distances = current_distances;
+        current_distances = temporary;
+    }
+    sz_size_t result = previous_distances[query_length];
+    return bound ? sz_min_of_two(result, bound) : result;
+}
+
+SZ_PUBLIC sz_bool_t sz_edit_distances_serial(sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates,
+                                             sz_size_t bound, sz_memory_allocator_t *alloc, sz_size_t *distances) {
+
+    sz_size_t const count = candidates->count;
+
+    // If the query is empty - the edit distance is equal to the length of the other string.
+    if (!query_length) {
+        for (sz_size_t i = 0; i != count; ++i) {
+            sz_size_t length = candidates->get_length(candidates, i);
+            distances[i] = bound ? sz_min_of_two(length, bound) : length;
+        }
+        return sz_true_k;
+    }
+
+    // Short queries fit into a single machine word, and need no dynamic memory.
+    if (query_length <= 64) {
+        sz_u64_t peq[256];
+        _sz_edit_distance_myers64_peq(query, query_length, peq);
+        for (sz_size_t i = 0; i != count; ++i)
+            distances[i] = _sz_edit_distance_myers64_serial(peq, query_length, candidates->get_start(candidates, i),
+                                                            candidates->get_length(candidates, i), bound);
+        return sz_true_k;
     }
 
     // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
@@ -2791,19 +4936,51 @@ SZ_PUBLIC sz_ssize_t sz_alignment_score_serial(       //
         alloc = &global_alloc;
     }
 
+    // Longer queries need two rows of the Wagner-Fisher matrix, allocated only once for all of the candidates.
+    sz_size_t const buffer_length = sizeof(sz_size_t) * (query_length + 1) * 2;
+    sz_size_t *const buffer = (sz_size_t *)alloc->allocate(buffer_length, alloc->handle);
+    if (!buffer) return sz_false_k;
+    for (sz_size_t i = 0; i != count; ++i)
+        distances[i] = _sz_edit_distance_wagner_fisher_reusing_serial(
+            query, query_length, candidates->get_start(candidates, i), candidates->get_length(candidates, i), bound,
+            buffer);
+    alloc->free(buffer, buffer_length, alloc->handle);
+    return sz_true_k;
+}
+
+/**
+ *  @brief  Computes the Needleman–Wunsch or Smith–Waterman alignment score row by row, reusing the `buffer`
+ *          of `2 * (min(a_length, b_length) + 1)` cells, so that the batched variants allocate only once.
+ */
+SZ_INTERNAL sz_ssize_t _sz_alignment_score_reusing_serial( //
+    sz_cptr_t longer, sz_size_t longer_length,             //
+    sz_cptr_t shorter, sz_size_t shorter_length,           //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local, sz_ssize_t *buffer) {
+
+    // If one of the strings is empty - the edit distance is equal to the length of the other one
+    if (longer_length == 0) return local ? 0 : (sz_ssize_t)shorter_length * gap;
+    if (shorter_length == 0) return local ? 0 : (sz_ssize_t)longer_length * gap;
+
+    // Let's make sure that we use the amount proportional to the
+    // number of elements in the shorter string, not the larger.
+    if (shorter_length > longer_length) {
+        sz_pointer_swap((void **)&longer_length, (void **)&shorter_length);
+        sz_pointer_swap((void **)&longer, (void **)&shorter);
+    }
+
     sz_size_t n = shorter_length + 1;
-    sz_size_t buffer_length = sizeof(sz_ssize_t) * n * 2;
-    sz_ssize_t *distances = (sz_ssize_t *)alloc->allocate(buffer_length, alloc->handle);
-    sz_ssize_t *previous_distances = distances;
+    sz_ssize_t *previous_distances = buffer;
     sz_ssize_t *current_distances = previous_distances + n;
 
+    // In local alignment, the first row and column are zeros, as any prefix can be skipped.
     for (sz_size_t idx_shorter = 0; idx_shorter != n; ++idx_shorter)
-        previous_distances[idx_shorter] = (sz_ssize_t)idx_shorter * gap;
+        previous_distances[idx_shorter] = local ? 0 : (sz_ssize_t)idx_shorter * gap;
 
     sz_u8_t const *shorter_unsigned = (sz_u8_t const *)shorter;
     sz_u8_t const *longer_unsigned = (sz_u8_t const *)longer;
+    sz_ssize_t best_score = 0;
     for (sz_size_t idx_longer = 0; idx_longer != longer_length; ++idx_longer) {
-        current_distances[0] = ((sz_ssize_t)idx_longer + 1) * gap;
+        current_distances[0] = local ? 0 : ((sz_ssize_t)idx_longer + 1) * gap;
 
         // Initialize min_distance with a value greater than bound
         sz_error_cost_t const *a_subs = subs + longer_unsigned[idx_longer] * 256ul;
@@ -2811,19 +4988,169 @@ SZ_PUBLIC sz_ssize_t sz_alignment_score_serial(       //
             sz_ssize_t cost_deletion = previous_distances[idx_shorter + 1] + gap;
             sz_ssize_t cost_insertion = current_distances[idx_shorter] + gap;
             sz_ssize_t cost_substitution = previous_distances[idx_shorter] + a_subs[shorter_unsigned[idx_shorter]];
-            current_distances[idx_shorter + 1] = sz_max_of_three(cost_deletion, cost_insertion, cost_substitution);
+            sz_ssize_t score = sz_max_of_three(cost_deletion, cost_insertion, cost_substitution);
+            // Any suffix can be skipped as well, so the best score may be anywhere in the matrix.
+            if (local) score = sz_max_of_two(score, 0), best_score = sz_max_of_two(best_score, score);
+            current_distances[idx_shorter + 1] = score;
         }
 
         // Swap previous_distances and current_distances pointers
         sz_pointer_swap((void **)&previous_distances, (void **)&current_distances);
     }
 
+    return local ? best_score : previous_distances[shorter_length];
+}
+
+/**
+ *  @brief  Allocates the rows for `_sz_alignment_score_reusing_serial`, used by the pairwise serial variants.
+ */
+SZ_INTERNAL sz_ssize_t _sz_alignment_score_serial(   //
+    sz_cptr_t a, sz_size_t a_length,                 //
+    sz_cptr_t b, sz_size_t b_length,                 //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, //
+    sz_bool_t local, sz_memory_allocator_t *alloc) {
+
+    // Empty strings need no memory at all.
+    if (a_length == 0 || b_length == 0)
+        return _sz_alignment_score_reusing_serial(a, a_length, b, b_length, subs, gap, local, SZ_NULL);
+
+    // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
+    }
+
+    sz_size_t buffer_length = sizeof(sz_ssize_t) * (sz_min_of_two(a_length, b_length) + 1) * 2;
+    sz_ssize_t *buffer = (sz_ssize_t *)alloc->allocate(buffer_length, alloc->handle);
+    if (!buffer) return SZ_SSIZE_MAX;
+
     // Cache scalar before `free` call.
-    sz_ssize_t result = previous_distances[shorter_length];
-    alloc->free(distances, buffer_length, alloc->handle);
+    sz_ssize_t result = _sz_alignment_score_reusing_serial(a, a_length, b, b_length, subs, gap, local, buffer);
+    alloc->free(buffer, buffer_length, alloc->handle);
     return result;
 }
 
+SZ_PUBLIC sz_ssize_t sz_alignment_score_serial(       //
+    sz_cptr_t a, sz_size_t a_length,                  //
+    sz_cptr_t b, sz_size_t b_length,                  //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, //
+    sz_memory_allocator_t *alloc) {
+    return _sz_alignment_score_serial(a, a_length, b, b_length, subs, gap, sz_false_k, alloc);
+}
+
+SZ_PUBLIC sz_ssize_t sz_local_alignment_score_serial( //
+    sz_cptr_t a, sz_size_t a_length,                  //
+    sz_cptr_t b, sz_size_t b_length,                  //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, //
+    sz_memory_allocator_t *alloc) {
+    return _sz_alignment_score_serial(a, a_length, b, b_length, subs, gap, sz_true_k, alloc);
+}
+
+SZ_PUBLIC sz_bool_t sz_alignment_scores_serial(                                    //
+    sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates,      //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local,             //
+    sz_memory_allocator_t *alloc, sz_ssize_t *scores) {
+
+    // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
+    }
+
+    // The rows are never longer than the query, so a single buffer suits all of the candidates.
+    sz_size_t const buffer_length = sizeof(sz_ssize_t) * (query_length + 1) * 2;
+    sz_ssize_t *const buffer = (sz_ssize_t *)alloc->allocate(buffer_length, alloc->handle);
+    if (!buffer) return sz_false_k;
+    for (sz_size_t i = 0; i != candidates->count; ++i)
+        scores[i] = _sz_alignment_score_reusing_serial(query, query_length, candidates->get_start(candidates, i),
+                                                       candidates->get_length(candidates, i), subs, gap, local,
+                                                       buffer);
+    alloc->free(buffer, buffer_length, alloc->handle);
+    return sz_true_k;
+}
+
+/**
+ *  @brief  Checks if every cell of the alignment matrix fits into a signed 16-bit integer, in which case the
+ *          saturating 16-bit SIMD arithmetic is exact. Every cell is bounded from below by the path of gaps
+ *          alone, and from above by the path with the most substitutions, each taking the highest cost found
+ *          in the rows of the substitution matrix, selected by the characters of the longer string.
+ */
+SZ_INTERNAL sz_bool_t _sz_alignment_score_fits_i16(sz_cptr_t longer, sz_size_t longer_length,
+                                                   sz_size_t shorter_length, sz_error_cost_t const *subs,
+                                                   sz_error_cost_t gap, sz_bool_t local) {
+
+    // No path can accumulate more than 255 costs, each of magnitude up to 128.
+    sz_size_t const path_length = longer_length + shorter_length;
+    if (path_length <= 255) return sz_true_k;
+
+    sz_u64_t used_rows[4] = {0, 0, 0, 0};
+    sz_u8_t const *longer_unsigned = (sz_u8_t const *)longer;
+    for (sz_size_t i = 0; i != longer_length; ++i)
+        used_rows[longer_unsigned[i] >> 6] |= 1ull << (longer_unsigned[i] & 63);
+    sz_error_cost_t highest_cost = 0;
+    for (sz_size_t row = 0; row != 256; ++row) {
+        if (!(used_rows[row >> 6] & (1ull << (row & 63)))) continue;
+        for (sz_size_t column = 0; column != 256; ++column)
+            highest_cost = sz_max_of_two(highest_cost, subs[row * 256 + column]);
+    }
+
+    sz_size_t const gap_magnitude = gap < 0 ? (sz_size_t)(-(sz_ssize_t)gap) : (sz_size_t)gap;
+    sz_size_t const lowest_score = local || gap >= 0 ? 0 : path_length * gap_magnitude;
+    sz_size_t const highest_score =
+        (gap > 0 ? path_length * gap_magnitude : 0) + shorter_length * (sz_size_t)highest_cost;
+    return (sz_bool_t)(lowest_score <= 32767 && highest_score <= 32767);
+}
+
+/**
+ *  @brief  The number of extra cells after every anti-diagonal and extra bytes after both strings, copied into
+ *          the scratch buffer of the SIMD alignment kernels, so that the last partial vector can be loaded whole.
+ */
+#define SZ_ALIGNMENT_PADDING (32u)
+
+/**
+ *  @brief  The scratch memory needed for the anti-diagonal alignment kernels with up to 32-bit cells.
+ */
+SZ_INTERNAL sz_size_t _sz_alignment_diagonals_buffer_length(sz_size_t longer_length, sz_size_t shorter_length) {
+    return sizeof(sz_i32_t) * (shorter_length + 1 + SZ_ALIGNMENT_PADDING) * 3 + //
+           (longer_length + SZ_ALIGNMENT_PADDING) + (shorter_length + SZ_ALIGNMENT_PADDING);
+}
+
+/**
+ *  @brief  Lays out three anti-diagonals of the alignment matrix in the `buffer`, followed by the padded copies of
+ *          both strings. The longer one is reversed, so that moving along an anti-diagonal from the top-right to
+ *          the bottom-left, the characters of both strings can be loaded with forward contiguous loads.
+ *
+ *  The cell `(i, j)` of the matrix, where `i` indexes the longer string and `j` the shorter, belongs to the
+ *  anti-diagonal `d = i + j`, and is stored at the offset `j` within it. It depends on the cells `j - 1` of the
+ *  diagonal `d - 2`, and the cells `j - 1` and `j` of the diagonal `d - 1`, so all the cells on one diagonal can be
+ *  computed at once. The characters to compare are `longer_reversed[longer_length - d + j]` and `shorter[j - 1]`.
+ *
+ *  @return The number of cells reserved per diagonal.
+ */
+SZ_INTERNAL sz_size_t _sz_alignment_diagonals_init(                             //
+    sz_cptr_t longer, sz_size_t longer_length,                                  //
+    sz_cptr_t shorter, sz_size_t shorter_length,                                //
+    sz_size_t cell_size, sz_ptr_t buffer,                                       //
+    sz_u8_t const **longer_reversed_output, sz_u8_t const **shorter_copy_output) {
+
+    sz_size_t const diagonal_length = shorter_length + 1 + SZ_ALIGNMENT_PADDING;
+    sz_u8_t *longer_reversed = (sz_u8_t *)buffer + sizeof(sz_i32_t) * diagonal_length * 3;
+    sz_u8_t *shorter_copy = longer_reversed + longer_length + SZ_ALIGNMENT_PADDING;
+
+    // The padding cells are never used, but are zeroed to avoid reading uninitialized memory.
+    sz_fill_serial(buffer, cell_size * diagonal_length * 3, 0);
+    for (sz_size_t i = 0; i != longer_length; ++i) longer_reversed[i] = (sz_u8_t)longer[longer_length - 1 - i];
+    sz_fill_serial((sz_ptr_t)longer_reversed + longer_length, SZ_ALIGNMENT_PADDING, 0);
+    sz_copy_serial((sz_ptr_t)shorter_copy, shorter, shorter_length);
+    sz_fill_serial((sz_ptr_t)shorter_copy + shorter_length, SZ_ALIGNMENT_PADDING, 0);
+
+    *longer_reversed_output = longer_reversed;
+    *shorter_copy_output = shorter_copy;
+    return diagonal_length;
+}
+
 SZ_PUBLIC sz_size_t sz_hamming_distance_serial( //
     sz_cptr_t a, sz_size_t a_length,            //
     sz_cptr_t b, sz_size_t b_length,            //
@@ -2857,39 +5184,26 @@ SZ_PUBLIC sz_size_t sz_hamming_distance_utf8_serial( //
     sz_cptr_t b, sz_size_t b_length,                 //
     sz_size_t bound) {
 
+    // Pure ASCII inputs can be compared byte-by-byte with SWAR.
+    if (sz_isascii(a, a_length) == sz_true_k && sz_isascii(b, b_length) == sz_true_k)
+        return sz_hamming_distance_serial(a, a_length, b, b_length, bound);
+
+    // The runes of the longer string, that have no counterparts in the shorter one, are all mismatches.
     sz_cptr_t const a_end = a + a_length;
     sz_cptr_t const b_end = b + b_length;
-    sz_size_t distance = 0;
+    sz_size_t const a_runes = sz_utf8_count(a, a_length);
+    sz_size_t const b_runes = sz_utf8_count(b, b_length);
+    sz_size_t const common_runes = sz_min_of_two(a_runes, b_runes);
+    sz_size_t distance = sz_max_of_two(a_runes, b_runes) - common_runes;
+    bound = bound == 0 ? SZ_SIZE_MAX : bound;
 
     sz_rune_t a_rune, b_rune;
-    sz_rune_length_t a_rune_length, b_rune_length;
-
-    if (bound) {
-        for (; a < a_end && b < b_end && distance < bound; a += a_rune_length, b += b_rune_length) {
-            _sz_extract_utf8_rune(a, &a_rune, &a_rune_length);
-            _sz_extract_utf8_rune(b, &b_rune, &b_rune_length);
-            distance += (a_rune != b_rune);
-        }
-        // If one string has more runes, we need to go through the tail.
-        if (distance < bound) {
-            for (; a < a_end && distance < bound; a += a_rune_length, ++distance)
-                _sz_extract_utf8_rune(a, &a_rune, &a_rune_length);
-
-            for (; b < b_end && distance < bound; b += b_rune_length, ++distance)
-                _sz_extract_utf8_rune(b, &b_rune, &b_rune_length);
-        }
-    }
-    else {
-        for (; a < a_end && b < b_end; a += a_rune_length, b += b_rune_length) {
-            _sz_extract_utf8_rune(a, &a_rune, &a_rune_length);
-            _sz_extract_utf8_rune(b, &b_rune, &b_rune_length);
-            distance += (a_rune != b_rune);
-        }
-        // If one string has more runes, we need to go through the tail.
-        for (; a < a_end; a += a_rune_length, ++distance) _sz_extract_utf8_rune(a, &a_rune, &a_rune_length);
-        for (; b < b_end; b += b_rune_length, ++distance) _sz_extract_utf8_rune(b, &b_rune, &b_rune_length);
+    for (sz_size_t i = 0; i != common_runes && distance < bound; ++i) {
+        a = _sz_utf8_next_rune(a, a_end, &a_rune);
+        b = _sz_utf8_next_rune(b, b_end, &b_rune);
+        distance += (a_rune != b_rune);
     }
-    return distance;
+    return sz_min_of_two(distance, bound);
 }
 
 SZ_PUBLIC sz_u64_t sz_checksum_serial(sz_cptr_t text, sz_size_t length) {
@@ -2914,139 +5228,179 @@ SZ_PUBLIC sz_u64_t sz_checksum_serial(sz_cptr_t text, sz_size_t length) {
  *  this = 18,446,744,073,709,551,557
  *  diff = 59
  */
-#define SZ_U64_MAX_PRIME (18446744073709551557ull)
+#define SZ_U64_MAX_PRIME (18446744073709551557ull)
+
+/*
+ *  One hardware-accelerated way of mixing hashes can be CRC, but it's only implemented for 32-bit values.
+ *  Using a Boost-like mixer works very poorly in such case:
+ *
+ *       hash_first ^ (hash_second + 0x517cc1b727220a95 + (hash_first << 6) + (hash_first >> 2));
+ *
+ *  Let's stick to the Fibonacci hash trick using the golden ratio.
+ *  https://probablydance.com/2018/06/16/fibonacci-hashing-the-optimization-that-the-world-forgot-or-a-better-alternative-to-integer-modulo/
+ */
+#define _sz_hash_mix(first, second) ((first * 11400714819323198485ull) ^ (second * 11400714819323198485ull))
+#define _sz_shift_low(x) (x)
+#define _sz_shift_high(x) ((x + 77ull) & 0xFFull)
+#define _sz_prime_mod(x) (x % SZ_U64_MAX_PRIME)
+
+/*
+ *  The `sz_hash` seeds the lanes and keys the stripes with the following 16 words, produced by the SplitMix64
+ *  generator, starting from zero. Every stripe uses a sliding window of 8 consecutive words, like xxHash3,
+ *  so that permuting the stripes changes the result, while the same values are loaded in every SIMD backend.
+ */
+static sz_u64_t const _sz_hash_secret[16] = {
+    0xE220A8397B1DCDAFull, 0x6E789E6AA1B965F4ull, 0x06C45D188009454Full, 0xF88BB8A8724C81ECull,
+    0x1B39896A51A8749Bull, 0x53CB9F0C747EA2EAull, 0x2C829ABE1F4532E1ull, 0xC584133AC916AB3Cull,
+    0x3EE5789041C98AC3ull, 0xF3B8488C368CB0A6ull, 0x657EECDD3CB13D09ull, 0xC2D326E0055BDEF6ull,
+    0x8621A03FE0BBDB7Bull, 0x8E1F7555983AA92Full, 0xB54E0F1600CC4D19ull, 0x84BB3F97971D80ABull,
+};
+
+#define _sz_hash_scramble_prime (0x9E3779B1ull)
+
+/** @brief  Final mixing step of the MurmurHash3, ensuring that every input bit affects every output bit. */
+SZ_INTERNAL sz_u64_t _sz_hash_avalanche(sz_u64_t x) {
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDull;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ull;
+    x ^= x >> 33;
+    return x;
+}
+
+/** @brief  Loads up to 8 bytes as a little-endian word, padding it with zeros. */
+SZ_INTERNAL sz_u64_t _sz_hash_load_partial(sz_u8_t const *text, sz_size_t length) {
+    sz_u64_t word = 0;
+    for (sz_size_t i = 0; i != length; ++i) word |= (sz_u64_t)text[i] << (i * 8);
+    return word;
+}
+
+/** @brief  Loads 8 bytes as a little-endian word, independent of the platform endianness. */
+SZ_INTERNAL sz_u64_t _sz_hash_load(sz_u8_t const *text) {
+#if SZ_DETECT_BIG_ENDIAN
+    return sz_u64_bytes_reverse(sz_u64_load((sz_cptr_t)text).u64);
+#else
+    return sz_u64_load((sz_cptr_t)text).u64;
+#endif
+}
+
+/** @brief  Loads up to 16 bytes as two zero-padded little-endian words, using overlapping loads where possible. */
+SZ_INTERNAL void _sz_hash_load_short(sz_u8_t const *text, sz_size_t length, sz_u64_t *low, sz_u64_t *high) {
+    if (length > 8) {
+        *low = _sz_hash_load(text);
+        *high = _sz_hash_load(text + length - 8) >> ((16 - length) * 8);
+    }
+    else if (length >= 4) {
+#if SZ_DETECT_BIG_ENDIAN
+        sz_u64_t first = sz_u32_bytes_reverse(sz_u32_load((sz_cptr_t)text).u32);
+        sz_u64_t last = sz_u32_bytes_reverse(sz_u32_load((sz_cptr_t)text + length - 4).u32);
+#else
+        sz_u64_t first = sz_u32_load((sz_cptr_t)text).u32;
+        sz_u64_t last = sz_u32_load((sz_cptr_t)text + length - 4).u32;
+#endif
+        // The overlapping bytes are the same in both halves, so OR-ing them is safe.
+        *low = first | (last << ((length - 4) * 8));
+        *high = 0;
+    }
+    else {
+        *low = _sz_hash_load_partial(text, length);
+        *high = 0;
+    }
+}
+
+/**
+ *  @brief  Hashes strings up to 16 bytes long, passed as two zero-padded little-endian words.
+ *          Shared by all backends, and mirrored lane-by-lane in the batched AVX-512 kernel.
+ */
+SZ_INTERNAL sz_u64_t _sz_hash_short(sz_u64_t low, sz_u64_t high, sz_size_t length) {
+    sz_u64_t low_mixed = (low ^ _sz_hash_secret[0]) * 0x9FB21C651E98DF25ull;
+    sz_u64_t high_mixed = (high ^ _sz_hash_secret[1]) * 0xC2B2AE3D27D4EB4Full;
+    return _sz_hash_avalanche(low_mixed ^ sz_u64_rotl(high_mixed, 31) ^ (length * 0x9E3779B97F4A7C15ull));
+}
 
-/*
- *  One hardware-accelerated way of mixing hashes can be CRC, but it's only implemented for 32-bit values.
- *  Using a Boost-like mixer works very poorly in such case:
- *
- *       hash_first ^ (hash_second + 0x517cc1b727220a95 + (hash_first << 6) + (hash_first >> 2));
- *
- *  Let's stick to the Fibonacci hash trick using the golden ratio.
- *  https://probablydance.com/2018/06/16/fibonacci-hashing-the-optimization-that-the-world-forgot-or-a-better-alternative-to-integer-modulo/
+/**
+ *  @brief  Folds the 8 lanes of a long string hash into a single word. Shared by all backends.
  */
-#define _sz_hash_mix(first, second) ((first * 11400714819323198485ull) ^ (second * 11400714819323198485ull))
-#define _sz_shift_low(x) (x)
-#define _sz_shift_high(x) ((x + 77ull) & 0xFFull)
-#define _sz_prime_mod(x) (x % SZ_U64_MAX_PRIME)
+SZ_INTERNAL sz_u64_t _sz_hash_fold(sz_u64_t const *lanes, sz_size_t length) {
+    sz_u64_t hash = length * 0x9E3779B97F4A7C15ull;
+    for (sz_size_t i = 0; i != 8; ++i) {
+        hash = (hash ^ lanes[i]) * 0x9FB21C651E98DF25ull;
+        hash ^= hash >> 29;
+    }
+    return _sz_hash_avalanche(hash);
+}
 
-SZ_PUBLIC sz_u64_t sz_hash_serial(sz_cptr_t start, sz_size_t length) {
+/**
+ *  @brief  Accumulates a 64-byte stripe into 8 lanes, multiplying the 32-bit halves of every keyed word,
+ *          like UMAC, and adding the word itself, to keep the zeroed products from erasing the input.
+ *          Every 8 stripes the lanes are scrambled, to propagate the high bits into the low ones.
+ */
+SZ_INTERNAL void _sz_hash_stripe_serial(sz_u64_t *lanes, sz_u8_t const *stripe, sz_size_t stripe_index) {
+    sz_u64_t const *keys = _sz_hash_secret + (stripe_index & 7);
+    for (sz_size_t i = 0; i != 8; ++i) {
+        sz_u64_t word = _sz_hash_load(stripe + i * 8);
+        sz_u64_t keyed = word ^ keys[i];
+        lanes[i] += (keyed & 0xFFFFFFFFull) * (keyed >> 32) + word;
+    }
+    if ((stripe_index & 7) != 7) return;
+    for (sz_size_t i = 0; i != 8; ++i) {
+        sz_u64_t lane = lanes[i];
+        lane ^= lane >> 47;
+        lane ^= _sz_hash_secret[8 + i];
+        lanes[i] = lane * _sz_hash_scramble_prime;
+    }
+}
 
-    sz_u64_t hash_low = 0;
-    sz_u64_t hash_high = 0;
+SZ_PUBLIC sz_u64_t sz_hash_serial(sz_cptr_t start, sz_size_t length) {
     sz_u8_t const *text = (sz_u8_t const *)start;
-    sz_u8_t const *text_end = text + length;
 
-    switch (length) {
-    case 0: return 0;
+    // Short strings are common keys in hash-tables, and avoid the lanes altogether.
+    if (length <= 16) {
+        sz_u64_t low, high;
+        _sz_hash_load_short(text, length, &low, &high);
+        return _sz_hash_short(low, high, length);
+    }
 
-    // Texts under 7 bytes long are definitely below the largest prime.
-    case 1:
-        hash_low = _sz_shift_low(text[0]);
-        hash_high = _sz_shift_high(text[0]);
-        break;
-    case 2:
-        hash_low = _sz_shift_low(text[0]) * 31ull + _sz_shift_low(text[1]);
-        hash_high = _sz_shift_high(text[0]) * 257ull + _sz_shift_high(text[1]);
-        break;
-    case 3:
-        hash_low = _sz_shift_low(text[0]) * 31ull * 31ull + //
-                   _sz_shift_low(text[1]) * 31ull +         //
-                   _sz_shift_low(text[2]);
-        hash_high = _sz_shift_high(text[0]) * 257ull * 257ull + //
-                    _sz_shift_high(text[1]) * 257ull +          //
-                    _sz_shift_high(text[2]);
-        break;
-    case 4:
-        hash_low = _sz_shift_low(text[0]) * 31ull * 31ull * 31ull + //
-                   _sz_shift_low(text[1]) * 31ull * 31ull +         //
-                   _sz_shift_low(text[2]) * 31ull +                 //
-                   _sz_shift_low(text[3]);
-        hash_high = _sz_shift_high(text[0]) * 257ull * 257ull * 257ull + //
-                    _sz_shift_high(text[1]) * 257ull * 257ull +          //
-                    _sz_shift_high(text[2]) * 257ull +                   //
-                    _sz_shift_high(text[3]);
-        break;
-    case 5:
-        hash_low = _sz_shift_low(text[0]) * 31ull * 31ull * 31ull * 31ull + //
-                   _sz_shift_low(text[1]) * 31ull * 31ull * 31ull +         //
-                   _sz_shift_low(text[2]) * 31ull * 31ull +                 //
-                   _sz_shift_low(text[3]) * 31ull +                         //
-                   _sz_shift_low(text[4]);
-        hash_high = _sz_shift_high(text[0]) * 257ull * 257ull * 257ull * 257ull + //
-                    _sz_shift_high(text[1]) * 257ull * 257ull * 257ull +          //
-                    _sz_shift_high(text[2]) * 257ull * 257ull +                   //
-                    _sz_shift_high(text[3]) * 257ull +                            //
-                    _sz_shift_high(text[4]);
-        break;
-    case 6:
-        hash_low = _sz_shift_low(text[0]) * 31ull * 31ull * 31ull * 31ull * 31ull + //
-                   _sz_shift_low(text[1]) * 31ull * 31ull * 31ull * 31ull +         //
-                   _sz_shift_low(text[2]) * 31ull * 31ull * 31ull +                 //
-                   _sz_shift_low(text[3]) * 31ull * 31ull +                         //
-                   _sz_shift_low(text[4]) * 31ull +                                 //
-                   _sz_shift_low(text[5]);
-        hash_high = _sz_shift_high(text[0]) * 257ull * 257ull * 257ull * 257ull * 257ull + //
-                    _sz_shift_high(text[1]) * 257ull * 257ull * 257ull * 257ull +          //
-                    _sz_shift_high(text[2]) * 257ull * 257ull * 257ull +                   //
-                    _sz_shift_high(text[3]) * 257ull * 257ull +                            //
-                    _sz_shift_high(text[4]) * 257ull +                                     //
-                    _sz_shift_high(text[5]);
-        break;
-    case 7:
-        hash_low = _sz_shift_low(text[0]) * 31ull * 31ull * 31ull * 31ull * 31ull * 31ull + //
-                   _sz_shift_low(text[1]) * 31ull * 31ull * 31ull * 31ull * 31ull +         //
-                   _sz_shift_low(text[2]) * 31ull * 31ull * 31ull * 31ull +                 //
-                   _sz_shift_low(text[3]) * 31ull * 31ull * 31ull +                         //
-                   _sz_shift_low(text[4]) * 31ull * 31ull +                                 //
-                   _sz_shift_low(text[5]) * 31ull +                                         //
-                   _sz_shift_low(text[6]);
-        hash_high = _sz_shift_high(text[0]) * 257ull * 257ull * 257ull * 257ull * 257ull * 257ull + //
-                    _sz_shift_high(text[1]) * 257ull * 257ull * 257ull * 257ull * 257ull +          //
-                    _sz_shift_high(text[2]) * 257ull * 257ull * 257ull * 257ull +                   //
-                    _sz_shift_high(text[3]) * 257ull * 257ull * 257ull +                            //
-                    _sz_shift_high(text[4]) * 257ull * 257ull +                                     //
-                    _sz_shift_high(text[5]) * 257ull +                                              //
-                    _sz_shift_high(text[6]);
-        break;
-    default:
-        // Unroll the first seven cycles:
-        hash_low = hash_low * 31ull + _sz_shift_low(text[0]);
-        hash_high = hash_high * 257ull + _sz_shift_high(text[0]);
-        hash_low = hash_low * 31ull + _sz_shift_low(text[1]);
-        hash_high = hash_high * 257ull + _sz_shift_high(text[1]);
-        hash_low = hash_low * 31ull + _sz_shift_low(text[2]);
-        hash_high = hash_high * 257ull + _sz_shift_high(text[2]);
-        hash_low = hash_low * 31ull + _sz_shift_low(text[3]);
-        hash_high = hash_high * 257ull + _sz_shift_high(text[3]);
-        hash_low = hash_low * 31ull + _sz_shift_low(text[4]);
-        hash_high = hash_high * 257ull + _sz_shift_high(text[4]);
-        hash_low = hash_low * 31ull + _sz_shift_low(text[5]);
-        hash_high = hash_high * 257ull + _sz_shift_high(text[5]);
-        hash_low = hash_low * 31ull + _sz_shift_low(text[6]);
-        hash_high = hash_high * 257ull + _sz_shift_high(text[6]);
-        text += 7;
-
-        // Iterate throw the rest with the modulus:
-        for (; text != text_end; ++text) {
-            hash_low = hash_low * 31ull + _sz_shift_low(text[0]);
-            hash_high = hash_high * 257ull + _sz_shift_high(text[0]);
-            // Wrap the hashes around:
-            hash_low = _sz_prime_mod(hash_low);
-            hash_high = _sz_prime_mod(hash_high);
-        }
-        break;
-    }
-
-    return _sz_hash_mix(hash_low, hash_high);
+    // Longer ones are processed in 64-byte stripes, the last of which is padded with zeros.
+    sz_u64_t lanes[8];
+    for (sz_size_t i = 0; i != 8; ++i) lanes[i] = _sz_hash_secret[i];
+    sz_size_t const full_stripes = (length - 1) / 64;
+    sz_size_t stripe_index = 0;
+    for (; stripe_index != full_stripes; ++stripe_index, text += 64)
+        _sz_hash_stripe_serial(lanes, text, stripe_index);
+
+    sz_u8_t tail[64];
+    sz_size_t const tail_length = length - full_stripes * 64;
+    for (sz_size_t i = 0; i != 64; ++i) tail[i] = i < tail_length ? text[i] : 0;
+    _sz_hash_stripe_serial(lanes, tail, stripe_index);
+    return _sz_hash_fold(lanes, length);
 }
 
-SZ_PUBLIC void sz_hashes_serial(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t step, //
-                                sz_hash_callback_t callback, void *callback_handle) {
+SZ_PUBLIC void sz_hash_batch_serial(sz_sequence_t const *sequence, sz_u64_t *hashes) {
+    for (sz_size_t i = 0; i != sequence->count; ++i)
+        hashes[i] = sz_hash_serial(sequence->get_start(sequence, i), sequence->get_length(sequence, i));
+}
 
-    if (length < window_length || !window_length) return;
+/**
+ *  @brief  State of the Karp-Rabin rolling hash of `sz_hashes_serial`, that can be advanced in batches.
+ */
+typedef struct _sz_hashes_rolling_t {
+    sz_u8_t const *text;     // Next byte to enter the window.
+    sz_u8_t const *text_end; // End of the string.
+    sz_size_t window_length;
+    sz_u64_t prime_power_low, prime_power_high;
+    sz_u64_t hash_low, hash_high;
+    sz_bool_t has_pending; // Whether the hash of the current window is yet to be exported.
+} _sz_hashes_rolling_t;
+
+/**
+ *  @brief  Hashes the first window of a string, which must be at least ::window_length bytes long.
+ */
+SZ_INTERNAL void _sz_hashes_rolling_init(_sz_hashes_rolling_t *state, sz_cptr_t start, sz_size_t length,
+                                         sz_size_t window_length) {
     sz_u8_t const *text = (sz_u8_t const *)start;
-    sz_u8_t const *text_end = text + length;
+    state->text_end = text + length;
+    state->window_length = window_length;
 
     // Prepare the `prime ^ window_length` values, that we are going to use for modulo arithmetic.
     sz_u64_t prime_power_low = 1, prime_power_high = 1;
@@ -3055,20 +5409,67 @@ SZ_PUBLIC void sz_hashes_serial(sz_cptr_t start, sz_size_t length, sz_size_t win
         prime_power_high = (prime_power_high * 257ull) % SZ_U64_MAX_PRIME;
 
     // Compute the initial hash value for the first window.
-    sz_u64_t hash_low = 0, hash_high = 0, hash_mix;
+    sz_u64_t hash_low = 0, hash_high = 0;
     for (sz_u8_t const *first_end = text + window_length; text < first_end; ++text)
         hash_low = (hash_low * 31ull + _sz_shift_low(*text)) % SZ_U64_MAX_PRIME,
         hash_high = (hash_high * 257ull + _sz_shift_high(*text)) % SZ_U64_MAX_PRIME;
 
-    // In most cases the fingerprint length will be a power of two.
-    hash_mix = _sz_hash_mix(hash_low, hash_high);
-    callback((sz_cptr_t)text, window_length, hash_mix, callback_handle);
+    state->text = text;
+    state->prime_power_low = prime_power_low, state->prime_power_high = prime_power_high;
+    state->hash_low = hash_low, state->hash_high = hash_high;
+    state->has_pending = sz_true_k;
+}
+
+/**
+ *  @brief  Exports the mixed hashes of up to ::capacity following windows, identical to the ones
+ *          passed to the callback of `sz_hashes_serial` with a unit step.
+ *  @return The number of exported hashes, zero once the string is exhausted.
+ */
+SZ_INTERNAL sz_size_t _sz_hashes_rolling_fill(_sz_hashes_rolling_t *state, sz_u64_t *hashes, sz_size_t capacity) {
+    sz_u8_t const *text = state->text, *text_end = state->text_end;
+    sz_size_t const window_length = state->window_length;
+    sz_u64_t const prime_power_low = state->prime_power_low, prime_power_high = state->prime_power_high;
+    sz_u64_t hash_low = state->hash_low, hash_high = state->hash_high;
+    sz_size_t count = 0;
+    if (state->has_pending && capacity) hashes[count++] = _sz_hash_mix(hash_low, hash_high);
+    state->has_pending = sz_false_k;
+
+    for (; count < capacity && text < text_end; ++text, ++count) {
+        // Discard one character:
+        hash_low -= _sz_shift_low(*(text - window_length)) * prime_power_low;
+        hash_high -= _sz_shift_high(*(text - window_length)) * prime_power_high;
+        // And add a new one:
+        hash_low = 31ull * hash_low + _sz_shift_low(*text);
+        hash_high = 257ull * hash_high + _sz_shift_high(*text);
+        // Wrap the hashes around:
+        hash_low = _sz_prime_mod(hash_low);
+        hash_high = _sz_prime_mod(hash_high);
+        hashes[count] = _sz_hash_mix(hash_low, hash_high);
+    }
+
+    state->text = text;
+    state->hash_low = hash_low, state->hash_high = hash_high;
+    return count;
+}
 
-    // Compute the hash value for every window, exporting into the fingerprint,
-    // using the expensive modulo operation.
-    sz_size_t cycles = 1;
+/**
+ *  @brief  Slides the window to the end of the string, passing to the ::callback every window, which offset from
+ *          the start of the string is divisible by the power-of-two ::step. Shared by `sz_hashes_serial` and the
+ *          vectorized backends, that finish the last few windows serially.
+ *  @param  index   Offset of the current window, whose hash is only reported if it's still pending.
+ */
+SZ_INTERNAL void _sz_hashes_rolling_resume(_sz_hashes_rolling_t *state, sz_size_t index, sz_size_t step,
+                                           sz_hash_callback_t callback, void *callback_handle) {
+    sz_u8_t const *text = state->text, *text_end = state->text_end;
+    sz_size_t const window_length = state->window_length;
+    sz_u64_t const prime_power_low = state->prime_power_low, prime_power_high = state->prime_power_high;
+    sz_u64_t hash_low = state->hash_low, hash_high = state->hash_high;
     sz_size_t const step_mask = step - 1;
-    for (; text < text_end; ++text, ++cycles) {
+    if (state->has_pending && (index & step_mask) == 0)
+        callback((sz_cptr_t)(text - window_length), window_length, _sz_hash_mix(hash_low, hash_high), callback_handle);
+    state->has_pending = sz_false_k;
+
+    for (; text < text_end; ++text) {
         // Discard one character:
         hash_low -= _sz_shift_low(*(text - window_length)) * prime_power_low;
         hash_high -= _sz_shift_high(*(text - window_length)) * prime_power_high;
@@ -3079,67 +5480,161 @@ SZ_PUBLIC void sz_hashes_serial(sz_cptr_t start, sz_size_t length, sz_size_t win
         hash_low = _sz_prime_mod(hash_low);
         hash_high = _sz_prime_mod(hash_high);
         // Mix only if we've skipped enough hashes.
-        if ((cycles & step_mask) == 0) {
-            hash_mix = _sz_hash_mix(hash_low, hash_high);
-            callback((sz_cptr_t)text, window_length, hash_mix, callback_handle);
+        if ((++index & step_mask) == 0)
+            callback((sz_cptr_t)(text + 1 - window_length), window_length, _sz_hash_mix(hash_low, hash_high),
+                     callback_handle);
+    }
+
+    state->text = text;
+    state->hash_low = hash_low, state->hash_high = hash_high;
+}
+
+SZ_PUBLIC void sz_hashes_serial(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t step, //
+                                sz_hash_callback_t callback, void *callback_handle) {
+
+    if (length < window_length || !window_length) return;
+    _sz_hashes_rolling_t rolling;
+    _sz_hashes_rolling_init(&rolling, start, length, window_length);
+    _sz_hashes_rolling_resume(&rolling, 0, step, callback, callback_handle);
+}
+
+/** @brief  Number of rolling hashes buffered on the stack by `sz_hashes_minhash`, before reducing them. */
+#define _SZ_HASHES_MINHASH_BATCH 256
+
+/**
+ *  @brief  Derives the two 32-bit multipliers and the 64-bit addend of the `index`-th MinHash function,
+ *          using the SplitMix64 generator, seeded with the index itself.
+ */
+SZ_INTERNAL void _sz_hashes_minhash_seeds(sz_size_t index, sz_u32_t *multiplier_low, sz_u32_t *multiplier_high,
+                                          sz_u64_t *addend) {
+    sz_u64_t state = (sz_u64_t)index * 3ull * 0x9E3779B97F4A7C15ull, z;
+    sz_u64_t outputs[3];
+    for (sz_size_t i = 0; i != 3; ++i) {
+        z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        outputs[i] = z ^ (z >> 31);
+    }
+    // Odd multipliers are bijective modulo 2^32, so no entropy of the input halves is lost.
+    *multiplier_low = (sz_u32_t)outputs[0] | 1u;
+    *multiplier_high = (sz_u32_t)outputs[1] | 1u;
+    *addend = outputs[2];
+}
+
+/**
+ *  @brief  Updates the signatures in the `[first, last)` range with a batch of rolling hashes.
+ *          Used by the serial backend, and by the SIMD backends for the signatures not filling a register.
+ */
+SZ_INTERNAL void _sz_hashes_minhash_reduce_serial(sz_u64_t const *hashes, sz_size_t hashes_count, sz_size_t first,
+                                                  sz_size_t last, sz_u32_t *signatures) {
+    for (sz_size_t i = first; i < last; ++i) {
+        sz_u32_t multiplier_low, multiplier_high;
+        sz_u64_t addend;
+        _sz_hashes_minhash_seeds(i, &multiplier_low, &multiplier_high, &addend);
+        sz_u32_t minimum = signatures[i];
+        for (sz_size_t j = 0; j != hashes_count; ++j) {
+            sz_u64_t hash = hashes[j];
+            sz_u64_t mixed = (hash & 0xFFFFFFFFull) * multiplier_low + (hash >> 32) * multiplier_high + addend;
+            sz_u32_t permuted = (sz_u32_t)(mixed >> 32);
+            minimum = permuted < minimum ? permuted : minimum;
         }
+        signatures[i] = minimum;
     }
 }
 
+SZ_PUBLIC void sz_hashes_minhash_serial(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t count,
+                                        sz_u32_t *signatures) {
+
+    for (sz_size_t i = 0; i != count; ++i) signatures[i] = 0xFFFFFFFFu;
+    if (length < window_length || !window_length) return;
+
+    _sz_hashes_rolling_t rolling;
+    _sz_hashes_rolling_init(&rolling, start, length, window_length);
+    sz_u64_t hashes[_SZ_HASHES_MINHASH_BATCH];
+    sz_size_t hashes_count;
+    while ((hashes_count = _sz_hashes_rolling_fill(&rolling, hashes, _SZ_HASHES_MINHASH_BATCH)))
+        _sz_hashes_minhash_reduce_serial(hashes, hashes_count, 0, count, signatures);
+}
+
 #undef _sz_shift_low
 #undef _sz_shift_high
 #undef _sz_hash_mix
 #undef _sz_prime_mod
 
 /**
- *  @brief  Uses a small lookup-table to convert a lowercase character to uppercase.
- */
-SZ_INTERNAL sz_u8_t sz_u8_tolower(sz_u8_t c) {
-    static sz_u8_t const lowered[256] = {
-        0,   1,   2,   3,   4,   5,   6,   7,   8,   9,   10,  11,  12,  13,  14,  15,  //
-        16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  //
-        32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  //
-        48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  //
-        64,  97,  98,  99,  100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, //
-        112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 91,  92,  93,  94,  95,  //
-        96,  97,  98,  99,  100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, //
-        112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, //
-        128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, //
-        144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, //
-        160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, //
-        176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, //
-        224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, //
-        240, 241, 242, 243, 244, 245, 246, 215, 248, 249, 250, 251, 252, 253, 254, 223, //
-        224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, //
-        240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, //
-    };
-    return lowered[c];
-}
+ *  @brief  ISO-8859-1 (Latin-1) case-mapping tables, shared by the serial code and the SIMD look-up kernels.
+ *          Aligned to the cache-line width, so each table spans exactly four cache lines.
+ */
+static SZ_ALIGN64 sz_u8_t const _sz_lut_lowered[256] = {
+    0,   1,   2,   3,   4,   5,   6,   7,   8,   9,   10,  11,  12,  13,  14,  15,  //
+    16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  //
+    32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  //
+    48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  //
+    64,  97,  98,  99,  100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, //
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 91,  92,  93,  94,  95,  //
+    96,  97,  98,  99,  100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, //
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, //
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, //
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, //
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, //
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, //
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, //
+    240, 241, 242, 243, 244, 245, 246, 215, 248, 249, 250, 251, 252, 253, 254, 223, //
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, //
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, //
+};
+
+/** @copydoc _sz_lut_lowered */
+static SZ_ALIGN64 sz_u8_t const _sz_lut_upped[256] = {
+    0,   1,   2,   3,   4,   5,   6,   7,   8,   9,   10,  11,  12,  13,  14,  15,  //
+    16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  //
+    32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  //
+    48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  //
+    64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  //
+    80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,  //
+    96,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  //
+    80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  123, 124, 125, 126, 127, //
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, //
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, //
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, //
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, //
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, //
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, //
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, //
+    208, 209, 210, 211, 212, 213, 214, 247, 216, 217, 218, 219, 220, 221, 222, 255, //
+};
+
+/**
+ *  @brief  Table clearing the top bit of every byte, to reuse the look-up kernels for `sz_toascii`.
+ */
+static SZ_ALIGN64 sz_u8_t const _sz_lut_ascii[256] = {
+    0,   1,   2,   3,   4,   5,   6,   7,   8,   9,   10,  11,  12,  13,  14,  15,  //
+    16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  //
+    32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  //
+    48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  //
+    64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  //
+    80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,  //
+    96,  97,  98,  99,  100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, //
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, //
+    0,   1,   2,   3,   4,   5,   6,   7,   8,   9,   10,  11,  12,  13,  14,  15,  //
+    16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  //
+    32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  //
+    48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  //
+    64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  //
+    80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,  //
+    96,  97,  98,  99,  100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, //
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, //
+};
 
 /**
  *  @brief  Uses a small lookup-table to convert an uppercase character to lowercase.
  */
-SZ_INTERNAL sz_u8_t sz_u8_toupper(sz_u8_t c) {
-    static sz_u8_t const upped[256] = {
-        0,   1,   2,   3,   4,   5,   6,   7,   8,   9,   10,  11,  12,  13,  14,  15,  //
-        16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  //
-        32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  //
-        48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  //
-        64,  97,  98,  99,  100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, //
-        112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 91,  92,  93,  94,  95,  //
-        96,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  //
-        80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  123, 124, 125, 126, 127, //
-        128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, //
-        144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, //
-        160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, //
-        176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, //
-        224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, //
-        240, 241, 242, 243, 244, 245, 246, 215, 248, 249, 250, 251, 252, 253, 254, 223, //
-        224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, //
-        240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, //
-    };
-    return upped[c];
-}
+SZ_INTERNAL sz_u8_t sz_u8_tolower(sz_u8_t c) { return _sz_lut_lowered[c]; }
+
+/**
+ *  @brief  Uses a small lookup-table to convert a lowercase character to uppercase.
+ */
+SZ_INTERNAL sz_u8_t sz_u8_toupper(sz_u8_t c) { return _sz_lut_upped[c]; }
 
 /**
  *  @brief  Uses two small lookup tables (768 bytes total) to accelerate division by a small
@@ -3196,24 +5691,15 @@ SZ_PUBLIC void sz_look_up_transform_serial(sz_cptr_t text, sz_size_t length, sz_
 }
 
 SZ_PUBLIC void sz_tolower_serial(sz_cptr_t text, sz_size_t length, sz_ptr_t result) {
-    sz_u8_t *unsigned_result = (sz_u8_t *)result;
-    sz_u8_t const *unsigned_text = (sz_u8_t const *)text;
-    sz_u8_t const *end = unsigned_text + length;
-    for (; unsigned_text != end; ++unsigned_text, ++unsigned_result) *unsigned_result = sz_u8_tolower(*unsigned_text);
+    sz_look_up_transform_serial(text, length, (sz_cptr_t)_sz_lut_lowered, result);
 }
 
 SZ_PUBLIC void sz_toupper_serial(sz_cptr_t text, sz_size_t length, sz_ptr_t result) {
-    sz_u8_t *unsigned_result = (sz_u8_t *)result;
-    sz_u8_t const *unsigned_text = (sz_u8_t const *)text;
-    sz_u8_t const *end = unsigned_text + length;
-    for (; unsigned_text != end; ++unsigned_text, ++unsigned_result) *unsigned_result = sz_u8_toupper(*unsigned_text);
+    sz_look_up_transform_serial(text, length, (sz_cptr_t)_sz_lut_upped, result);
 }
 
 SZ_PUBLIC void sz_toascii_serial(sz_cptr_t text, sz_size_t length, sz_ptr_t result) {
-    sz_u8_t *unsigned_result = (sz_u8_t *)result;
-    sz_u8_t const *unsigned_text = (sz_u8_t const *)text;
-    sz_u8_t const *end = unsigned_text + length;
-    for (; unsigned_text != end; ++unsigned_text, ++unsigned_result) *unsigned_result = *unsigned_text & 0x7F;
+    sz_look_up_transform_serial(text, length, (sz_cptr_t)_sz_lut_ascii, result);
 }
 
 /**
@@ -3245,6 +5731,98 @@ SZ_PUBLIC sz_bool_t sz_isascii_serial(sz_cptr_t text, sz_size_t length) {
     return sz_true_k;
 }
 
+SZ_PUBLIC sz_bool_t sz_utf8_validate_serial(sz_cptr_t text, sz_size_t length) {
+    sz_u8_t const *current = (sz_u8_t const *)text;
+    sz_u8_t const *const end = current + length;
+
+    while (current != end) {
+        // Skip the ASCII runs eight bytes at a time.
+        if (current + 8 <= end && (sz_u64_load((sz_cptr_t)current).u64 & 0x8080808080808080ull) == 0) {
+            current += 8;
+            continue;
+        }
+        sz_u8_t const lead = *current;
+        if (lead < 0x80) {
+            ++current;
+            continue;
+        }
+
+        // The second byte has a narrower range after some leading bytes, to exclude overlong encodings,
+        // UTF16 surrogates in [U+D800, U+DFFF], and the codepoints beyond U+10FFFF.
+        sz_size_t rune_length;
+        sz_u8_t second_min = 0x80, second_max = 0xBF;
+        if (lead < 0xC2) return sz_false_k; // Stray continuation byte or an overlong 2-byte rune
+        else if (lead < 0xE0) { rune_length = 2; }
+        else if (lead < 0xF0) {
+            rune_length = 3;
+            if (lead == 0xE0) second_min = 0xA0;
+            else if (lead == 0xED) second_max = 0x9F;
+        }
+        else if (lead < 0xF5) {
+            rune_length = 4;
+            if (lead == 0xF0) second_min = 0x90;
+            else if (lead == 0xF4) second_max = 0x8F;
+        }
+        else { return sz_false_k; }
+
+        if ((sz_size_t)(end - current) < rune_length) return sz_false_k;
+        if (current[1] < second_min || current[1] > second_max) return sz_false_k;
+        for (sz_size_t i = 2; i < rune_length; ++i)
+            if (!_sz_utf8_is_continuation(current[i])) return sz_false_k;
+        current += rune_length;
+    }
+    return sz_true_k;
+}
+
+/**
+ *  @brief  Counts the non-continuation bytes in a buffer, using the SWAR technique to process 8 bytes at a time.
+ *          The `10xxxxxx` continuation bytes are the ones with the top bit set, and the next one cleared.
+ */
+SZ_PUBLIC sz_size_t sz_utf8_count_serial(sz_cptr_t text, sz_size_t length) {
+    sz_u8_t const *current = (sz_u8_t const *)text;
+    sz_u8_t const *const end = current + length;
+    sz_size_t count = 0;
+
+    sz_u64_vec_t text_vec;
+    for (; current + 8 <= end; current += 8) {
+        text_vec = sz_u64_load((sz_cptr_t)current);
+        sz_u64_t continuations = text_vec.u64 & ~(text_vec.u64 << 1) & 0x8080808080808080ull;
+        count += 8 - sz_u64_popcount(continuations);
+    }
+    for (; current != end; ++current) count += !_sz_utf8_is_continuation(*current);
+    return count;
+}
+
+SZ_PUBLIC sz_size_t sz_utf8_to_utf32_serial(sz_cptr_t text, sz_size_t length, sz_rune_t *runes) {
+    sz_u8_t const *current = (sz_u8_t const *)text;
+    sz_u8_t const *const end = current + length;
+    sz_rune_t *const runes_start = runes;
+    for (; current != end; ++current)
+        if (!_sz_utf8_is_continuation(*current)) *runes++ = _sz_utf8_decode_lead(current, end);
+    return (sz_size_t)(runes - runes_start);
+}
+
+SZ_PUBLIC sz_cptr_t sz_utf8_find_nth_serial(sz_cptr_t text, sz_size_t length, sz_size_t n) {
+    sz_u8_t const *current = (sz_u8_t const *)text;
+    sz_u8_t const *const end = current + length;
+
+    // Skip whole words, while the rune is further away.
+    sz_u64_vec_t text_vec;
+    for (; current + 8 <= end; current += 8) {
+        text_vec = sz_u64_load((sz_cptr_t)current);
+        sz_u64_t continuations = text_vec.u64 & ~(text_vec.u64 << 1) & 0x8080808080808080ull;
+        sz_size_t leads = 8 - sz_u64_popcount(continuations);
+        if (n < leads) break;
+        n -= leads;
+    }
+    for (; current != end; ++current)
+        if (!_sz_utf8_is_continuation(*current)) {
+            if (!n) return (sz_cptr_t)current;
+            --n;
+        }
+    return SZ_NULL_CHAR;
+}
+
 SZ_PUBLIC void sz_generate_serial(sz_cptr_t alphabet, sz_size_t alphabet_size, sz_ptr_t result, sz_size_t result_length,
                                   sz_random_generator_t generator, void *generator_user_data) {
 
@@ -3565,6 +6143,86 @@ SZ_PUBLIC void sz_move_serial(sz_ptr_t target, sz_cptr_t source, sz_size_t lengt
     }
 }
 
+/**
+ *  @brief  Shared state of the `sz_copy_parallel` and `sz_fill_parallel` tasks.
+ *          The first chunk also covers the unaligned head of the `target`, so that no two tasks
+ *          ever write into the same cache line.
+ */
+typedef struct _sz_memory_parallel_state_t {
+    sz_ptr_t target;
+    sz_cptr_t source;
+    sz_size_t length;
+    sz_size_t head_length;
+    sz_size_t chunk_length;
+    sz_u8_t value;
+} _sz_memory_parallel_state_t;
+
+SZ_INTERNAL void _sz_memory_parallel_init(_sz_memory_parallel_state_t *state, sz_ptr_t target, sz_size_t length) {
+    // Each chunk should be large enough to use streaming copies and a multiple of the cache line width.
+    sz_size_t const chunk_length = sz_max_of_two((sz_size_t)SZ_NON_TEMPORAL_THRESHOLD, 1024ull * 1024ull);
+    sz_size_t const misalignment = (sz_size_t)target % SZ_CACHE_LINE_WIDTH;
+    sz_size_t const head_length = misalignment ? SZ_CACHE_LINE_WIDTH - misalignment : 0;
+    state->target = target;
+    state->length = length;
+    state->head_length = sz_min_of_two(head_length, length);
+    state->chunk_length = (chunk_length + SZ_CACHE_LINE_WIDTH - 1) / SZ_CACHE_LINE_WIDTH * SZ_CACHE_LINE_WIDTH;
+}
+
+SZ_INTERNAL sz_size_t _sz_memory_parallel_tasks_count(_sz_memory_parallel_state_t const *state) {
+    return (state->length - state->head_length + state->chunk_length - 1) / state->chunk_length;
+}
+
+SZ_INTERNAL void _sz_memory_parallel_range(_sz_memory_parallel_state_t const *state, sz_size_t task_index,
+                                           sz_size_t *first, sz_size_t *last) {
+    *first = task_index ? state->head_length + task_index * state->chunk_length : 0;
+    *last = sz_min_of_two(state->head_length + (task_index + 1) * state->chunk_length, state->length);
+}
+
+SZ_INTERNAL void _sz_copy_parallel_task(void *context, sz_size_t task_index) {
+    _sz_memory_parallel_state_t *state = (_sz_memory_parallel_state_t *)context;
+    sz_size_t first, last;
+    _sz_memory_parallel_range(state, task_index, &first, &last);
+    sz_copy(state->target + first, state->source + first, last - first);
+}
+
+SZ_INTERNAL void _sz_fill_parallel_task(void *context, sz_size_t task_index) {
+    _sz_memory_parallel_state_t *state = (_sz_memory_parallel_state_t *)context;
+    sz_size_t first, last;
+    _sz_memory_parallel_range(state, task_index, &first, &last);
+    sz_fill(state->target + first, last - first, state->value);
+}
+
+SZ_PUBLIC void sz_copy_parallel(sz_ptr_t target, sz_cptr_t source, sz_size_t length, //
+                                sz_parallel_for_t parallel_for, void *executor) {
+    _sz_memory_parallel_state_t state;
+    _sz_memory_parallel_init(&state, target, length);
+    state.source = source;
+
+    // Small inputs are not worth the synchronization overhead.
+    sz_size_t const tasks_count = _sz_memory_parallel_tasks_count(&state);
+    if (!parallel_for || tasks_count < 2) {
+        sz_copy(target, source, length);
+        return;
+    }
+    parallel_for(executor, _sz_copy_parallel_task, &state, tasks_count);
+}
+
+SZ_PUBLIC void sz_fill_parallel(sz_ptr_t target, sz_size_t length, sz_u8_t value, //
+                                sz_parallel_for_t parallel_for, void *executor) {
+    _sz_memory_parallel_state_t state;
+    _sz_memory_parallel_init(&state, target, length);
+    state.source = SZ_NULL;
+    state.value = value;
+
+    // Small inputs are not worth the synchronization overhead.
+    sz_size_t const tasks_count = _sz_memory_parallel_tasks_count(&state);
+    if (!parallel_for || tasks_count < 2) {
+        sz_fill(target, length, value);
+        return;
+    }
+    parallel_for(executor, _sz_fill_parallel_task, &state, tasks_count);
+}
+
 #pragma endregion
 
 /*
@@ -3572,6 +6230,286 @@ SZ_PUBLIC void sz_move_serial(sz_ptr_t target, sz_cptr_t source, sz_size_t lengt
  */
 #pragma region Serial Implementation for Sequences
 
+SZ_INTERNAL sz_cptr_t _sz_sequence_u32tape_start(sz_sequence_t const *sequence, sz_size_t i) {
+    sz_sequence_tape_t const *tape = (sz_sequence_tape_t const *)sequence->handle;
+    return tape->start + ((sz_u32_t const *)tape->offsets)[i];
+}
+
+SZ_INTERNAL sz_size_t _sz_sequence_u32tape_length(sz_sequence_t const *sequence, sz_size_t i) {
+    sz_u32_t const *offsets = (sz_u32_t const *)((sz_sequence_tape_t const *)sequence->handle)->offsets;
+    return offsets[i + 1] - offsets[i];
+}
+
+SZ_INTERNAL sz_cptr_t _sz_sequence_u64tape_start(sz_sequence_t const *sequence, sz_size_t i) {
+    sz_sequence_tape_t const *tape = (sz_sequence_tape_t const *)sequence->handle;
+    return tape->start + ((sz_u64_t const *)tape->offsets)[i];
+}
+
+SZ_INTERNAL sz_size_t _sz_sequence_u64tape_length(sz_sequence_t const *sequence, sz_size_t i) {
+    sz_u64_t const *offsets = (sz_u64_t const *)((sz_sequence_tape_t const *)sequence->handle)->offsets;
+    return (sz_size_t)(offsets[i + 1] - offsets[i]);
+}
+
+SZ_PUBLIC void sz_sequence_from_u32tape(sz_sequence_tape_t *tape, sz_cptr_t start, sz_u32_t const *offsets,
+                                        sz_size_t count, sz_sequence_t *sequence) {
+    tape->start = start;
+    tape->offsets = offsets;
+    sequence->order = SZ_NULL;
+    sequence->count = count;
+    sequence->handle = tape;
+    sequence->get_start = _sz_sequence_u32tape_start;
+    sequence->get_length = _sz_sequence_u32tape_length;
+}
+
+SZ_PUBLIC void sz_sequence_from_u64tape(sz_sequence_tape_t *tape, sz_cptr_t start, sz_u64_t const *offsets,
+                                        sz_size_t count, sz_sequence_t *sequence) {
+    tape->start = start;
+    tape->offsets = offsets;
+    sequence->order = SZ_NULL;
+    sequence->count = count;
+    sequence->handle = tape;
+    sequence->get_start = _sz_sequence_u64tape_start;
+    sequence->get_length = _sz_sequence_u64tape_length;
+}
+
+SZ_INTERNAL sz_cptr_t _sz_sequence_views_start(sz_sequence_t const *sequence, sz_size_t i) {
+    return ((sz_string_view_t const *)sequence->handle)[i].start;
+}
+
+SZ_INTERNAL sz_size_t _sz_sequence_views_length(sz_sequence_t const *sequence, sz_size_t i) {
+    return ((sz_string_view_t const *)sequence->handle)[i].length;
+}
+
+SZ_PUBLIC void sz_sequence_from_views(sz_string_view_t const *views, sz_size_t count, sz_sequence_t *sequence) {
+    sequence->order = SZ_NULL;
+    sequence->count = count;
+    sequence->handle = views;
+    sequence->get_start = _sz_sequence_views_start;
+    sequence->get_length = _sz_sequence_views_length;
+}
+
+/** @brief  Checks the Arrow validity bitmap, where a missing bitmap means that all entries are valid. */
+SZ_INTERNAL sz_bool_t _sz_arrow_is_valid(struct ArrowArray const *array, sz_size_t i) {
+    sz_u8_t const *validity = (sz_u8_t const *)array->buffers[0];
+    sz_size_t bit = (sz_size_t)array->offset + i;
+    return (sz_bool_t)(!validity || ((validity[bit / 8] >> (bit % 8)) & 1));
+}
+
+SZ_INTERNAL sz_cptr_t _sz_sequence_arrow_i32_start(sz_sequence_t const *sequence, sz_size_t i) {
+    struct ArrowArray const *array = (struct ArrowArray const *)sequence->handle;
+    sz_i32_t const *offsets = (sz_i32_t const *)array->buffers[1];
+    return (sz_cptr_t)array->buffers[2] + offsets[(sz_size_t)array->offset + i];
+}
+
+SZ_INTERNAL sz_size_t _sz_sequence_arrow_i32_length(sz_sequence_t const *sequence, sz_size_t i) {
+    struct ArrowArray const *array = (struct ArrowArray const *)sequence->handle;
+    if (!_sz_arrow_is_valid(array, i)) return 0;
+    sz_i32_t const *offsets = (sz_i32_t const *)array->buffers[1] + array->offset + i;
+    return (sz_size_t)(offsets[1] - offsets[0]);
+}
+
+SZ_INTERNAL sz_cptr_t _sz_sequence_arrow_i64_start(sz_sequence_t const *sequence, sz_size_t i) {
+    struct ArrowArray const *array = (struct ArrowArray const *)sequence->handle;
+    sz_i64_t const *offsets = (sz_i64_t const *)array->buffers[1];
+    return (sz_cptr_t)array->buffers[2] + offsets[(sz_size_t)array->offset + i];
+}
+
+SZ_INTERNAL sz_size_t _sz_sequence_arrow_i64_length(sz_sequence_t const *sequence, sz_size_t i) {
+    struct ArrowArray const *array = (struct ArrowArray const *)sequence->handle;
+    if (!_sz_arrow_is_valid(array, i)) return 0;
+    sz_i64_t const *offsets = (sz_i64_t const *)array->buffers[1] + array->offset + i;
+    return (sz_size_t)(offsets[1] - offsets[0]);
+}
+
+/**
+ *  @brief  Every Arrow `string_view` is 16 bytes long, starting with a 32-bit length. Strings up to 12 bytes
+ *          are stored inline, and longer ones are referenced by a 32-bit buffer index and a 32-bit offset.
+ */
+SZ_INTERNAL sz_cptr_t _sz_sequence_arrow_view_start(sz_sequence_t const *sequence, sz_size_t i) {
+    struct ArrowArray const *array = (struct ArrowArray const *)sequence->handle;
+    sz_cptr_t view = (sz_cptr_t)array->buffers[1] + ((sz_size_t)array->offset + i) * 16;
+    sz_i32_t length, buffer_index, offset;
+    sz_copy((sz_ptr_t)&length, view, 4);
+    if (length <= 12) return view + 4;
+    sz_copy((sz_ptr_t)&buffer_index, view + 8, 4);
+    sz_copy((sz_ptr_t)&offset, view + 12, 4);
+    return (sz_cptr_t)array->buffers[2 + buffer_index] + offset;
+}
+
+SZ_INTERNAL sz_size_t _sz_sequence_arrow_view_length(sz_sequence_t const *sequence, sz_size_t i) {
+    struct ArrowArray const *array = (struct ArrowArray const *)sequence->handle;
+    if (!_sz_arrow_is_valid(array, i)) return 0;
+    sz_i32_t length;
+    sz_copy((sz_ptr_t)&length, (sz_cptr_t)array->buffers[1] + ((sz_size_t)array->offset + i) * 16, 4);
+    return (sz_size_t)length;
+}
+
+SZ_PUBLIC sz_bool_t sz_sequence_from_arrow(sz_cptr_t format, struct ArrowArray const *array,
+                                           sz_sequence_t *sequence) {
+    if (!format || !array || !array->release || array->length < 0 || array->offset < 0) return sz_false_k;
+    sequence->order = SZ_NULL;
+    sequence->count = (sz_size_t)array->length;
+    sequence->handle = array;
+
+    // The format strings are short, so compare them byte-by-byte
+    sz_bool_t const is_string = (sz_bool_t)(format[0] == 'u' || format[0] == 'z');
+    sz_bool_t const is_large = (sz_bool_t)(format[0] == 'U' || format[0] == 'Z');
+    sz_bool_t const is_view = (sz_bool_t)(format[0] == 'v' && (format[1] == 'u' || format[1] == 'z'));
+    if (is_string && format[1] == 0 && array->n_buffers == 3) {
+        sequence->get_start = _sz_sequence_arrow_i32_start;
+        sequence->get_length = _sz_sequence_arrow_i32_length;
+        return sz_true_k;
+    }
+    if (is_large && format[1] == 0 && array->n_buffers == 3) {
+        sequence->get_start = _sz_sequence_arrow_i64_start;
+        sequence->get_length = _sz_sequence_arrow_i64_length;
+        return sz_true_k;
+    }
+    // Views have the validity and views buffers, the variadic data buffers, and one more buffer with their sizes
+    if (is_view && format[2] == 0 && array->n_buffers >= 3) {
+        sequence->get_start = _sz_sequence_arrow_view_start;
+        sequence->get_length = _sz_sequence_arrow_view_length;
+        return sz_true_k;
+    }
+    return sz_false_k;
+}
+
+/**
+ *  @brief  Shared state of the `sz_sequence_to_u32tape` and `sz_sequence_to_u64tape` tasks,
+ *          each gathering ::partition_size consecutive strings of the ::sequence.
+ */
+typedef struct _sz_sequence_gather_state_t {
+    sz_sequence_t const *sequence;
+    void const *offsets;
+    sz_bool_t offsets_are_large;
+    sz_ptr_t tape;
+    sz_size_t partition_size;
+} _sz_sequence_gather_state_t;
+
+/**
+ *  @brief  Number of strings ahead of the current one, that `_sz_sequence_gather_task` prefetches.
+ *          Must be a power of two.
+ */
+#define _sz_sequence_gather_prefetch_distance 8
+
+SZ_INTERNAL void _sz_sequence_gather_task(void *context, sz_size_t task_index) {
+    _sz_sequence_gather_state_t const *state = (_sz_sequence_gather_state_t const *)context;
+    sz_sequence_t const *sequence = state->sequence;
+    sz_size_t const first = task_index * state->partition_size;
+    sz_size_t const last = sz_min_of_two(first + state->partition_size, sequence->count);
+
+    // Prefetch the starts of the upcoming strings, keeping their pointers in a small ring buffer,
+    // as the `get_start` callbacks are usually just as expensive as the cache misses on the strings.
+    sz_cptr_t starts[_sz_sequence_gather_prefetch_distance];
+    sz_size_t const mask = _sz_sequence_gather_prefetch_distance - 1;
+    sz_size_t ahead = first;
+    for (; ahead != last && ahead - first != _sz_sequence_gather_prefetch_distance; ++ahead) {
+        starts[ahead & mask] = sequence->get_start(sequence, sequence->order ? sequence->order[ahead] : ahead);
+        sz_prefetch(starts[ahead & mask]);
+    }
+
+    for (sz_size_t i = first; i != last; ++i) {
+        sz_size_t offset, length;
+        if (state->offsets_are_large) {
+            sz_u64_t const *offsets = (sz_u64_t const *)state->offsets;
+            offset = (sz_size_t)offsets[i], length = (sz_size_t)(offsets[i + 1] - offsets[i]);
+        }
+        else {
+            sz_u32_t const *offsets = (sz_u32_t const *)state->offsets;
+            offset = offsets[i], length = offsets[i + 1] - offsets[i];
+        }
+        sz_cptr_t start = starts[i & mask];
+        if (ahead != last) {
+            starts[ahead & mask] = sequence->get_start(sequence, sequence->order ? sequence->order[ahead] : ahead);
+            sz_prefetch(starts[ahead & mask]);
+            ++ahead;
+        }
+        sz_copy(state->tape + offset, start, length);
+    }
+}
+
+SZ_INTERNAL void _sz_sequence_gather(_sz_sequence_gather_state_t *state, sz_size_t tape_length,
+                                     sz_parallel_for_t parallel_for, void *executor) {
+    // Similar to `sz_copy_parallel`, small inputs are not worth the synchronization overhead.
+    sz_size_t const count = state->sequence->count;
+    sz_size_t const partition_length = sz_max_of_two((sz_size_t)SZ_NON_TEMPORAL_THRESHOLD, 1024ull * 1024ull);
+    sz_size_t const tasks_count = sz_min_of_two(tape_length / partition_length, count);
+    if (!parallel_for || tasks_count < 2) {
+        state->partition_size = count;
+        if (count) _sz_sequence_gather_task(state, 0);
+        return;
+    }
+    state->partition_size = (count + tasks_count - 1) / tasks_count;
+    sz_size_t const partitions_count = (count + state->partition_size - 1) / state->partition_size;
+    parallel_for(executor, _sz_sequence_gather_task, state, partitions_count);
+}
+
+SZ_PUBLIC sz_size_t sz_sequence_to_u32tape(sz_sequence_t const *sequence, sz_u32_t *offsets, sz_ptr_t tape,
+                                           sz_parallel_for_t parallel_for, void *executor) {
+    sz_size_t const count = sequence->count;
+    if (!tape) {
+        sz_size_t length = 0;
+        for (sz_size_t i = 0; i != count; ++i) {
+            offsets[i] = (sz_u32_t)length;
+            length += sequence->get_length(sequence, sequence->order ? sequence->order[i] : i);
+        }
+        offsets[count] = (sz_u32_t)length;
+        return length;
+    }
+
+    _sz_sequence_gather_state_t state;
+    state.sequence = sequence;
+    state.offsets = offsets;
+    state.offsets_are_large = sz_false_k;
+    state.tape = tape;
+    _sz_sequence_gather(&state, offsets[count], parallel_for, executor);
+    return offsets[count];
+}
+
+SZ_PUBLIC sz_size_t sz_sequence_to_u64tape(sz_sequence_t const *sequence, sz_u64_t *offsets, sz_ptr_t tape,
+                                           sz_parallel_for_t parallel_for, void *executor) {
+    sz_size_t const count = sequence->count;
+    if (!tape) {
+        sz_size_t length = 0;
+        for (sz_size_t i = 0; i != count; ++i) {
+            offsets[i] = length;
+            length += sequence->get_length(sequence, sequence->order ? sequence->order[i] : i);
+        }
+        offsets[count] = length;
+        return length;
+    }
+
+    _sz_sequence_gather_state_t state;
+    state.sequence = sequence;
+    state.offsets = offsets;
+    state.offsets_are_large = sz_true_k;
+    state.tape = tape;
+    _sz_sequence_gather(&state, (sz_size_t)offsets[count], parallel_for, executor);
+    return (sz_size_t)offsets[count];
+}
+
+SZ_PUBLIC void sz_find_batch(sz_sequence_t const *haystacks, sz_cptr_t needle, sz_size_t n_length,
+                             sz_size_t *offsets) {
+    sz_size_t const count = haystacks->count;
+    if (!n_length) {
+        for (sz_size_t i = 0; i != count; ++i) offsets[i] = 0;
+        return;
+    }
+    for (sz_size_t i = 0; i != count; ++i) {
+        sz_cptr_t haystack = haystacks->get_start(haystacks, i);
+        sz_cptr_t match = sz_find(haystack, haystacks->get_length(haystacks, i), needle, n_length);
+        offsets[i] = match ? (sz_size_t)(match - haystack) : SZ_SIZE_MAX;
+    }
+}
+
+SZ_PUBLIC void sz_count_batch(sz_sequence_t const *haystacks, sz_cptr_t needle, sz_size_t n_length,
+                              sz_bool_t allow_overlap, sz_size_t *counts) {
+    sz_size_t const count = haystacks->count;
+    for (sz_size_t i = 0; i != count; ++i)
+        counts[i] = sz_count(haystacks->get_start(haystacks, i), haystacks->get_length(haystacks, i), needle,
+                             n_length, allow_overlap);
+}
+
 SZ_PUBLIC sz_size_t sz_partition(sz_sequence_t *sequence, sz_sequence_predicate_t predicate) {
 
     sz_size_t matches = 0;
@@ -3657,9 +6595,14 @@ SZ_INTERNAL void _sz_heapsort(sz_sequence_t *sequence, sz_sequence_comparator_t
     }
 }
 
-SZ_PUBLIC void sz_sort_introsort_recursion(sz_sequence_t *sequence, sz_sequence_comparator_t less, sz_size_t first,
-                                           sz_size_t last, sz_size_t depth) {
+/**
+ *  @brief  Intro-Sort of the `[first, last)` range, that only guarantees the `[first, partial_last)` prefix to be
+ *          sorted and contain the smallest entries, skipping the partitions entirely beyond the ::partial_last.
+ */
+SZ_PUBLIC void _sz_sort_introsort_recursion(sz_sequence_t *sequence, sz_sequence_comparator_t less, sz_size_t first,
+                                            sz_size_t last, sz_size_t depth, sz_size_t partial_last) {
 
+    if (first >= partial_last) return;
     sz_size_t length = last - first;
     switch (length) {
     case 0:
@@ -3720,34 +6663,37 @@ SZ_PUBLIC void sz_sort_introsort_recursion(sz_sequence_t *sequence, sz_sequence_
         right--;
     }
 
-    // Recursively sort the partitions
-    sz_sort_introsort_recursion(sequence, less, first, left, depth);
-    sz_sort_introsort_recursion(sequence, less, right + 1, last, depth);
+    // Recursively sort the partitions, skipping the right one, if it's beyond the requested prefix
+    _sz_sort_introsort_recursion(sequence, less, first, left, depth, partial_last);
+    _sz_sort_introsort_recursion(sequence, less, right + 1, last, depth, partial_last);
 }
 
-SZ_PUBLIC void sz_sort_introsort(sz_sequence_t *sequence, sz_sequence_comparator_t less) {
-    if (sequence->count == 0) return;
+SZ_PUBLIC void sz_sort_introsort_recursion(sz_sequence_t *sequence, sz_sequence_comparator_t less, sz_size_t first,
+                                           sz_size_t last, sz_size_t depth) {
+    _sz_sort_introsort_recursion(sequence, less, first, last, depth, last);
+}
+
+/**
+ *  @brief  Partial Intro-Sort, placing the ::partial_order_length smallest entries in sorted order at the front.
+ */
+SZ_INTERNAL void _sz_sort_introsort_partial(sz_sequence_t *sequence, sz_sequence_comparator_t less,
+                                            sz_size_t partial_order_length) {
+    if (sequence->count == 0 || partial_order_length == 0) return;
     sz_size_t size_is_not_power_of_two = (sequence->count & (sequence->count - 1)) != 0;
     sz_size_t depth_limit = sz_size_log2i_nonzero(sequence->count) + size_is_not_power_of_two;
-    sz_sort_introsort_recursion(sequence, less, 0, sequence->count, depth_limit);
+    _sz_sort_introsort_recursion(sequence, less, 0, sequence->count, depth_limit,
+                                 sz_min_of_two(partial_order_length, sequence->count));
 }
 
-SZ_PUBLIC void sz_sort_recursion( //
-    sz_sequence_t *sequence, sz_size_t bit_idx, sz_size_t bit_max, sz_sequence_comparator_t comparator,
-    sz_size_t partial_order_length) {
-
-    if (!sequence->count) return;
-
-    // Array of size one doesn't need sorting - only needs the prefix to be discarded.
-    if (sequence->count == 1) {
-        sz_u32_t *order_half_words = (sz_u32_t *)sequence->order;
-        order_half_words[1] = 0;
-        return;
-    }
+SZ_PUBLIC void sz_sort_introsort(sz_sequence_t *sequence, sz_sequence_comparator_t less) {
+    _sz_sort_introsort_partial(sequence, less, sequence->count);
+}
 
-    // Partition a range of integers according to a specific bit value
-    sz_size_t split = 0;
-    sz_u64_t mask = (1ull << 63) >> bit_idx;
+/**
+ *  @brief  Moves the entries of the ::sequence without the ::mask bit to the front, in an unstable fashion.
+ *  @return The number of entries without the ::mask bit, which is also the index of the first one with it.
+ */
+SZ_INTERNAL sz_size_t _sz_sort_partition_by_bit(sz_sequence_t *sequence, sz_u64_t mask) {
 
     // The clean approach would be to perform a single pass over the sequence.
     //
@@ -3761,7 +6707,7 @@ SZ_PUBLIC void sz_sort_recursion( //
     // This would often lead to ~15% performance gain.
     sz_size_t count_with_bit_set = 0;
     for (sz_size_t i = 0; i != sequence->count; ++i) count_with_bit_set += (sequence->order[i] & mask) != 0;
-    split = sequence->count - count_with_bit_set;
+    sz_size_t split = sequence->count - count_with_bit_set;
 
     // It's possible that the sequence is already partitioned.
     if (split != 0 && split != sequence->count) {
@@ -3783,35 +6729,123 @@ SZ_PUBLIC void sz_sort_recursion( //
             else { break; }
         }
     }
+    return split;
+}
+
+/**
+ *  @brief  Exports up to 4 bytes of every string in the `[first, last)` range, starting from the ::key_offset,
+ *          into the upper half of the matching `sequence->order` entries, that must be empty.
+ *  @return Whether any of the strings has bytes at or past the ::key_offset.
+ */
+SZ_INTERNAL sz_bool_t _sz_sort_export_prefixes(sz_sequence_t *sequence, sz_size_t first, sz_size_t last,
+                                               sz_size_t key_offset) {
+    sz_bool_t has_more = sz_false_k;
+    for (sz_size_t i = first; i != last; ++i) {
+        sz_size_t length = sequence->get_length(sequence, sequence->order[i]);
+        if (length <= key_offset) continue;
+        sz_cptr_t begin = sequence->get_start(sequence, sequence->order[i]) + key_offset;
+        length -= key_offset;
+        length = length > 4u ? 4u : length;
+        sz_ptr_t prefix = (sz_ptr_t)&sequence->order[i];
+        for (sz_size_t j = 0; j != length; ++j) prefix[7 - j] = begin[j];
+        has_more = sz_true_k;
+    }
+    return has_more;
+}
+
+SZ_PUBLIC void _sz_sort_recursion( //
+    sz_sequence_t *sequence, sz_size_t bit_idx, sz_size_t bit_max, sz_sequence_comparator_t comparator,
+    sz_size_t key_offset, sz_size_t partial_order_length);
+
+/**
+ *  @brief  Continues sorting a bucket of strings sharing the same (zero-padded) prefix of ::key_offset bytes.
+ *          Instead of comparing strings with long shared prefixes via indirect calls, reloads the next 4 bytes
+ *          of every string and keeps radix-partitioning, until the buckets are small or the keys are exhausted.
+ *          Only the first ::partial_order_length entries of the bucket are guaranteed to be sorted.
+ */
+SZ_PUBLIC void _sz_sort_refill(sz_sequence_t *sequence, sz_sequence_comparator_t comparator, sz_size_t key_offset,
+                               sz_size_t partial_order_length) {
+
+    // Small buckets are cheaper to sort with comparisons, and the refill depth is limited to bound the costs.
+    sz_size_t const refill_min_count = 32, refill_max_offset = 1024;
+    sz_u32_t *order_half_words = (sz_u32_t *)sequence->order;
+    for (;; key_offset += 4) {
+        // Discard the prefixes.
+        for (sz_size_t i = 0; i != sequence->count; ++i) { order_half_words[i * 2 + 1] = 0; }
+        if (!partial_order_length) return;
+
+        if (sequence->count <= refill_min_count || key_offset >= refill_max_offset ||
+            !_sz_sort_export_prefixes(sequence, 0, sequence->count, key_offset)) {
+            _sz_sort_introsort_partial(sequence, comparator, partial_order_length);
+            return;
+        }
+
+        // Shared prefixes may be much longer than 4 bytes, so let's find the first bit that differs between
+        // the keys in a single pass, instead of partitioning on every one of them.
+        sz_u32_t keys_or = 0, keys_and = 0xFFFFFFFFu;
+        for (sz_size_t i = 0; i != sequence->count; ++i)
+            keys_or |= order_half_words[i * 2 + 1], keys_and &= order_half_words[i * 2 + 1];
+        if (keys_or == keys_and) continue;
+
+        _sz_sort_recursion(sequence, (sz_size_t)sz_u32_clz(keys_or ^ keys_and), 32, comparator, key_offset,
+                           partial_order_length);
+        return;
+    }
+}
+
+SZ_PUBLIC void _sz_sort_recursion( //
+    sz_sequence_t *sequence, sz_size_t bit_idx, sz_size_t bit_max, sz_sequence_comparator_t comparator,
+    sz_size_t key_offset, sz_size_t partial_order_length) {
+
+    if (!sequence->count) return;
+
+    // Array of size one doesn't need sorting - only needs the prefix to be discarded.
+    // Same applies to the buckets entirely beyond the requested top-k, that will stay unordered.
+    if (sequence->count == 1 || !partial_order_length) {
+        sz_u32_t *order_half_words = (sz_u32_t *)sequence->order;
+        for (sz_size_t i = 0; i != sequence->count; ++i) order_half_words[i * 2 + 1] = 0;
+        return;
+    }
 
-    // Go down recursively.
+    // Partition a range of integers according to a specific bit value.
+    // Skip the bits, that don't split the range at all, without going deeper into the recursion,
+    // which is often the case for long shared prefixes.
+    sz_size_t split = _sz_sort_partition_by_bit(sequence, (1ull << 63) >> bit_idx);
+    while (bit_idx < bit_max && (split == 0 || split == sequence->count))
+        split = _sz_sort_partition_by_bit(sequence, (1ull << 63) >> ++bit_idx);
+
+    // Go down recursively. The second half only matters, if the top-k doesn't fit into the first one.
+    sz_size_t const a_partial_length = sz_min_of_two(partial_order_length, split);
+    sz_size_t const b_partial_length = partial_order_length - a_partial_length;
     if (bit_idx < bit_max) {
         sz_sequence_t a = *sequence;
         a.count = split;
-        sz_sort_recursion(&a, bit_idx + 1, bit_max, comparator, partial_order_length);
+        _sz_sort_recursion(&a, bit_idx + 1, bit_max, comparator, key_offset, a_partial_length);
 
         sz_sequence_t b = *sequence;
         b.order += split;
         b.count -= split;
-        sz_sort_recursion(&b, bit_idx + 1, bit_max, comparator, partial_order_length);
+        _sz_sort_recursion(&b, bit_idx + 1, bit_max, comparator, key_offset, b_partial_length);
     }
-    // Reached the end of recursion.
+    // Reached the end of recursion, continue with the next bytes of the keys.
     else {
-        // Discard the prefixes.
-        sz_u32_t *order_half_words = (sz_u32_t *)sequence->order;
-        for (sz_size_t i = 0; i != sequence->count; ++i) { order_half_words[i * 2 + 1] = 0; }
-
         sz_sequence_t a = *sequence;
         a.count = split;
-        sz_sort_introsort(&a, comparator);
+        _sz_sort_refill(&a, comparator, key_offset + 4, a_partial_length);
 
         sz_sequence_t b = *sequence;
         b.order += split;
         b.count -= split;
-        sz_sort_introsort(&b, comparator);
+        _sz_sort_refill(&b, comparator, key_offset + 4, b_partial_length);
     }
 }
 
+SZ_PUBLIC void sz_sort_recursion( //
+    sz_sequence_t *sequence, sz_size_t bit_idx, sz_size_t bit_max, sz_sequence_comparator_t comparator,
+    sz_size_t partial_order_length) {
+    _sz_sort_recursion(sequence, bit_idx, bit_max, comparator, 0, partial_order_length);
+}
+
 SZ_INTERNAL sz_bool_t _sz_sort_is_less(sz_sequence_t *sequence, sz_size_t i_key, sz_size_t j_key) {
     sz_cptr_t i_str = sequence->get_start(sequence, i_key);
     sz_cptr_t j_str = sequence->get_start(sequence, j_key);
@@ -3820,33 +6854,100 @@ SZ_INTERNAL sz_bool_t _sz_sort_is_less(sz_sequence_t *sequence, sz_size_t i_key,
     return (sz_bool_t)(sz_order_serial(i_str, i_len, j_str, j_len) == sz_less_k);
 }
 
-SZ_PUBLIC void sz_sort_partial(sz_sequence_t *sequence, sz_size_t partial_order_length) {
+SZ_PUBLIC void sz_sort_partial_serial(sz_sequence_t *sequence, sz_size_t partial_order_length) {
 
 #if SZ_DETECT_BIG_ENDIAN
-    // TODO: Implement partial sort for big-endian systems. For now this sorts the whole thing.
-    sz_unused(partial_order_length);
-    sz_sort_introsort(sequence, (sz_sequence_comparator_t)_sz_sort_is_less);
+    // The radix prefixes are exported in little-endian order, so only the comparison-based sort is available.
+    _sz_sort_introsort_partial(sequence, (sz_sequence_comparator_t)_sz_sort_is_less, partial_order_length);
 #else
 
     // Export up to 4 bytes into the `sequence` bits themselves
-    for (sz_size_t i = 0; i != sequence->count; ++i) {
-        sz_cptr_t begin = sequence->get_start(sequence, sequence->order[i]);
-        sz_size_t length = sequence->get_length(sequence, sequence->order[i]);
-        length = length > 4u ? 4u : length;
-        sz_ptr_t prefix = (sz_ptr_t)&sequence->order[i];
-        for (sz_size_t j = 0; j != length; ++j) prefix[7 - j] = begin[j];
-    }
+    _sz_sort_export_prefixes(sequence, 0, sequence->count, 0);
 
     // Perform optionally-parallel radix sort on them
     sz_sort_recursion(sequence, 0, 32, (sz_sequence_comparator_t)_sz_sort_is_less, partial_order_length);
 #endif
 }
 
-SZ_PUBLIC void sz_sort(sz_sequence_t *sequence) {
+SZ_PUBLIC void sz_sort_serial(sz_sequence_t *sequence) {
+#if SZ_DETECT_BIG_ENDIAN
+    sz_sort_introsort(sequence, (sz_sequence_comparator_t)_sz_sort_is_less);
+#else
+    sz_sort_partial_serial(sequence, sequence->count);
+#endif
+}
+
+/**
+ *  @brief  Shared state of the `sz_sort_parallel` tasks.
+ *          On every level of the radix, the `bounds` of the `2^level` ranges are known,
+ *          and each task partitions one of them, reporting the `splits`.
+ */
+typedef struct _sz_sort_parallel_state_t {
+    sz_sequence_t *sequence;
+    sz_size_t bit_idx;
+    sz_size_t chunk_length;
+    sz_size_t bounds[257];
+    sz_size_t splits[256];
+} _sz_sort_parallel_state_t;
+
+SZ_INTERNAL void _sz_sort_parallel_export_task(void *context, sz_size_t task_index) {
+    _sz_sort_parallel_state_t *state = (_sz_sort_parallel_state_t *)context;
+    sz_size_t first = task_index * state->chunk_length;
+    sz_size_t last = sz_min_of_two(first + state->chunk_length, state->sequence->count);
+    _sz_sort_export_prefixes(state->sequence, first, last, 0);
+}
+
+SZ_INTERNAL void _sz_sort_parallel_partition_task(void *context, sz_size_t task_index) {
+    _sz_sort_parallel_state_t *state = (_sz_sort_parallel_state_t *)context;
+    sz_sequence_t range = *state->sequence;
+    range.order += state->bounds[task_index];
+    range.count = state->bounds[task_index + 1] - state->bounds[task_index];
+    sz_size_t split = _sz_sort_partition_by_bit(&range, (1ull << 63) >> state->bit_idx);
+    state->splits[task_index] = state->bounds[task_index] + split;
+}
+
+SZ_INTERNAL void _sz_sort_parallel_recursion_task(void *context, sz_size_t task_index) {
+    _sz_sort_parallel_state_t *state = (_sz_sort_parallel_state_t *)context;
+    sz_sequence_t range = *state->sequence;
+    range.order += state->bounds[task_index];
+    range.count = state->bounds[task_index + 1] - state->bounds[task_index];
+    sz_sort_recursion(&range, state->bit_idx, 32, (sz_sequence_comparator_t)_sz_sort_is_less, state->sequence->count);
+}
+
+SZ_PUBLIC void sz_sort_parallel_serial(sz_sequence_t *sequence, sz_parallel_for_t parallel_for, void *executor) {
+
+    // Small inputs are not worth the synchronization overhead.
+    sz_size_t const chunk_length = 64 * 1024;
+    if (!parallel_for || sequence->count < chunk_length) {
+        sz_sort_serial(sequence);
+        return;
+    }
+
 #if SZ_DETECT_BIG_ENDIAN
+    sz_unused(executor);
     sz_sort_introsort(sequence, (sz_sequence_comparator_t)_sz_sort_is_less);
 #else
-    sz_sort_partial(sequence, sequence->count);
+    _sz_sort_parallel_state_t state;
+    state.sequence = sequence;
+    state.chunk_length = chunk_length;
+
+    // Export the prefixes in equally-sized chunks.
+    parallel_for(executor, _sz_sort_parallel_export_task, &state, (sequence->count + chunk_length - 1) / chunk_length);
+
+    // Partition on the top 8 bits level-by-level, exactly like the serial `sz_sort_recursion` would,
+    // but handling all of the independent ranges of the same level concurrently.
+    sz_size_t ranges_count = 1;
+    state.bounds[0] = 0, state.bounds[1] = sequence->count;
+    for (state.bit_idx = 0; state.bit_idx != 8; ++state.bit_idx, ranges_count *= 2) {
+        parallel_for(executor, _sz_sort_parallel_partition_task, &state, ranges_count);
+        for (sz_size_t i = ranges_count; i != 0; --i) {
+            state.bounds[i * 2] = state.bounds[i];
+            state.bounds[i * 2 - 1] = state.splits[i - 1];
+        }
+    }
+
+    // Continue the radix sort and the follow-up comparison-based sort in every bucket independently.
+    parallel_for(executor, _sz_sort_parallel_recursion_task, &state, ranges_count);
 #endif
 }
 
@@ -3927,8 +7028,15 @@ SZ_PUBLIC void sz_fill_avx2(sz_ptr_t target, sz_size_t length, sz_u8_t value) {
             _mm_store_si128((__m128i *)target, _mm_set1_epi8(value_char)), target += 16, head_length -= 16;
         sz_assert((sz_size_t)target % 32 == 0 && "Target is supposed to be aligned to the YMM register size.");
 
-        // Fill the aligned body of the buffer.
-        for (; body_length >= 32; target += 32, body_length -= 32) _mm256_store_si256((__m256i *)target, value_vec);
+        // Fill the aligned body of the buffer. Huge buffers bypass the caches with streaming stores.
+        if (length < SZ_NON_TEMPORAL_FILL_THRESHOLD) {
+            for (; body_length >= 32; target += 32, body_length -= 32) _mm256_store_si256((__m256i *)target, value_vec);
+        }
+        else {
+            for (; body_length >= 32; target += 32, body_length -= 32)
+                _mm256_stream_si256((__m256i *)target, value_vec);
+            _mm_sfence();
+        }
 
         // Fill the tail of the buffer. This part is much cleaner with AVX-512.
         sz_assert((sz_size_t)target % 32 == 0 && "Target is supposed to be aligned to the YMM register size.");
@@ -3951,8 +7059,8 @@ SZ_PUBLIC void sz_copy_avx2(sz_ptr_t target, sz_cptr_t source, sz_size_t length)
     //
     // A typical AWS Skylake instance can have 32 KB x 2 blocks of L1 data cache per core,
     // 1 MB x 2 blocks of L2 cache per core, and one shared L3 cache buffer.
-    // For now, let's avoid the cases beyond the L2 size.
-    int is_huge = length > 1ull * 1024ull * 1024ull;
+    // Beyond the `SZ_NON_TEMPORAL_THRESHOLD`, we switch to streaming stores, not to pollute the caches.
+    int const is_huge = length >= SZ_NON_TEMPORAL_THRESHOLD;
     if (length <= 32) { sz_copy_serial(target, source, length); }
     // When dealing wirh larger arrays, the optimization is not as simple as with the `sz_fill_avx2` function,
     // as both buffers may be unaligned. If we are lucky and the requested operation is some huge page transfer,
@@ -3985,14 +7093,19 @@ SZ_PUBLIC void sz_copy_avx2(sz_ptr_t target, sz_cptr_t source, sz_size_t length)
             for (; body_length >= 32; target += 32, source += 32, body_length -= 32)
                 _mm256_store_si256((__m256i *)target, _mm256_lddqu_si256((__m256i const *)source));
         }
-        // When the biffer is huge, we can traverse it in 2 directions.
+        // When the buffer is huge, we can traverse it in 2 directions, bypassing the caches with streaming stores.
+        // The forward and backward passes meet in the middle, so we rewind to the end of the body afterwards.
         else {
+            sz_ptr_t const target_body_end = target + body_length;
+            sz_cptr_t const source_body_end = source + body_length;
             for (; body_length >= 64; target += 32, source += 32, body_length -= 64) {
-                _mm256_store_si256((__m256i *)(target), _mm256_lddqu_si256((__m256i const *)(source)));
-                _mm256_store_si256((__m256i *)(target + body_length - 32),
-                                   _mm256_lddqu_si256((__m256i const *)(source + body_length - 32)));
+                _mm256_stream_si256((__m256i *)(target), _mm256_lddqu_si256((__m256i const *)(source)));
+                _mm256_stream_si256((__m256i *)(target + body_length - 32),
+                                    _mm256_lddqu_si256((__m256i const *)(source + body_length - 32)));
             }
-            if (body_length) _mm256_store_si256((__m256i *)target, _mm256_lddqu_si256((__m256i const *)source));
+            if (body_length) _mm256_stream_si256((__m256i *)target, _mm256_lddqu_si256((__m256i const *)source));
+            _mm_sfence();
+            target = target_body_end, source = source_body_end;
         }
 
         // Fill the tail of the buffer. This part is much cleaner with AVX-512.
@@ -4008,7 +7121,11 @@ SZ_PUBLIC void sz_copy_avx2(sz_ptr_t target, sz_cptr_t source, sz_size_t length)
 }
 
 SZ_PUBLIC void sz_move_avx2(sz_ptr_t target, sz_cptr_t source, sz_size_t length) {
-    if (target < source || target >= source + length) {
+    // Huge non-overlapping buffers benefit from the streaming stores of `sz_copy_avx2`.
+    if (length >= SZ_NON_TEMPORAL_THRESHOLD && (target + length <= source || target >= source + length)) {
+        sz_copy_avx2(target, source, length);
+    }
+    else if (target < source || target >= source + length) {
         for (; length >= 32; target += 32, source += 32, length -= 32)
             _mm256_storeu_si256((__m256i *)target, _mm256_lddqu_si256((__m256i const *)source));
         while (length--) *(target++) = *(source++);
@@ -4058,7 +7175,7 @@ SZ_PUBLIC sz_u64_t sz_checksum_avx2(sz_cptr_t text, sz_size_t length) {
         sz_u64_t result = 0;
 
         // Handle the head
-        while (head_length--) result += *text++;
+        while (head_length--) result += *(sz_u8_t const *)text++;
 
         sz_u256_vec_t text_vec, sums_vec;
         sums_vec.ymm = _mm256_setzero_si256();
@@ -4069,14 +7186,16 @@ SZ_PUBLIC sz_u64_t sz_checksum_avx2(sz_cptr_t text, sz_size_t length) {
                 sums_vec.ymm = _mm256_add_epi64(sums_vec.ymm, _mm256_sad_epu8(text_vec.ymm, _mm256_setzero_si256()));
             }
         }
-        // When the biffer is huge, we can traverse it in 2 directions.
+        // When the buffer is huge, we can traverse it in 2 directions.
+        // The forward and backward passes meet in the middle, so we rewind to the end of the body afterwards.
         else {
             sz_u256_vec_t text_reversed_vec, sums_reversed_vec;
+            sz_cptr_t const text_body_end = text + body_length;
             sums_reversed_vec.ymm = _mm256_setzero_si256();
-            for (; body_length >= 64; text += 64, body_length -= 64) {
+            for (; body_length >= 64; text += 32, body_length -= 64) {
                 text_vec.ymm = _mm256_stream_load_si256((__m256i *)(text));
                 sums_vec.ymm = _mm256_add_epi64(sums_vec.ymm, _mm256_sad_epu8(text_vec.ymm, _mm256_setzero_si256()));
-                text_reversed_vec.ymm = _mm256_stream_load_si256((__m256i *)(text + body_length - 64));
+                text_reversed_vec.ymm = _mm256_stream_load_si256((__m256i *)(text + body_length - 32));
                 sums_reversed_vec.ymm = _mm256_add_epi64(
                     sums_reversed_vec.ymm, _mm256_sad_epu8(text_reversed_vec.ymm, _mm256_setzero_si256()));
             }
@@ -4085,10 +7204,11 @@ SZ_PUBLIC sz_u64_t sz_checksum_avx2(sz_cptr_t text, sz_size_t length) {
                 sums_vec.ymm = _mm256_add_epi64(sums_vec.ymm, _mm256_sad_epu8(text_vec.ymm, _mm256_setzero_si256()));
             }
             sums_vec.ymm = _mm256_add_epi64(sums_vec.ymm, sums_reversed_vec.ymm);
+            text = text_body_end;
         }
 
         // Handle the tail
-        while (tail_length--) result += *text++;
+        while (tail_length--) result += *(sz_u8_t const *)text++;
 
         // Accumulating 256 bits is harders, as we need to extract the 128-bit sums first.
         __m128i low_xmm = _mm256_castsi256_si128(sums_vec.ymm);
@@ -4100,6 +7220,52 @@ SZ_PUBLIC sz_u64_t sz_checksum_avx2(sz_cptr_t text, sz_size_t length) {
         return result;
     }
 }
+/**
+ *  @brief  AVX2 variant of `_sz_hash_stripe_serial`, keeping the 8 lanes in two registers.
+ */
+SZ_INTERNAL void _sz_hash_stripe_avx2(__m256i *lanes, sz_cptr_t stripe, sz_size_t stripe_index) {
+    sz_u64_t const *keys = _sz_hash_secret + (stripe_index & 7);
+    for (int half = 0; half != 2; ++half) {
+        __m256i words = _mm256_lddqu_si256((__m256i const *)(stripe + half * 32));
+        __m256i keyed = _mm256_xor_si256(words, _mm256_loadu_si256((__m256i const *)(keys + half * 4)));
+        __m256i products = _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32));
+        lanes[half] = _mm256_add_epi64(lanes[half], _mm256_add_epi64(products, words));
+    }
+    if ((stripe_index & 7) != 7) return;
+    // There is no 64-bit multiplication in AVX2, but the prime is only 32 bits wide.
+    __m256i const prime = _mm256_set1_epi64x(_sz_hash_scramble_prime);
+    for (int half = 0; half != 2; ++half) {
+        __m256i lane = _mm256_xor_si256(lanes[half], _mm256_srli_epi64(lanes[half], 47));
+        lane = _mm256_xor_si256(lane, _mm256_loadu_si256((__m256i const *)(_sz_hash_secret + 8 + half * 4)));
+        __m256i low_products = _mm256_mul_epu32(lane, prime);
+        __m256i high_products = _mm256_mul_epu32(_mm256_srli_epi64(lane, 32), prime);
+        lanes[half] = _mm256_add_epi64(low_products, _mm256_slli_epi64(high_products, 32));
+    }
+}
+
+SZ_PUBLIC sz_u64_t sz_hash_avx2(sz_cptr_t start, sz_size_t length) {
+    if (length <= 16) {
+        sz_u64_t low, high;
+        _sz_hash_load_short((sz_u8_t const *)start, length, &low, &high);
+        return _sz_hash_short(low, high, length);
+    }
+
+    __m256i lanes[2];
+    lanes[0] = _mm256_loadu_si256((__m256i const *)_sz_hash_secret);
+    lanes[1] = _mm256_loadu_si256((__m256i const *)(_sz_hash_secret + 4));
+    sz_size_t const full_stripes = (length - 1) / 64;
+    sz_size_t stripe_index = 0;
+    for (; stripe_index != full_stripes; ++stripe_index, start += 64) _sz_hash_stripe_avx2(lanes, start, stripe_index);
+
+    // AVX2 has no byte-granular masked loads, so the tail is zero-padded on the stack
+    sz_u64_t tail[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    sz_copy_serial((sz_ptr_t)tail, start, length - full_stripes * 64);
+    _sz_hash_stripe_avx2(lanes, (sz_cptr_t)tail, stripe_index);
+    _mm256_storeu_si256((__m256i *)tail, lanes[0]);
+    _mm256_storeu_si256((__m256i *)(tail + 4), lanes[1]);
+    return _sz_hash_fold(tail, length);
+}
+
 
 SZ_PUBLIC void sz_look_up_transform_avx2(sz_cptr_t source, sz_size_t length, sz_cptr_t lut, sz_ptr_t target) {
 
@@ -4340,6 +7506,140 @@ SZ_PUBLIC sz_cptr_t sz_rfind_avx2(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n,
     return sz_rfind_serial(h, h_length, n, n_length);
 }
 
+/**
+ *  @brief  Folds uppercase ASCII letters into lowercase. Lacking unsigned comparisons in AVX2,
+ *          the "A-Z" range check is performed with a saturating subtraction.
+ */
+SZ_INTERNAL __m256i _sz_fold_ascii_avx2(__m256i text) {
+    __m256i offsets = _mm256_sub_epi8(text, _mm256_set1_epi8('A'));
+    __m256i uppers = _mm256_cmpeq_epi8(_mm256_subs_epu8(offsets, _mm256_set1_epi8(25)), _mm256_setzero_si256());
+    return _mm256_or_si256(text, _mm256_and_si256(uppers, _mm256_set1_epi8(0x20)));
+}
+
+SZ_INTERNAL sz_bool_t _sz_equal_caseless_avx2(sz_cptr_t a, sz_cptr_t b, sz_size_t length) {
+    sz_u256_vec_t a_vec, b_vec;
+    for (; length >= 32; a += 32, b += 32, length -= 32) {
+        a_vec.ymm = _sz_fold_ascii_avx2(_mm256_lddqu_si256((__m256i const *)a));
+        b_vec.ymm = _sz_fold_ascii_avx2(_mm256_lddqu_si256((__m256i const *)b));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(a_vec.ymm, b_vec.ymm)) != (int)0xFFFFFFFF) return sz_false_k;
+    }
+    return _sz_equal_caseless_serial(a, b, length);
+}
+
+SZ_PUBLIC sz_cptr_t sz_find_caseless_avx2(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
+
+    // This almost never fires, but it's better to be safe than sorry.
+    if (h_length < n_length || !n_length) return SZ_NULL_CHAR;
+
+    // Pick the parts of the needle that are worth comparing.
+    sz_size_t offset_first, offset_mid, offset_last;
+    _sz_locate_needle_anomalies(n, n_length, &offset_first, &offset_mid, &offset_last);
+
+    // Broadcast the folded characters into YMM registers.
+    int matches;
+    sz_u256_vec_t h_first_vec, h_mid_vec, h_last_vec, n_first_vec, n_mid_vec, n_last_vec;
+    n_first_vec.ymm = _mm256_set1_epi8((char)_sz_u8_fold_ascii((sz_u8_t)n[offset_first]));
+    n_mid_vec.ymm = _mm256_set1_epi8((char)_sz_u8_fold_ascii((sz_u8_t)n[offset_mid]));
+    n_last_vec.ymm = _mm256_set1_epi8((char)_sz_u8_fold_ascii((sz_u8_t)n[offset_last]));
+
+    // Scan through the string, folding the haystack in-register.
+    for (; h_length >= n_length + 32; h += 32, h_length -= 32) {
+        h_first_vec.ymm = _sz_fold_ascii_avx2(_mm256_lddqu_si256((__m256i const *)(h + offset_first)));
+        h_mid_vec.ymm = _sz_fold_ascii_avx2(_mm256_lddqu_si256((__m256i const *)(h + offset_mid)));
+        h_last_vec.ymm = _sz_fold_ascii_avx2(_mm256_lddqu_si256((__m256i const *)(h + offset_last)));
+        matches = _mm256_movemask_epi8(_mm256_cmpeq_epi8(h_first_vec.ymm, n_first_vec.ymm)) &
+                  _mm256_movemask_epi8(_mm256_cmpeq_epi8(h_mid_vec.ymm, n_mid_vec.ymm)) &
+                  _mm256_movemask_epi8(_mm256_cmpeq_epi8(h_last_vec.ymm, n_last_vec.ymm));
+        while (matches) {
+            int potential_offset = sz_u32_ctz(matches);
+            if (n_length <= 3 || _sz_equal_caseless_avx2(h + potential_offset, n, n_length))
+                return h + potential_offset;
+            matches &= matches - 1;
+        }
+    }
+
+    return sz_find_caseless_serial(h, h_length, n, n_length);
+}
+
+SZ_PUBLIC sz_cptr_t sz_rfind_caseless_avx2(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
+
+    // This almost never fires, but it's better to be safe than sorry.
+    if (h_length < n_length || !n_length) return SZ_NULL_CHAR;
+
+    // Pick the parts of the needle that are worth comparing.
+    sz_size_t offset_first, offset_mid, offset_last;
+    _sz_locate_needle_anomalies(n, n_length, &offset_first, &offset_mid, &offset_last);
+
+    // Broadcast the folded characters into YMM registers.
+    int matches;
+    sz_u256_vec_t h_first_vec, h_mid_vec, h_last_vec, n_first_vec, n_mid_vec, n_last_vec;
+    n_first_vec.ymm = _mm256_set1_epi8((char)_sz_u8_fold_ascii((sz_u8_t)n[offset_first]));
+    n_mid_vec.ymm = _mm256_set1_epi8((char)_sz_u8_fold_ascii((sz_u8_t)n[offset_mid]));
+    n_last_vec.ymm = _mm256_set1_epi8((char)_sz_u8_fold_ascii((sz_u8_t)n[offset_last]));
+
+    // Scan through the string, folding the haystack in-register.
+    sz_cptr_t h_reversed;
+    for (; h_length >= n_length + 32; h_length -= 32) {
+        h_reversed = h + h_length - n_length - 32 + 1;
+        h_first_vec.ymm = _sz_fold_ascii_avx2(_mm256_lddqu_si256((__m256i const *)(h_reversed + offset_first)));
+        h_mid_vec.ymm = _sz_fold_ascii_avx2(_mm256_lddqu_si256((__m256i const *)(h_reversed + offset_mid)));
+        h_last_vec.ymm = _sz_fold_ascii_avx2(_mm256_lddqu_si256((__m256i const *)(h_reversed + offset_last)));
+        matches = _mm256_movemask_epi8(_mm256_cmpeq_epi8(h_first_vec.ymm, n_first_vec.ymm)) &
+                  _mm256_movemask_epi8(_mm256_cmpeq_epi8(h_mid_vec.ymm, n_mid_vec.ymm)) &
+                  _mm256_movemask_epi8(_mm256_cmpeq_epi8(h_last_vec.ymm, n_last_vec.ymm));
+        while (matches) {
+            int potential_offset = sz_u32_clz(matches);
+            if (n_length <= 3 || _sz_equal_caseless_avx2(h + h_length - n_length - potential_offset, n, n_length))
+                return h + h_length - n_length - potential_offset;
+            matches &= ~(1 << (31 - potential_offset));
+        }
+    }
+
+    return sz_rfind_caseless_serial(h, h_length, n, n_length);
+}
+
+SZ_PUBLIC sz_cptr_t sz_find_multi_avx2(sz_multi_matcher_t const *matcher, sz_cptr_t h, sz_size_t h_length,
+                                       sz_size_t *needle_index) {
+
+    if (!matcher->count || h_length < matcher->min_length) return SZ_NULL_CHAR;
+
+    // The `vpshufb` instruction performs look-ups within 128-bit lanes,
+    // so the 16-entry nibble tables are replicated into both halves of YMM registers.
+    sz_size_t const teddy_length = sz_min_of_two(matcher->prefix_length, 3);
+    sz_u256_vec_t lows_vec[3], highs_vec[3];
+    for (sz_size_t j = 0; j != teddy_length; ++j) {
+        lows_vec[j].xmms[0] = lows_vec[j].xmms[1] = _mm_lddqu_si128((__m128i const *)matcher->nibbles_low[j]);
+        highs_vec[j].xmms[0] = highs_vec[j].xmms[1] = _mm_lddqu_si128((__m128i const *)matcher->nibbles_high[j]);
+    }
+
+    sz_u32_t matches;
+    sz_u256_vec_t h_vec, groups_vec, nibble_mask_vec;
+    nibble_mask_vec.ymm = _mm256_set1_epi8(0x0F);
+
+    // Every iteration evaluates 32 starting offsets, intersecting the groups of needles,
+    // that have matching low and high nibbles in each of the first `teddy_length` bytes.
+    for (; h_length >= 32 + teddy_length; h += 32, h_length -= 32) {
+        groups_vec.ymm = _mm256_set1_epi8((char)0xFF);
+        for (sz_size_t j = 0; j != teddy_length; ++j) {
+            h_vec.ymm = _mm256_lddqu_si256((__m256i const *)(h + j));
+            groups_vec.ymm = _mm256_and_si256(
+                groups_vec.ymm,
+                _mm256_and_si256(_mm256_shuffle_epi8(lows_vec[j].ymm, _mm256_and_si256(h_vec.ymm, nibble_mask_vec.ymm)),
+                                 _mm256_shuffle_epi8(highs_vec[j].ymm, _mm256_and_si256(_mm256_srli_epi16(h_vec.ymm, 4),
+                                                                                        nibble_mask_vec.ymm))));
+        }
+        matches = ~(sz_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(groups_vec.ymm, _mm256_setzero_si256()));
+        while (matches) {
+            int potential_offset = sz_u32_ctz(matches);
+            if (_sz_multi_matcher_verify(matcher, h + potential_offset, h_length - potential_offset, needle_index))
+                return h + potential_offset;
+            matches &= matches - 1;
+        }
+    }
+
+    return sz_find_multi_serial(matcher, h, h_length, needle_index);
+}
+
 SZ_PUBLIC sz_cptr_t sz_find_charset_avx2(sz_cptr_t text, sz_size_t length, sz_charset_t const *filter) {
 
     // Let's unzip even and odd elements and replicate them into both lanes of the YMM register.
@@ -4411,160 +7711,705 @@ SZ_PUBLIC sz_cptr_t sz_find_charset_avx2(sz_cptr_t text, sz_size_t length, sz_ch
         __m256i take_first = _mm256_cmpgt_epi8(_mm256_set1_epi8(8), lower_nibbles_vec.ymm);
         bitset_even_vec.ymm = _mm256_blendv_epi8(bitset_odd_vec.ymm, bitset_even_vec.ymm, take_first);
 
-        // It would have been great to have an instruction that tests the bits and then broadcasts
-        // the matching bit into all bits in that byte. But we don't have that, so we have to
-        // `and`, `cmpeq`, `movemask`, and then invert at the end...
-        matches_vec.ymm = _mm256_and_si256(bitset_even_vec.ymm, bitmask_vec.ymm);
-        matches_vec.ymm = _mm256_cmpeq_epi8(matches_vec.ymm, _mm256_setzero_si256());
-        int matches_mask = ~_mm256_movemask_epi8(matches_vec.ymm);
-        if (matches_mask) {
-            int offset = sz_u32_ctz(matches_mask);
-            return text + offset;
+        // It would have been great to have an instruction that tests the bits and then broadcasts
+        // the matching bit into all bits in that byte. But we don't have that, so we have to
+        // `and`, `cmpeq`, `movemask`, and then invert at the end...
+        matches_vec.ymm = _mm256_and_si256(bitset_even_vec.ymm, bitmask_vec.ymm);
+        matches_vec.ymm = _mm256_cmpeq_epi8(matches_vec.ymm, _mm256_setzero_si256());
+        int matches_mask = ~_mm256_movemask_epi8(matches_vec.ymm);
+        if (matches_mask) {
+            int offset = sz_u32_ctz(matches_mask);
+            return text + offset;
+        }
+        else { text += 32, length -= 32; }
+    }
+
+    return sz_find_charset_serial(text, length, filter);
+}
+
+SZ_PUBLIC sz_cptr_t sz_rfind_charset_avx2(sz_cptr_t text, sz_size_t length, sz_charset_t const *filter) {
+    return sz_rfind_charset_serial(text, length, filter);
+}
+
+/**
+ *  @brief  Exports the offsets of the set bits of the ::mask, relative to the ::base, after the first ::count ones.
+ *  @return Total number of exported offsets, at most ::capacity.
+ */
+SZ_INTERNAL sz_size_t _sz_find_all_export_avx2(sz_u32_t mask, sz_size_t base, sz_size_t *offsets, sz_size_t count,
+                                               sz_size_t capacity) {
+    if (!offsets) return sz_min_of_two(count + sz_u32_popcount(mask), capacity);
+    for (; mask && count != capacity; mask &= mask - 1) offsets[count++] = base + sz_u32_ctz(mask);
+    return count;
+}
+
+/**
+ *  @brief  Tests 32 bytes for membership in a set, like the loop of `sz_find_charset_avx2`, returning the bitmask.
+ *          Expects the even and odd bytes of the set unzipped and replicated into both lanes of the registers.
+ */
+SZ_INTERNAL sz_u32_t _sz_charset_mask_avx2(__m256i text, __m256i filter_even, __m256i filter_odd) {
+    __m256i const bitmask_lookup = _mm256_set_epi8(-128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1, //
+                                                   -128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1);
+    __m256i const nibble_mask = _mm256_set1_epi8(0x0f);
+    __m256i lower_nibbles = _mm256_and_si256(text, nibble_mask);
+    __m256i higher_nibbles = _mm256_and_si256(_mm256_srli_epi16(text, 4), nibble_mask);
+    __m256i bitmask = _mm256_shuffle_epi8(bitmask_lookup, lower_nibbles);
+    __m256i bitset_even = _mm256_shuffle_epi8(filter_even, higher_nibbles);
+    __m256i bitset_odd = _mm256_shuffle_epi8(filter_odd, higher_nibbles);
+    __m256i take_first = _mm256_cmpgt_epi8(_mm256_set1_epi8(8), lower_nibbles);
+    __m256i bitset = _mm256_blendv_epi8(bitset_odd, bitset_even, take_first);
+    __m256i misses = _mm256_cmpeq_epi8(_mm256_and_si256(bitset, bitmask), _mm256_setzero_si256());
+    return ~(sz_u32_t)_mm256_movemask_epi8(misses);
+}
+
+SZ_PUBLIC sz_size_t sz_find_all_avx2(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length,
+                                     sz_bool_t allow_overlap, sz_size_t *offsets, sz_size_t capacity) {
+
+    // This almost never fires, but it's better to be safe than sorry.
+    if (h_length < n_length || !n_length) return 0;
+
+    sz_size_t count = 0, i = 0;
+    if (n_length == 1) {
+        sz_u256_vec_t h_vec, n_vec;
+        n_vec.ymm = _mm256_set1_epi8(n[0]);
+        for (; i + 32 <= h_length && count != capacity; i += 32) {
+            h_vec.ymm = _mm256_lddqu_si256((__m256i const *)(h + i));
+            sz_u32_t matches = (sz_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(h_vec.ymm, n_vec.ymm));
+            count = _sz_find_all_export_avx2(matches, i, offsets, count, capacity);
+        }
+        if (count == capacity) return count;
+        return _sz_find_all_resume_serial(h, h_length, i, n, n_length, allow_overlap, offsets, count, capacity);
+    }
+
+    // Pick the parts of the needle that are worth comparing.
+    // For needles of up to 3 bytes those cover every byte, and need no further verification.
+    sz_size_t offset_first, offset_mid, offset_last;
+    _sz_locate_needle_anomalies(n, n_length, &offset_first, &offset_mid, &offset_last);
+    sz_u256_vec_t h_first_vec, h_mid_vec, h_last_vec, n_first_vec, n_mid_vec, n_last_vec;
+    n_first_vec.ymm = _mm256_set1_epi8(n[offset_first]);
+    n_mid_vec.ymm = _mm256_set1_epi8(n[offset_mid]);
+    n_last_vec.ymm = _mm256_set1_epi8(n[offset_last]);
+
+    // Every match forbids the following candidates, that would overlap with it.
+    sz_size_t const skip_length = allow_overlap ? 1 : n_length;
+    sz_size_t next_offset = 0;
+    for (; i + n_length + 32 <= h_length && count != capacity; i += 32) {
+        h_first_vec.ymm = _mm256_lddqu_si256((__m256i const *)(h + i + offset_first));
+        h_mid_vec.ymm = _mm256_lddqu_si256((__m256i const *)(h + i + offset_mid));
+        h_last_vec.ymm = _mm256_lddqu_si256((__m256i const *)(h + i + offset_last));
+        sz_u32_t matches = (sz_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(h_first_vec.ymm, n_first_vec.ymm)) &
+                           (sz_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(h_mid_vec.ymm, n_mid_vec.ymm)) &
+                           (sz_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(h_last_vec.ymm, n_last_vec.ymm));
+        if (next_offset > i) matches = next_offset - i >= 32 ? 0 : matches & (0xFFFFFFFFu << (next_offset - i));
+        while (matches && count != capacity) {
+            sz_size_t offset = i + sz_u32_ctz(matches);
+            if (n_length > 3 && !sz_equal_avx2(h + offset, n, n_length)) {
+                matches &= matches - 1;
+                continue;
+            }
+            if (offsets) offsets[count] = offset;
+            ++count;
+            next_offset = offset + skip_length;
+            matches = next_offset - i >= 32 ? 0 : matches & (0xFFFFFFFFu << (next_offset - i));
+        }
+    }
+
+    if (count == capacity) return count;
+    return _sz_find_all_resume_serial(h, h_length, sz_max_of_two(i, next_offset), n, n_length, allow_overlap,
+                                      offsets, count, capacity);
+}
+
+SZ_PUBLIC sz_size_t sz_find_all_charset_avx2(sz_cptr_t text, sz_size_t length, sz_charset_t const *filter,
+                                             sz_size_t *offsets, sz_size_t capacity) {
+
+    // Unzip the even and odd bytes of the set, same as in `sz_find_charset_avx2`.
+    sz_u256_vec_t filter_even_vec, filter_odd_vec, text_vec;
+    for (sz_size_t i = 0; i != 16; ++i)
+        filter_even_vec.u8s[i] = filter->_u8s[i * 2], filter_odd_vec.u8s[i] = filter->_u8s[i * 2 + 1];
+    filter_even_vec.xmms[1] = filter_even_vec.xmms[0];
+    filter_odd_vec.xmms[1] = filter_odd_vec.xmms[0];
+
+    sz_size_t count = 0, i = 0;
+    for (; i + 32 <= length && count != capacity; i += 32) {
+        text_vec.ymm = _mm256_lddqu_si256((__m256i const *)(text + i));
+        sz_u32_t matches = _sz_charset_mask_avx2(text_vec.ymm, filter_even_vec.ymm, filter_odd_vec.ymm);
+        count = _sz_find_all_export_avx2(matches, i, offsets, count, capacity);
+    }
+
+    if (count == capacity) return count;
+    return _sz_find_all_charset_resume_serial(text, length, i, filter, offsets, count, capacity);
+}
+
+/**
+ *  @brief  There is no AVX2 instruction for fast multiplication of 64-bit integers.
+ *          This implementation is coming from Agner Fog's Vector Class Library.
+ */
+SZ_INTERNAL __m256i _mm256_mul_epu64(__m256i a, __m256i b) {
+    __m256i bswap = _mm256_shuffle_epi32(b, 0xB1);
+    __m256i prodlh = _mm256_mullo_epi32(a, bswap);
+    __m256i zero = _mm256_setzero_si256();
+    __m256i prodlh2 = _mm256_hadd_epi32(prodlh, zero);
+    __m256i prodlh3 = _mm256_shuffle_epi32(prodlh2, 0x73);
+    __m256i prodll = _mm256_mul_epu32(a, b);
+    __m256i prod = _mm256_add_epi64(prodll, prodlh3);
+    return prod;
+}
+
+/**
+ *  @brief  Reduces the unsigned 64-bit lanes modulo `SZ_U64_MAX_PRIME`, like the `%` in `sz_hashes_serial`.
+ *          There are only 59 values between the prime and 2^64, so a conditional subtraction is enough. AVX2 only
+ *          compares signed integers, so the sign bits are flipped to compare `x ^ sign > (prime - 1) ^ sign`.
+ */
+SZ_INTERNAL __m256i _sz_hashes_prime_mod_avx2(__m256i x) {
+    __m256i const sign_vec = _mm256_set1_epi64x((long long)0x8000000000000000ull);
+    __m256i const threshold_vec = _mm256_set1_epi64x((long long)((SZ_U64_MAX_PRIME - 1) ^ 0x8000000000000000ull));
+    __m256i const prime_vec = _mm256_set1_epi64x((long long)SZ_U64_MAX_PRIME);
+    __m256i above_vec = _mm256_cmpgt_epi64(_mm256_xor_si256(x, sign_vec), threshold_vec);
+    return _mm256_sub_epi64(x, _mm256_and_si256(above_vec, prime_vec));
+}
+
+/**
+ *  @brief  Multiplies the 64-bit lanes holding bytes by the 64-bit ::factor, wrapping around like `sz_u64_t`.
+ *          The ::factor_top must contain the top halves of the ::factor, as `_mm256_mul_epu32` ignores them.
+ */
+SZ_INTERNAL __m256i _sz_hashes_mul_byte_avx2(__m256i bytes, __m256i factor, __m256i factor_top) {
+    return _mm256_add_epi64(_mm256_mul_epu32(bytes, factor), //
+                            _mm256_slli_epi64(_mm256_mul_epu32(bytes, factor_top), 32));
+}
+
+/**
+ *  @brief  Loads the characters at the same ::offset of 4 consecutive runs of ::run_length bytes into 64-bit lanes.
+ */
+SZ_INTERNAL __m256i _sz_hashes_load_lanes_avx2(sz_u8_t const *text, sz_size_t run_length, sz_size_t offset) {
+    text += offset;
+    return _mm256_set_epi64x(text[run_length * 3], text[run_length * 2], text[run_length * 1], text[0]);
+}
+
+SZ_PUBLIC void sz_hashes_avx2(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t step, //
+                              sz_hash_callback_t callback, void *callback_handle) {
+
+    if (length < window_length || !window_length) return;
+
+    // Slice the windows into 4 contiguous runs, each a multiple of the `step` long, and slide over them in
+    // parallel, keeping the hashes of every run in a separate 64-bit lane. The last run serially continues
+    // over the remaining windows. Priming 4 windows at once doesn't pay off for short strings.
+    sz_size_t const windows = length - window_length + 1;
+    sz_size_t const step_mask = step - 1;
+    sz_size_t const windows_per_lane = (windows / 4) & ~step_mask;
+    if (windows_per_lane < window_length) {
+        sz_hashes_serial(start, length, window_length, step, callback, callback_handle);
+        return;
+    }
+    sz_u8_t const *text = (sz_u8_t const *)start;
+    _sz_hashes_rolling_t rolling;
+    _sz_hashes_rolling_init(&rolling, start, length, window_length);
+
+    // AVX2 can't multiply 64-bit integers, but the bases are just a shift and an addition away,
+    // and the outgoing characters fit into the 32 bits supported by `_mm256_mul_epu32`.
+    sz_u256_vec_t prime_power_low_vec, prime_power_low_top_vec, prime_power_high_vec, prime_power_high_top_vec;
+    sz_u256_vec_t shift_high_vec, byte_mask_vec, golden_ratio_vec;
+    prime_power_low_vec.ymm = _mm256_set1_epi64x((long long)rolling.prime_power_low);
+    prime_power_high_vec.ymm = _mm256_set1_epi64x((long long)rolling.prime_power_high);
+    prime_power_low_top_vec.ymm = _mm256_srli_epi64(prime_power_low_vec.ymm, 32);
+    prime_power_high_top_vec.ymm = _mm256_srli_epi64(prime_power_high_vec.ymm, 32);
+    shift_high_vec.ymm = _mm256_set1_epi64x(77);
+    byte_mask_vec.ymm = _mm256_set1_epi64x(0xFF);
+    golden_ratio_vec.ymm = _mm256_set1_epi64x((long long)11400714819323198485ull);
+
+    // Compute the initial hash values for every one of the four windows.
+    sz_u256_vec_t hash_low_vec, hash_high_vec, hash_mix_vec, chars_low_vec, chars_high_vec;
+    hash_low_vec.ymm = _mm256_setzero_si256();
+    hash_high_vec.ymm = _mm256_setzero_si256();
+    for (sz_size_t i = 0; i != window_length; ++i) {
+        chars_low_vec.ymm = _sz_hashes_load_lanes_avx2(text, windows_per_lane, i);
+        chars_high_vec.ymm = _mm256_and_si256(_mm256_add_epi64(chars_low_vec.ymm, shift_high_vec.ymm), //
+                                              byte_mask_vec.ymm);
+        hash_low_vec.ymm = _mm256_sub_epi64(_mm256_slli_epi64(hash_low_vec.ymm, 5), hash_low_vec.ymm);
+        hash_high_vec.ymm = _mm256_add_epi64(_mm256_slli_epi64(hash_high_vec.ymm, 8), hash_high_vec.ymm);
+        hash_low_vec.ymm = _sz_hashes_prime_mod_avx2(_mm256_add_epi64(hash_low_vec.ymm, chars_low_vec.ymm));
+        hash_high_vec.ymm = _sz_hashes_prime_mod_avx2(_mm256_add_epi64(hash_high_vec.ymm, chars_high_vec.ymm));
+    }
+
+    // Now repeat that operation for the remaining characters, discarding older characters.
+    for (sz_size_t i = 0; i != windows_per_lane; ++i) {
+        if (i) {
+            // 1. Discard the outgoing characters.
+            chars_low_vec.ymm = _sz_hashes_load_lanes_avx2(text, windows_per_lane, i - 1);
+            chars_high_vec.ymm = _mm256_and_si256(_mm256_add_epi64(chars_low_vec.ymm, shift_high_vec.ymm), //
+                                                  byte_mask_vec.ymm);
+            hash_low_vec.ymm = _mm256_sub_epi64(
+                hash_low_vec.ymm,
+                _sz_hashes_mul_byte_avx2(chars_low_vec.ymm, prime_power_low_vec.ymm, prime_power_low_top_vec.ymm));
+            hash_high_vec.ymm = _mm256_sub_epi64(
+                hash_high_vec.ymm,
+                _sz_hashes_mul_byte_avx2(chars_high_vec.ymm, prime_power_high_vec.ymm, prime_power_high_top_vec.ymm));
+
+            // 2. Multiply by the bases and add the incoming characters.
+            chars_low_vec.ymm = _sz_hashes_load_lanes_avx2(text, windows_per_lane, i + window_length - 1);
+            chars_high_vec.ymm = _mm256_and_si256(_mm256_add_epi64(chars_low_vec.ymm, shift_high_vec.ymm), //
+                                                  byte_mask_vec.ymm);
+            hash_low_vec.ymm = _mm256_sub_epi64(_mm256_slli_epi64(hash_low_vec.ymm, 5), hash_low_vec.ymm);
+            hash_high_vec.ymm = _mm256_add_epi64(_mm256_slli_epi64(hash_high_vec.ymm, 8), hash_high_vec.ymm);
+            hash_low_vec.ymm = _sz_hashes_prime_mod_avx2(_mm256_add_epi64(hash_low_vec.ymm, chars_low_vec.ymm));
+            hash_high_vec.ymm = _sz_hashes_prime_mod_avx2(_mm256_add_epi64(hash_high_vec.ymm, chars_high_vec.ymm));
+        }
+
+        // 3. Mix the hashes into separate registers, keeping the rolling state intact.
+        if ((i & step_mask) == 0) {
+            hash_mix_vec.ymm = _mm256_xor_si256(_mm256_mul_epu64(hash_low_vec.ymm, golden_ratio_vec.ymm),
+                                                _mm256_mul_epu64(hash_high_vec.ymm, golden_ratio_vec.ymm));
+            for (sz_size_t lane = 0; lane != 4; ++lane)
+                callback((sz_cptr_t)(text + lane * windows_per_lane + i), window_length, hash_mix_vec.u64s[lane],
+                         callback_handle);
+        }
+    }
+
+    // Continue the last lane until the end of the string.
+    rolling.text = text + windows_per_lane * 4 - 1 + window_length;
+    rolling.hash_low = hash_low_vec.u64s[3], rolling.hash_high = hash_high_vec.u64s[3];
+    rolling.has_pending = sz_false_k;
+    _sz_hashes_rolling_resume(&rolling, windows_per_lane * 4 - 1, step, callback, callback_handle);
+}
+
+SZ_PUBLIC void sz_hashes_minhash_avx2(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t count,
+                                      sz_u32_t *signatures) {
+
+    for (sz_size_t i = 0; i != count; ++i) signatures[i] = 0xFFFFFFFFu;
+    if (length < window_length || !window_length) return;
+
+    _sz_hashes_rolling_t rolling;
+    _sz_hashes_rolling_init(&rolling, start, length, window_length);
+    sz_u64_t hashes[_SZ_HASHES_MINHASH_BATCH];
+    sz_u32_t multipliers_low[8], multipliers_high[8];
+    sz_u64_t addends[8];
+    sz_size_t hashes_count;
+
+    // AVX2 has no 64-bit multiplication, but `_mm256_mul_epu32` multiplies the low 32-bit halves of 64-bit lanes,
+    // which is exactly what we need, given 32-bit multipliers and 32-bit halves of the rolling hash.
+    // The top halves of the products fit in 32 bits, so the `_mm256_min_epu32` is enough to track the minimums.
+    sz_u256_vec_t multipliers_low_vecs[2], multipliers_high_vecs[2], addends_vecs[2], minimums_vecs[2];
+    sz_u256_vec_t hash_low_vec, hash_high_vec, permuted_vec;
+    __m256i const evens_vec = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    while ((hashes_count = _sz_hashes_rolling_fill(&rolling, hashes, _SZ_HASHES_MINHASH_BATCH))) {
+        sz_size_t const count_vectorized = count - count % 8;
+        for (sz_size_t first = 0; first != count_vectorized; first += 8) {
+            for (sz_size_t i = 0; i != 8; ++i)
+                _sz_hashes_minhash_seeds(first + i, &multipliers_low[i], &multipliers_high[i], &addends[i]);
+            for (sz_size_t half = 0; half != 2; ++half) {
+                multipliers_low_vecs[half].ymm =
+                    _mm256_cvtepu32_epi64(_mm_loadu_si128((__m128i *)&multipliers_low[half * 4]));
+                multipliers_high_vecs[half].ymm =
+                    _mm256_cvtepu32_epi64(_mm_loadu_si128((__m128i *)&multipliers_high[half * 4]));
+                addends_vecs[half].ymm = _mm256_loadu_si256((__m256i *)&addends[half * 4]);
+                minimums_vecs[half].ymm =
+                    _mm256_cvtepu32_epi64(_mm_loadu_si128((__m128i *)&signatures[first + half * 4]));
+            }
+            for (sz_size_t j = 0; j != hashes_count; ++j) {
+                hash_low_vec.ymm = _mm256_set1_epi64x((long long)hashes[j]);
+                hash_high_vec.ymm = _mm256_srli_epi64(hash_low_vec.ymm, 32);
+                for (sz_size_t half = 0; half != 2; ++half) {
+                    permuted_vec.ymm = _mm256_add_epi64(
+                        _mm256_add_epi64(_mm256_mul_epu32(multipliers_low_vecs[half].ymm, hash_low_vec.ymm),
+                                         _mm256_mul_epu32(multipliers_high_vecs[half].ymm, hash_high_vec.ymm)),
+                        addends_vecs[half].ymm);
+                    permuted_vec.ymm = _mm256_srli_epi64(permuted_vec.ymm, 32);
+                    minimums_vecs[half].ymm = _mm256_min_epu32(minimums_vecs[half].ymm, permuted_vec.ymm);
+                }
+            }
+            // Gather the low halves of the 64-bit lanes back into 32-bit signatures.
+            for (sz_size_t half = 0; half != 2; ++half)
+                _mm_storeu_si128((__m128i *)&signatures[first + half * 4],
+                                 _mm256_castsi256_si128(
+                                     _mm256_permutevar8x32_epi32(minimums_vecs[half].ymm, evens_vec)));
+        }
+        _sz_hashes_minhash_reduce_serial(hashes, hashes_count, count_vectorized, count, signatures);
+    }
+}
+
+/**
+ *  @brief  Classifies every byte of a 32-byte block, given the preceding block, with the nibble look-up tables
+ *          from ::_sz_utf8_lookup_tables. Any non-zero byte of the result signals an encoding error.
+ */
+SZ_INTERNAL __m256i _sz_utf8_errors_avx2(__m256i input_vec, __m256i previous_vec) {
+    __m256i const first_high_lut_vec =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i const *)_sz_utf8_lookup_tables[0]));
+    __m256i const first_low_lut_vec =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i const *)_sz_utf8_lookup_tables[1]));
+    __m256i const second_high_lut_vec =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i const *)_sz_utf8_lookup_tables[2]));
+    __m256i const nibble_mask_vec = _mm256_set1_epi8(0x0F);
+
+    // Shift the input by 1, 2, and 3 bytes, pulling in the tail of the previous block.
+    __m256i const carried_vec = _mm256_permute2x128_si256(previous_vec, input_vec, 0x21);
+    __m256i const previous_1_vec = _mm256_alignr_epi8(input_vec, carried_vec, 15);
+    __m256i const previous_2_vec = _mm256_alignr_epi8(input_vec, carried_vec, 14);
+    __m256i const previous_3_vec = _mm256_alignr_epi8(input_vec, carried_vec, 13);
+
+    __m256i const first_high_vec = _mm256_shuffle_epi8(
+        first_high_lut_vec, _mm256_and_si256(_mm256_srli_epi16(previous_1_vec, 4), nibble_mask_vec));
+    __m256i const first_low_vec =
+        _mm256_shuffle_epi8(first_low_lut_vec, _mm256_and_si256(previous_1_vec, nibble_mask_vec));
+    __m256i const second_high_vec =
+        _mm256_shuffle_epi8(second_high_lut_vec, _mm256_and_si256(_mm256_srli_epi16(input_vec, 4), nibble_mask_vec));
+    __m256i const errors_vec = _mm256_and_si256(_mm256_and_si256(first_high_vec, first_low_vec), second_high_vec);
+
+    // The third and fourth bytes of 3- and 4-byte runes are the only places, where two continuations can follow.
+    __m256i const third_vec = _mm256_subs_epu8(previous_2_vec, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+    __m256i const fourth_vec = _mm256_subs_epu8(previous_3_vec, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+    __m256i const expected_vec = _mm256_and_si256(_mm256_or_si256(third_vec, fourth_vec), _mm256_set1_epi8((char)0x80));
+    return _mm256_xor_si256(errors_vec, expected_vec);
+}
+
+SZ_PUBLIC sz_bool_t sz_utf8_validate_avx2(sz_cptr_t text, sz_size_t length) {
+    sz_u256_vec_t input_vec, previous_vec, errors_vec;
+    previous_vec.ymm = errors_vec.ymm = _mm256_setzero_si256();
+
+    // The largest values of the last three bytes of a block, that don't expect continuations in the next one.
+    __m256i const complete_max_vec =
+        _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, //
+                         -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)0xEF, (char)0xDF, (char)0xBF);
+
+    for (; length >= 32; text += 32, length -= 32) {
+        input_vec.ymm = _mm256_loadu_si256((__m256i const *)text);
+        // ASCII blocks are only worth checking, if the previous block ended with an incomplete rune.
+        __m256i const incomplete_vec = _mm256_subs_epu8(previous_vec.ymm, complete_max_vec);
+        if (_mm256_movemask_epi8(input_vec.ymm) != 0 || !_mm256_testz_si256(incomplete_vec, incomplete_vec))
+            errors_vec.ymm = _mm256_or_si256(errors_vec.ymm, _sz_utf8_errors_avx2(input_vec.ymm, previous_vec.ymm));
+        previous_vec.ymm = input_vec.ymm;
+    }
+
+    // The tail is padded with zeros, which also catches the runes cut short by the end of the string.
+    input_vec.ymm = _mm256_setzero_si256();
+    for (sz_size_t i = 0; i != length; ++i) input_vec.u8s[i] = text[i];
+    errors_vec.ymm = _mm256_or_si256(errors_vec.ymm, _sz_utf8_errors_avx2(input_vec.ymm, previous_vec.ymm));
+    return (sz_bool_t)_mm256_testz_si256(errors_vec.ymm, errors_vec.ymm);
+}
+
+SZ_PUBLIC sz_size_t sz_utf8_count_avx2(sz_cptr_t text, sz_size_t length) {
+    // As signed integers, the continuation bytes are in [-128, -65], below all other bytes.
+    __m256i const continuation_max_vec = _mm256_set1_epi8((char)0xBF);
+    sz_u256_vec_t text_vec, counters_vec, sums_vec;
+    sums_vec.ymm = _mm256_setzero_si256();
+
+    // Accumulate the 8-bit counters for up to 255 blocks, before widening them into 64-bit sums.
+    while (length >= 32) {
+        sz_size_t const blocks = sz_min_of_two(length / 32, 255);
+        counters_vec.ymm = _mm256_setzero_si256();
+        for (sz_size_t i = 0; i != blocks; ++i, text += 32) {
+            text_vec.ymm = _mm256_loadu_si256((__m256i const *)text);
+            counters_vec.ymm =
+                _mm256_sub_epi8(counters_vec.ymm, _mm256_cmpgt_epi8(text_vec.ymm, continuation_max_vec));
         }
-        else { text += 32, length -= 32; }
+        sums_vec.ymm = _mm256_add_epi64(sums_vec.ymm, _mm256_sad_epu8(counters_vec.ymm, _mm256_setzero_si256()));
+        length -= blocks * 32;
     }
 
-    return sz_find_charset_serial(text, length, filter);
+    sz_size_t const count = sums_vec.u64s[0] + sums_vec.u64s[1] + sums_vec.u64s[2] + sums_vec.u64s[3];
+    return count + sz_utf8_count_serial(text, length);
 }
 
-SZ_PUBLIC sz_cptr_t sz_rfind_charset_avx2(sz_cptr_t text, sz_size_t length, sz_charset_t const *filter) {
-    return sz_rfind_charset_serial(text, length, filter);
+SZ_PUBLIC sz_size_t sz_utf8_to_utf32_avx2(sz_cptr_t text, sz_size_t length, sz_rune_t *runes) {
+    sz_u8_t const *current = (sz_u8_t const *)text;
+    sz_u8_t const *const end = current + length;
+    sz_rune_t *const runes_start = runes;
+    sz_u256_vec_t text_vec;
+
+    for (; current + 32 <= end; current += 32) {
+        text_vec.ymm = _mm256_loadu_si256((__m256i const *)current);
+        // Pure ASCII blocks are widened 8 bytes at a time, others are decoded serially.
+        if (_mm256_movemask_epi8(text_vec.ymm) == 0) {
+            _mm256_storeu_si256((__m256i *)(runes + 0), _mm256_cvtepu8_epi32(text_vec.xmms[0]));
+            _mm256_storeu_si256((__m256i *)(runes + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(text_vec.xmms[0], 8)));
+            _mm256_storeu_si256((__m256i *)(runes + 16), _mm256_cvtepu8_epi32(text_vec.xmms[1]));
+            _mm256_storeu_si256((__m256i *)(runes + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(text_vec.xmms[1], 8)));
+            runes += 32;
+        }
+        else {
+            for (sz_size_t i = 0; i != 32; ++i)
+                if (!_sz_utf8_is_continuation(current[i])) *runes++ = _sz_utf8_decode_lead(current + i, end);
+        }
+    }
+
+    runes += sz_utf8_to_utf32_serial((sz_cptr_t)current, (sz_size_t)(end - current), runes);
+    return (sz_size_t)(runes - runes_start);
+}
+
+SZ_PUBLIC sz_cptr_t sz_utf8_find_nth_avx2(sz_cptr_t text, sz_size_t length, sz_size_t n) {
+    __m256i const continuation_max_vec = _mm256_set1_epi8((char)0xBF);
+    sz_u256_vec_t text_vec;
+
+    for (; length >= 32; text += 32, length -= 32) {
+        text_vec.ymm = _mm256_loadu_si256((__m256i const *)text);
+        sz_u32_t leads = (sz_u32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi8(text_vec.ymm, continuation_max_vec));
+        sz_size_t const leads_count = (sz_size_t)sz_u64_popcount(leads);
+        if (n < leads_count) {
+            for (; n; --n) leads &= leads - 1; // Drop the lowest set bits, preceding the one we need
+            return text + sz_u64_ctz(leads);
+        }
+        n -= leads_count;
+    }
+    return sz_utf8_find_nth_serial(text, length, n);
 }
 
 /**
- *  @brief  There is no AVX2 instruction for fast multiplication of 64-bit integers.
- *          This implementation is coming from Agner Fog's Vector Class Library.
+ *  @brief  Gathers 8 substitution costs by their offsets in the 256 x 256 matrix, sign-extended to 32-bit integers.
+ *          Every gathered 32-bit word contains the wanted cost in its lowest byte. The last 3 cells of the matrix
+ *          are taken from the last full word and shifted down, to avoid reading past the end of the matrix.
  */
-SZ_INTERNAL __m256i _mm256_mul_epu64(__m256i a, __m256i b) {
-    __m256i bswap = _mm256_shuffle_epi32(b, 0xB1);
-    __m256i prodlh = _mm256_mullo_epi32(a, bswap);
-    __m256i zero = _mm256_setzero_si256();
-    __m256i prodlh2 = _mm256_hadd_epi32(prodlh, zero);
-    __m256i prodlh3 = _mm256_shuffle_epi32(prodlh2, 0x73);
-    __m256i prodll = _mm256_mul_epu32(a, b);
-    __m256i prod = _mm256_add_epi64(prodll, prodlh3);
-    return prod;
+SZ_INTERNAL __m256i _sz_alignment_gather_costs_avx2(sz_error_cost_t const *subs, __m256i offsets) {
+    __m256i const last_word_vec = _mm256_set1_epi32(256 * 256 - 4);
+    __m256i const clamped_vec = _mm256_min_epu32(offsets, last_word_vec);
+    __m256i const shifts_vec = _mm256_slli_epi32(_mm256_sub_epi32(offsets, clamped_vec), 3);
+    __m256i words_vec = _mm256_i32gather_epi32((int const *)subs, clamped_vec, 1);
+    words_vec = _mm256_srlv_epi32(words_vec, shifts_vec);
+    return _mm256_srai_epi32(_mm256_slli_epi32(words_vec, 24), 24);
 }
 
-SZ_PUBLIC void sz_hashes_avx2(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t step, //
-                              sz_hash_callback_t callback, void *callback_handle) {
+/**
+ *  @brief  Computes the Needleman–Wunsch or Smith–Waterman score along the anti-diagonals of the matrix,
+ *          16 cells at a time, in saturating 16-bit arithmetic. Only exact if `_sz_alignment_score_fits_i16`.
+ *  @see    _sz_alignment_diagonals_init
+ */
+SZ_INTERNAL sz_ssize_t _sz_alignment_score_diagonals_i16_avx2( //
+    sz_cptr_t longer, sz_size_t longer_length,                 //
+    sz_cptr_t shorter, sz_size_t shorter_length,               //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local, sz_ptr_t buffer) {
+
+    sz_u8_t const *longer_reversed, *shorter_copy;
+    sz_size_t const diagonal_length = _sz_alignment_diagonals_init( //
+        longer, longer_length, shorter, shorter_length, sizeof(sz_i16_t), buffer, &longer_reversed, &shorter_copy);
+    sz_i16_t *previous_scores = (sz_i16_t *)buffer;
+    sz_i16_t *current_scores = previous_scores + diagonal_length;
+    sz_i16_t *next_scores = current_scores + diagonal_length;
+
+    __m256i const gap_vec = _mm256_set1_epi16(gap);
+    __m256i const zeros_vec = _mm256_setzero_si256();
+    __m256i const lanes_vec = _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    sz_u256_vec_t best_vec, offsets_vec, costs_vec, cells_vec;
+    best_vec.ymm = zeros_vec;
+
+    // The top-left corner of the matrix is the only cell on the zeroth anti-diagonal.
+    current_scores[0] = 0;
+    sz_size_t const diagonals_count = longer_length + shorter_length + 1;
+    for (sz_size_t diagonal = 1; diagonal != diagonals_count; ++diagonal) {
+        sz_size_t const first = diagonal > longer_length ? diagonal - longer_length : 1;
+        sz_size_t const last = sz_min_of_two(shorter_length, diagonal - 1);
+        for (sz_size_t j = first; j <= last; j += 16) {
+            // Combine pairs of characters into 16-bit offsets in the substitution matrix.
+            offsets_vec.ymm = _mm256_or_si256(
+                _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128(
+                                      (__m128i const *)(longer_reversed + longer_length - diagonal + j))),
+                                  8),
+                _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i const *)(shorter_copy + j - 1))));
+            // Gather them in two halves, pack back into 16-bit integers, and undo the in-lane interleaving.
+            costs_vec.ymm = _mm256_permute4x64_epi64(
+                _mm256_packs_epi32(
+                    _sz_alignment_gather_costs_avx2(subs, _mm256_cvtepu16_epi32(offsets_vec.xmms[0])),
+                    _sz_alignment_gather_costs_avx2(subs, _mm256_cvtepu16_epi32(offsets_vec.xmms[1]))),
+                0xD8);
+
+            __m256i diagonal_vec = _mm256_loadu_si256((__m256i const *)(previous_scores + j - 1));
+            __m256i top_vec = _mm256_loadu_si256((__m256i const *)(current_scores + j));
+            __m256i left_vec = _mm256_loadu_si256((__m256i const *)(current_scores + j - 1));
+            cells_vec.ymm = _mm256_max_epi16(_mm256_adds_epi16(diagonal_vec, costs_vec.ymm),
+                                             _mm256_adds_epi16(_mm256_max_epi16(top_vec, left_vec), gap_vec));
+            if (local) {
+                cells_vec.ymm = _mm256_max_epi16(cells_vec.ymm, zeros_vec);
+                // Lanes past the end of the anti-diagonal contain garbage, that can't affect the best score.
+                __m256i tail_vec =
+                    _mm256_cmpgt_epi16(lanes_vec, _mm256_set1_epi16((short)sz_min_of_two(last - j, 16)));
+                best_vec.ymm = _mm256_max_epi16(best_vec.ymm, _mm256_andnot_si256(tail_vec, cells_vec.ymm));
+            }
+            _mm256_storeu_si256((__m256i *)(next_scores + j), cells_vec.ymm);
+        }
 
-    if (length < window_length || !window_length) return;
-    if (length < 4 * window_length) {
-        sz_hashes_serial(start, length, window_length, step, callback, callback_handle);
-        return;
+        // Populate the first row and the first column of the matrix, once the garbage lanes are written.
+        sz_i16_t const edge_score = local ? 0 : (sz_i16_t)((sz_ssize_t)diagonal * gap);
+        if (diagonal <= longer_length) next_scores[0] = edge_score;
+        if (diagonal <= shorter_length) next_scores[diagonal] = edge_score;
+
+        // Perform a circular rotation of those buffers, to reuse the memory.
+        sz_i16_t *temporary = previous_scores;
+        previous_scores = current_scores;
+        current_scores = next_scores;
+        next_scores = temporary;
     }
 
-    // Using AVX2, we can perform 4 long integer multiplications and additions within one register.
-    // So let's slice the entire string into 4 overlapping windows, to slide over them in parallel.
-    sz_size_t const max_hashes = length - window_length + 1;
-    sz_size_t const min_hashes_per_thread = max_hashes / 4; // At most one sequence can overlap between 2 threads.
-    sz_u8_t const *text_first = (sz_u8_t const *)start;
-    sz_u8_t const *text_second = text_first + min_hashes_per_thread;
-    sz_u8_t const *text_third = text_first + min_hashes_per_thread * 2;
-    sz_u8_t const *text_fourth = text_first + min_hashes_per_thread * 3;
-    sz_u8_t const *text_end = text_first + length;
+    if (!local) return current_scores[shorter_length];
+    sz_i16_t best_score = 0;
+    for (int i = 0; i != 16; ++i) best_score = sz_max_of_two(best_score, (sz_i16_t)best_vec.u16s[i]);
+    return best_score;
+}
 
-    // Prepare the `prime ^ window_length` values, that we are going to use for modulo arithmetic.
-    sz_u64_t prime_power_low = 1, prime_power_high = 1;
-    for (sz_size_t i = 0; i + 1 < window_length; ++i)
-        prime_power_low = (prime_power_low * 31ull) % SZ_U64_MAX_PRIME,
-        prime_power_high = (prime_power_high * 257ull) % SZ_U64_MAX_PRIME;
+/**
+ *  @brief  Computes the Needleman–Wunsch or Smith–Waterman score along the anti-diagonals of the matrix,
+ *          8 cells at a time, in 32-bit arithmetic. Exact for strings with less than 2^24 bytes in total.
+ *  @see    _sz_alignment_diagonals_init
+ */
+SZ_INTERNAL sz_ssize_t _sz_alignment_score_diagonals_i32_avx2( //
+    sz_cptr_t longer, sz_size_t longer_length,                 //
+    sz_cptr_t shorter, sz_size_t shorter_length,               //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local, sz_ptr_t buffer) {
+
+    sz_u8_t const *longer_reversed, *shorter_copy;
+    sz_size_t const diagonal_length = _sz_alignment_diagonals_init( //
+        longer, longer_length, shorter, shorter_length, sizeof(sz_i32_t), buffer, &longer_reversed, &shorter_copy);
+    sz_i32_t *previous_scores = (sz_i32_t *)buffer;
+    sz_i32_t *current_scores = previous_scores + diagonal_length;
+    sz_i32_t *next_scores = current_scores + diagonal_length;
+
+    __m256i const gap_vec = _mm256_set1_epi32(gap);
+    __m256i const zeros_vec = _mm256_setzero_si256();
+    __m256i const lanes_vec = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    sz_u256_vec_t best_vec, offsets_vec, costs_vec, cells_vec;
+    best_vec.ymm = zeros_vec;
+
+    // The top-left corner of the matrix is the only cell on the zeroth anti-diagonal.
+    current_scores[0] = 0;
+    sz_size_t const diagonals_count = longer_length + shorter_length + 1;
+    for (sz_size_t diagonal = 1; diagonal != diagonals_count; ++diagonal) {
+        sz_size_t const first = diagonal > longer_length ? diagonal - longer_length : 1;
+        sz_size_t const last = sz_min_of_two(shorter_length, diagonal - 1);
+        for (sz_size_t j = first; j <= last; j += 8) {
+            offsets_vec.ymm = _mm256_or_si256(
+                _mm256_slli_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64(
+                                      (__m128i const *)(longer_reversed + longer_length - diagonal + j))),
+                                  8),
+                _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const *)(shorter_copy + j - 1))));
+            costs_vec.ymm = _sz_alignment_gather_costs_avx2(subs, offsets_vec.ymm);
+
+            __m256i diagonal_vec = _mm256_loadu_si256((__m256i const *)(previous_scores + j - 1));
+            __m256i top_vec = _mm256_loadu_si256((__m256i const *)(current_scores + j));
+            __m256i left_vec = _mm256_loadu_si256((__m256i const *)(current_scores + j - 1));
+            cells_vec.ymm = _mm256_max_epi32(_mm256_add_epi32(diagonal_vec, costs_vec.ymm),
+                                             _mm256_add_epi32(_mm256_max_epi32(top_vec, left_vec), gap_vec));
+            if (local) {
+                cells_vec.ymm = _mm256_max_epi32(cells_vec.ymm, zeros_vec);
+                // Lanes past the end of the anti-diagonal contain garbage, that can't affect the best score.
+                __m256i tail_vec = _mm256_cmpgt_epi32(lanes_vec, _mm256_set1_epi32((int)sz_min_of_two(last - j, 8)));
+                best_vec.ymm = _mm256_max_epi32(best_vec.ymm, _mm256_andnot_si256(tail_vec, cells_vec.ymm));
+            }
+            _mm256_storeu_si256((__m256i *)(next_scores + j), cells_vec.ymm);
+        }
 
-    // Broadcast the constants into the registers.
-    sz_u256_vec_t prime_vec, golden_ratio_vec;
-    sz_u256_vec_t base_low_vec, base_high_vec, prime_power_low_vec, prime_power_high_vec, shift_high_vec;
-    base_low_vec.ymm = _mm256_set1_epi64x(31ull);
-    base_high_vec.ymm = _mm256_set1_epi64x(257ull);
-    shift_high_vec.ymm = _mm256_set1_epi64x(77ull);
-    prime_vec.ymm = _mm256_set1_epi64x(SZ_U64_MAX_PRIME);
-    golden_ratio_vec.ymm = _mm256_set1_epi64x(11400714819323198485ull);
-    prime_power_low_vec.ymm = _mm256_set1_epi64x(prime_power_low);
-    prime_power_high_vec.ymm = _mm256_set1_epi64x(prime_power_high);
+        // Populate the first row and the first column of the matrix, once the garbage lanes are written.
+        sz_i32_t const edge_score = local ? 0 : (sz_i32_t)((sz_ssize_t)diagonal * gap);
+        if (diagonal <= longer_length) next_scores[0] = edge_score;
+        if (diagonal <= shorter_length) next_scores[diagonal] = edge_score;
 
-    // Compute the initial hash values for every one of the four windows.
-    sz_u256_vec_t hash_low_vec, hash_high_vec, hash_mix_vec, chars_low_vec, chars_high_vec;
-    hash_low_vec.ymm = _mm256_setzero_si256();
-    hash_high_vec.ymm = _mm256_setzero_si256();
-    for (sz_u8_t const *prefix_end = text_first + window_length; text_first < prefix_end;
-         ++text_first, ++text_second, ++text_third, ++text_fourth) {
-
-        // 1. Multiply the hashes by the base.
-        hash_low_vec.ymm = _mm256_mul_epu64(hash_low_vec.ymm, base_low_vec.ymm);
-        hash_high_vec.ymm = _mm256_mul_epu64(hash_high_vec.ymm, base_high_vec.ymm);
-
-        // 2. Load the four characters from `text_first`, `text_first + max_hashes_per_thread`,
-        //   `text_first + max_hashes_per_thread * 2`, `text_first + max_hashes_per_thread * 3`.
-        chars_low_vec.ymm = _mm256_set_epi64x(text_fourth[0], text_third[0], text_second[0], text_first[0]);
-        chars_high_vec.ymm = _mm256_add_epi8(chars_low_vec.ymm, shift_high_vec.ymm);
-
-        // 3. Add the incoming characters.
-        hash_low_vec.ymm = _mm256_add_epi64(hash_low_vec.ymm, chars_low_vec.ymm);
-        hash_high_vec.ymm = _mm256_add_epi64(hash_high_vec.ymm, chars_high_vec.ymm);
-
-        // 4. Compute the modulo. Assuming there are only 59 values between our prime
-        //    and the 2^64 value, we can simply compute the modulo by conditionally subtracting the prime.
-        hash_low_vec.ymm = _mm256_blendv_epi8(hash_low_vec.ymm, _mm256_sub_epi64(hash_low_vec.ymm, prime_vec.ymm),
-                                              _mm256_cmpgt_epi64(hash_low_vec.ymm, prime_vec.ymm));
-        hash_high_vec.ymm = _mm256_blendv_epi8(hash_high_vec.ymm, _mm256_sub_epi64(hash_high_vec.ymm, prime_vec.ymm),
-                                               _mm256_cmpgt_epi64(hash_high_vec.ymm, prime_vec.ymm));
-    }
-
-    // 5. Compute the hash mix, that will be used to index into the fingerprint.
-    //    This includes a serial step at the end.
-    hash_low_vec.ymm = _mm256_mul_epu64(hash_low_vec.ymm, golden_ratio_vec.ymm);
-    hash_high_vec.ymm = _mm256_mul_epu64(hash_high_vec.ymm, golden_ratio_vec.ymm);
-    hash_mix_vec.ymm = _mm256_xor_si256(hash_low_vec.ymm, hash_high_vec.ymm);
-    callback((sz_cptr_t)text_first, window_length, hash_mix_vec.u64s[0], callback_handle);
-    callback((sz_cptr_t)text_second, window_length, hash_mix_vec.u64s[1], callback_handle);
-    callback((sz_cptr_t)text_third, window_length, hash_mix_vec.u64s[2], callback_handle);
-    callback((sz_cptr_t)text_fourth, window_length, hash_mix_vec.u64s[3], callback_handle);
+        // Perform a circular rotation of those buffers, to reuse the memory.
+        sz_i32_t *temporary = previous_scores;
+        previous_scores = current_scores;
+        current_scores = next_scores;
+        next_scores = temporary;
+    }
 
-    // Now repeat that operation for the remaining characters, discarding older characters.
-    sz_size_t cycle = 1;
-    sz_size_t const step_mask = step - 1;
-    for (; text_fourth != text_end; ++text_first, ++text_second, ++text_third, ++text_fourth, ++cycle) {
-        // 0. Load again the four characters we are dropping, shift them, and subtract.
-        chars_low_vec.ymm = _mm256_set_epi64x(text_fourth[-window_length], text_third[-window_length],
-                                              text_second[-window_length], text_first[-window_length]);
-        chars_high_vec.ymm = _mm256_add_epi8(chars_low_vec.ymm, shift_high_vec.ymm);
-        hash_low_vec.ymm =
-            _mm256_sub_epi64(hash_low_vec.ymm, _mm256_mul_epu64(chars_low_vec.ymm, prime_power_low_vec.ymm));
-        hash_high_vec.ymm =
-            _mm256_sub_epi64(hash_high_vec.ymm, _mm256_mul_epu64(chars_high_vec.ymm, prime_power_high_vec.ymm));
-
-        // 1. Multiply the hashes by the base.
-        hash_low_vec.ymm = _mm256_mul_epu64(hash_low_vec.ymm, base_low_vec.ymm);
-        hash_high_vec.ymm = _mm256_mul_epu64(hash_high_vec.ymm, base_high_vec.ymm);
-
-        // 2. Load the four characters from `text_first`, `text_first + max_hashes_per_thread`,
-        //   `text_first + max_hashes_per_thread * 2`, `text_first + max_hashes_per_thread * 3`.
-        chars_low_vec.ymm = _mm256_set_epi64x(text_fourth[0], text_third[0], text_second[0], text_first[0]);
-        chars_high_vec.ymm = _mm256_add_epi8(chars_low_vec.ymm, shift_high_vec.ymm);
-
-        // 3. Add the incoming characters.
-        hash_low_vec.ymm = _mm256_add_epi64(hash_low_vec.ymm, chars_low_vec.ymm);
-        hash_high_vec.ymm = _mm256_add_epi64(hash_high_vec.ymm, chars_high_vec.ymm);
-
-        // 4. Compute the modulo. Assuming there are only 59 values between our prime
-        //    and the 2^64 value, we can simply compute the modulo by conditionally subtracting the prime.
-        hash_low_vec.ymm = _mm256_blendv_epi8(hash_low_vec.ymm, _mm256_sub_epi64(hash_low_vec.ymm, prime_vec.ymm),
-                                              _mm256_cmpgt_epi64(hash_low_vec.ymm, prime_vec.ymm));
-        hash_high_vec.ymm = _mm256_blendv_epi8(hash_high_vec.ymm, _mm256_sub_epi64(hash_high_vec.ymm, prime_vec.ymm),
-                                               _mm256_cmpgt_epi64(hash_high_vec.ymm, prime_vec.ymm));
-
-        // 5. Compute the hash mix, that will be used to index into the fingerprint.
-        //    This includes a serial step at the end.
-        hash_low_vec.ymm = _mm256_mul_epu64(hash_low_vec.ymm, golden_ratio_vec.ymm);
-        hash_high_vec.ymm = _mm256_mul_epu64(hash_high_vec.ymm, golden_ratio_vec.ymm);
-        hash_mix_vec.ymm = _mm256_xor_si256(hash_low_vec.ymm, hash_high_vec.ymm);
-        if ((cycle & step_mask) == 0) {
-            callback((sz_cptr_t)text_first, window_length, hash_mix_vec.u64s[0], callback_handle);
-            callback((sz_cptr_t)text_second, window_length, hash_mix_vec.u64s[1], callback_handle);
-            callback((sz_cptr_t)text_third, window_length, hash_mix_vec.u64s[2], callback_handle);
-            callback((sz_cptr_t)text_fourth, window_length, hash_mix_vec.u64s[3], callback_handle);
-        }
+    if (!local) return current_scores[shorter_length];
+    sz_i32_t best_score = 0;
+    for (int i = 0; i != 8; ++i) best_score = sz_max_of_two(best_score, (sz_i32_t)best_vec.u32s[i]);
+    return best_score;
+}
+
+/**
+ *  @brief  Picks the narrowest exact anti-diagonal kernel for the pair of strings, reusing the `buffer`
+ *          of `_sz_alignment_diagonals_buffer_length` bytes, or falls back to the serial one for huge inputs.
+ */
+SZ_INTERNAL sz_ssize_t _sz_alignment_score_reusing_avx2( //
+    sz_cptr_t longer, sz_size_t longer_length,           //
+    sz_cptr_t shorter, sz_size_t shorter_length,         //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local, sz_ptr_t buffer) {
+
+    // If one of the strings is empty - the edit distance is equal to the length of the other one
+    if (longer_length == 0) return local ? 0 : (sz_ssize_t)shorter_length * gap;
+    if (shorter_length == 0) return local ? 0 : (sz_ssize_t)longer_length * gap;
+
+    // Keep the same roles of the arguments, as in the serial variant.
+    if (shorter_length > longer_length) {
+        sz_pointer_swap((void **)&longer_length, (void **)&shorter_length);
+        sz_pointer_swap((void **)&longer, (void **)&shorter);
+    }
+
+    if (_sz_alignment_score_fits_i16(longer, longer_length, shorter_length, subs, gap, local))
+        return _sz_alignment_score_diagonals_i16_avx2(longer, longer_length, shorter, shorter_length, subs, gap,
+                                                      local, buffer);
+    else
+        return _sz_alignment_score_diagonals_i32_avx2(longer, longer_length, shorter, shorter_length, subs, gap,
+                                                      local, buffer);
+}
+
+SZ_INTERNAL sz_ssize_t _sz_alignment_score_avx2(     //
+    sz_cptr_t a, sz_size_t a_length,                 //
+    sz_cptr_t b, sz_size_t b_length,                 //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, //
+    sz_bool_t local, sz_memory_allocator_t *alloc) {
+
+    // Tiny inputs aren't worth the setup, and huge ones may overflow the 32-bit lanes.
+    sz_size_t const shorter_length = sz_min_of_two(a_length, b_length);
+    sz_size_t const longer_length = sz_max_of_two(a_length, b_length);
+    if (shorter_length < 4 || longer_length + shorter_length >= 256ull * 256ull * 256ull)
+        return _sz_alignment_score_serial(a, a_length, b, b_length, subs, gap, local, alloc);
+
+    // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
+    }
+
+    sz_size_t const buffer_length = _sz_alignment_diagonals_buffer_length(longer_length, shorter_length);
+    sz_ptr_t const buffer = (sz_ptr_t)alloc->allocate(buffer_length, alloc->handle);
+    if (!buffer) return SZ_SSIZE_MAX;
+
+    // Cache scalar before `free` call.
+    sz_ssize_t result = _sz_alignment_score_reusing_avx2(a, a_length, b, b_length, subs, gap, local, buffer);
+    alloc->free(buffer, buffer_length, alloc->handle);
+    return result;
+}
+
+SZ_PUBLIC sz_ssize_t sz_alignment_score_avx2(         //
+    sz_cptr_t a, sz_size_t a_length,                  //
+    sz_cptr_t b, sz_size_t b_length,                  //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, //
+    sz_memory_allocator_t *alloc) {
+    return _sz_alignment_score_avx2(a, a_length, b, b_length, subs, gap, sz_false_k, alloc);
+}
+
+SZ_PUBLIC sz_ssize_t sz_local_alignment_score_avx2(   //
+    sz_cptr_t a, sz_size_t a_length,                  //
+    sz_cptr_t b, sz_size_t b_length,                  //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, //
+    sz_memory_allocator_t *alloc) {
+    return _sz_alignment_score_avx2(a, a_length, b, b_length, subs, gap, sz_true_k, alloc);
+}
+
+SZ_PUBLIC sz_bool_t sz_alignment_scores_avx2(                                 //
+    sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates, //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local,        //
+    sz_memory_allocator_t *alloc, sz_ssize_t *scores) {
+
+    // Size the buffer for the longest candidate, so that it's allocated only once.
+    sz_size_t longest_candidate = 0;
+    for (sz_size_t i = 0; i != candidates->count; ++i)
+        longest_candidate = sz_max_of_two(longest_candidate, candidates->get_length(candidates, i));
+    if (query_length + longest_candidate >= 256ull * 256ull * 256ull)
+        return sz_alignment_scores_serial(query, query_length, candidates, subs, gap, local, alloc, scores);
+
+    // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
     }
+
+    sz_size_t const buffer_length = _sz_alignment_diagonals_buffer_length(
+        sz_max_of_two(query_length, longest_candidate), sz_min_of_two(query_length, longest_candidate));
+    sz_ptr_t const buffer = (sz_ptr_t)alloc->allocate(buffer_length, alloc->handle);
+    if (!buffer) return sz_false_k;
+    for (sz_size_t i = 0; i != candidates->count; ++i)
+        scores[i] = _sz_alignment_score_reusing_avx2(query, query_length, candidates->get_start(candidates, i),
+                                                     candidates->get_length(candidates, i), subs, gap, local,
+                                                     buffer);
+    alloc->free(buffer, buffer_length, alloc->handle);
+    return sz_true_k;
 }
 
 #pragma clang attribute pop
@@ -4663,8 +8508,8 @@ SZ_PUBLIC sz_ordering_t sz_order_avx512(sz_cptr_t a, sz_size_t a_length, sz_cptr
     __mmask64 mask_not_equal = _mm512_cmpneq_epi8_mask(a_vec.zmm, b_vec.zmm);
     if (mask_not_equal != 0) {
         sz_u64_t first_diff = _tzcnt_u64(mask_not_equal);
-        char a_char = a_vec.u8s[first_diff];
-        char b_char = b_vec.u8s[first_diff];
+        sz_u8_t a_char = a_vec.u8s[first_diff];
+        sz_u8_t b_char = b_vec.u8s[first_diff];
         return _sz_order_scalars(a_char, b_char);
     }
     else if (head_length == a_length && head_length == b_length) { return sz_equal_k; }
@@ -4678,8 +8523,8 @@ SZ_PUBLIC sz_ordering_t sz_order_avx512(sz_cptr_t a, sz_size_t a_length, sz_cptr
         mask_not_equal = _mm512_cmpneq_epi8_mask(a_vec.zmm, b_vec.zmm);
         if (mask_not_equal != 0) {
             sz_u64_t first_diff = _tzcnt_u64(mask_not_equal);
-            char a_char = a_vec.u8s[first_diff];
-            char b_char = b_vec.u8s[first_diff];
+            sz_u8_t a_char = a_vec.u8s[first_diff];
+            sz_u8_t b_char = b_vec.u8s[first_diff];
             return _sz_order_scalars(a_char, b_char);
         }
         a += 64, b += 64, a_length -= 64, b_length -= 64;
@@ -4697,8 +8542,8 @@ SZ_PUBLIC sz_ordering_t sz_order_avx512(sz_cptr_t a, sz_size_t a_length, sz_cptr
         mask_not_equal = _mm512_cmpneq_epi8_mask(a_vec.zmm, b_vec.zmm);
         if (mask_not_equal != 0) {
             sz_u64_t first_diff = _tzcnt_u64(mask_not_equal);
-            char a_char = a_vec.u8s[first_diff];
-            char b_char = b_vec.u8s[first_diff];
+            sz_u8_t a_char = a_vec.u8s[first_diff];
+            sz_u8_t b_char = b_vec.u8s[first_diff];
             return _sz_order_scalars(a_char, b_char);
         }
         // From logic perspective, the hardest cases are "abc\0" and "abc".
@@ -4757,8 +8602,16 @@ SZ_PUBLIC void sz_fill_avx512(sz_ptr_t target, sz_size_t length, sz_u8_t value)
         __mmask64 head_mask = _sz_u64_mask_until(head_length);
         __mmask64 tail_mask = _sz_u64_mask_until(tail_length);
         _mm512_mask_storeu_epi8(target, head_mask, value_vec);
-        for (target += head_length; body_length >= 64; target += 64, body_length -= 64)
-            _mm512_store_si512(target, value_vec);
+        // Huge buffers bypass the caches with streaming stores, not to evict the rest of the working set.
+        if (length < SZ_NON_TEMPORAL_FILL_THRESHOLD) {
+            for (target += head_length; body_length >= 64; target += 64, body_length -= 64)
+                _mm512_store_si512(target, value_vec);
+        }
+        else {
+            for (target += head_length; body_length >= 64; target += 64, body_length -= 64)
+                _mm512_stream_si512((__m512i *)target, value_vec);
+            _mm_sfence();
+        }
         _mm512_mask_storeu_epi8(target, tail_mask, value_vec);
     }
 }
@@ -4774,8 +8627,8 @@ SZ_PUBLIC void sz_copy_avx512(sz_ptr_t target, sz_cptr_t source, sz_size_t lengt
     //
     // A typical AWS Sapphire Rapids instance can have 48 KB x 2 blocks of L1 data cache per core,
     // 2 MB x 2 blocks of L2 cache per core, and one shared 60 MB buffer of L3 cache.
-    // With two strings, we may consider the overal workload huge, if each exceeds 1 MB in length.
-    int const is_huge = length >= 1ull * 1024ull * 1024ull;
+    // With two strings, we may consider the overal workload huge, if each exceeds `SZ_NON_TEMPORAL_THRESHOLD`.
+    int const is_huge = length >= SZ_NON_TEMPORAL_THRESHOLD;
 
     // When the buffer is small, there isn't much to innovate.
     if (length <= 64) {
@@ -4827,7 +8680,7 @@ SZ_PUBLIC void sz_copy_avx512(sz_ptr_t target, sz_cptr_t source, sz_size_t lengt
         __mmask64 tail_mask = _sz_u64_mask_until(tail_length);
         _mm512_mask_storeu_epi8(target, head_mask, _mm512_maskz_loadu_epi8(head_mask, source));
         _mm512_mask_storeu_epi8(target + head_length + body_length, tail_mask,
-                                _mm512_maskz_loadu_epi8(tail_mask, source));
+                                _mm512_maskz_loadu_epi8(tail_mask, source + head_length + body_length));
 
         // Now in the main loop, we can use non-temporal loads and stores,
         // performing the operation in both directions.
@@ -4838,6 +8691,8 @@ SZ_PUBLIC void sz_copy_avx512(sz_ptr_t target, sz_cptr_t source, sz_size_t lengt
             _mm512_stream_si512((__m512i *)(target + body_length - 64), _mm512_loadu_si512(source + body_length - 64));
         }
         if (body_length >= 64) _mm512_stream_si512((__m512i *)target, _mm512_loadu_si512(source));
+        // Streaming stores are weakly-ordered, so fence them before any following store becomes visible.
+        _mm_sfence();
     }
 }
 
@@ -5053,77 +8908,363 @@ SZ_PUBLIC sz_cptr_t sz_find_avx512(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n,
         h_first_vec.zmm = _mm512_maskz_loadu_epi8(mask, h + offset_first);
         h_mid_vec.zmm = _mm512_maskz_loadu_epi8(mask, h + offset_mid);
         h_last_vec.zmm = _mm512_maskz_loadu_epi8(mask, h + offset_last);
+        // The zeroed lanes past the end of the haystack would match the NUL bytes of the needle.
+        matches = _kand_mask64(_kand_mask64( // Intersect the masks
+                                   _mm512_mask_cmpeq_epi8_mask(mask, h_first_vec.zmm, n_first_vec.zmm),
+                                   _mm512_cmpeq_epi8_mask(h_mid_vec.zmm, n_mid_vec.zmm)),
+                               _mm512_cmpeq_epi8_mask(h_last_vec.zmm, n_last_vec.zmm));
+        while (matches) {
+            int potential_offset = sz_u64_ctz(matches);
+            if (n_length <= 3 || sz_equal_avx512(h + potential_offset, n, n_length)) return h + potential_offset;
+            matches &= matches - 1;
+        }
+    }
+    return SZ_NULL_CHAR;
+}
+
+/**
+ *  @brief  Exports the offsets of the set bits of the ::mask, relative to the ::base, after the first ::count ones.
+ *          Dense masks are unpacked 8 bits at a time with compressing stores, if the output has enough space.
+ *  @return Total number of exported offsets, at most ::capacity.
+ */
+SZ_INTERNAL sz_size_t _sz_find_all_export_avx512(sz_u64_t mask, sz_size_t base, sz_size_t *offsets, sz_size_t count,
+                                                 sz_size_t capacity) {
+    sz_size_t const mask_count = (sz_size_t)sz_u64_popcount(mask);
+    if (!offsets) return sz_min_of_two(count + mask_count, capacity);
+    if (mask_count <= 8 || capacity - count < mask_count) {
+        for (; mask && count != capacity; mask &= mask - 1) offsets[count++] = base + sz_u64_ctz(mask);
+        return count;
+    }
+
+    sz_u512_vec_t offsets_vec, step_vec;
+    offsets_vec.zmm = _mm512_add_epi64(_mm512_set1_epi64((long long)base), _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0));
+    step_vec.zmm = _mm512_set1_epi64(8);
+    for (; mask; mask >>= 8, offsets_vec.zmm = _mm512_add_epi64(offsets_vec.zmm, step_vec.zmm)) {
+        __mmask8 byte_mask = (__mmask8)mask;
+        _mm512_mask_compressstoreu_epi64(offsets + count, byte_mask, offsets_vec.zmm);
+        count += sz_u32_popcount(byte_mask);
+    }
+    return count;
+}
+
+SZ_PUBLIC sz_size_t sz_find_all_avx512(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length,
+                                       sz_bool_t allow_overlap, sz_size_t *offsets, sz_size_t capacity) {
+
+    // This almost never fires, but it's better to be safe than sorry.
+    if (h_length < n_length || !n_length) return 0;
+
+    __mmask64 mask, matches;
+    sz_size_t count = 0;
+    if (n_length == 1) {
+        sz_u512_vec_t h_vec, n_vec;
+        n_vec.zmm = _mm512_set1_epi8(n[0]);
+        for (sz_size_t i = 0; i < h_length && count != capacity; i += 64) {
+            mask = _sz_u64_mask_until(sz_min_of_two(h_length - i, 64));
+            h_vec.zmm = _mm512_maskz_loadu_epi8(mask, h + i);
+            matches = _mm512_mask_cmpeq_epi8_mask(mask, h_vec.zmm, n_vec.zmm);
+            count = _sz_find_all_export_avx512(matches, i, offsets, count, capacity);
+        }
+        return count;
+    }
+
+    // Pick the parts of the needle that are worth comparing.
+    // For needles of up to 3 bytes those cover every byte, and need no further verification.
+    sz_size_t offset_first, offset_mid, offset_last;
+    _sz_locate_needle_anomalies(n, n_length, &offset_first, &offset_mid, &offset_last);
+    sz_u512_vec_t h_first_vec, h_mid_vec, h_last_vec, n_first_vec, n_mid_vec, n_last_vec;
+    n_first_vec.zmm = _mm512_set1_epi8(n[offset_first]);
+    n_mid_vec.zmm = _mm512_set1_epi8(n[offset_mid]);
+    n_last_vec.zmm = _mm512_set1_epi8(n[offset_last]);
+
+    // Every match forbids the following candidates, that would overlap with it.
+    sz_size_t const skip_length = allow_overlap ? 1 : n_length;
+    sz_size_t const candidates = h_length - n_length + 1;
+    sz_size_t next_offset = 0;
+    for (sz_size_t i = 0; i < candidates && count != capacity; i += 64) {
+        mask = _sz_u64_mask_until(sz_min_of_two(candidates - i, 64));
+        h_first_vec.zmm = _mm512_maskz_loadu_epi8(mask, h + i + offset_first);
+        h_mid_vec.zmm = _mm512_maskz_loadu_epi8(mask, h + i + offset_mid);
+        h_last_vec.zmm = _mm512_maskz_loadu_epi8(mask, h + i + offset_last);
+        // The zeroed lanes past the end of the haystack would match the NUL bytes of the needle.
+        matches = _kand_mask64(_kand_mask64( // Intersect the masks
+                                   _mm512_mask_cmpeq_epi8_mask(mask, h_first_vec.zmm, n_first_vec.zmm),
+                                   _mm512_cmpeq_epi8_mask(h_mid_vec.zmm, n_mid_vec.zmm)),
+                               _mm512_cmpeq_epi8_mask(h_last_vec.zmm, n_last_vec.zmm));
+        if (next_offset > i) matches &= ~_sz_u64_mask_until(sz_min_of_two(next_offset - i, 64));
+        while (matches && count != capacity) {
+            sz_size_t offset = i + sz_u64_ctz(matches);
+            if (n_length > 3 && !sz_equal_avx512(h + offset, n, n_length)) {
+                matches &= matches - 1;
+                continue;
+            }
+            if (offsets) offsets[count] = offset;
+            ++count;
+            next_offset = offset + skip_length;
+            matches &= ~_sz_u64_mask_until(sz_min_of_two(next_offset - i, 64));
+        }
+    }
+    return count;
+}
+
+SZ_PUBLIC sz_cptr_t sz_find_multi_avx512(sz_multi_matcher_t const *matcher, sz_cptr_t h, sz_size_t h_length,
+                                         sz_size_t *needle_index) {
+
+    if (!matcher->count || h_length < matcher->min_length) return SZ_NULL_CHAR;
+
+    // The `vpshufb` instruction performs look-ups within 128-bit lanes,
+    // so the 16-entry nibble tables are replicated into all four quarters of ZMM registers.
+    sz_size_t const teddy_length = sz_min_of_two(matcher->prefix_length, 3);
+    sz_u512_vec_t lows_vec[3], highs_vec[3];
+    for (sz_size_t j = 0; j != teddy_length; ++j) {
+        lows_vec[j].xmms[0] = _mm_loadu_si128((__m128i const *)matcher->nibbles_low[j]);
+        highs_vec[j].xmms[0] = _mm_loadu_si128((__m128i const *)matcher->nibbles_high[j]);
+        lows_vec[j].xmms[1] = lows_vec[j].xmms[2] = lows_vec[j].xmms[3] = lows_vec[j].xmms[0];
+        highs_vec[j].xmms[1] = highs_vec[j].xmms[2] = highs_vec[j].xmms[3] = highs_vec[j].xmms[0];
+    }
+
+    __mmask64 matches;
+    sz_u512_vec_t h_vec, groups_vec, nibble_mask_vec;
+    nibble_mask_vec.zmm = _mm512_set1_epi8(0x0F);
+
+    // Every iteration evaluates 64 starting offsets, intersecting the groups of needles,
+    // that have matching low and high nibbles in each of the first `teddy_length` bytes.
+    for (; h_length >= 64 + teddy_length; h += 64, h_length -= 64) {
+        groups_vec.zmm = _mm512_set1_epi8((char)0xFF);
+        for (sz_size_t j = 0; j != teddy_length; ++j) {
+            h_vec.zmm = _mm512_loadu_si512(h + j);
+            groups_vec.zmm = _mm512_and_si512(
+                groups_vec.zmm,
+                _mm512_and_si512(_mm512_shuffle_epi8(lows_vec[j].zmm, _mm512_and_si512(h_vec.zmm, nibble_mask_vec.zmm)),
+                                 _mm512_shuffle_epi8(highs_vec[j].zmm, _mm512_and_si512(_mm512_srli_epi16(h_vec.zmm, 4),
+                                                                                        nibble_mask_vec.zmm))));
+        }
+        matches = _mm512_test_epi8_mask(groups_vec.zmm, groups_vec.zmm);
+        while (matches) {
+            int potential_offset = sz_u64_ctz(matches);
+            if (_sz_multi_matcher_verify(matcher, h + potential_offset, h_length - potential_offset, needle_index))
+                return h + potential_offset;
+            matches &= matches - 1;
+        }
+    }
+
+    // The "tail" of the function uses masked loads to process the remaining bytes.
+    if (h_length >= matcher->min_length) {
+        groups_vec.zmm = _mm512_set1_epi8((char)0xFF);
+        for (sz_size_t j = 0; j != teddy_length; ++j) {
+            h_vec.zmm = _mm512_maskz_loadu_epi8(_sz_u64_clamp_mask_until(h_length - j), h + j);
+            groups_vec.zmm = _mm512_and_si512(
+                groups_vec.zmm,
+                _mm512_and_si512(_mm512_shuffle_epi8(lows_vec[j].zmm, _mm512_and_si512(h_vec.zmm, nibble_mask_vec.zmm)),
+                                 _mm512_shuffle_epi8(highs_vec[j].zmm, _mm512_and_si512(_mm512_srli_epi16(h_vec.zmm, 4),
+                                                                                        nibble_mask_vec.zmm))));
+        }
+        matches = _mm512_test_epi8_mask(groups_vec.zmm, groups_vec.zmm) &
+                  _sz_u64_clamp_mask_until(h_length - matcher->min_length + 1);
+        while (matches) {
+            int potential_offset = sz_u64_ctz(matches);
+            if (_sz_multi_matcher_verify(matcher, h + potential_offset, h_length - potential_offset, needle_index))
+                return h + potential_offset;
+            matches &= matches - 1;
+        }
+    }
+    return SZ_NULL_CHAR;
+}
+
+SZ_PUBLIC sz_cptr_t sz_rfind_byte_avx512(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n) {
+    __mmask64 mask;
+    sz_u512_vec_t h_vec, n_vec;
+    n_vec.zmm = _mm512_set1_epi8(n[0]);
+
+    while (h_length >= 64) {
+        h_vec.zmm = _mm512_loadu_si512(h + h_length - 64);
+        mask = _mm512_cmpeq_epi8_mask(h_vec.zmm, n_vec.zmm);
+        if (mask) return h + h_length - 1 - sz_u64_clz(mask);
+        h_length -= 64;
+    }
+
+    if (h_length) {
+        mask = _sz_u64_mask_until(h_length);
+        h_vec.zmm = _mm512_maskz_loadu_epi8(mask, h);
+        // Reuse the same `mask` variable to find the bit that doesn't match
+        mask = _mm512_mask_cmpeq_epu8_mask(mask, h_vec.zmm, n_vec.zmm);
+        if (mask) return h + 64 - sz_u64_clz(mask) - 1;
+    }
+
+    return SZ_NULL_CHAR;
+}
+
+SZ_PUBLIC sz_cptr_t sz_rfind_avx512(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
+
+    // This almost never fires, but it's better to be safe than sorry.
+    if (h_length < n_length || !n_length) return SZ_NULL_CHAR;
+    if (n_length == 1) return sz_rfind_byte_avx512(h, h_length, n);
+
+    // Pick the parts of the needle that are worth comparing.
+    sz_size_t offset_first, offset_mid, offset_last;
+    _sz_locate_needle_anomalies(n, n_length, &offset_first, &offset_mid, &offset_last);
+
+    // Broadcast those characters into ZMM registers.
+    __mmask64 mask;
+    __mmask64 matches;
+    sz_u512_vec_t h_first_vec, h_mid_vec, h_last_vec, n_first_vec, n_mid_vec, n_last_vec;
+    n_first_vec.zmm = _mm512_set1_epi8(n[offset_first]);
+    n_mid_vec.zmm = _mm512_set1_epi8(n[offset_mid]);
+    n_last_vec.zmm = _mm512_set1_epi8(n[offset_last]);
+
+    // Scan through the string.
+    sz_cptr_t h_reversed;
+    for (; h_length >= n_length + 64; h_length -= 64) {
+        h_reversed = h + h_length - n_length - 64 + 1;
+        h_first_vec.zmm = _mm512_loadu_si512(h_reversed + offset_first);
+        h_mid_vec.zmm = _mm512_loadu_si512(h_reversed + offset_mid);
+        h_last_vec.zmm = _mm512_loadu_si512(h_reversed + offset_last);
+        matches = _kand_mask64(_kand_mask64( // Intersect the masks
+                                   _mm512_cmpeq_epi8_mask(h_first_vec.zmm, n_first_vec.zmm),
+                                   _mm512_cmpeq_epi8_mask(h_mid_vec.zmm, n_mid_vec.zmm)),
+                               _mm512_cmpeq_epi8_mask(h_last_vec.zmm, n_last_vec.zmm));
+        while (matches) {
+            int potential_offset = sz_u64_clz(matches);
+            if (n_length <= 3 || sz_equal_avx512(h + h_length - n_length - potential_offset, n, n_length))
+                return h + h_length - n_length - potential_offset;
+            sz_assert((matches & ((sz_u64_t)1 << (63 - potential_offset))) != 0 &&
+                      "The bit must be set before we squash it");
+            matches &= ~((sz_u64_t)1 << (63 - potential_offset));
+        }
+    }
+
+    // The "tail" of the function uses masked loads to process the remaining bytes.
+    {
+        mask = _sz_u64_mask_until(h_length - n_length + 1);
+        h_first_vec.zmm = _mm512_maskz_loadu_epi8(mask, h + offset_first);
+        h_mid_vec.zmm = _mm512_maskz_loadu_epi8(mask, h + offset_mid);
+        h_last_vec.zmm = _mm512_maskz_loadu_epi8(mask, h + offset_last);
+        // The zeroed lanes past the end of the haystack would match the NUL bytes of the needle.
         matches = _kand_mask64(_kand_mask64( // Intersect the masks
-                                   _mm512_cmpeq_epi8_mask(h_first_vec.zmm, n_first_vec.zmm),
+                                   _mm512_mask_cmpeq_epi8_mask(mask, h_first_vec.zmm, n_first_vec.zmm),
                                    _mm512_cmpeq_epi8_mask(h_mid_vec.zmm, n_mid_vec.zmm)),
                                _mm512_cmpeq_epi8_mask(h_last_vec.zmm, n_last_vec.zmm));
         while (matches) {
-            int potential_offset = sz_u64_ctz(matches);
-            if (n_length <= 3 || sz_equal_avx512(h + potential_offset, n, n_length)) return h + potential_offset;
-            matches &= matches - 1;
+            int potential_offset = sz_u64_clz(matches);
+            if (n_length <= 3 || sz_equal_avx512(h + 64 - potential_offset - 1, n, n_length))
+                return h + 64 - potential_offset - 1;
+            sz_assert((matches & ((sz_u64_t)1 << (63 - potential_offset))) != 0 &&
+                      "The bit must be set before we squash it");
+            matches &= ~((sz_u64_t)1 << (63 - potential_offset));
         }
     }
+
     return SZ_NULL_CHAR;
 }
 
-SZ_PUBLIC sz_cptr_t sz_rfind_byte_avx512(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n) {
-    __mmask64 mask;
-    sz_u512_vec_t h_vec, n_vec;
-    n_vec.zmm = _mm512_set1_epi8(n[0]);
+/**
+ *  @brief  Folds uppercase ASCII letters into lowercase, adding 0x20 to the bytes in the "A-Z" range.
+ */
+SZ_INTERNAL __m512i _sz_fold_ascii_avx512(__m512i text) {
+    __mmask64 uppers = _mm512_cmplt_epu8_mask(_mm512_sub_epi8(text, _mm512_set1_epi8('A')), _mm512_set1_epi8(26));
+    return _mm512_mask_add_epi8(text, uppers, text, _mm512_set1_epi8(0x20));
+}
 
-    while (h_length >= 64) {
-        h_vec.zmm = _mm512_loadu_si512(h + h_length - 64);
-        mask = _mm512_cmpeq_epi8_mask(h_vec.zmm, n_vec.zmm);
-        if (mask) return h + h_length - 1 - sz_u64_clz(mask);
-        h_length -= 64;
+SZ_INTERNAL sz_bool_t _sz_equal_caseless_avx512(sz_cptr_t a, sz_cptr_t b, sz_size_t length) {
+    __mmask64 mask;
+    sz_u512_vec_t a_vec, b_vec;
+    for (; length >= 64; a += 64, b += 64, length -= 64) {
+        a_vec.zmm = _sz_fold_ascii_avx512(_mm512_loadu_si512(a));
+        b_vec.zmm = _sz_fold_ascii_avx512(_mm512_loadu_si512(b));
+        if (_mm512_cmpneq_epi8_mask(a_vec.zmm, b_vec.zmm)) return sz_false_k;
     }
+    mask = _sz_u64_mask_until(length);
+    a_vec.zmm = _sz_fold_ascii_avx512(_mm512_maskz_loadu_epi8(mask, a));
+    b_vec.zmm = _sz_fold_ascii_avx512(_mm512_maskz_loadu_epi8(mask, b));
+    return (sz_bool_t)(_mm512_mask_cmpneq_epi8_mask(mask, a_vec.zmm, b_vec.zmm) == 0);
+}
 
-    if (h_length) {
-        mask = _sz_u64_mask_until(h_length);
-        h_vec.zmm = _mm512_maskz_loadu_epi8(mask, h);
-        // Reuse the same `mask` variable to find the bit that doesn't match
-        mask = _mm512_mask_cmpeq_epu8_mask(mask, h_vec.zmm, n_vec.zmm);
-        if (mask) return h + 64 - sz_u64_clz(mask) - 1;
+SZ_PUBLIC sz_cptr_t sz_find_caseless_avx512(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
+
+    // This almost never fires, but it's better to be safe than sorry.
+    if (h_length < n_length || !n_length) return SZ_NULL_CHAR;
+
+    // Pick the parts of the needle that are worth comparing.
+    sz_size_t offset_first, offset_mid, offset_last;
+    _sz_locate_needle_anomalies(n, n_length, &offset_first, &offset_mid, &offset_last);
+
+    // Broadcast the folded characters into ZMM registers.
+    __mmask64 matches;
+    __mmask64 mask;
+    sz_u512_vec_t h_first_vec, h_mid_vec, h_last_vec, n_first_vec, n_mid_vec, n_last_vec;
+    n_first_vec.zmm = _mm512_set1_epi8((char)_sz_u8_fold_ascii((sz_u8_t)n[offset_first]));
+    n_mid_vec.zmm = _mm512_set1_epi8((char)_sz_u8_fold_ascii((sz_u8_t)n[offset_mid]));
+    n_last_vec.zmm = _mm512_set1_epi8((char)_sz_u8_fold_ascii((sz_u8_t)n[offset_last]));
+
+    // Scan through the string, folding the haystack in-register.
+    for (; h_length >= n_length + 64; h += 64, h_length -= 64) {
+        h_first_vec.zmm = _sz_fold_ascii_avx512(_mm512_loadu_si512(h + offset_first));
+        h_mid_vec.zmm = _sz_fold_ascii_avx512(_mm512_loadu_si512(h + offset_mid));
+        h_last_vec.zmm = _sz_fold_ascii_avx512(_mm512_loadu_si512(h + offset_last));
+        matches = _kand_mask64(_kand_mask64( // Intersect the masks
+                                   _mm512_cmpeq_epi8_mask(h_first_vec.zmm, n_first_vec.zmm),
+                                   _mm512_cmpeq_epi8_mask(h_mid_vec.zmm, n_mid_vec.zmm)),
+                               _mm512_cmpeq_epi8_mask(h_last_vec.zmm, n_last_vec.zmm));
+        while (matches) {
+            int potential_offset = sz_u64_ctz(matches);
+            if (n_length <= 3 || _sz_equal_caseless_avx512(h + potential_offset, n, n_length))
+                return h + potential_offset;
+            matches &= matches - 1;
+        }
     }
 
+    // The "tail" of the function uses masked loads to process the remaining bytes.
+    {
+        mask = _sz_u64_mask_until(h_length - n_length + 1);
+        h_first_vec.zmm = _sz_fold_ascii_avx512(_mm512_maskz_loadu_epi8(mask, h + offset_first));
+        h_mid_vec.zmm = _sz_fold_ascii_avx512(_mm512_maskz_loadu_epi8(mask, h + offset_mid));
+        h_last_vec.zmm = _sz_fold_ascii_avx512(_mm512_maskz_loadu_epi8(mask, h + offset_last));
+        matches = _kand_mask64(_kand_mask64( // Intersect the masks
+                                   _mm512_mask_cmpeq_epi8_mask(mask, h_first_vec.zmm, n_first_vec.zmm),
+                                   _mm512_cmpeq_epi8_mask(h_mid_vec.zmm, n_mid_vec.zmm)),
+                               _mm512_cmpeq_epi8_mask(h_last_vec.zmm, n_last_vec.zmm));
+        while (matches) {
+            int potential_offset = sz_u64_ctz(matches);
+            if (n_length <= 3 || _sz_equal_caseless_avx512(h + potential_offset, n, n_length))
+                return h + potential_offset;
+            matches &= matches - 1;
+        }
+    }
     return SZ_NULL_CHAR;
 }
 
-SZ_PUBLIC sz_cptr_t sz_rfind_avx512(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
+SZ_PUBLIC sz_cptr_t sz_rfind_caseless_avx512(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
 
     // This almost never fires, but it's better to be safe than sorry.
     if (h_length < n_length || !n_length) return SZ_NULL_CHAR;
-    if (n_length == 1) return sz_rfind_byte_avx512(h, h_length, n);
 
     // Pick the parts of the needle that are worth comparing.
     sz_size_t offset_first, offset_mid, offset_last;
     _sz_locate_needle_anomalies(n, n_length, &offset_first, &offset_mid, &offset_last);
 
-    // Broadcast those characters into ZMM registers.
+    // Broadcast the folded characters into ZMM registers.
     __mmask64 mask;
     __mmask64 matches;
     sz_u512_vec_t h_first_vec, h_mid_vec, h_last_vec, n_first_vec, n_mid_vec, n_last_vec;
-    n_first_vec.zmm = _mm512_set1_epi8(n[offset_first]);
-    n_mid_vec.zmm = _mm512_set1_epi8(n[offset_mid]);
-    n_last_vec.zmm = _mm512_set1_epi8(n[offset_last]);
+    n_first_vec.zmm = _mm512_set1_epi8((char)_sz_u8_fold_ascii((sz_u8_t)n[offset_first]));
+    n_mid_vec.zmm = _mm512_set1_epi8((char)_sz_u8_fold_ascii((sz_u8_t)n[offset_mid]));
+    n_last_vec.zmm = _mm512_set1_epi8((char)_sz_u8_fold_ascii((sz_u8_t)n[offset_last]));
 
-    // Scan through the string.
+    // Scan through the string, folding the haystack in-register.
     sz_cptr_t h_reversed;
     for (; h_length >= n_length + 64; h_length -= 64) {
         h_reversed = h + h_length - n_length - 64 + 1;
-        h_first_vec.zmm = _mm512_loadu_si512(h_reversed + offset_first);
-        h_mid_vec.zmm = _mm512_loadu_si512(h_reversed + offset_mid);
-        h_last_vec.zmm = _mm512_loadu_si512(h_reversed + offset_last);
+        h_first_vec.zmm = _sz_fold_ascii_avx512(_mm512_loadu_si512(h_reversed + offset_first));
+        h_mid_vec.zmm = _sz_fold_ascii_avx512(_mm512_loadu_si512(h_reversed + offset_mid));
+        h_last_vec.zmm = _sz_fold_ascii_avx512(_mm512_loadu_si512(h_reversed + offset_last));
         matches = _kand_mask64(_kand_mask64( // Intersect the masks
                                    _mm512_cmpeq_epi8_mask(h_first_vec.zmm, n_first_vec.zmm),
                                    _mm512_cmpeq_epi8_mask(h_mid_vec.zmm, n_mid_vec.zmm)),
                                _mm512_cmpeq_epi8_mask(h_last_vec.zmm, n_last_vec.zmm));
         while (matches) {
             int potential_offset = sz_u64_clz(matches);
-            if (n_length <= 3 || sz_equal_avx512(h + h_length - n_length - potential_offset, n, n_length))
+            if (n_length <= 3 ||
+                _sz_equal_caseless_avx512(h + h_length - n_length - potential_offset, n, n_length))
                 return h + h_length - n_length - potential_offset;
-            sz_assert((matches & ((sz_u64_t)1 << (63 - potential_offset))) != 0 &&
-                      "The bit must be set before we squash it");
             matches &= ~((sz_u64_t)1 << (63 - potential_offset));
         }
     }
@@ -5131,19 +9272,17 @@ SZ_PUBLIC sz_cptr_t sz_rfind_avx512(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n
     // The "tail" of the function uses masked loads to process the remaining bytes.
     {
         mask = _sz_u64_mask_until(h_length - n_length + 1);
-        h_first_vec.zmm = _mm512_maskz_loadu_epi8(mask, h + offset_first);
-        h_mid_vec.zmm = _mm512_maskz_loadu_epi8(mask, h + offset_mid);
-        h_last_vec.zmm = _mm512_maskz_loadu_epi8(mask, h + offset_last);
+        h_first_vec.zmm = _sz_fold_ascii_avx512(_mm512_maskz_loadu_epi8(mask, h + offset_first));
+        h_mid_vec.zmm = _sz_fold_ascii_avx512(_mm512_maskz_loadu_epi8(mask, h + offset_mid));
+        h_last_vec.zmm = _sz_fold_ascii_avx512(_mm512_maskz_loadu_epi8(mask, h + offset_last));
         matches = _kand_mask64(_kand_mask64( // Intersect the masks
-                                   _mm512_cmpeq_epi8_mask(h_first_vec.zmm, n_first_vec.zmm),
+                                   _mm512_mask_cmpeq_epi8_mask(mask, h_first_vec.zmm, n_first_vec.zmm),
                                    _mm512_cmpeq_epi8_mask(h_mid_vec.zmm, n_mid_vec.zmm)),
                                _mm512_cmpeq_epi8_mask(h_last_vec.zmm, n_last_vec.zmm));
         while (matches) {
             int potential_offset = sz_u64_clz(matches);
-            if (n_length <= 3 || sz_equal_avx512(h + 64 - potential_offset - 1, n, n_length))
+            if (n_length <= 3 || _sz_equal_caseless_avx512(h + 64 - potential_offset - 1, n, n_length))
                 return h + 64 - potential_offset - 1;
-            sz_assert((matches & ((sz_u64_t)1 << (63 - potential_offset))) != 0 &&
-                      "The bit must be set before we squash it");
             matches &= ~((sz_u64_t)1 << (63 - potential_offset));
         }
     }
@@ -5297,13 +9436,317 @@ SZ_INTERNAL sz_size_t sz_edit_distance_avx512(   //
     sz_cptr_t longer, sz_size_t longer_length,   //
     sz_size_t bound, sz_memory_allocator_t *alloc) {
 
-    if (shorter_length == longer_length && !bound && shorter_length && shorter_length < 256u * 256u)
+    // Strings up to 128 bytes are faster to handle with the bit-parallel serial kernels.
+    if (shorter_length == longer_length && !bound && shorter_length > 128 && shorter_length < 256u * 256u)
         return _sz_edit_distance_skewed_diagonals_upto65k_avx512(shorter, shorter_length, longer, longer_length, bound,
                                                                  alloc);
     else
         return sz_edit_distance_serial(shorter, shorter_length, longer, longer_length, bound, alloc);
 }
 
+/**
+ *  @brief  Bit-parallel Myers-Hyyrö Levenshtein distance, evaluating 8 candidates at a time,
+ *          one per 64-bit lane, gathering the pattern match bit-vectors for 8 different bytes per step.
+ *          Lanes, that have reached the end of their candidate, are masked out until the longest one is done.
+ */
+SZ_PUBLIC sz_bool_t sz_edit_distances_avx512(sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates,
+                                             sz_size_t bound, sz_memory_allocator_t *alloc, sz_size_t *distances) {
+
+    if (!query_length || query_length > 64)
+        return sz_edit_distances_serial(query, query_length, candidates, bound, alloc, distances);
+
+    sz_u64_t peq[256];
+    _sz_edit_distance_myers64_peq(query, query_length, peq);
+
+    __m512i const ones_vec = _mm512_set1_epi64(1);
+    __m512i const all_bits_vec = _mm512_set1_epi64(-1);
+    __m512i const byte_mask_vec = _mm512_set1_epi64(0xFF);
+    __m512i const last_bit_vec = _mm512_set1_epi64((sz_i64_t)(1ull << (query_length - 1)));
+
+    sz_size_t const count = candidates->count;
+    for (sz_size_t group_start = 0; group_start < count; group_start += 8) {
+        sz_size_t const group_size = sz_min_of_two(count - group_start, 8);
+        sz_cptr_t starts[8];
+        sz_u64_t lengths[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+        sz_u64_t max_length = 0;
+        for (sz_size_t lane = 0; lane != group_size; ++lane) {
+            starts[lane] = candidates->get_start(candidates, group_start + lane);
+            lengths[lane] = candidates->get_length(candidates, group_start + lane);
+            max_length = sz_max_of_two(max_length, lengths[lane]);
+        }
+
+        __m512i lengths_vec = _mm512_loadu_si512(lengths);
+        __m512i vertical_positive_vec = all_bits_vec, vertical_negative_vec = _mm512_setzero_si512();
+        __m512i scores_vec = _mm512_set1_epi64((sz_i64_t)query_length);
+        for (sz_u64_t j = 0; j < max_length; j += 8) {
+
+            // Transpose the next 8 bytes of every candidate into the matching 64-bit lane.
+            sz_u64_vec_t chunks[8];
+            for (sz_size_t lane = 0; lane != 8; ++lane) {
+                chunks[lane].u64 = 0;
+                if (lengths[lane] <= j) continue;
+                sz_size_t const chunk_length = sz_min_of_two(lengths[lane] - j, 8);
+                if (chunk_length == 8) { chunks[lane].u64 = sz_u64_load(starts[lane] + j).u64; }
+                else {
+                    for (sz_size_t k = 0; k != chunk_length; ++k) chunks[lane].u8s[k] = (sz_u8_t)starts[lane][j + k];
+                }
+            }
+            __m512i chars_vec = _mm512_loadu_si512(chunks);
+
+            sz_u64_t const steps = sz_min_of_two(max_length - j, 8);
+            for (sz_u64_t k = 0; k != steps; ++k, chars_vec = _mm512_srli_epi64(chars_vec, 8)) {
+                __mmask8 active = _mm512_cmpgt_epu64_mask(lengths_vec, _mm512_set1_epi64((sz_i64_t)(j + k)));
+                __m512i match_vec = _mm512_i64gather_epi64(_mm512_and_si512(chars_vec, byte_mask_vec), peq, 8);
+                __m512i vertical_other_vec = _mm512_or_si512(match_vec, vertical_negative_vec);
+                __m512i horizontal_other_vec = _mm512_or_si512(
+                    _mm512_xor_si512(_mm512_add_epi64(_mm512_and_si512(match_vec, vertical_positive_vec),
+                                                      vertical_positive_vec),
+                                     vertical_positive_vec),
+                    match_vec);
+                __m512i horizontal_positive_vec = _mm512_or_si512(
+                    vertical_negative_vec,
+                    _mm512_andnot_si512(_mm512_or_si512(horizontal_other_vec, vertical_positive_vec), all_bits_vec));
+                __m512i horizontal_negative_vec = _mm512_and_si512(vertical_positive_vec, horizontal_other_vec);
+
+                __mmask8 increments = _mm512_mask_test_epi64_mask(active, horizontal_positive_vec, last_bit_vec);
+                __mmask8 decrements = _mm512_mask_test_epi64_mask(active, horizontal_negative_vec, last_bit_vec);
+                scores_vec = _mm512_mask_add_epi64(scores_vec, increments, scores_vec, ones_vec);
+                scores_vec = _mm512_mask_sub_epi64(scores_vec, decrements, scores_vec, ones_vec);
+
+                horizontal_positive_vec = _mm512_or_si512(_mm512_slli_epi64(horizontal_positive_vec, 1), ones_vec);
+                horizontal_negative_vec = _mm512_slli_epi64(horizontal_negative_vec, 1);
+                vertical_positive_vec = _mm512_mask_or_epi64(
+                    vertical_positive_vec, active, horizontal_negative_vec,
+                    _mm512_andnot_si512(_mm512_or_si512(vertical_other_vec, horizontal_positive_vec), all_bits_vec));
+                vertical_negative_vec = _mm512_mask_and_epi64(vertical_negative_vec, active, horizontal_positive_vec,
+                                                              vertical_other_vec);
+            }
+        }
+
+        sz_u64_t scores[8];
+        _mm512_storeu_si512(scores, scores_vec);
+        for (sz_size_t lane = 0; lane != group_size; ++lane)
+            distances[group_start + lane] = bound ? sz_min_of_two(scores[lane], bound) : scores[lane];
+    }
+    return sz_true_k;
+}
+
+/**
+ *  @brief  Classifies every byte of a 64-byte block, given the preceding block, with the nibble look-up tables
+ *          from ::_sz_utf8_lookup_tables. Any non-zero byte of the result signals an encoding error.
+ */
+SZ_INTERNAL __m512i _sz_utf8_errors_avx512(__m512i input_vec, __m512i previous_vec) {
+    __m512i const first_high_lut_vec = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const *)_sz_utf8_lookup_tables[0]));
+    __m512i const first_low_lut_vec = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const *)_sz_utf8_lookup_tables[1]));
+    __m512i const second_high_lut_vec =
+        _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const *)_sz_utf8_lookup_tables[2]));
+    __m512i const nibble_mask_vec = _mm512_set1_epi8(0x0F);
+
+    // Shift the input by 1, 2, and 3 bytes, pulling in the tail of the previous block.
+    // The `alignr` instruction works within 128-bit lanes, so we first compose the lanes preceding each of the input.
+    __m512i const carried_vec =
+        _mm512_permutex2var_epi64(previous_vec, _mm512_setr_epi64(6, 7, 8, 9, 10, 11, 12, 13), input_vec);
+    __m512i const previous_1_vec = _mm512_alignr_epi8(input_vec, carried_vec, 15);
+    __m512i const previous_2_vec = _mm512_alignr_epi8(input_vec, carried_vec, 14);
+    __m512i const previous_3_vec = _mm512_alignr_epi8(input_vec, carried_vec, 13);
+
+    __m512i const first_high_vec = _mm512_shuffle_epi8(
+        first_high_lut_vec, _mm512_and_si512(_mm512_srli_epi16(previous_1_vec, 4), nibble_mask_vec));
+    __m512i const first_low_vec =
+        _mm512_shuffle_epi8(first_low_lut_vec, _mm512_and_si512(previous_1_vec, nibble_mask_vec));
+    __m512i const second_high_vec =
+        _mm512_shuffle_epi8(second_high_lut_vec, _mm512_and_si512(_mm512_srli_epi16(input_vec, 4), nibble_mask_vec));
+    __m512i const errors_vec = _mm512_and_si512(_mm512_and_si512(first_high_vec, first_low_vec), second_high_vec);
+
+    // The third and fourth bytes of 3- and 4-byte runes are the only places, where two continuations can follow.
+    __m512i const third_vec = _mm512_subs_epu8(previous_2_vec, _mm512_set1_epi8((char)(0xE0 - 0x80)));
+    __m512i const fourth_vec = _mm512_subs_epu8(previous_3_vec, _mm512_set1_epi8((char)(0xF0 - 0x80)));
+    __m512i const expected_vec = _mm512_and_si512(_mm512_or_si512(third_vec, fourth_vec), _mm512_set1_epi8((char)0x80));
+    return _mm512_xor_si512(errors_vec, expected_vec);
+}
+
+SZ_PUBLIC sz_bool_t sz_utf8_validate_avx512(sz_cptr_t text, sz_size_t length) {
+    sz_u512_vec_t input_vec, previous_vec, errors_vec;
+    previous_vec.zmm = errors_vec.zmm = _mm512_setzero_si512();
+
+    // The largest values of the last three bytes of a block, that don't expect continuations in the next one.
+    __m512i const complete_max_vec = _mm512_set_epi64((sz_i64_t)0xBFDFEFFFFFFFFFFFull, -1, -1, -1, -1, -1, -1, -1);
+
+    for (; length >= 64; text += 64, length -= 64) {
+        input_vec.zmm = _mm512_loadu_si512(text);
+        // ASCII blocks are only worth checking, if the previous block ended with an incomplete rune.
+        if (_mm512_movepi8_mask(input_vec.zmm) || _mm512_cmpgt_epu8_mask(previous_vec.zmm, complete_max_vec))
+            errors_vec.zmm = _mm512_or_si512(errors_vec.zmm, _sz_utf8_errors_avx512(input_vec.zmm, previous_vec.zmm));
+        previous_vec.zmm = input_vec.zmm;
+    }
+
+    // The tail is padded with zeros, which also catches the runes cut short by the end of the string.
+    input_vec.zmm = _mm512_maskz_loadu_epi8(_sz_u64_mask_until(length), text);
+    errors_vec.zmm = _mm512_or_si512(errors_vec.zmm, _sz_utf8_errors_avx512(input_vec.zmm, previous_vec.zmm));
+    return (sz_bool_t)(_mm512_test_epi8_mask(errors_vec.zmm, errors_vec.zmm) == 0);
+}
+
+SZ_PUBLIC sz_size_t sz_utf8_count_avx512(sz_cptr_t text, sz_size_t length) {
+    // As signed integers, the continuation bytes are in [-128, -65], below all other bytes.
+    __m512i const continuation_max_vec = _mm512_set1_epi8((char)0xBF);
+    sz_u512_vec_t text_vec;
+    sz_size_t count = 0;
+
+    for (; length >= 64; text += 64, length -= 64) {
+        text_vec.zmm = _mm512_loadu_si512(text);
+        count += sz_u64_popcount(_mm512_cmpgt_epi8_mask(text_vec.zmm, continuation_max_vec));
+    }
+
+    __mmask64 const mask = _sz_u64_mask_until(length);
+    text_vec.zmm = _mm512_maskz_loadu_epi8(mask, text);
+    count += sz_u64_popcount(_mm512_mask_cmpgt_epi8_mask(mask, text_vec.zmm, continuation_max_vec));
+    return count;
+}
+
+/**
+ *  @brief  Decodes UTF8 into UTF32, 16 bytes at a time, without any shuffle tables.
+ *
+ *  Every byte is widened into a 32-bit lane, along with the lower 6 bits of the three bytes that follow it.
+ *  For each lane we assemble the rune, assuming it's a leading byte, and later compress away the lanes with
+ *  continuation bytes. A rune starting at the last byte of the block can reach 3 bytes into the next one.
+ */
+SZ_PUBLIC sz_size_t sz_utf8_to_utf32_avx512(sz_cptr_t text, sz_size_t length, sz_rune_t *runes) {
+    sz_u8_t const *current = (sz_u8_t const *)text;
+    sz_u8_t const *const end = current + length;
+    sz_rune_t *const runes_start = runes;
+    __m512i const payload_mask_vec = _mm512_set1_epi32(0x3F);
+    sz_u512_vec_t text_vec;
+
+    // All the stores are 64 bytes wide, but never reach past the first `length` runes of the output.
+    while (end - current >= 19) {
+        // Pure ASCII blocks are just widened.
+        if (end - current >= 64) {
+            text_vec.zmm = _mm512_loadu_si512(current);
+            if (_mm512_movepi8_mask(text_vec.zmm) == 0) {
+                _mm512_storeu_si512(runes + 0, _mm512_cvtepu8_epi32(text_vec.xmms[0]));
+                _mm512_storeu_si512(runes + 16, _mm512_cvtepu8_epi32(text_vec.xmms[1]));
+                _mm512_storeu_si512(runes + 32, _mm512_cvtepu8_epi32(text_vec.xmms[2]));
+                _mm512_storeu_si512(runes + 48, _mm512_cvtepu8_epi32(text_vec.xmms[3]));
+                current += 64, runes += 64;
+                continue;
+            }
+        }
+
+        __m512i const lead_vec = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i const *)(current + 0)));
+        __m512i const first_vec = _mm512_and_si512(
+            _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i const *)(current + 1))), payload_mask_vec);
+        __m512i const second_vec = _mm512_and_si512(
+            _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i const *)(current + 2))), payload_mask_vec);
+        __m512i const third_vec = _mm512_and_si512(
+            _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i const *)(current + 3))), payload_mask_vec);
+
+        // Assemble the 2-, 3-, and 4-byte runes, and pick the right one for every leading byte.
+        __m512i const two_bytes_vec =
+            _mm512_or_si512(_mm512_slli_epi32(_mm512_and_si512(lead_vec, _mm512_set1_epi32(0x1F)), 6), first_vec);
+        __m512i const tail_vec = _mm512_or_si512(_mm512_slli_epi32(first_vec, 6), second_vec);
+        __m512i const three_bytes_vec =
+            _mm512_or_si512(_mm512_slli_epi32(_mm512_and_si512(lead_vec, _mm512_set1_epi32(0x0F)), 12), tail_vec);
+        __m512i const four_bytes_vec =
+            _mm512_or_si512(_mm512_slli_epi32(_mm512_and_si512(lead_vec, _mm512_set1_epi32(0x07)), 18),
+                            _mm512_or_si512(_mm512_slli_epi32(tail_vec, 6), third_vec));
+        __m512i runes_vec = four_bytes_vec;
+        runes_vec = _mm512_mask_mov_epi32(runes_vec, _mm512_cmplt_epu32_mask(lead_vec, _mm512_set1_epi32(0xF0)),
+                                          three_bytes_vec);
+        runes_vec = _mm512_mask_mov_epi32(runes_vec, _mm512_cmplt_epu32_mask(lead_vec, _mm512_set1_epi32(0xE0)),
+                                          two_bytes_vec);
+        runes_vec =
+            _mm512_mask_mov_epi32(runes_vec, _mm512_cmplt_epu32_mask(lead_vec, _mm512_set1_epi32(0x80)), lead_vec);
+
+        // The continuation bytes don't start new runes.
+        __mmask16 const leads = (__mmask16)~_mm512_cmpeq_epi32_mask(
+            _mm512_and_si512(lead_vec, _mm512_set1_epi32(0xC0)), _mm512_set1_epi32(0x80));
+        _mm512_storeu_si512(runes, _mm512_maskz_compress_epi32(leads, runes_vec));
+        runes += sz_u64_popcount(leads);
+        current += 16;
+    }
+
+    runes += sz_utf8_to_utf32_serial((sz_cptr_t)current, (sz_size_t)(end - current), runes);
+    return (sz_size_t)(runes - runes_start);
+}
+
+SZ_PUBLIC sz_cptr_t sz_utf8_find_nth_avx512(sz_cptr_t text, sz_size_t length, sz_size_t n) {
+    __m512i const continuation_max_vec = _mm512_set1_epi8((char)0xBF);
+    sz_u512_vec_t text_vec;
+    __mmask64 leads;
+    sz_size_t leads_count;
+
+    for (; length >= 64; text += 64, length -= 64) {
+        text_vec.zmm = _mm512_loadu_si512(text);
+        leads = _mm512_cmpgt_epi8_mask(text_vec.zmm, continuation_max_vec);
+        leads_count = sz_u64_popcount(leads);
+        // Deposit a single bit into the position of the n-th set bit of the mask.
+        if (n < leads_count) return text + sz_u64_ctz(_pdep_u64(1ull << n, leads));
+        n -= leads_count;
+    }
+
+    __mmask64 const mask = _sz_u64_mask_until(length);
+    text_vec.zmm = _mm512_maskz_loadu_epi8(mask, text);
+    leads = _mm512_mask_cmpgt_epi8_mask(mask, text_vec.zmm, continuation_max_vec);
+    leads_count = sz_u64_popcount(leads);
+    if (n < leads_count) return text + sz_u64_ctz(_pdep_u64(1ull << n, leads));
+    return SZ_NULL_CHAR;
+}
+
+SZ_PUBLIC void sz_hashes_minhash_avx512(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t count,
+                                        sz_u32_t *signatures) {
+
+    for (sz_size_t i = 0; i != count; ++i) signatures[i] = 0xFFFFFFFFu;
+    if (length < window_length || !window_length) return;
+
+    _sz_hashes_rolling_t rolling;
+    _sz_hashes_rolling_init(&rolling, start, length, window_length);
+    sz_u64_t hashes[_SZ_HASHES_MINHASH_BATCH];
+    sz_u32_t multipliers_low[16], multipliers_high[16];
+    sz_u64_t addends[16];
+    sz_size_t hashes_count;
+
+    // Similar to AVX2, we multiply the 32-bit halves with `_mm512_mul_epu32`, but handle 16 signatures
+    // per iteration in two registers, and use masked loads and stores for the last incomplete block.
+    sz_u512_vec_t multipliers_low_vecs[2], multipliers_high_vecs[2], addends_vecs[2], minimums_vecs[2];
+    sz_u512_vec_t hash_low_vec, hash_high_vec, permuted_vec;
+    __mmask8 masks[2];
+    while ((hashes_count = _sz_hashes_rolling_fill(&rolling, hashes, _SZ_HASHES_MINHASH_BATCH))) {
+        for (sz_size_t first = 0; first < count; first += 16) {
+            sz_size_t const block_length = count - first < 16 ? count - first : 16;
+            for (sz_size_t i = 0; i != block_length; ++i)
+                _sz_hashes_minhash_seeds(first + i, &multipliers_low[i], &multipliers_high[i], &addends[i]);
+            for (sz_size_t half = 0; half != 2; ++half) {
+                sz_size_t const half_offset = half * 8;
+                sz_size_t const half_length =
+                    block_length > half_offset ? (block_length - half_offset < 8 ? block_length - half_offset : 8) : 0;
+                masks[half] = (__mmask8)_bzhi_u32(0xFFu, (unsigned)half_length);
+                multipliers_low_vecs[half].zmm =
+                    _mm512_cvtepu32_epi64(_mm256_maskz_loadu_epi32(masks[half], &multipliers_low[half_offset]));
+                multipliers_high_vecs[half].zmm =
+                    _mm512_cvtepu32_epi64(_mm256_maskz_loadu_epi32(masks[half], &multipliers_high[half_offset]));
+                addends_vecs[half].zmm = _mm512_maskz_loadu_epi64(masks[half], &addends[half_offset]);
+                minimums_vecs[half].zmm =
+                    _mm512_cvtepu32_epi64(_mm256_maskz_loadu_epi32(masks[half], &signatures[first + half_offset]));
+            }
+            for (sz_size_t j = 0; j != hashes_count; ++j) {
+                hash_low_vec.zmm = _mm512_set1_epi64((long long)hashes[j]);
+                hash_high_vec.zmm = _mm512_srli_epi64(hash_low_vec.zmm, 32);
+                for (sz_size_t half = 0; half != 2; ++half) {
+                    permuted_vec.zmm = _mm512_add_epi64(
+                        _mm512_add_epi64(_mm512_mul_epu32(multipliers_low_vecs[half].zmm, hash_low_vec.zmm),
+                                         _mm512_mul_epu32(multipliers_high_vecs[half].zmm, hash_high_vec.zmm)),
+                        addends_vecs[half].zmm);
+                    permuted_vec.zmm = _mm512_srli_epi64(permuted_vec.zmm, 32);
+                    minimums_vecs[half].zmm = _mm512_min_epu64(minimums_vecs[half].zmm, permuted_vec.zmm);
+                }
+            }
+            for (sz_size_t half = 0; half != 2; ++half)
+                _mm256_mask_storeu_epi32(&signatures[first + half * 8], masks[half],
+                                         _mm512_cvtepi64_epi32(minimums_vecs[half].zmm));
+        }
+    }
+}
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 
@@ -5390,7 +9833,7 @@ SZ_PUBLIC sz_u64_t sz_checksum_avx512(sz_cptr_t text, sz_size_t length) {
 
         // Now in the main loop, we can use non-temporal loads and stores,
         // performing the operation in both directions.
-        for (text += head_length; body_length >= 128; text += 64, text += 64, body_length -= 128) {
+        for (text += head_length; body_length >= 128; text += 64, body_length -= 128) {
             text_vec.zmm = _mm512_stream_load_si512((__m512i *)(text));
             sums_vec.zmm = _mm512_add_epi64(sums_vec.zmm, _mm512_sad_epu8(text_vec.zmm, _mm512_setzero_si512()));
             text_reversed_vec.zmm = _mm512_stream_load_si512((__m512i *)(text + body_length - 64));
@@ -5406,129 +9849,201 @@ SZ_PUBLIC sz_u64_t sz_checksum_avx512(sz_cptr_t text, sz_size_t length) {
     }
 }
 
+/**
+ *  @brief  Reduces the unsigned 64-bit lanes modulo `SZ_U64_MAX_PRIME`, like the `%` in `sz_hashes_serial`.
+ *          There are only 59 values between the prime and 2^64, so a conditional subtraction is enough.
+ */
+SZ_INTERNAL __m512i _sz_hashes_prime_mod_avx512(__m512i x) {
+    __m512i const prime_vec = _mm512_set1_epi64((long long)SZ_U64_MAX_PRIME);
+    return _mm512_mask_sub_epi64(x, _mm512_cmpge_epu64_mask(x, prime_vec), x, prime_vec);
+}
+
+/**
+ *  @brief  Loads the characters at the same ::offset of 8 consecutive runs of ::run_length bytes into 64-bit lanes.
+ */
+SZ_INTERNAL __m512i _sz_hashes_load_lanes_avx512(sz_u8_t const *text, sz_size_t run_length, sz_size_t offset) {
+    text += offset;
+    return _mm512_set_epi64(text[run_length * 7], text[run_length * 6], text[run_length * 5], text[run_length * 4],
+                            text[run_length * 3], text[run_length * 2], text[run_length * 1], text[0]);
+}
+
 SZ_PUBLIC void sz_hashes_avx512(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t step, //
                                 sz_hash_callback_t callback, void *callback_handle) {
 
     if (length < window_length || !window_length) return;
-    if (length < 4 * window_length) {
+
+    // Slice the windows into 8 contiguous runs, each a multiple of the `step` long, and slide over them in
+    // parallel, keeping the hashes of every run in a separate 64-bit lane. The last run serially continues
+    // over the remaining windows. Priming 8 windows at once doesn't pay off for short strings.
+    sz_size_t const windows = length - window_length + 1;
+    sz_size_t const step_mask = step - 1;
+    sz_size_t const windows_per_lane = (windows / 8) & ~step_mask;
+    if (windows_per_lane < window_length) {
         sz_hashes_serial(start, length, window_length, step, callback, callback_handle);
         return;
     }
+    sz_u8_t const *text = (sz_u8_t const *)start;
+    _sz_hashes_rolling_t rolling;
+    _sz_hashes_rolling_init(&rolling, start, length, window_length);
+
+    // Unlike AVX2, AVX-512 has unsigned comparisons and, with the DQ extension, 64-bit multiplications.
+    sz_u512_vec_t golden_ratio_vec, prime_power_low_vec, prime_power_high_vec;
+    sz_u512_vec_t base_low_vec, base_high_vec, shift_high_vec, byte_mask_vec;
+    golden_ratio_vec.zmm = _mm512_set1_epi64((long long)11400714819323198485ull);
+    prime_power_low_vec.zmm = _mm512_set1_epi64((long long)rolling.prime_power_low);
+    prime_power_high_vec.zmm = _mm512_set1_epi64((long long)rolling.prime_power_high);
+    base_low_vec.zmm = _mm512_set1_epi64(31);
+    base_high_vec.zmm = _mm512_set1_epi64(257);
+    shift_high_vec.zmm = _mm512_set1_epi64(77);
+    byte_mask_vec.zmm = _mm512_set1_epi64(0xFF);
+
+    // Compute the initial hash values for every one of the eight windows.
+    sz_u512_vec_t hash_low_vec, hash_high_vec, hash_mix_vec, chars_low_vec, chars_high_vec;
+    hash_low_vec.zmm = _mm512_setzero_si512();
+    hash_high_vec.zmm = _mm512_setzero_si512();
+    for (sz_size_t i = 0; i != window_length; ++i) {
+        chars_low_vec.zmm = _sz_hashes_load_lanes_avx512(text, windows_per_lane, i);
+        chars_high_vec.zmm = _mm512_and_si512(_mm512_add_epi64(chars_low_vec.zmm, shift_high_vec.zmm), //
+                                              byte_mask_vec.zmm);
+        hash_low_vec.zmm = _mm512_add_epi64(_mm512_mullo_epi64(hash_low_vec.zmm, base_low_vec.zmm), chars_low_vec.zmm);
+        hash_high_vec.zmm =
+            _mm512_add_epi64(_mm512_mullo_epi64(hash_high_vec.zmm, base_high_vec.zmm), chars_high_vec.zmm);
+        hash_low_vec.zmm = _sz_hashes_prime_mod_avx512(hash_low_vec.zmm);
+        hash_high_vec.zmm = _sz_hashes_prime_mod_avx512(hash_high_vec.zmm);
+    }
 
-    // Using AVX2, we can perform 4 long integer multiplications and additions within one register.
-    // So let's slice the entire string into 4 overlapping windows, to slide over them in parallel.
-    sz_size_t const max_hashes = length - window_length + 1;
-    sz_size_t const min_hashes_per_thread = max_hashes / 4; // At most one sequence can overlap between 2 threads.
-    sz_u8_t const *text_first = (sz_u8_t const *)start;
-    sz_u8_t const *text_second = text_first + min_hashes_per_thread;
-    sz_u8_t const *text_third = text_first + min_hashes_per_thread * 2;
-    sz_u8_t const *text_fourth = text_first + min_hashes_per_thread * 3;
-    sz_u8_t const *text_end = text_first + length;
-
-    // Broadcast the global constants into the registers.
-    // Both high and low hashes will work with the same prime and golden ratio.
-    sz_u512_vec_t prime_vec, golden_ratio_vec;
-    prime_vec.zmm = _mm512_set1_epi64(SZ_U64_MAX_PRIME);
-    golden_ratio_vec.zmm = _mm512_set1_epi64(11400714819323198485ull);
-
-    // Prepare the `prime ^ window_length` values, that we are going to use for modulo arithmetic.
-    sz_u64_t prime_power_low = 1, prime_power_high = 1;
-    for (sz_size_t i = 0; i + 1 < window_length; ++i)
-        prime_power_low = (prime_power_low * 31ull) % SZ_U64_MAX_PRIME,
-        prime_power_high = (prime_power_high * 257ull) % SZ_U64_MAX_PRIME;
-
-    // We will be evaluating 4 offsets at a time with 2 different hash functions.
-    // We can fit all those 8 state variables in each of the following ZMM registers.
-    sz_u512_vec_t base_vec, prime_power_vec, shift_vec;
-    base_vec.zmm = _mm512_set_epi64(31ull, 31ull, 31ull, 31ull, 257ull, 257ull, 257ull, 257ull);
-    shift_vec.zmm = _mm512_set_epi64(0ull, 0ull, 0ull, 0ull, 77ull, 77ull, 77ull, 77ull);
-    prime_power_vec.zmm = _mm512_set_epi64(prime_power_low, prime_power_low, prime_power_low, prime_power_low,
-                                           prime_power_high, prime_power_high, prime_power_high, prime_power_high);
-
-    // Compute the initial hash values for every one of the four windows.
-    sz_u512_vec_t hash_vec, chars_vec;
-    hash_vec.zmm = _mm512_setzero_si512();
-    for (sz_u8_t const *prefix_end = text_first + window_length; text_first < prefix_end;
-         ++text_first, ++text_second, ++text_third, ++text_fourth) {
-
-        // 1. Multiply the hashes by the base.
-        hash_vec.zmm = _mm512_mullo_epi64(hash_vec.zmm, base_vec.zmm);
-
-        // 2. Load the four characters from `text_first`, `text_first + max_hashes_per_thread`,
-        //   `text_first + max_hashes_per_thread * 2`, `text_first + max_hashes_per_thread * 3`...
-        chars_vec.zmm = _mm512_set_epi64(text_fourth[0], text_third[0], text_second[0], text_first[0], //
-                                         text_fourth[0], text_third[0], text_second[0], text_first[0]);
-        chars_vec.zmm = _mm512_add_epi8(chars_vec.zmm, shift_vec.zmm);
-
-        // 3. Add the incoming characters.
-        hash_vec.zmm = _mm512_add_epi64(hash_vec.zmm, chars_vec.zmm);
+    // Now repeat that operation for the remaining characters, discarding older characters.
+    for (sz_size_t i = 0; i != windows_per_lane; ++i) {
+        if (i) {
+            // 1. Discard the outgoing characters.
+            chars_low_vec.zmm = _sz_hashes_load_lanes_avx512(text, windows_per_lane, i - 1);
+            chars_high_vec.zmm = _mm512_and_si512(_mm512_add_epi64(chars_low_vec.zmm, shift_high_vec.zmm), //
+                                                  byte_mask_vec.zmm);
+            hash_low_vec.zmm =
+                _mm512_sub_epi64(hash_low_vec.zmm, _mm512_mullo_epi64(chars_low_vec.zmm, prime_power_low_vec.zmm));
+            hash_high_vec.zmm =
+                _mm512_sub_epi64(hash_high_vec.zmm, _mm512_mullo_epi64(chars_high_vec.zmm, prime_power_high_vec.zmm));
+
+            // 2. Multiply by the bases and add the incoming characters.
+            chars_low_vec.zmm = _sz_hashes_load_lanes_avx512(text, windows_per_lane, i + window_length - 1);
+            chars_high_vec.zmm = _mm512_and_si512(_mm512_add_epi64(chars_low_vec.zmm, shift_high_vec.zmm), //
+                                                  byte_mask_vec.zmm);
+            hash_low_vec.zmm =
+                _mm512_add_epi64(_mm512_mullo_epi64(hash_low_vec.zmm, base_low_vec.zmm), chars_low_vec.zmm);
+            hash_high_vec.zmm =
+                _mm512_add_epi64(_mm512_mullo_epi64(hash_high_vec.zmm, base_high_vec.zmm), chars_high_vec.zmm);
+            hash_low_vec.zmm = _sz_hashes_prime_mod_avx512(hash_low_vec.zmm);
+            hash_high_vec.zmm = _sz_hashes_prime_mod_avx512(hash_high_vec.zmm);
+        }
 
-        // 4. Compute the modulo. Assuming there are only 59 values between our prime
-        //    and the 2^64 value, we can simply compute the modulo by conditionally subtracting the prime.
-        hash_vec.zmm = _mm512_mask_blend_epi8(_mm512_cmpgt_epi64_mask(hash_vec.zmm, prime_vec.zmm), hash_vec.zmm,
-                                              _mm512_sub_epi64(hash_vec.zmm, prime_vec.zmm));
+        // 3. Mix the hashes into separate registers, keeping the rolling state intact.
+        if ((i & step_mask) == 0) {
+            hash_mix_vec.zmm = _mm512_xor_si512(_mm512_mullo_epi64(hash_low_vec.zmm, golden_ratio_vec.zmm),
+                                                _mm512_mullo_epi64(hash_high_vec.zmm, golden_ratio_vec.zmm));
+            for (sz_size_t lane = 0; lane != 8; ++lane)
+                callback((sz_cptr_t)(text + lane * windows_per_lane + i), window_length, hash_mix_vec.u64s[lane],
+                         callback_handle);
+        }
     }
 
-    // 5. Compute the hash mix, that will be used to index into the fingerprint.
-    //    This includes a serial step at the end.
-    sz_u512_vec_t hash_mix_vec;
-    hash_mix_vec.zmm = _mm512_mullo_epi64(hash_vec.zmm, golden_ratio_vec.zmm);
-    hash_mix_vec.ymms[0] = _mm256_xor_si256(_mm512_extracti64x4_epi64(hash_mix_vec.zmm, 1), //
-                                            _mm512_extracti64x4_epi64(hash_mix_vec.zmm, 0));
+    // Continue the last lane until the end of the string.
+    rolling.text = text + windows_per_lane * 8 - 1 + window_length;
+    rolling.hash_low = hash_low_vec.u64s[7], rolling.hash_high = hash_high_vec.u64s[7];
+    rolling.has_pending = sz_false_k;
+    _sz_hashes_rolling_resume(&rolling, windows_per_lane * 8 - 1, step, callback, callback_handle);
+}
 
-    callback((sz_cptr_t)text_first, window_length, hash_mix_vec.u64s[0], callback_handle);
-    callback((sz_cptr_t)text_second, window_length, hash_mix_vec.u64s[1], callback_handle);
-    callback((sz_cptr_t)text_third, window_length, hash_mix_vec.u64s[2], callback_handle);
-    callback((sz_cptr_t)text_fourth, window_length, hash_mix_vec.u64s[3], callback_handle);
+/**
+ *  @brief  AVX-512 variant of `_sz_hash_stripe_serial`, keeping all 8 lanes in a single register.
+ */
+SZ_INTERNAL __m512i _sz_hash_stripe_avx512(__m512i lanes, __m512i words, sz_size_t stripe_index) {
+    __m512i keys = _mm512_loadu_si512(_sz_hash_secret + (stripe_index & 7));
+    __m512i keyed = _mm512_xor_si512(words, keys);
+    __m512i products = _mm512_mul_epu32(keyed, _mm512_srli_epi64(keyed, 32));
+    lanes = _mm512_add_epi64(lanes, _mm512_add_epi64(products, words));
+    if ((stripe_index & 7) != 7) return lanes;
+    lanes = _mm512_xor_si512(lanes, _mm512_srli_epi64(lanes, 47));
+    lanes = _mm512_xor_si512(lanes, _mm512_loadu_si512(_sz_hash_secret + 8));
+    return _mm512_mullo_epi64(lanes, _mm512_set1_epi64(_sz_hash_scramble_prime));
+}
 
-    // Now repeat that operation for the remaining characters, discarding older characters.
-    sz_size_t cycle = 1;
-    sz_size_t step_mask = step - 1;
-    for (; text_fourth != text_end; ++text_first, ++text_second, ++text_third, ++text_fourth, ++cycle) {
-        // 0. Load again the four characters we are dropping, shift them, and subtract.
-        chars_vec.zmm = _mm512_set_epi64(text_fourth[-window_length], text_third[-window_length],
-                                         text_second[-window_length], text_first[-window_length], //
-                                         text_fourth[-window_length], text_third[-window_length],
-                                         text_second[-window_length], text_first[-window_length]);
-        chars_vec.zmm = _mm512_add_epi8(chars_vec.zmm, shift_vec.zmm);
-        hash_vec.zmm = _mm512_sub_epi64(hash_vec.zmm, _mm512_mullo_epi64(chars_vec.zmm, prime_power_vec.zmm));
-
-        // 1. Multiply the hashes by the base.
-        hash_vec.zmm = _mm512_mullo_epi64(hash_vec.zmm, base_vec.zmm);
-
-        // 2. Load the four characters from `text_first`, `text_first + max_hashes_per_thread`,
-        //   `text_first + max_hashes_per_thread * 2`, `text_first + max_hashes_per_thread * 3`.
-        chars_vec.zmm = _mm512_set_epi64(text_fourth[0], text_third[0], text_second[0], text_first[0], //
-                                         text_fourth[0], text_third[0], text_second[0], text_first[0]);
-        chars_vec.zmm = _mm512_add_epi8(chars_vec.zmm, shift_vec.zmm);
-
-        // ... and prefetch the next four characters into Level 2 or higher.
-        _mm_prefetch((sz_cptr_t)text_fourth + 1, _MM_HINT_T1);
-        _mm_prefetch((sz_cptr_t)text_third + 1, _MM_HINT_T1);
-        _mm_prefetch((sz_cptr_t)text_second + 1, _MM_HINT_T1);
-        _mm_prefetch((sz_cptr_t)text_first + 1, _MM_HINT_T1);
-
-        // 3. Add the incoming characters.
-        hash_vec.zmm = _mm512_add_epi64(hash_vec.zmm, chars_vec.zmm);
-
-        // 4. Compute the modulo. Assuming there are only 59 values between our prime
-        //    and the 2^64 value, we can simply compute the modulo by conditionally subtracting the prime.
-        hash_vec.zmm = _mm512_mask_blend_epi8(_mm512_cmpgt_epi64_mask(hash_vec.zmm, prime_vec.zmm), hash_vec.zmm,
-                                              _mm512_sub_epi64(hash_vec.zmm, prime_vec.zmm));
-
-        // 5. Compute the hash mix, that will be used to index into the fingerprint.
-        //    This includes a serial step at the end.
-        hash_mix_vec.zmm = _mm512_mullo_epi64(hash_vec.zmm, golden_ratio_vec.zmm);
-        hash_mix_vec.ymms[0] = _mm256_xor_si256(_mm512_extracti64x4_epi64(hash_mix_vec.zmm, 1), //
-                                                _mm512_castsi512_si256(hash_mix_vec.zmm));
-
-        if ((cycle & step_mask) == 0) {
-            callback((sz_cptr_t)text_first, window_length, hash_mix_vec.u64s[0], callback_handle);
-            callback((sz_cptr_t)text_second, window_length, hash_mix_vec.u64s[1], callback_handle);
-            callback((sz_cptr_t)text_third, window_length, hash_mix_vec.u64s[2], callback_handle);
-            callback((sz_cptr_t)text_fourth, window_length, hash_mix_vec.u64s[3], callback_handle);
+SZ_PUBLIC sz_u64_t sz_hash_avx512(sz_cptr_t start, sz_size_t length) {
+    if (length <= 16) {
+        __m128i text_xmm = _mm_maskz_loadu_epi8(_sz_u16_mask_until(length), start);
+        return _sz_hash_short((sz_u64_t)_mm_cvtsi128_si64(text_xmm), (sz_u64_t)_mm_extract_epi64(text_xmm, 1),
+                              length);
+    }
+
+    sz_u512_vec_t lanes_vec;
+    lanes_vec.zmm = _mm512_loadu_si512(_sz_hash_secret);
+    sz_size_t const full_stripes = (length - 1) / 64;
+    sz_size_t stripe_index = 0;
+    for (; stripe_index != full_stripes; ++stripe_index, start += 64)
+        lanes_vec.zmm = _sz_hash_stripe_avx512(lanes_vec.zmm, _mm512_loadu_si512(start), stripe_index);
+
+    // The masked load zero-pads the tail, just like the serial variant
+    __m512i tail = _mm512_maskz_loadu_epi8(_sz_u64_mask_until(length - full_stripes * 64), start);
+    lanes_vec.zmm = _sz_hash_stripe_avx512(lanes_vec.zmm, tail, stripe_index);
+    return _sz_hash_fold(lanes_vec.u64s, length);
+}
+
+SZ_PUBLIC void sz_hash_batch_avx512(sz_sequence_t const *sequence, sz_u64_t *hashes) {
+    sz_size_t const count = sequence->count;
+    sz_size_t group_start = 0;
+
+    // Every lane mirrors the `_sz_hash_short`, as long as all 8 strings are short.
+    __m512i const secret_low = _mm512_set1_epi64(_sz_hash_secret[0]);
+    __m512i const secret_high = _mm512_set1_epi64(_sz_hash_secret[1]);
+    __m512i const multiplier_low = _mm512_set1_epi64(0x9FB21C651E98DF25ull);
+    __m512i const multiplier_high = _mm512_set1_epi64(0xC2B2AE3D27D4EB4Full);
+    __m512i const multiplier_length = _mm512_set1_epi64(0x9E3779B97F4A7C15ull);
+    __m512i const avalanche_first = _mm512_set1_epi64(0xFF51AFD7ED558CCDull);
+    __m512i const avalanche_second = _mm512_set1_epi64(0xC4CEB9FE1A85EC53ull);
+
+    for (; group_start + 8 <= count; group_start += 8) {
+        sz_cptr_t starts[8];
+        sz_size_t lengths[8];
+        sz_size_t longest = 0;
+        for (sz_size_t lane = 0; lane != 8; ++lane) {
+            starts[lane] = sequence->get_start(sequence, group_start + lane);
+            lengths[lane] = sequence->get_length(sequence, group_start + lane);
+            longest = sz_max_of_two(longest, lengths[lane]);
         }
-    }
+        // Long strings are rare among the keys, and don't justify a separate vectorized path
+        if (longest > 16) {
+            for (sz_size_t lane = 0; lane != 8; ++lane)
+                hashes[group_start + lane] = sz_hash_avx512(starts[lane], lengths[lane]);
+            continue;
+        }
+        // Transpose the pairs of words with shuffles, as scalar stores would stall the following vector loads
+        __m128i texts[8];
+        for (sz_size_t lane = 0; lane != 8; ++lane)
+            texts[lane] = _mm_maskz_loadu_epi8(_sz_u16_mask_until(lengths[lane]), starts[lane]);
+        __m512i lows = _mm512_castsi128_si512(_mm_unpacklo_epi64(texts[0], texts[1]));
+        __m512i highs = _mm512_castsi128_si512(_mm_unpackhi_epi64(texts[0], texts[1]));
+        lows = _mm512_inserti64x2(lows, _mm_unpacklo_epi64(texts[2], texts[3]), 1);
+        highs = _mm512_inserti64x2(highs, _mm_unpackhi_epi64(texts[2], texts[3]), 1);
+        lows = _mm512_inserti64x2(lows, _mm_unpacklo_epi64(texts[4], texts[5]), 2);
+        highs = _mm512_inserti64x2(highs, _mm_unpackhi_epi64(texts[4], texts[5]), 2);
+        lows = _mm512_inserti64x2(lows, _mm_unpacklo_epi64(texts[6], texts[7]), 3);
+        highs = _mm512_inserti64x2(highs, _mm_unpackhi_epi64(texts[6], texts[7]), 3);
+        __m512i lengths_vec = _mm512_set_epi64(lengths[7], lengths[6], lengths[5], lengths[4], //
+                                               lengths[3], lengths[2], lengths[1], lengths[0]);
+        __m512i low_mixed = _mm512_mullo_epi64(_mm512_xor_si512(lows, secret_low), multiplier_low);
+        __m512i high_mixed = _mm512_mullo_epi64(_mm512_xor_si512(highs, secret_high), multiplier_high);
+        __m512i hash = _mm512_ternarylogic_epi64(low_mixed, _mm512_rol_epi64(high_mixed, 31),
+                                                 _mm512_mullo_epi64(lengths_vec, multiplier_length), 0x96);
+        hash = _mm512_xor_si512(hash, _mm512_srli_epi64(hash, 33));
+        hash = _mm512_mullo_epi64(hash, avalanche_first);
+        hash = _mm512_xor_si512(hash, _mm512_srli_epi64(hash, 33));
+        hash = _mm512_mullo_epi64(hash, avalanche_second);
+        hash = _mm512_xor_si512(hash, _mm512_srli_epi64(hash, 33));
+        _mm512_storeu_si512(hashes + group_start, hash);
+    }
+
+    for (; group_start != count; ++group_start)
+        hashes[group_start] =
+            sz_hash_avx512(sequence->get_start(sequence, group_start), sequence->get_length(sequence, group_start));
 }
 
 #pragma clang attribute pop
@@ -5767,6 +10282,40 @@ SZ_PUBLIC sz_cptr_t sz_rfind_charset_avx512(sz_cptr_t text, sz_size_t length, sz
     return sz_rfind_charset_serial(text, length, filter);
 }
 
+SZ_PUBLIC sz_size_t sz_find_all_charset_avx512(sz_cptr_t text, sz_size_t length, sz_charset_t const *filter,
+                                               sz_size_t *offsets, sz_size_t capacity) {
+
+    // Unzip the even and odd bytes of the set, same as in `sz_find_charset_avx512`.
+    sz_u512_vec_t filter_even_vec, filter_odd_vec;
+    __m256i filter_ymm = _mm256_lddqu_si256((__m256i const *)filter);
+    filter_even_vec.zmm = _mm512_broadcast_i32x4(_mm256_castsi256_si128( // broadcast __m128i to __m512i
+        _mm256_maskz_compress_epi8(0x55555555, filter_ymm)));
+    filter_odd_vec.zmm = _mm512_broadcast_i32x4(_mm256_castsi256_si128( // broadcast __m128i to __m512i
+        _mm256_maskz_compress_epi8(0xaaaaaaaa, filter_ymm)));
+
+    sz_u512_vec_t text_vec, lower_nibbles_vec, higher_nibbles_vec, bitset_vec, bitmask_vec, bitmask_lookup_vec;
+    bitmask_lookup_vec.zmm = _mm512_set_epi8(-128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1, //
+                                             -128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1, //
+                                             -128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1, //
+                                             -128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1);
+
+    sz_size_t count = 0;
+    for (sz_size_t i = 0; i < length && count != capacity; i += 64) {
+        __mmask64 load_mask = _sz_u64_mask_until(sz_min_of_two(length - i, 64));
+        text_vec.zmm = _mm512_maskz_loadu_epi8(load_mask, text + i);
+        lower_nibbles_vec.zmm = _mm512_and_si512(text_vec.zmm, _mm512_set1_epi8(0x0f));
+        higher_nibbles_vec.zmm = _mm512_and_si512(_mm512_srli_epi16(text_vec.zmm, 4), _mm512_set1_epi8(0x0f));
+        bitmask_vec.zmm = _mm512_shuffle_epi8(bitmask_lookup_vec.zmm, lower_nibbles_vec.zmm);
+        bitset_vec.zmm = _mm512_mask_blend_epi8(                              //
+            _mm512_cmplt_epi8_mask(lower_nibbles_vec.zmm, _mm512_set1_epi8(8)), //
+            _mm512_shuffle_epi8(filter_odd_vec.zmm, higher_nibbles_vec.zmm),    //
+            _mm512_shuffle_epi8(filter_even_vec.zmm, higher_nibbles_vec.zmm));
+        __mmask64 matches = _mm512_mask_test_epi8_mask(load_mask, bitset_vec.zmm, bitmask_vec.zmm);
+        count = _sz_find_all_export_avx512(matches, i, offsets, count, capacity);
+    }
+    return count;
+}
+
 /**
  *  Computes the Needleman Wunsch alignment score between two strings.
  *  The method uses 32-bit integers to accumulate the running score for every cell in the matrix.
@@ -6087,48 +10636,248 @@ typedef union sz_u128_vec_t {
     sz_u8_t u8s[16];
 } sz_u128_vec_t;
 
-SZ_INTERNAL sz_u64_t _sz_vreinterpretq_u8_u4(uint8x16_t vec) {
-    // Use `vshrn` to produce a bitmask, similar to `movemask` in SSE.
-    // https://community.arm.com/arm-community-blogs/b/infrastructure-solutions-blog/posts/porting-x86-vector-bitmask-optimizations-to-arm-neon
-    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(vec), 4)), 0) & 0x8888888888888888ull;
-}
+SZ_INTERNAL sz_u64_t _sz_vreinterpretq_u8_u4(uint8x16_t vec) {
+    // Use `vshrn` to produce a bitmask, similar to `movemask` in SSE.
+    // https://community.arm.com/arm-community-blogs/b/infrastructure-solutions-blog/posts/porting-x86-vector-bitmask-optimizations-to-arm-neon
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(vec), 4)), 0) & 0x8888888888888888ull;
+}
+
+SZ_PUBLIC sz_ordering_t sz_order_neon(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length) {
+    //! Before optimizing this, read the "Operations Not Worth Optimizing" in Contributions Guide:
+    //! https://github.com/ashvardanian/StringZilla/blob/main/CONTRIBUTING.md#general-performance-observations
+    return sz_order_serial(a, a_length, b, b_length);
+}
+
+SZ_PUBLIC sz_bool_t sz_equal_neon(sz_cptr_t a, sz_cptr_t b, sz_size_t length) {
+    sz_u128_vec_t a_vec, b_vec;
+    for (; length >= 16; a += 16, b += 16, length -= 16) {
+        a_vec.u8x16 = vld1q_u8((sz_u8_t const *)a);
+        b_vec.u8x16 = vld1q_u8((sz_u8_t const *)b);
+        uint8x16_t cmp = vceqq_u8(a_vec.u8x16, b_vec.u8x16);
+        if (vminvq_u8(cmp) != 255) { return sz_false_k; } // Check if all bytes match
+    }
+
+    // Handle remaining bytes
+    if (length) return sz_equal_serial(a, b, length);
+    return sz_true_k;
+}
+
+SZ_PUBLIC sz_u64_t sz_checksum_neon(sz_cptr_t text, sz_size_t length) {
+    uint64x2_t sum_vec = vdupq_n_u64(0);
+
+    // Process 16 bytes (128 bits) at a time
+    for (; length >= 16; text += 16, length -= 16) {
+        uint8x16_t vec = vld1q_u8((sz_u8_t const *)text);      // Load 16 bytes
+        uint16x8_t pairwise_sum1 = vpaddlq_u8(vec);            // Pairwise add lower and upper 8 bits
+        uint32x4_t pairwise_sum2 = vpaddlq_u16(pairwise_sum1); // Pairwise add 16-bit results
+        uint64x2_t pairwise_sum3 = vpaddlq_u32(pairwise_sum2); // Pairwise add 32-bit results
+        sum_vec = vaddq_u64(sum_vec, pairwise_sum3);           // Accumulate the sum
+    }
+
+    // Final reduction of `sum_vec` to a single scalar
+    sz_u64_t sum = vgetq_lane_u64(sum_vec, 0) + vgetq_lane_u64(sum_vec, 1);
+    if (length) sum += sz_checksum_serial(text, length);
+    return sum;
+}
+
+/**
+ *  @brief  NEON variant of `_sz_hash_stripe_serial`, keeping the 8 lanes in four registers.
+ */
+SZ_INTERNAL void _sz_hash_stripe_neon(uint64x2_t *lanes, sz_cptr_t stripe, sz_size_t stripe_index) {
+    sz_u64_t const *keys = _sz_hash_secret + (stripe_index & 7);
+    for (int quarter = 0; quarter != 4; ++quarter) {
+        uint64x2_t words = vreinterpretq_u64_u8(vld1q_u8((sz_u8_t const *)stripe + quarter * 16));
+        uint64x2_t keyed = veorq_u64(words, vld1q_u64(keys + quarter * 2));
+        uint64x2_t products = vmull_u32(vmovn_u64(keyed), vshrn_n_u64(keyed, 32));
+        lanes[quarter] = vaddq_u64(lanes[quarter], vaddq_u64(products, words));
+    }
+    if ((stripe_index & 7) != 7) return;
+    uint32x2_t const prime = vdup_n_u32((sz_u32_t)_sz_hash_scramble_prime);
+    for (int quarter = 0; quarter != 4; ++quarter) {
+        uint64x2_t lane = veorq_u64(lanes[quarter], vshrq_n_u64(lanes[quarter], 47));
+        lane = veorq_u64(lane, vld1q_u64(_sz_hash_secret + 8 + quarter * 2));
+        uint64x2_t low_products = vmull_u32(vmovn_u64(lane), prime);
+        uint64x2_t high_products = vmull_u32(vshrn_n_u64(lane, 32), prime);
+        lanes[quarter] = vaddq_u64(low_products, vshlq_n_u64(high_products, 32));
+    }
+}
+
+SZ_PUBLIC sz_u64_t sz_hash_neon(sz_cptr_t start, sz_size_t length) {
+    if (length <= 16) {
+        sz_u64_t low, high;
+        _sz_hash_load_short((sz_u8_t const *)start, length, &low, &high);
+        return _sz_hash_short(low, high, length);
+    }
+
+    uint64x2_t lanes[4];
+    for (int quarter = 0; quarter != 4; ++quarter) lanes[quarter] = vld1q_u64(_sz_hash_secret + quarter * 2);
+    sz_size_t const full_stripes = (length - 1) / 64;
+    sz_size_t stripe_index = 0;
+    for (; stripe_index != full_stripes; ++stripe_index, start += 64) _sz_hash_stripe_neon(lanes, start, stripe_index);
+
+    sz_u64_t tail[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    sz_copy_serial((sz_ptr_t)tail, start, length - full_stripes * 64);
+    _sz_hash_stripe_neon(lanes, (sz_cptr_t)tail, stripe_index);
+    for (int quarter = 0; quarter != 4; ++quarter) vst1q_u64(tail + quarter * 2, lanes[quarter]);
+    return _sz_hash_fold(tail, length);
+}
+
+/**
+ *  @brief  Reduces the unsigned 64-bit lanes modulo `SZ_U64_MAX_PRIME`, like the `%` in `sz_hashes_serial`.
+ *          There are only 59 values between the prime and 2^64, so a conditional subtraction is enough.
+ */
+SZ_INTERNAL uint64x2_t _sz_hashes_prime_mod_neon(uint64x2_t x) {
+    uint64x2_t const prime_vec = vdupq_n_u64(SZ_U64_MAX_PRIME);
+    return vsubq_u64(x, vandq_u64(vcgeq_u64(x, prime_vec), prime_vec));
+}
+
+/**
+ *  @brief  Multiplies the 64-bit lanes holding bytes by the 64-bit factor, split into 32-bit halves,
+ *          wrapping around like `sz_u64_t`. Arm has no 64-bit multiplications, but has widening 32-bit ones.
+ */
+SZ_INTERNAL uint64x2_t _sz_hashes_mul_byte_neon(uint64x2_t bytes, uint32x2_t factor_low, uint32x2_t factor_high) {
+    uint32x2_t bytes_narrow = vmovn_u64(bytes);
+    return vaddq_u64(vmull_u32(bytes_narrow, factor_low), vshlq_n_u64(vmull_u32(bytes_narrow, factor_high), 32));
+}
+
+/**
+ *  @brief  Loads the characters at the same ::offset of 2 consecutive runs of ::run_length bytes into 64-bit lanes.
+ */
+SZ_INTERNAL uint64x2_t _sz_hashes_load_lanes_neon(sz_u8_t const *text, sz_size_t run_length, sz_size_t offset) {
+    text += offset;
+    return vcombine_u64(vcreate_u64(text[0]), vcreate_u64(text[run_length]));
+}
+
+SZ_PUBLIC void sz_hashes_neon(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t step, //
+                              sz_hash_callback_t callback, void *callback_handle) {
+
+    if (length < window_length || !window_length) return;
+
+    // Slice the windows into 4 contiguous runs, each a multiple of the `step` long, and slide over them in
+    // parallel, keeping the hashes of every run in a separate 64-bit lane of 2 registers. The last run serially
+    // continues over the remaining windows. Priming 4 windows at once doesn't pay off for short strings.
+    sz_size_t const windows = length - window_length + 1;
+    sz_size_t const step_mask = step - 1;
+    sz_size_t const windows_per_lane = (windows / 4) & ~step_mask;
+    if (windows_per_lane < window_length) {
+        sz_hashes_serial(start, length, window_length, step, callback, callback_handle);
+        return;
+    }
+    sz_u8_t const *text = (sz_u8_t const *)start;
+    sz_u8_t const *text_halves[2] = {text, text + windows_per_lane * 2};
+    _sz_hashes_rolling_t rolling;
+    _sz_hashes_rolling_init(&rolling, start, length, window_length);
+
+    // The bases are just a shift and an addition away, and the outgoing characters are multiplied
+    // by the halves of the prime powers with the widening `vmull_u32`.
+    uint32x2_t const prime_power_low_vec = vdup_n_u32((sz_u32_t)rolling.prime_power_low);
+    uint32x2_t const prime_power_low_top_vec = vdup_n_u32((sz_u32_t)(rolling.prime_power_low >> 32));
+    uint32x2_t const prime_power_high_vec = vdup_n_u32((sz_u32_t)rolling.prime_power_high);
+    uint32x2_t const prime_power_high_top_vec = vdup_n_u32((sz_u32_t)(rolling.prime_power_high >> 32));
+    uint64x2_t const shift_high_vec = vdupq_n_u64(77), byte_mask_vec = vdupq_n_u64(0xFF);
+    sz_u64_t const golden_ratio = 11400714819323198485ull;
+
+    // Compute the initial hash values for every one of the four windows.
+    uint64x2_t hash_low_vecs[2], hash_high_vecs[2], chars_low_vec, chars_high_vec;
+    hash_low_vecs[0] = hash_low_vecs[1] = hash_high_vecs[0] = hash_high_vecs[1] = vdupq_n_u64(0);
+    for (sz_size_t i = 0; i != window_length; ++i) {
+        for (sz_size_t half = 0; half != 2; ++half) {
+            chars_low_vec = _sz_hashes_load_lanes_neon(text_halves[half], windows_per_lane, i);
+            chars_high_vec = vandq_u64(vaddq_u64(chars_low_vec, shift_high_vec), byte_mask_vec);
+            hash_low_vecs[half] = vsubq_u64(vshlq_n_u64(hash_low_vecs[half], 5), hash_low_vecs[half]);
+            hash_high_vecs[half] = vaddq_u64(vshlq_n_u64(hash_high_vecs[half], 8), hash_high_vecs[half]);
+            hash_low_vecs[half] = _sz_hashes_prime_mod_neon(vaddq_u64(hash_low_vecs[half], chars_low_vec));
+            hash_high_vecs[half] = _sz_hashes_prime_mod_neon(vaddq_u64(hash_high_vecs[half], chars_high_vec));
+        }
+    }
 
-SZ_PUBLIC sz_ordering_t sz_order_neon(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length) {
-    //! Before optimizing this, read the "Operations Not Worth Optimizing" in Contributions Guide:
-    //! https://github.com/ashvardanian/StringZilla/blob/main/CONTRIBUTING.md#general-performance-observations
-    return sz_order_serial(a, a_length, b, b_length);
-}
+    // Now repeat that operation for the remaining characters, discarding older characters.
+    for (sz_size_t i = 0; i != windows_per_lane; ++i) {
+        if (i) {
+            for (sz_size_t half = 0; half != 2; ++half) {
+                // 1. Discard the outgoing characters.
+                chars_low_vec = _sz_hashes_load_lanes_neon(text_halves[half], windows_per_lane, i - 1);
+                chars_high_vec = vandq_u64(vaddq_u64(chars_low_vec, shift_high_vec), byte_mask_vec);
+                hash_low_vecs[half] = vsubq_u64(
+                    hash_low_vecs[half],
+                    _sz_hashes_mul_byte_neon(chars_low_vec, prime_power_low_vec, prime_power_low_top_vec));
+                hash_high_vecs[half] = vsubq_u64(
+                    hash_high_vecs[half],
+                    _sz_hashes_mul_byte_neon(chars_high_vec, prime_power_high_vec, prime_power_high_top_vec));
+
+                // 2. Multiply by the bases and add the incoming characters.
+                chars_low_vec = _sz_hashes_load_lanes_neon(text_halves[half], windows_per_lane, i + window_length - 1);
+                chars_high_vec = vandq_u64(vaddq_u64(chars_low_vec, shift_high_vec), byte_mask_vec);
+                hash_low_vecs[half] = vsubq_u64(vshlq_n_u64(hash_low_vecs[half], 5), hash_low_vecs[half]);
+                hash_high_vecs[half] = vaddq_u64(vshlq_n_u64(hash_high_vecs[half], 8), hash_high_vecs[half]);
+                hash_low_vecs[half] = _sz_hashes_prime_mod_neon(vaddq_u64(hash_low_vecs[half], chars_low_vec));
+                hash_high_vecs[half] = _sz_hashes_prime_mod_neon(vaddq_u64(hash_high_vecs[half], chars_high_vec));
+            }
+        }
 
-SZ_PUBLIC sz_bool_t sz_equal_neon(sz_cptr_t a, sz_cptr_t b, sz_size_t length) {
-    sz_u128_vec_t a_vec, b_vec;
-    for (; length >= 16; a += 16, b += 16, length -= 16) {
-        a_vec.u8x16 = vld1q_u8((sz_u8_t const *)a);
-        b_vec.u8x16 = vld1q_u8((sz_u8_t const *)b);
-        uint8x16_t cmp = vceqq_u8(a_vec.u8x16, b_vec.u8x16);
-        if (vminvq_u8(cmp) != 255) { return sz_false_k; } // Check if all bytes match
+        // 3. Mix the hashes, keeping the rolling state intact. Without 64-bit vector multiplications,
+        //    it's cheaper to do in general-purpose registers.
+        if ((i & step_mask) == 0) {
+            sz_u64_t hashes_low[4], hashes_high[4];
+            vst1q_u64(hashes_low, hash_low_vecs[0]), vst1q_u64(hashes_low + 2, hash_low_vecs[1]);
+            vst1q_u64(hashes_high, hash_high_vecs[0]), vst1q_u64(hashes_high + 2, hash_high_vecs[1]);
+            for (sz_size_t lane = 0; lane != 4; ++lane)
+                callback((sz_cptr_t)(text + lane * windows_per_lane + i), window_length,
+                         (hashes_low[lane] * golden_ratio) ^ (hashes_high[lane] * golden_ratio), callback_handle);
+        }
     }
 
-    // Handle remaining bytes
-    if (length) return sz_equal_serial(a, b, length);
-    return sz_true_k;
+    // Continue the last lane until the end of the string.
+    rolling.text = text + windows_per_lane * 4 - 1 + window_length;
+    rolling.hash_low = vgetq_lane_u64(hash_low_vecs[1], 1), rolling.hash_high = vgetq_lane_u64(hash_high_vecs[1], 1);
+    rolling.has_pending = sz_false_k;
+    _sz_hashes_rolling_resume(&rolling, windows_per_lane * 4 - 1, step, callback, callback_handle);
 }
 
-SZ_PUBLIC sz_u64_t sz_checksum_neon(sz_cptr_t text, sz_size_t length) {
-    uint64x2_t sum_vec = vdupq_n_u64(0);
+SZ_PUBLIC void sz_hashes_minhash_neon(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t count,
+                                      sz_u32_t *signatures) {
 
-    // Process 16 bytes (128 bits) at a time
-    for (; length >= 16; text += 16, length -= 16) {
-        uint8x16_t vec = vld1q_u8((sz_u8_t const *)text);      // Load 16 bytes
-        uint16x8_t pairwise_sum1 = vpaddlq_u8(vec);            // Pairwise add lower and upper 8 bits
-        uint32x4_t pairwise_sum2 = vpaddlq_u16(pairwise_sum1); // Pairwise add 16-bit results
-        uint64x2_t pairwise_sum3 = vpaddlq_u32(pairwise_sum2); // Pairwise add 32-bit results
-        sum_vec = vaddq_u64(sum_vec, pairwise_sum3);           // Accumulate the sum
-    }
+    for (sz_size_t i = 0; i != count; ++i) signatures[i] = 0xFFFFFFFFu;
+    if (length < window_length || !window_length) return;
 
-    // Final reduction of `sum_vec` to a single scalar
-    sz_u64_t sum = vgetq_lane_u64(sum_vec, 0) + vgetq_lane_u64(sum_vec, 1);
-    if (length) sum += sz_checksum_serial(text, length);
-    return sum;
+    _sz_hashes_rolling_t rolling;
+    _sz_hashes_rolling_init(&rolling, start, length, window_length);
+    sz_u64_t hashes[_SZ_HASHES_MINHASH_BATCH];
+    sz_u32_t multipliers_low[4], multipliers_high[4];
+    sz_u64_t addends[4];
+    sz_size_t hashes_count;
+
+    // Arm has widening multiply-accumulate instructions, so the 64-bit sums of products are computed
+    // with `vmlal_u32`, and the narrowing shift `vshrn_n_u64` extracts their top halves in one go.
+    uint32x4_t multipliers_low_vec, multipliers_high_vec, minimums_vec;
+    uint64x2_t addends_low_vec, addends_high_vec, permuted_low_vec, permuted_high_vec;
+    uint32x4_t hash_low_vec, hash_high_vec;
+    while ((hashes_count = _sz_hashes_rolling_fill(&rolling, hashes, _SZ_HASHES_MINHASH_BATCH))) {
+        sz_size_t const count_vectorized = count - count % 4;
+        for (sz_size_t first = 0; first != count_vectorized; first += 4) {
+            for (sz_size_t i = 0; i != 4; ++i)
+                _sz_hashes_minhash_seeds(first + i, &multipliers_low[i], &multipliers_high[i], &addends[i]);
+            multipliers_low_vec = vld1q_u32(multipliers_low);
+            multipliers_high_vec = vld1q_u32(multipliers_high);
+            addends_low_vec = vld1q_u64(addends);
+            addends_high_vec = vld1q_u64(addends + 2);
+            minimums_vec = vld1q_u32(signatures + first);
+            for (sz_size_t j = 0; j != hashes_count; ++j) {
+                hash_low_vec = vdupq_n_u32((sz_u32_t)hashes[j]);
+                hash_high_vec = vdupq_n_u32((sz_u32_t)(hashes[j] >> 32));
+                permuted_low_vec =
+                    vmlal_u32(addends_low_vec, vget_low_u32(multipliers_low_vec), vget_low_u32(hash_low_vec));
+                permuted_low_vec =
+                    vmlal_u32(permuted_low_vec, vget_low_u32(multipliers_high_vec), vget_low_u32(hash_high_vec));
+                permuted_high_vec = vmlal_high_u32(addends_high_vec, multipliers_low_vec, hash_low_vec);
+                permuted_high_vec = vmlal_high_u32(permuted_high_vec, multipliers_high_vec, hash_high_vec);
+                minimums_vec = vminq_u32(
+                    minimums_vec, vcombine_u32(vshrn_n_u64(permuted_low_vec, 32), vshrn_n_u64(permuted_high_vec, 32)));
+            }
+            vst1q_u32(signatures + first, minimums_vec);
+        }
+        _sz_hashes_minhash_reduce_serial(hashes, hashes_count, count_vectorized, count, signatures);
+    }
 }
 
 SZ_PUBLIC void sz_copy_neon(sz_ptr_t target, sz_cptr_t source, sz_size_t length) {
@@ -6214,15 +10963,15 @@ SZ_PUBLIC void sz_look_up_transform_neon(sz_cptr_t source, sz_size_t length, sz_
     sz_u128_vec_t lookup_0_to_63_vec, lookup_64_to_127_vec, lookup_128_to_191_vec, lookup_192_to_255_vec;
     sz_u128_vec_t blended_0_to_255_vec;
 
-    // Process the head with serial code
+    // Process the head with serial code, shrinking the remaining length before the counter is consumed.
+    length -= head_length;
+    length -= tail_length;
     for (; head_length; target += 1, source += 1, head_length -= 1) *target = lut[*(sz_u8_t const *)source];
 
     // Table lookups on Arm are much simpler to use than on x86, as we can use the `vqtbl4q_u8` instruction
     // to perform a 4-table lookup in a single instruction. The XORs are used to adjust the lookup position
     // within each 64-byte range of the table.
     // Details on the 4-table lookup: https://lemire.me/blog/2019/07/23/arbitrary-byte-to-byte-maps-using-arm-neon/
-    length -= head_length;
-    length -= tail_length;
     for (; length >= 16; source += 16, target += 16, length -= 16) {
         source_vec.u8x16 = vld1q_u8((sz_u8_t const *)source);
         lookup_0_to_63_vec.u8x16 = vqtbl4q_u8(lut_0_to_63_vec, source_vec.u8x16);
@@ -6371,80 +11120,611 @@ SZ_PUBLIC sz_cptr_t sz_find_neon(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, s
         }
     }
 
-    return sz_find_serial(h, h_length, n, n_length);
+    return sz_find_serial(h, h_length, n, n_length);
+}
+
+SZ_PUBLIC sz_cptr_t sz_rfind_neon(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
+
+    // This almost never fires, but it's better to be safe than sorry.
+    if (h_length < n_length || !n_length) return SZ_NULL_CHAR;
+    if (n_length == 1) return sz_rfind_byte_neon(h, h_length, n);
+
+    // Pick the parts of the needle that are worth comparing.
+    sz_size_t offset_first, offset_mid, offset_last;
+    _sz_locate_needle_anomalies(n, n_length, &offset_first, &offset_mid, &offset_last);
+
+    // Will contain 4 bits per character.
+    sz_u64_t matches;
+    sz_u128_vec_t h_first_vec, h_mid_vec, h_last_vec, n_first_vec, n_mid_vec, n_last_vec, matches_vec;
+    n_first_vec.u8x16 = vld1q_dup_u8((sz_u8_t const *)&n[offset_first]);
+    n_mid_vec.u8x16 = vld1q_dup_u8((sz_u8_t const *)&n[offset_mid]);
+    n_last_vec.u8x16 = vld1q_dup_u8((sz_u8_t const *)&n[offset_last]);
+
+    sz_cptr_t h_reversed;
+    for (; h_length >= n_length + 16; h_length -= 16) {
+        h_reversed = h + h_length - n_length - 16 + 1;
+        h_first_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h_reversed + offset_first));
+        h_mid_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h_reversed + offset_mid));
+        h_last_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h_reversed + offset_last));
+        matches_vec.u8x16 = vandq_u8(                           //
+            vandq_u8(                                           //
+                vceqq_u8(h_first_vec.u8x16, n_first_vec.u8x16), //
+                vceqq_u8(h_mid_vec.u8x16, n_mid_vec.u8x16)),
+            vceqq_u8(h_last_vec.u8x16, n_last_vec.u8x16));
+        matches = _sz_vreinterpretq_u8_u4(matches_vec.u8x16);
+        while (matches) {
+            int potential_offset = sz_u64_clz(matches) / 4;
+            if (sz_equal(h + h_length - n_length - potential_offset, n, n_length))
+                return h + h_length - n_length - potential_offset;
+            sz_assert((matches & (1ull << (63 - potential_offset * 4))) != 0 &&
+                      "The bit must be set before we squash it");
+            matches &= ~(1ull << (63 - potential_offset * 4));
+        }
+    }
+
+    return sz_rfind_serial(h, h_length, n, n_length);
+}
+
+/**
+ *  @brief  Folds uppercase ASCII letters into lowercase, setting the 0x20 bit in the bytes of the "A-Z" range.
+ */
+SZ_INTERNAL uint8x16_t _sz_fold_ascii_neon(uint8x16_t text) {
+    uint8x16_t uppers = vcltq_u8(vsubq_u8(text, vdupq_n_u8('A')), vdupq_n_u8(26));
+    return vorrq_u8(text, vandq_u8(uppers, vdupq_n_u8(0x20)));
+}
+
+SZ_INTERNAL sz_bool_t _sz_equal_caseless_neon(sz_cptr_t a, sz_cptr_t b, sz_size_t length) {
+    sz_u128_vec_t a_vec, b_vec;
+    for (; length >= 16; a += 16, b += 16, length -= 16) {
+        a_vec.u8x16 = _sz_fold_ascii_neon(vld1q_u8((sz_u8_t const *)a));
+        b_vec.u8x16 = _sz_fold_ascii_neon(vld1q_u8((sz_u8_t const *)b));
+        if (vminvq_u8(vceqq_u8(a_vec.u8x16, b_vec.u8x16)) != 0xFF) return sz_false_k;
+    }
+    return _sz_equal_caseless_serial(a, b, length);
+}
+
+SZ_PUBLIC sz_cptr_t sz_find_caseless_neon(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
+
+    // This almost never fires, but it's better to be safe than sorry.
+    if (h_length < n_length || !n_length) return SZ_NULL_CHAR;
+
+    // Pick the parts of the needle that are worth comparing.
+    sz_size_t offset_first, offset_mid, offset_last;
+    _sz_locate_needle_anomalies(n, n_length, &offset_first, &offset_mid, &offset_last);
+
+    // Will contain 4 bits per character.
+    sz_u64_t matches;
+    sz_u128_vec_t h_first_vec, h_mid_vec, h_last_vec, n_first_vec, n_mid_vec, n_last_vec, matches_vec;
+    n_first_vec.u8x16 = vdupq_n_u8(_sz_u8_fold_ascii((sz_u8_t)n[offset_first]));
+    n_mid_vec.u8x16 = vdupq_n_u8(_sz_u8_fold_ascii((sz_u8_t)n[offset_mid]));
+    n_last_vec.u8x16 = vdupq_n_u8(_sz_u8_fold_ascii((sz_u8_t)n[offset_last]));
+
+    // Walk through the string, folding the haystack in-register.
+    for (; h_length >= n_length + 16; h += 16, h_length -= 16) {
+        h_first_vec.u8x16 = _sz_fold_ascii_neon(vld1q_u8((sz_u8_t const *)(h + offset_first)));
+        h_mid_vec.u8x16 = _sz_fold_ascii_neon(vld1q_u8((sz_u8_t const *)(h + offset_mid)));
+        h_last_vec.u8x16 = _sz_fold_ascii_neon(vld1q_u8((sz_u8_t const *)(h + offset_last)));
+        matches_vec.u8x16 = vandq_u8(                           //
+            vandq_u8(                                           //
+                vceqq_u8(h_first_vec.u8x16, n_first_vec.u8x16), //
+                vceqq_u8(h_mid_vec.u8x16, n_mid_vec.u8x16)),
+            vceqq_u8(h_last_vec.u8x16, n_last_vec.u8x16));
+        matches = _sz_vreinterpretq_u8_u4(matches_vec.u8x16);
+        while (matches) {
+            int potential_offset = sz_u64_ctz(matches) / 4;
+            if (n_length <= 3 || _sz_equal_caseless_neon(h + potential_offset, n, n_length))
+                return h + potential_offset;
+            matches &= ~(0xFull << (potential_offset * 4));
+        }
+    }
+
+    return sz_find_caseless_serial(h, h_length, n, n_length);
+}
+
+SZ_PUBLIC sz_cptr_t sz_rfind_caseless_neon(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
+
+    // This almost never fires, but it's better to be safe than sorry.
+    if (h_length < n_length || !n_length) return SZ_NULL_CHAR;
+
+    // Pick the parts of the needle that are worth comparing.
+    sz_size_t offset_first, offset_mid, offset_last;
+    _sz_locate_needle_anomalies(n, n_length, &offset_first, &offset_mid, &offset_last);
+
+    // Will contain 4 bits per character.
+    sz_u64_t matches;
+    sz_u128_vec_t h_first_vec, h_mid_vec, h_last_vec, n_first_vec, n_mid_vec, n_last_vec, matches_vec;
+    n_first_vec.u8x16 = vdupq_n_u8(_sz_u8_fold_ascii((sz_u8_t)n[offset_first]));
+    n_mid_vec.u8x16 = vdupq_n_u8(_sz_u8_fold_ascii((sz_u8_t)n[offset_mid]));
+    n_last_vec.u8x16 = vdupq_n_u8(_sz_u8_fold_ascii((sz_u8_t)n[offset_last]));
+
+    // Walk through the string, folding the haystack in-register.
+    sz_cptr_t h_reversed;
+    for (; h_length >= n_length + 16; h_length -= 16) {
+        h_reversed = h + h_length - n_length - 16 + 1;
+        h_first_vec.u8x16 = _sz_fold_ascii_neon(vld1q_u8((sz_u8_t const *)(h_reversed + offset_first)));
+        h_mid_vec.u8x16 = _sz_fold_ascii_neon(vld1q_u8((sz_u8_t const *)(h_reversed + offset_mid)));
+        h_last_vec.u8x16 = _sz_fold_ascii_neon(vld1q_u8((sz_u8_t const *)(h_reversed + offset_last)));
+        matches_vec.u8x16 = vandq_u8(                           //
+            vandq_u8(                                           //
+                vceqq_u8(h_first_vec.u8x16, n_first_vec.u8x16), //
+                vceqq_u8(h_mid_vec.u8x16, n_mid_vec.u8x16)),
+            vceqq_u8(h_last_vec.u8x16, n_last_vec.u8x16));
+        matches = _sz_vreinterpretq_u8_u4(matches_vec.u8x16);
+        while (matches) {
+            int potential_offset = sz_u64_clz(matches) / 4;
+            if (n_length <= 3 ||
+                _sz_equal_caseless_neon(h + h_length - n_length - potential_offset, n, n_length))
+                return h + h_length - n_length - potential_offset;
+            matches &= ~(0xFull << (60 - potential_offset * 4));
+        }
+    }
+
+    return sz_rfind_caseless_serial(h, h_length, n, n_length);
+}
+
+SZ_PUBLIC sz_cptr_t sz_find_charset_neon(sz_cptr_t h, sz_size_t h_length, sz_charset_t const *set) {
+    sz_u64_t matches;
+    sz_u128_vec_t h_vec;
+    uint8x16_t set_top_vec_u8x16 = vld1q_u8(&set->_u8s[0]);
+    uint8x16_t set_bottom_vec_u8x16 = vld1q_u8(&set->_u8s[16]);
+
+    for (; h_length >= 16; h += 16, h_length -= 16) {
+        h_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h));
+        matches = _sz_find_charset_neon_register(h_vec, set_top_vec_u8x16, set_bottom_vec_u8x16);
+        if (matches) return h + sz_u64_ctz(matches) / 4;
+    }
+
+    return sz_find_charset_serial(h, h_length, set);
+}
+
+SZ_PUBLIC sz_cptr_t sz_rfind_charset_neon(sz_cptr_t h, sz_size_t h_length, sz_charset_t const *set) {
+    sz_u64_t matches;
+    sz_u128_vec_t h_vec;
+    uint8x16_t set_top_vec_u8x16 = vld1q_u8(&set->_u8s[0]);
+    uint8x16_t set_bottom_vec_u8x16 = vld1q_u8(&set->_u8s[16]);
+
+    // Check `sz_find_charset_neon` for explanations.
+    for (; h_length >= 16; h_length -= 16) {
+        h_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h) + h_length - 16);
+        matches = _sz_find_charset_neon_register(h_vec, set_top_vec_u8x16, set_bottom_vec_u8x16);
+        if (matches) return h + h_length - 1 - sz_u64_clz(matches) / 4;
+    }
+
+    return sz_rfind_charset_serial(h, h_length, set);
+}
+
+/**
+ *  @brief  Exports the offsets of the bytes flagged in the ::mask by `_sz_vreinterpretq_u8_u4`,
+ *          relative to the ::base, after the first ::count ones.
+ *  @return Total number of exported offsets, at most ::capacity.
+ */
+SZ_INTERNAL sz_size_t _sz_find_all_export_neon(sz_u64_t mask, sz_size_t base, sz_size_t *offsets, sz_size_t count,
+                                               sz_size_t capacity) {
+    if (!offsets) return sz_min_of_two(count + (sz_size_t)sz_u64_popcount(mask), capacity);
+    for (; mask && count != capacity; mask &= mask - 1) offsets[count++] = base + sz_u64_ctz(mask) / 4;
+    return count;
+}
+
+SZ_PUBLIC sz_size_t sz_find_all_neon(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length,
+                                     sz_bool_t allow_overlap, sz_size_t *offsets, sz_size_t capacity) {
+
+    // This almost never fires, but it's better to be safe than sorry.
+    if (h_length < n_length || !n_length) return 0;
+
+    sz_u64_t matches;
+    sz_size_t count = 0, i = 0;
+    if (n_length == 1) {
+        sz_u128_vec_t h_vec, n_vec;
+        n_vec.u8x16 = vld1q_dup_u8((sz_u8_t const *)n);
+        for (; i + 16 <= h_length && count != capacity; i += 16) {
+            h_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h + i));
+            matches = _sz_vreinterpretq_u8_u4(vceqq_u8(h_vec.u8x16, n_vec.u8x16));
+            count = _sz_find_all_export_neon(matches, i, offsets, count, capacity);
+        }
+        if (count == capacity) return count;
+        return _sz_find_all_resume_serial(h, h_length, i, n, n_length, allow_overlap, offsets, count, capacity);
+    }
+
+    // Pick the parts of the needle that are worth comparing.
+    // For needles of up to 3 bytes those cover every byte, and need no further verification.
+    sz_size_t offset_first, offset_mid, offset_last;
+    _sz_locate_needle_anomalies(n, n_length, &offset_first, &offset_mid, &offset_last);
+    sz_u128_vec_t h_first_vec, h_mid_vec, h_last_vec, n_first_vec, n_mid_vec, n_last_vec, matches_vec;
+    n_first_vec.u8x16 = vld1q_dup_u8((sz_u8_t const *)&n[offset_first]);
+    n_mid_vec.u8x16 = vld1q_dup_u8((sz_u8_t const *)&n[offset_mid]);
+    n_last_vec.u8x16 = vld1q_dup_u8((sz_u8_t const *)&n[offset_last]);
+
+    // Every match forbids the following candidates, that would overlap with it.
+    // Every byte is represented by 4 bits in the `matches` mask.
+    sz_size_t const skip_length = allow_overlap ? 1 : n_length;
+    sz_size_t next_offset = 0;
+    for (; i + n_length + 16 <= h_length && count != capacity; i += 16) {
+        h_first_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h + i + offset_first));
+        h_mid_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h + i + offset_mid));
+        h_last_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h + i + offset_last));
+        matches_vec.u8x16 = vandq_u8(                           //
+            vandq_u8(                                           //
+                vceqq_u8(h_first_vec.u8x16, n_first_vec.u8x16), //
+                vceqq_u8(h_mid_vec.u8x16, n_mid_vec.u8x16)),
+            vceqq_u8(h_last_vec.u8x16, n_last_vec.u8x16));
+        matches = _sz_vreinterpretq_u8_u4(matches_vec.u8x16);
+        if (next_offset > i) matches = next_offset - i >= 16 ? 0 : matches & (~0ull << ((next_offset - i) * 4));
+        while (matches && count != capacity) {
+            sz_size_t offset = i + sz_u64_ctz(matches) / 4;
+            if (n_length > 3 && !sz_equal(h + offset, n, n_length)) {
+                matches &= matches - 1;
+                continue;
+            }
+            if (offsets) offsets[count] = offset;
+            ++count;
+            next_offset = offset + skip_length;
+            matches = next_offset - i >= 16 ? 0 : matches & (~0ull << ((next_offset - i) * 4));
+        }
+    }
+
+    if (count == capacity) return count;
+    return _sz_find_all_resume_serial(h, h_length, sz_max_of_two(i, next_offset), n, n_length, allow_overlap,
+                                      offsets, count, capacity);
+}
+
+SZ_PUBLIC sz_size_t sz_find_all_charset_neon(sz_cptr_t text, sz_size_t length, sz_charset_t const *set,
+                                             sz_size_t *offsets, sz_size_t capacity) {
+    sz_u128_vec_t text_vec;
+    uint8x16_t set_top_vec_u8x16 = vld1q_u8(&set->_u8s[0]);
+    uint8x16_t set_bottom_vec_u8x16 = vld1q_u8(&set->_u8s[16]);
+
+    sz_size_t count = 0, i = 0;
+    for (; i + 16 <= length && count != capacity; i += 16) {
+        text_vec.u8x16 = vld1q_u8((sz_u8_t const *)(text + i));
+        sz_u64_t matches = _sz_find_charset_neon_register(text_vec, set_top_vec_u8x16, set_bottom_vec_u8x16);
+        count = _sz_find_all_export_neon(matches, i, offsets, count, capacity);
+    }
+
+    if (count == capacity) return count;
+    return _sz_find_all_charset_resume_serial(text, length, i, set, offsets, count, capacity);
+}
+
+/**
+ *  @brief  Classifies every byte of a 16-byte block, given the preceding block, with the nibble look-up tables
+ *          from ::_sz_utf8_lookup_tables. Any non-zero byte of the result signals an encoding error.
+ */
+SZ_INTERNAL uint8x16_t _sz_utf8_errors_neon(uint8x16_t input_vec, uint8x16_t previous_vec) {
+    uint8x16_t const first_high_lut_vec = vld1q_u8(_sz_utf8_lookup_tables[0]);
+    uint8x16_t const first_low_lut_vec = vld1q_u8(_sz_utf8_lookup_tables[1]);
+    uint8x16_t const second_high_lut_vec = vld1q_u8(_sz_utf8_lookup_tables[2]);
+
+    // Shift the input by 1, 2, and 3 bytes, pulling in the tail of the previous block.
+    uint8x16_t const previous_1_vec = vextq_u8(previous_vec, input_vec, 15);
+    uint8x16_t const previous_2_vec = vextq_u8(previous_vec, input_vec, 14);
+    uint8x16_t const previous_3_vec = vextq_u8(previous_vec, input_vec, 13);
+
+    uint8x16_t const first_high_vec = vqtbl1q_u8(first_high_lut_vec, vshrq_n_u8(previous_1_vec, 4));
+    uint8x16_t const first_low_vec = vqtbl1q_u8(first_low_lut_vec, vandq_u8(previous_1_vec, vdupq_n_u8(0x0F)));
+    uint8x16_t const second_high_vec = vqtbl1q_u8(second_high_lut_vec, vshrq_n_u8(input_vec, 4));
+    uint8x16_t const errors_vec = vandq_u8(vandq_u8(first_high_vec, first_low_vec), second_high_vec);
+
+    // The third and fourth bytes of 3- and 4-byte runes are the only places, where two continuations can follow.
+    uint8x16_t const third_vec = vqsubq_u8(previous_2_vec, vdupq_n_u8(0xE0 - 0x80));
+    uint8x16_t const fourth_vec = vqsubq_u8(previous_3_vec, vdupq_n_u8(0xF0 - 0x80));
+    uint8x16_t const expected_vec = vandq_u8(vorrq_u8(third_vec, fourth_vec), vdupq_n_u8(0x80));
+    return veorq_u8(errors_vec, expected_vec);
+}
+
+SZ_PUBLIC sz_bool_t sz_utf8_validate_neon(sz_cptr_t text, sz_size_t length) {
+    sz_u128_vec_t input_vec, previous_vec, errors_vec, complete_max_vec;
+    previous_vec.u8x16 = errors_vec.u8x16 = vdupq_n_u8(0);
+
+    // The largest values of the last three bytes of a block, that don't expect continuations in the next one.
+    complete_max_vec.u64s[0] = 0xFFFFFFFFFFFFFFFFull, complete_max_vec.u64s[1] = 0xBFDFEFFFFFFFFFFFull;
+
+    for (; length >= 16; text += 16, length -= 16) {
+        input_vec.u8x16 = vld1q_u8((sz_u8_t const *)text);
+        // ASCII blocks are only worth checking, if the previous block ended with an incomplete rune.
+        if (vmaxvq_u8(input_vec.u8x16) >= 0x80 || vmaxvq_u8(vcgtq_u8(previous_vec.u8x16, complete_max_vec.u8x16)))
+            errors_vec.u8x16 = vorrq_u8(errors_vec.u8x16, _sz_utf8_errors_neon(input_vec.u8x16, previous_vec.u8x16));
+        previous_vec.u8x16 = input_vec.u8x16;
+    }
+
+    // The tail is padded with zeros, which also catches the runes cut short by the end of the string.
+    input_vec.u8x16 = vdupq_n_u8(0);
+    for (sz_size_t i = 0; i != length; ++i) input_vec.u8s[i] = text[i];
+    errors_vec.u8x16 = vorrq_u8(errors_vec.u8x16, _sz_utf8_errors_neon(input_vec.u8x16, previous_vec.u8x16));
+    return (sz_bool_t)(vmaxvq_u8(errors_vec.u8x16) == 0);
+}
+
+SZ_PUBLIC sz_size_t sz_utf8_count_neon(sz_cptr_t text, sz_size_t length) {
+    // As signed integers, the continuation bytes are in [-128, -65], below all other bytes.
+    int8x16_t const continuation_max_vec = vdupq_n_s8(-65);
+    sz_u128_vec_t text_vec, counters_vec;
+    sz_size_t count = 0;
+
+    // Accumulate the 8-bit counters for up to 255 blocks, before widening them.
+    while (length >= 16) {
+        sz_size_t const blocks = sz_min_of_two(length / 16, 255);
+        counters_vec.u8x16 = vdupq_n_u8(0);
+        for (sz_size_t i = 0; i != blocks; ++i, text += 16) {
+            text_vec.u8x16 = vld1q_u8((sz_u8_t const *)text);
+            counters_vec.u8x16 = vsubq_u8(counters_vec.u8x16,
+                                          vcgtq_s8(vreinterpretq_s8_u8(text_vec.u8x16), continuation_max_vec));
+        }
+        count += vaddlvq_u8(counters_vec.u8x16);
+        length -= blocks * 16;
+    }
+    return count + sz_utf8_count_serial(text, length);
+}
+
+SZ_PUBLIC sz_size_t sz_utf8_to_utf32_neon(sz_cptr_t text, sz_size_t length, sz_rune_t *runes) {
+    sz_u8_t const *current = (sz_u8_t const *)text;
+    sz_u8_t const *const end = current + length;
+    sz_rune_t *const runes_start = runes;
+    sz_u128_vec_t text_vec, low_vec, high_vec;
+
+    for (; current + 16 <= end; current += 16) {
+        text_vec.u8x16 = vld1q_u8(current);
+        // Pure ASCII blocks are widened 4 bytes at a time, others are decoded serially.
+        if (vmaxvq_u8(text_vec.u8x16) < 0x80) {
+            low_vec.u16x8 = vmovl_u8(vget_low_u8(text_vec.u8x16));
+            high_vec.u16x8 = vmovl_u8(vget_high_u8(text_vec.u8x16));
+            vst1q_u32(runes + 0, vmovl_u16(vget_low_u16(low_vec.u16x8)));
+            vst1q_u32(runes + 4, vmovl_u16(vget_high_u16(low_vec.u16x8)));
+            vst1q_u32(runes + 8, vmovl_u16(vget_low_u16(high_vec.u16x8)));
+            vst1q_u32(runes + 12, vmovl_u16(vget_high_u16(high_vec.u16x8)));
+            runes += 16;
+        }
+        else {
+            for (sz_size_t i = 0; i != 16; ++i)
+                if (!_sz_utf8_is_continuation(current[i])) *runes++ = _sz_utf8_decode_lead(current + i, end);
+        }
+    }
+
+    runes += sz_utf8_to_utf32_serial((sz_cptr_t)current, (sz_size_t)(end - current), runes);
+    return (sz_size_t)(runes - runes_start);
+}
+
+SZ_PUBLIC sz_cptr_t sz_utf8_find_nth_neon(sz_cptr_t text, sz_size_t length, sz_size_t n) {
+    int8x16_t const continuation_max_vec = vdupq_n_s8(-65);
+    sz_u128_vec_t text_vec, leads_vec;
+
+    for (; length >= 16; text += 16, length -= 16) {
+        text_vec.u8x16 = vld1q_u8((sz_u8_t const *)text);
+        leads_vec.u8x16 = vcgtq_s8(vreinterpretq_s8_u8(text_vec.u8x16), continuation_max_vec);
+        sz_size_t const leads_count = vaddvq_u8(vandq_u8(leads_vec.u8x16, vdupq_n_u8(1)));
+        if (n < leads_count) return sz_utf8_find_nth_serial(text, 16, n);
+        n -= leads_count;
+    }
+    return sz_utf8_find_nth_serial(text, length, n);
+}
+
+/**
+ *  @brief  Computes the Needleman–Wunsch or Smith–Waterman score along the anti-diagonals of the matrix,
+ *          8 cells at a time, in saturating 16-bit arithmetic. Only exact if `_sz_alignment_score_fits_i16`.
+ *          Arm has no gather instructions, so the substitution costs are looked up serially.
+ *  @see    _sz_alignment_diagonals_init
+ */
+SZ_INTERNAL sz_ssize_t _sz_alignment_score_diagonals_i16_neon( //
+    sz_cptr_t longer, sz_size_t longer_length,                 //
+    sz_cptr_t shorter, sz_size_t shorter_length,               //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local, sz_ptr_t buffer) {
+
+    sz_u8_t const *longer_reversed, *shorter_copy;
+    sz_size_t const diagonal_length = _sz_alignment_diagonals_init( //
+        longer, longer_length, shorter, shorter_length, sizeof(sz_i16_t), buffer, &longer_reversed, &shorter_copy);
+    sz_i16_t *previous_scores = (sz_i16_t *)buffer;
+    sz_i16_t *current_scores = previous_scores + diagonal_length;
+    sz_i16_t *next_scores = current_scores + diagonal_length;
+
+    static sz_i16_t const lanes[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    int16x8_t const gap_vec = vdupq_n_s16(gap);
+    int16x8_t const zeros_vec = vdupq_n_s16(0);
+    int16x8_t const lanes_vec = vld1q_s16(lanes);
+    int16x8_t best_vec = zeros_vec, cells_vec;
+    sz_i8_t costs[8];
+
+    // The top-left corner of the matrix is the only cell on the zeroth anti-diagonal.
+    current_scores[0] = 0;
+    sz_size_t const diagonals_count = longer_length + shorter_length + 1;
+    for (sz_size_t diagonal = 1; diagonal != diagonals_count; ++diagonal) {
+        sz_size_t const first = diagonal > longer_length ? diagonal - longer_length : 1;
+        sz_size_t const last = sz_min_of_two(shorter_length, diagonal - 1);
+        for (sz_size_t j = first; j <= last; j += 8) {
+            sz_u8_t const *longer_slice = longer_reversed + longer_length - diagonal + j;
+            sz_u8_t const *shorter_slice = shorter_copy + j - 1;
+            for (int i = 0; i != 8; ++i) costs[i] = subs[longer_slice[i] * 256u + shorter_slice[i]];
+
+            int16x8_t diagonal_vec = vld1q_s16(previous_scores + j - 1);
+            int16x8_t top_vec = vld1q_s16(current_scores + j);
+            int16x8_t left_vec = vld1q_s16(current_scores + j - 1);
+            cells_vec = vmaxq_s16(vqaddq_s16(diagonal_vec, vmovl_s8(vld1_s8(costs))),
+                                  vqaddq_s16(vmaxq_s16(top_vec, left_vec), gap_vec));
+            if (local) {
+                cells_vec = vmaxq_s16(cells_vec, zeros_vec);
+                // Lanes past the end of the anti-diagonal contain garbage, that can't affect the best score.
+                uint16x8_t tail_vec = vcgtq_s16(lanes_vec, vdupq_n_s16((sz_i16_t)sz_min_of_two(last - j, 8)));
+                best_vec = vmaxq_s16(best_vec, vbicq_s16(cells_vec, vreinterpretq_s16_u16(tail_vec)));
+            }
+            vst1q_s16(next_scores + j, cells_vec);
+        }
+
+        // Populate the first row and the first column of the matrix, once the garbage lanes are written.
+        sz_i16_t const edge_score = local ? 0 : (sz_i16_t)((sz_ssize_t)diagonal * gap);
+        if (diagonal <= longer_length) next_scores[0] = edge_score;
+        if (diagonal <= shorter_length) next_scores[diagonal] = edge_score;
+
+        // Perform a circular rotation of those buffers, to reuse the memory.
+        sz_i16_t *temporary = previous_scores;
+        previous_scores = current_scores;
+        current_scores = next_scores;
+        next_scores = temporary;
+    }
+
+    return local ? vmaxvq_s16(best_vec) : current_scores[shorter_length];
 }
 
-SZ_PUBLIC sz_cptr_t sz_rfind_neon(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
+/**
+ *  @brief  Computes the Needleman–Wunsch or Smith–Waterman score along the anti-diagonals of the matrix,
+ *          4 cells at a time, in 32-bit arithmetic. Exact for strings with less than 2^24 bytes in total.
+ *  @see    _sz_alignment_diagonals_init
+ */
+SZ_INTERNAL sz_ssize_t _sz_alignment_score_diagonals_i32_neon( //
+    sz_cptr_t longer, sz_size_t longer_length,                 //
+    sz_cptr_t shorter, sz_size_t shorter_length,               //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local, sz_ptr_t buffer) {
+
+    sz_u8_t const *longer_reversed, *shorter_copy;
+    sz_size_t const diagonal_length = _sz_alignment_diagonals_init( //
+        longer, longer_length, shorter, shorter_length, sizeof(sz_i32_t), buffer, &longer_reversed, &shorter_copy);
+    sz_i32_t *previous_scores = (sz_i32_t *)buffer;
+    sz_i32_t *current_scores = previous_scores + diagonal_length;
+    sz_i32_t *next_scores = current_scores + diagonal_length;
+
+    static sz_i32_t const lanes[4] = {0, 1, 2, 3};
+    int32x4_t const gap_vec = vdupq_n_s32(gap);
+    int32x4_t const zeros_vec = vdupq_n_s32(0);
+    int32x4_t const lanes_vec = vld1q_s32(lanes);
+    int32x4_t best_vec = zeros_vec, cells_vec;
+    sz_i32_t costs[4];
+
+    // The top-left corner of the matrix is the only cell on the zeroth anti-diagonal.
+    current_scores[0] = 0;
+    sz_size_t const diagonals_count = longer_length + shorter_length + 1;
+    for (sz_size_t diagonal = 1; diagonal != diagonals_count; ++diagonal) {
+        sz_size_t const first = diagonal > longer_length ? diagonal - longer_length : 1;
+        sz_size_t const last = sz_min_of_two(shorter_length, diagonal - 1);
+        for (sz_size_t j = first; j <= last; j += 4) {
+            sz_u8_t const *longer_slice = longer_reversed + longer_length - diagonal + j;
+            sz_u8_t const *shorter_slice = shorter_copy + j - 1;
+            for (int i = 0; i != 4; ++i) costs[i] = subs[longer_slice[i] * 256u + shorter_slice[i]];
+
+            int32x4_t diagonal_vec = vld1q_s32(previous_scores + j - 1);
+            int32x4_t top_vec = vld1q_s32(current_scores + j);
+            int32x4_t left_vec = vld1q_s32(current_scores + j - 1);
+            cells_vec = vmaxq_s32(vaddq_s32(diagonal_vec, vld1q_s32(costs)),
+                                  vaddq_s32(vmaxq_s32(top_vec, left_vec), gap_vec));
+            if (local) {
+                cells_vec = vmaxq_s32(cells_vec, zeros_vec);
+                // Lanes past the end of the anti-diagonal contain garbage, that can't affect the best score.
+                uint32x4_t tail_vec = vcgtq_s32(lanes_vec, vdupq_n_s32((sz_i32_t)sz_min_of_two(last - j, 4)));
+                best_vec = vmaxq_s32(best_vec, vbicq_s32(cells_vec, vreinterpretq_s32_u32(tail_vec)));
+            }
+            vst1q_s32(next_scores + j, cells_vec);
+        }
 
-    // This almost never fires, but it's better to be safe than sorry.
-    if (h_length < n_length || !n_length) return SZ_NULL_CHAR;
-    if (n_length == 1) return sz_rfind_byte_neon(h, h_length, n);
+        // Populate the first row and the first column of the matrix, once the garbage lanes are written.
+        sz_i32_t const edge_score = local ? 0 : (sz_i32_t)((sz_ssize_t)diagonal * gap);
+        if (diagonal <= longer_length) next_scores[0] = edge_score;
+        if (diagonal <= shorter_length) next_scores[diagonal] = edge_score;
 
-    // Pick the parts of the needle that are worth comparing.
-    sz_size_t offset_first, offset_mid, offset_last;
-    _sz_locate_needle_anomalies(n, n_length, &offset_first, &offset_mid, &offset_last);
+        // Perform a circular rotation of those buffers, to reuse the memory.
+        sz_i32_t *temporary = previous_scores;
+        previous_scores = current_scores;
+        current_scores = next_scores;
+        next_scores = temporary;
+    }
 
-    // Will contain 4 bits per character.
-    sz_u64_t matches;
-    sz_u128_vec_t h_first_vec, h_mid_vec, h_last_vec, n_first_vec, n_mid_vec, n_last_vec, matches_vec;
-    n_first_vec.u8x16 = vld1q_dup_u8((sz_u8_t const *)&n[offset_first]);
-    n_mid_vec.u8x16 = vld1q_dup_u8((sz_u8_t const *)&n[offset_mid]);
-    n_last_vec.u8x16 = vld1q_dup_u8((sz_u8_t const *)&n[offset_last]);
+    return local ? vmaxvq_s32(best_vec) : current_scores[shorter_length];
+}
 
-    sz_cptr_t h_reversed;
-    for (; h_length >= n_length + 16; h_length -= 16) {
-        h_reversed = h + h_length - n_length - 16 + 1;
-        h_first_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h_reversed + offset_first));
-        h_mid_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h_reversed + offset_mid));
-        h_last_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h_reversed + offset_last));
-        matches_vec.u8x16 = vandq_u8(                           //
-            vandq_u8(                                           //
-                vceqq_u8(h_first_vec.u8x16, n_first_vec.u8x16), //
-                vceqq_u8(h_mid_vec.u8x16, n_mid_vec.u8x16)),
-            vceqq_u8(h_last_vec.u8x16, n_last_vec.u8x16));
-        matches = _sz_vreinterpretq_u8_u4(matches_vec.u8x16);
-        while (matches) {
-            int potential_offset = sz_u64_clz(matches) / 4;
-            if (sz_equal(h + h_length - n_length - potential_offset, n, n_length))
-                return h + h_length - n_length - potential_offset;
-            sz_assert((matches & (1ull << (63 - potential_offset * 4))) != 0 &&
-                      "The bit must be set before we squash it");
-            matches &= ~(1ull << (63 - potential_offset * 4));
-        }
+/**
+ *  @brief  Picks the narrowest exact anti-diagonal kernel for the pair of strings, reusing the `buffer`
+ *          of `_sz_alignment_diagonals_buffer_length` bytes.
+ */
+SZ_INTERNAL sz_ssize_t _sz_alignment_score_reusing_neon( //
+    sz_cptr_t longer, sz_size_t longer_length,           //
+    sz_cptr_t shorter, sz_size_t shorter_length,         //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local, sz_ptr_t buffer) {
+
+    // If one of the strings is empty - the edit distance is equal to the length of the other one
+    if (longer_length == 0) return local ? 0 : (sz_ssize_t)shorter_length * gap;
+    if (shorter_length == 0) return local ? 0 : (sz_ssize_t)longer_length * gap;
+
+    // Keep the same roles of the arguments, as in the serial variant.
+    if (shorter_length > longer_length) {
+        sz_pointer_swap((void **)&longer_length, (void **)&shorter_length);
+        sz_pointer_swap((void **)&longer, (void **)&shorter);
     }
 
-    return sz_rfind_serial(h, h_length, n, n_length);
+    if (_sz_alignment_score_fits_i16(longer, longer_length, shorter_length, subs, gap, local))
+        return _sz_alignment_score_diagonals_i16_neon(longer, longer_length, shorter, shorter_length, subs, gap,
+                                                      local, buffer);
+    else
+        return _sz_alignment_score_diagonals_i32_neon(longer, longer_length, shorter, shorter_length, subs, gap,
+                                                      local, buffer);
 }
 
-SZ_PUBLIC sz_cptr_t sz_find_charset_neon(sz_cptr_t h, sz_size_t h_length, sz_charset_t const *set) {
-    sz_u64_t matches;
-    sz_u128_vec_t h_vec;
-    uint8x16_t set_top_vec_u8x16 = vld1q_u8(&set->_u8s[0]);
-    uint8x16_t set_bottom_vec_u8x16 = vld1q_u8(&set->_u8s[16]);
+SZ_INTERNAL sz_ssize_t _sz_alignment_score_neon(     //
+    sz_cptr_t a, sz_size_t a_length,                 //
+    sz_cptr_t b, sz_size_t b_length,                 //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, //
+    sz_bool_t local, sz_memory_allocator_t *alloc) {
 
-    for (; h_length >= 16; h += 16, h_length -= 16) {
-        h_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h));
-        matches = _sz_find_charset_neon_register(h_vec, set_top_vec_u8x16, set_bottom_vec_u8x16);
-        if (matches) return h + sz_u64_ctz(matches) / 4;
+    // Tiny inputs aren't worth the setup, and huge ones may overflow the 32-bit lanes.
+    sz_size_t const shorter_length = sz_min_of_two(a_length, b_length);
+    sz_size_t const longer_length = sz_max_of_two(a_length, b_length);
+    if (shorter_length < 4 || longer_length + shorter_length >= 256ull * 256ull * 256ull)
+        return _sz_alignment_score_serial(a, a_length, b, b_length, subs, gap, local, alloc);
+
+    // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
     }
 
-    return sz_find_charset_serial(h, h_length, set);
+    sz_size_t const buffer_length = _sz_alignment_diagonals_buffer_length(longer_length, shorter_length);
+    sz_ptr_t const buffer = (sz_ptr_t)alloc->allocate(buffer_length, alloc->handle);
+    if (!buffer) return SZ_SSIZE_MAX;
+
+    // Cache scalar before `free` call.
+    sz_ssize_t result = _sz_alignment_score_reusing_neon(a, a_length, b, b_length, subs, gap, local, buffer);
+    alloc->free(buffer, buffer_length, alloc->handle);
+    return result;
 }
 
-SZ_PUBLIC sz_cptr_t sz_rfind_charset_neon(sz_cptr_t h, sz_size_t h_length, sz_charset_t const *set) {
-    sz_u64_t matches;
-    sz_u128_vec_t h_vec;
-    uint8x16_t set_top_vec_u8x16 = vld1q_u8(&set->_u8s[0]);
-    uint8x16_t set_bottom_vec_u8x16 = vld1q_u8(&set->_u8s[16]);
+SZ_PUBLIC sz_ssize_t sz_alignment_score_neon(         //
+    sz_cptr_t a, sz_size_t a_length,                  //
+    sz_cptr_t b, sz_size_t b_length,                  //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, //
+    sz_memory_allocator_t *alloc) {
+    return _sz_alignment_score_neon(a, a_length, b, b_length, subs, gap, sz_false_k, alloc);
+}
 
-    // Check `sz_find_charset_neon` for explanations.
-    for (; h_length >= 16; h_length -= 16) {
-        h_vec.u8x16 = vld1q_u8((sz_u8_t const *)(h) + h_length - 16);
-        matches = _sz_find_charset_neon_register(h_vec, set_top_vec_u8x16, set_bottom_vec_u8x16);
-        if (matches) return h + h_length - 1 - sz_u64_clz(matches) / 4;
+SZ_PUBLIC sz_ssize_t sz_local_alignment_score_neon(   //
+    sz_cptr_t a, sz_size_t a_length,                  //
+    sz_cptr_t b, sz_size_t b_length,                  //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, //
+    sz_memory_allocator_t *alloc) {
+    return _sz_alignment_score_neon(a, a_length, b, b_length, subs, gap, sz_true_k, alloc);
+}
+
+SZ_PUBLIC sz_bool_t sz_alignment_scores_neon(                                 //
+    sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates, //
+    sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local,        //
+    sz_memory_allocator_t *alloc, sz_ssize_t *scores) {
+
+    // Size the buffer for the longest candidate, so that it's allocated only once.
+    sz_size_t longest_candidate = 0;
+    for (sz_size_t i = 0; i != candidates->count; ++i)
+        longest_candidate = sz_max_of_two(longest_candidate, candidates->get_length(candidates, i));
+    if (query_length + longest_candidate >= 256ull * 256ull * 256ull)
+        return sz_alignment_scores_serial(query, query_length, candidates, subs, gap, local, alloc, scores);
+
+    // Simplify usage in higher-level libraries, where wrapping custom allocators may be troublesome.
+    sz_memory_allocator_t global_alloc;
+    if (!alloc) {
+        sz_memory_allocator_init_default(&global_alloc);
+        alloc = &global_alloc;
     }
 
-    return sz_rfind_charset_serial(h, h_length, set);
+    sz_size_t const buffer_length = _sz_alignment_diagonals_buffer_length(
+        sz_max_of_two(query_length, longest_candidate), sz_min_of_two(query_length, longest_candidate));
+    sz_ptr_t const buffer = (sz_ptr_t)alloc->allocate(buffer_length, alloc->handle);
+    if (!buffer) return sz_false_k;
+    for (sz_size_t i = 0; i != candidates->count; ++i)
+        scores[i] = _sz_alignment_score_reusing_neon(query, query_length, candidates->get_start(candidates, i),
+                                                     candidates->get_length(candidates, i), subs, gap, local,
+                                                     buffer);
+    alloc->free(buffer, buffer_length, alloc->handle);
+    return sz_true_k;
 }
 
 #pragma clang attribute pop
@@ -6460,6 +11740,8 @@ SZ_PUBLIC sz_cptr_t sz_rfind_charset_neon(sz_cptr_t h, sz_size_t h_length, sz_ch
  *      - memory: {copy, move, fill}
  *      - comparisons: {equal, order}
  *      - search: {substring, character, character set} x {forward, reverse}.
+ *      - transforms: {look-up table}
+ *      - hashing: {rolling hashes}
  */
 #pragma region ARM SVE
 
@@ -6570,6 +11852,116 @@ SZ_PUBLIC void sz_copy_sve(sz_ptr_t target, sz_cptr_t source, sz_size_t length)
     }
 }
 
+SZ_PUBLIC void sz_look_up_transform_sve(sz_cptr_t source, sz_size_t length, sz_cptr_t lut, sz_ptr_t target) {
+    sz_size_t const vec_len = svcntb(); // Vector length in bytes, a multiple of 16 up to 256
+
+#if SZ_USE_ARM_NEON
+    // The SVE `TBL` only looks up within a single register, so with the minimal 128-bit vectors we would
+    // need 16 lookups per vector, while the NEON `vqtbl4q_u8` covers 64 bytes of the table with one instruction.
+    if (vec_len < 32) {
+        sz_look_up_transform_neon(source, length, lut, target);
+        return;
+    }
+#endif
+
+    // Each `svtbl_u8` resolves the indices within a single vector-wide slice of the table, producing zeros
+    // for out-of-range indices. So we shift the indices by the slice offset and OR the partial results.
+    // That's 8 slices for 256-bit vectors, 4 slices for 512-bit, and just one for 2048-bit registers.
+    // Sizeless SVE types can't be stored in arrays, so the slices are re-loaded from L1 on every iteration.
+    // If the vector length is not a power of two, the last slice is loaded with a mask, zeroing the excess,
+    // so the wrapped-around indices select zeros as well.
+    // Unlike NEON and AVX-512, predicated loads and stores handle the tail without a serial fallback.
+    for (sz_size_t progress = 0; progress < length; progress += vec_len) {
+        svbool_t progress_mask = svwhilelt_b8_u64((sz_u64_t)progress, (sz_u64_t)length);
+        svuint8_t source_vec = svld1_u8(progress_mask, (sz_u8_t const *)source + progress);
+        svuint8_t result_vec = svdup_n_u8(0);
+        for (sz_size_t slice_offset = 0; slice_offset < 256; slice_offset += vec_len) {
+            svbool_t slice_mask = svwhilelt_b8_u64((sz_u64_t)slice_offset, (sz_u64_t)256);
+            svuint8_t slice_vec = svld1_u8(slice_mask, (sz_u8_t const *)lut + slice_offset);
+            svuint8_t indices_vec = svsub_n_u8_x(progress_mask, source_vec, (sz_u8_t)slice_offset);
+            result_vec = svorr_u8_x(progress_mask, result_vec, svtbl_u8(slice_vec, indices_vec));
+        }
+        svst1_u8(progress_mask, (sz_u8_t *)target + progress, result_vec);
+    }
+}
+
+/**
+ *  @brief  Reduces the unsigned 64-bit lanes modulo `SZ_U64_MAX_PRIME`, like the `%` in `sz_hashes_serial`.
+ *          There are only 59 values between the prime and 2^64, so a predicated subtraction is enough.
+ */
+SZ_INTERNAL svuint64_t _sz_hashes_prime_mod_sve(svbool_t mask, svuint64_t x) {
+    return svsub_n_u64_m(svcmpge_n_u64(mask, x, SZ_U64_MAX_PRIME), x, SZ_U64_MAX_PRIME);
+}
+
+SZ_PUBLIC void sz_hashes_sve(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_size_t step, //
+                             sz_hash_callback_t callback, void *callback_handle) {
+
+    if (length < window_length || !window_length) return;
+
+    // Slice the windows into as many contiguous runs as there are 64-bit lanes, each a multiple of the `step`
+    // long, and slide over them in parallel. The last run serially continues over the remaining windows.
+    // Unlike NEON, SVE has 64-bit multiplications, and gathers the characters of all runs in one instruction.
+    sz_size_t const lanes = svcntd(); // Between 2 and 32 lanes, depending on the CPU.
+    sz_size_t const windows = length - window_length + 1;
+    sz_size_t const step_mask = step - 1;
+    sz_size_t const windows_per_lane = (windows / lanes) & ~step_mask;
+    if (windows_per_lane < window_length) {
+        sz_hashes_serial(start, length, window_length, step, callback, callback_handle);
+        return;
+    }
+    sz_u8_t const *text = (sz_u8_t const *)start;
+    _sz_hashes_rolling_t rolling;
+    _sz_hashes_rolling_init(&rolling, start, length, window_length);
+
+    svbool_t const mask = svptrue_b64();
+    svuint64_t const offsets_vec = svindex_u64(0, windows_per_lane);
+    sz_u64_t const prime_power_low = rolling.prime_power_low, prime_power_high = rolling.prime_power_high;
+    sz_u64_t const golden_ratio = 11400714819323198485ull;
+
+    // Compute the initial hash values for every one of the windows.
+    svuint64_t hash_low_vec = svdup_n_u64(0), hash_high_vec = svdup_n_u64(0), chars_low_vec, chars_high_vec;
+    for (sz_size_t i = 0; i != window_length; ++i) {
+        chars_low_vec = svld1ub_gather_u64offset_u64(mask, text + i, offsets_vec);
+        chars_high_vec = svand_n_u64_x(mask, svadd_n_u64_x(mask, chars_low_vec, 77), 0xFF);
+        hash_low_vec = _sz_hashes_prime_mod_sve(mask, svmla_n_u64_x(mask, chars_low_vec, hash_low_vec, 31));
+        hash_high_vec = _sz_hashes_prime_mod_sve(mask, svmla_n_u64_x(mask, chars_high_vec, hash_high_vec, 257));
+    }
+
+    // Now repeat that operation for the remaining characters, discarding older characters.
+    sz_u64_t hashes_mixed[32];
+    for (sz_size_t i = 0; i != windows_per_lane; ++i) {
+        if (i) {
+            // 1. Discard the outgoing characters.
+            chars_low_vec = svld1ub_gather_u64offset_u64(mask, text + i - 1, offsets_vec);
+            chars_high_vec = svand_n_u64_x(mask, svadd_n_u64_x(mask, chars_low_vec, 77), 0xFF);
+            hash_low_vec = svmls_n_u64_x(mask, hash_low_vec, chars_low_vec, prime_power_low);
+            hash_high_vec = svmls_n_u64_x(mask, hash_high_vec, chars_high_vec, prime_power_high);
+
+            // 2. Multiply by the bases and add the incoming characters.
+            chars_low_vec = svld1ub_gather_u64offset_u64(mask, text + i + window_length - 1, offsets_vec);
+            chars_high_vec = svand_n_u64_x(mask, svadd_n_u64_x(mask, chars_low_vec, 77), 0xFF);
+            hash_low_vec = _sz_hashes_prime_mod_sve(mask, svmla_n_u64_x(mask, chars_low_vec, hash_low_vec, 31));
+            hash_high_vec = _sz_hashes_prime_mod_sve(mask, svmla_n_u64_x(mask, chars_high_vec, hash_high_vec, 257));
+        }
+
+        // 3. Mix the hashes into separate registers, keeping the rolling state intact.
+        if ((i & step_mask) == 0) {
+            svst1_u64(mask, hashes_mixed,
+                      sveor_u64_x(mask, svmul_n_u64_x(mask, hash_low_vec, golden_ratio),
+                                  svmul_n_u64_x(mask, hash_high_vec, golden_ratio)));
+            for (sz_size_t lane = 0; lane != lanes; ++lane)
+                callback((sz_cptr_t)(text + lane * windows_per_lane + i), window_length, hashes_mixed[lane],
+                         callback_handle);
+        }
+    }
+
+    // Continue the last lane until the end of the string.
+    rolling.text = text + windows_per_lane * lanes - 1 + window_length;
+    rolling.hash_low = svlastb_u64(mask, hash_low_vec), rolling.hash_high = svlastb_u64(mask, hash_high_vec);
+    rolling.has_pending = sz_false_k;
+    _sz_hashes_rolling_resume(&rolling, windows_per_lane * lanes - 1, step, callback, callback_handle);
+}
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // Arm SVE
@@ -6581,10 +11973,6 @@ SZ_PUBLIC void sz_copy_sve(sz_ptr_t target, sz_cptr_t source, sz_size_t length)
  */
 #pragma region Compile - Time Dispatching
 
-SZ_PUBLIC sz_u64_t sz_hash(sz_cptr_t ins, sz_size_t length) { return sz_hash_serial(ins, length); }
-SZ_PUBLIC void sz_tolower(sz_cptr_t ins, sz_size_t length, sz_ptr_t outs) { sz_tolower_serial(ins, length, outs); }
-SZ_PUBLIC void sz_toupper(sz_cptr_t ins, sz_size_t length, sz_ptr_t outs) { sz_toupper_serial(ins, length, outs); }
-SZ_PUBLIC void sz_toascii(sz_cptr_t ins, sz_size_t length, sz_ptr_t outs) { sz_toascii_serial(ins, length, outs); }
 SZ_PUBLIC sz_bool_t sz_isascii(sz_cptr_t ins, sz_size_t length) { return sz_isascii_serial(ins, length); }
 
 SZ_PUBLIC void sz_hashes_fingerprint(sz_cptr_t start, sz_size_t length, sz_size_t window_length, sz_ptr_t fingerprint,
@@ -6606,6 +11994,83 @@ SZ_PUBLIC void sz_hashes_fingerprint(sz_cptr_t start, sz_size_t length, sz_size_
 
 #if !SZ_DYNAMIC_DISPATCH
 
+SZ_DYNAMIC sz_u64_t sz_hash(sz_cptr_t text, sz_size_t length) {
+#if SZ_USE_X86_AVX512
+    return sz_hash_avx512(text, length);
+#elif SZ_USE_X86_AVX2
+    return sz_hash_avx2(text, length);
+#elif SZ_USE_ARM_NEON
+    return sz_hash_neon(text, length);
+#else
+    return sz_hash_serial(text, length);
+#endif
+}
+
+SZ_DYNAMIC void sz_hash_batch(sz_sequence_t const *sequence, sz_u64_t *hashes) {
+#if SZ_USE_X86_AVX512
+    sz_hash_batch_avx512(sequence, hashes);
+#else
+    for (sz_size_t i = 0; i != sequence->count; ++i)
+        hashes[i] = sz_hash(sequence->get_start(sequence, i), sequence->get_length(sequence, i));
+#endif
+}
+
+SZ_DYNAMIC void sz_sort(sz_sequence_t *sequence) { sz_sort_serial(sequence); }
+
+SZ_DYNAMIC void sz_sort_partial(sz_sequence_t *sequence, sz_size_t n) { sz_sort_partial_serial(sequence, n); }
+
+SZ_DYNAMIC void sz_sort_parallel(sz_sequence_t *sequence, sz_parallel_for_t parallel_for, void *executor) {
+    sz_sort_parallel_serial(sequence, parallel_for, executor);
+}
+
+SZ_DYNAMIC sz_bool_t sz_utf8_validate(sz_cptr_t text, sz_size_t length) {
+#if SZ_USE_X86_AVX512
+    return sz_utf8_validate_avx512(text, length);
+#elif SZ_USE_X86_AVX2
+    return sz_utf8_validate_avx2(text, length);
+#elif SZ_USE_ARM_NEON
+    return sz_utf8_validate_neon(text, length);
+#else
+    return sz_utf8_validate_serial(text, length);
+#endif
+}
+
+SZ_DYNAMIC sz_size_t sz_utf8_count(sz_cptr_t text, sz_size_t length) {
+#if SZ_USE_X86_AVX512
+    return sz_utf8_count_avx512(text, length);
+#elif SZ_USE_X86_AVX2
+    return sz_utf8_count_avx2(text, length);
+#elif SZ_USE_ARM_NEON
+    return sz_utf8_count_neon(text, length);
+#else
+    return sz_utf8_count_serial(text, length);
+#endif
+}
+
+SZ_DYNAMIC sz_size_t sz_utf8_to_utf32(sz_cptr_t text, sz_size_t length, sz_rune_t *runes) {
+#if SZ_USE_X86_AVX512
+    return sz_utf8_to_utf32_avx512(text, length, runes);
+#elif SZ_USE_X86_AVX2
+    return sz_utf8_to_utf32_avx2(text, length, runes);
+#elif SZ_USE_ARM_NEON
+    return sz_utf8_to_utf32_neon(text, length, runes);
+#else
+    return sz_utf8_to_utf32_serial(text, length, runes);
+#endif
+}
+
+SZ_DYNAMIC sz_cptr_t sz_utf8_find_nth(sz_cptr_t text, sz_size_t length, sz_size_t n) {
+#if SZ_USE_X86_AVX512
+    return sz_utf8_find_nth_avx512(text, length, n);
+#elif SZ_USE_X86_AVX2
+    return sz_utf8_find_nth_avx2(text, length, n);
+#elif SZ_USE_ARM_NEON
+    return sz_utf8_find_nth_neon(text, length, n);
+#else
+    return sz_utf8_find_nth_serial(text, length, n);
+#endif
+}
+
 SZ_DYNAMIC sz_u64_t sz_checksum(sz_cptr_t text, sz_size_t length) {
 #if SZ_USE_X86_AVX512
     return sz_checksum_avx512(text, length);
@@ -6683,6 +12148,8 @@ SZ_DYNAMIC void sz_look_up_transform(sz_cptr_t source, sz_size_t length, sz_cptr
     sz_look_up_transform_avx512(source, length, lut, target);
 #elif SZ_USE_X86_AVX2
     sz_look_up_transform_avx2(source, length, lut, target);
+#elif SZ_USE_ARM_SVE
+    sz_look_up_transform_sve(source, length, lut, target);
 #elif SZ_USE_ARM_NEON
     sz_look_up_transform_neon(source, length, lut, target);
 #else
@@ -6690,6 +12157,18 @@ SZ_DYNAMIC void sz_look_up_transform(sz_cptr_t source, sz_size_t length, sz_cptr
 #endif
 }
 
+SZ_DYNAMIC void sz_tolower(sz_cptr_t text, sz_size_t length, sz_ptr_t result) {
+    sz_look_up_transform(text, length, (sz_cptr_t)_sz_lut_lowered, result);
+}
+
+SZ_DYNAMIC void sz_toupper(sz_cptr_t text, sz_size_t length, sz_ptr_t result) {
+    sz_look_up_transform(text, length, (sz_cptr_t)_sz_lut_upped, result);
+}
+
+SZ_DYNAMIC void sz_toascii(sz_cptr_t text, sz_size_t length, sz_ptr_t result) {
+    sz_look_up_transform(text, length, (sz_cptr_t)_sz_lut_ascii, result);
+}
+
 SZ_DYNAMIC sz_cptr_t sz_find_byte(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle) {
 #if SZ_USE_X86_AVX512
     return sz_find_byte_avx512(haystack, h_length, needle);
@@ -6738,6 +12217,30 @@ SZ_DYNAMIC sz_cptr_t sz_rfind(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t
 #endif
 }
 
+SZ_DYNAMIC sz_cptr_t sz_find_caseless(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length) {
+#if SZ_USE_X86_AVX512
+    return sz_find_caseless_avx512(haystack, h_length, needle, n_length);
+#elif SZ_USE_X86_AVX2
+    return sz_find_caseless_avx2(haystack, h_length, needle, n_length);
+#elif SZ_USE_ARM_NEON
+    return sz_find_caseless_neon(haystack, h_length, needle, n_length);
+#else
+    return sz_find_caseless_serial(haystack, h_length, needle, n_length);
+#endif
+}
+
+SZ_DYNAMIC sz_cptr_t sz_rfind_caseless(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length) {
+#if SZ_USE_X86_AVX512
+    return sz_rfind_caseless_avx512(haystack, h_length, needle, n_length);
+#elif SZ_USE_X86_AVX2
+    return sz_rfind_caseless_avx2(haystack, h_length, needle, n_length);
+#elif SZ_USE_ARM_NEON
+    return sz_rfind_caseless_neon(haystack, h_length, needle, n_length);
+#else
+    return sz_rfind_caseless_serial(haystack, h_length, needle, n_length);
+#endif
+}
+
 SZ_DYNAMIC sz_cptr_t sz_find_charset(sz_cptr_t text, sz_size_t length, sz_charset_t const *set) {
 #if SZ_USE_X86_AVX512
     return sz_find_charset_avx512(text, length, set);
@@ -6762,6 +12265,48 @@ SZ_DYNAMIC sz_cptr_t sz_rfind_charset(sz_cptr_t text, sz_size_t length, sz_chars
 #endif
 }
 
+SZ_DYNAMIC sz_size_t sz_find_all(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length,
+                                 sz_bool_t allow_overlap, sz_size_t *offsets, sz_size_t capacity) {
+#if SZ_USE_X86_AVX512
+    return sz_find_all_avx512(haystack, h_length, needle, n_length, allow_overlap, offsets, capacity);
+#elif SZ_USE_X86_AVX2
+    return sz_find_all_avx2(haystack, h_length, needle, n_length, allow_overlap, offsets, capacity);
+#elif SZ_USE_ARM_NEON
+    return sz_find_all_neon(haystack, h_length, needle, n_length, allow_overlap, offsets, capacity);
+#else
+    return sz_find_all_serial(haystack, h_length, needle, n_length, allow_overlap, offsets, capacity);
+#endif
+}
+
+SZ_DYNAMIC sz_size_t sz_find_all_charset(sz_cptr_t text, sz_size_t length, sz_charset_t const *set, sz_size_t *offsets,
+                                         sz_size_t capacity) {
+#if SZ_USE_X86_AVX512
+    return sz_find_all_charset_avx512(text, length, set, offsets, capacity);
+#elif SZ_USE_X86_AVX2
+    return sz_find_all_charset_avx2(text, length, set, offsets, capacity);
+#elif SZ_USE_ARM_NEON
+    return sz_find_all_charset_neon(text, length, set, offsets, capacity);
+#else
+    return sz_find_all_charset_serial(text, length, set, offsets, capacity);
+#endif
+}
+
+SZ_DYNAMIC sz_size_t sz_count(sz_cptr_t haystack, sz_size_t h_length, sz_cptr_t needle, sz_size_t n_length,
+                              sz_bool_t allow_overlap) {
+    return sz_find_all(haystack, h_length, needle, n_length, allow_overlap, SZ_NULL, SZ_SIZE_MAX);
+}
+
+SZ_DYNAMIC sz_cptr_t sz_find_multi(sz_multi_matcher_t const *matcher, sz_cptr_t text, sz_size_t length,
+                                   sz_size_t *needle_index) {
+#if SZ_USE_X86_AVX512
+    return sz_find_multi_avx512(matcher, text, length, needle_index);
+#elif SZ_USE_X86_AVX2
+    return sz_find_multi_avx2(matcher, text, length, needle_index);
+#else
+    return sz_find_multi_serial(matcher, text, length, needle_index);
+#endif
+}
+
 SZ_DYNAMIC sz_size_t sz_hamming_distance( //
     sz_cptr_t a, sz_size_t a_length,      //
     sz_cptr_t b, sz_size_t b_length,      //
@@ -6787,6 +12332,15 @@ SZ_DYNAMIC sz_size_t sz_edit_distance( //
 #endif
 }
 
+SZ_DYNAMIC sz_bool_t sz_edit_distances(sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates,
+                                       sz_size_t bound, sz_memory_allocator_t *alloc, sz_size_t *distances) {
+#if SZ_USE_X86_AVX512
+    return sz_edit_distances_avx512(query, query_length, candidates, bound, alloc, distances);
+#else
+    return sz_edit_distances_serial(query, query_length, candidates, bound, alloc, distances);
+#endif
+}
+
 SZ_DYNAMIC sz_size_t sz_edit_distance_utf8( //
     sz_cptr_t a, sz_size_t a_length,        //
     sz_cptr_t b, sz_size_t b_length,        //
@@ -6797,24 +12351,69 @@ SZ_DYNAMIC sz_size_t sz_edit_distance_utf8( //
 SZ_DYNAMIC sz_ssize_t sz_alignment_score(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length,
                                          sz_error_cost_t const *subs, sz_error_cost_t gap,
                                          sz_memory_allocator_t *alloc) {
-#if SZ_USE_X86_AVX512
+#if SZ_USE_X86_AVX2
+    return sz_alignment_score_avx2(a, a_length, b, b_length, subs, gap, alloc);
+#elif SZ_USE_X86_AVX512
     return sz_alignment_score_avx512(a, a_length, b, b_length, subs, gap, alloc);
+#elif SZ_USE_ARM_NEON
+    return sz_alignment_score_neon(a, a_length, b, b_length, subs, gap, alloc);
 #else
     return sz_alignment_score_serial(a, a_length, b, b_length, subs, gap, alloc);
 #endif
 }
 
+SZ_DYNAMIC sz_ssize_t sz_local_alignment_score(sz_cptr_t a, sz_size_t a_length, sz_cptr_t b, sz_size_t b_length,
+                                               sz_error_cost_t const *subs, sz_error_cost_t gap,
+                                               sz_memory_allocator_t *alloc) {
+#if SZ_USE_X86_AVX2
+    return sz_local_alignment_score_avx2(a, a_length, b, b_length, subs, gap, alloc);
+#elif SZ_USE_ARM_NEON
+    return sz_local_alignment_score_neon(a, a_length, b, b_length, subs, gap, alloc);
+#else
+    return sz_local_alignment_score_serial(a, a_length, b, b_length, subs, gap, alloc);
+#endif
+}
+
+SZ_DYNAMIC sz_bool_t sz_alignment_scores(sz_cptr_t query, sz_size_t query_length, sz_sequence_t const *candidates,
+                                         sz_error_cost_t const *subs, sz_error_cost_t gap, sz_bool_t local,
+                                         sz_memory_allocator_t *alloc, sz_ssize_t *scores) {
+#if SZ_USE_X86_AVX2
+    return sz_alignment_scores_avx2(query, query_length, candidates, subs, gap, local, alloc, scores);
+#elif SZ_USE_ARM_NEON
+    return sz_alignment_scores_neon(query, query_length, candidates, subs, gap, local, alloc, scores);
+#else
+    return sz_alignment_scores_serial(query, query_length, candidates, subs, gap, local, alloc, scores);
+#endif
+}
+
 SZ_DYNAMIC void sz_hashes(sz_cptr_t text, sz_size_t length, sz_size_t window_length, sz_size_t window_step, //
                           sz_hash_callback_t callback, void *callback_handle) {
 #if SZ_USE_X86_AVX512
     sz_hashes_avx512(text, length, window_length, window_step, callback, callback_handle);
 #elif SZ_USE_X86_AVX2
     sz_hashes_avx2(text, length, window_length, window_step, callback, callback_handle);
+#elif SZ_USE_ARM_SVE
+    sz_hashes_sve(text, length, window_length, window_step, callback, callback_handle);
+#elif SZ_USE_ARM_NEON
+    sz_hashes_neon(text, length, window_length, window_step, callback, callback_handle);
 #else
     sz_hashes_serial(text, length, window_length, window_step, callback, callback_handle);
 #endif
 }
 
+SZ_DYNAMIC void sz_hashes_minhash(sz_cptr_t text, sz_size_t length, sz_size_t window_length, sz_size_t count, //
+                                  sz_u32_t *signatures) {
+#if SZ_USE_X86_AVX512
+    sz_hashes_minhash_avx512(text, length, window_length, count, signatures);
+#elif SZ_USE_X86_AVX2
+    sz_hashes_minhash_avx2(text, length, window_length, count, signatures);
+#elif SZ_USE_ARM_NEON
+    sz_hashes_minhash_neon(text, length, window_length, count, signatures);
+#else
+    sz_hashes_minhash_serial(text, length, window_length, count, signatures);
+#endif
+}
+
 SZ_DYNAMIC sz_cptr_t sz_find_char_from(sz_cptr_t h, sz_size_t h_length, sz_cptr_t n, sz_size_t n_length) {
     sz_charset_t set;
     sz_charset_init(&set);
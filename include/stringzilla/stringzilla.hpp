@@ -45,9 +45,12 @@
 #endif
 
 #if !SZ_AVOID_STL
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <bitset>
 #include <string>
+#include <thread>
 #include <vector>
 #if SZ_DETECT_CPP_17 && __cpp_lib_string_view
 #include <string_view>
@@ -58,7 +61,9 @@
 #include <cstddef>   // `std::size_t`
 #include <cstdint>   // `std::int8_t`
 #include <iosfwd>    // `std::basic_ostream`
+#include <new>       // `std::nothrow`
 #include <stdexcept> // `std::out_of_range`
+#include <tuple>     // `std::forward_as_tuple`
 #include <utility>   // `std::swap`
 
 #include <stringzilla/stringzilla.h>
@@ -111,6 +116,57 @@ inline void memcpy(void *target, void const *source, std::size_t n) noexcept {
     return sz_copy(reinterpret_cast<sz_ptr_t>(target), reinterpret_cast<sz_cptr_t>(source), n);
 }
 
+#if !SZ_AVOID_STL
+
+/**
+ *  @brief  Executor compatible with `sz_parallel_for_t`, spawning STL threads on every call.
+ *          The ::executor must point to the `std::size_t` number of threads to use, including the calling one.
+ *          If some threads can't be spawned, the work is completed by the remaining ones.
+ */
+inline void _parallel_for_std_threads(void *executor, sz_parallel_task_t task, void *context,
+                                      sz_size_t tasks_count) noexcept {
+    std::size_t threads_count = *reinterpret_cast<std::size_t const *>(executor);
+    if (threads_count > tasks_count) threads_count = tasks_count;
+
+    std::atomic<std::size_t> next_task {0};
+    auto worker = [&]() noexcept {
+        for (std::size_t i = next_task++; i < tasks_count; i = next_task++) task(context, i);
+    };
+
+    std::vector<std::thread> threads;
+    try {
+        threads.reserve(threads_count);
+        for (std::size_t i = 1; i < threads_count; ++i) threads.emplace_back(worker);
+    }
+    catch (...) {
+    }
+    worker();
+    for (std::thread &thread : threads) thread.join();
+}
+
+/**
+ *  @brief  Analog to @b `std::memset`, splitting huge buffers between multiple threads.
+ *  @param  threads The number of threads to use, including the calling one.
+ *  @see    sz_fill_parallel
+ */
+inline void memset(void *target, char value, std::size_t n, std::size_t threads) noexcept {
+    if (threads <= 1) return sz_fill(reinterpret_cast<sz_ptr_t>(target), n, value);
+    sz_fill_parallel(reinterpret_cast<sz_ptr_t>(target), n, value, &_parallel_for_std_threads, &threads);
+}
+
+/**
+ *  @brief  Analog to @b `std::memcpy`, splitting huge buffers between multiple threads.
+ *  @param  threads The number of threads to use, including the calling one.
+ *  @see    sz_copy_parallel
+ */
+inline void memcpy(void *target, void const *source, std::size_t n, std::size_t threads) noexcept {
+    if (threads <= 1) return sz_copy(reinterpret_cast<sz_ptr_t>(target), reinterpret_cast<sz_cptr_t>(source), n);
+    sz_copy_parallel(reinterpret_cast<sz_ptr_t>(target), reinterpret_cast<sz_cptr_t>(source), n,
+                     &_parallel_for_std_threads, &threads);
+}
+
+#endif // !SZ_AVOID_STL
+
 #pragma endregion
 
 #pragma region Character Sets
@@ -437,6 +493,46 @@ struct matcher_rfind {
     }
 };
 
+/**
+ *  @brief  Wrapper around the ::sz_find_caseless function, ignoring the case of ASCII letters.
+ *          Works with any string-like class exposing `data()` and `size()`, including STL views.
+ */
+template <typename string_type_, typename overlaps_type = include_overlaps_type>
+struct matcher_find_caseless {
+    using size_type = typename string_type_::size_type;
+    string_type_ needle_;
+
+    matcher_find_caseless(string_type_ needle = {}) noexcept : needle_(needle) {}
+    size_type needle_length() const noexcept { return needle_.length(); }
+    size_type operator()(string_type_ haystack) const noexcept {
+        sz_cptr_t match = sz_find_caseless(haystack.data(), haystack.size(), needle_.data(), needle_.size());
+        return match ? static_cast<size_type>(match - haystack.data()) : string_type_::npos;
+    }
+    size_type skip_length() const noexcept {
+        return std::is_same<overlaps_type, include_overlaps_type>() ? 1 : needle_.length();
+    }
+};
+
+/**
+ *  @brief  Wrapper around the ::sz_rfind_caseless function, ignoring the case of ASCII letters.
+ *          Works with any string-like class exposing `data()` and `size()`, including STL views.
+ */
+template <typename string_type_, typename overlaps_type = include_overlaps_type>
+struct matcher_rfind_caseless {
+    using size_type = typename string_type_::size_type;
+    string_type_ needle_;
+
+    matcher_rfind_caseless(string_type_ needle = {}) noexcept : needle_(needle) {}
+    size_type needle_length() const noexcept { return needle_.length(); }
+    size_type operator()(string_type_ haystack) const noexcept {
+        sz_cptr_t match = sz_rfind_caseless(haystack.data(), haystack.size(), needle_.data(), needle_.size());
+        return match ? static_cast<size_type>(match - haystack.data()) : string_type_::npos;
+    }
+    size_type skip_length() const noexcept {
+        return std::is_same<overlaps_type, include_overlaps_type>() ? 1 : needle_.length();
+    }
+};
+
 /**
  *  @brief  Zero-cost wrapper around the `.find_first_of` member function of string-like classes.
  */
@@ -485,6 +581,35 @@ struct matcher_find_last_not_of {
     size_type operator()(haystack_type haystack) const noexcept { return haystack.find_last_not_of(needles_); }
 };
 
+/**
+ *  @brief  Wrapper around the ::sz_find_multi function, locating the first of many compiled needles.
+ *          Unlike other matchers, the length of a match depends on the needle, so it's memorized with its index.
+ *  @see    basic_multi_matcher
+ */
+template <typename string_type_, typename overlaps_type = include_overlaps_type>
+struct matcher_find_multi {
+    using size_type = typename string_type_::size_type;
+    sz_multi_matcher_t const *matcher_;
+    mutable size_type needle_index_ = 0;
+    mutable size_type needle_length_ = 0;
+
+    matcher_find_multi(sz_multi_matcher_t const *matcher = nullptr) noexcept : matcher_(matcher) {}
+    size_type needle_index() const noexcept { return needle_index_; }
+    size_type needle_length() const noexcept { return needle_length_; }
+    size_type operator()(string_type_ haystack) const noexcept {
+        if (!matcher_) return string_type_::npos;
+        sz_size_t index = 0;
+        sz_cptr_t match = sz_find_multi(matcher_, haystack.data(), haystack.size(), &index);
+        if (!match) return string_type_::npos;
+        needle_index_ = static_cast<size_type>(index);
+        needle_length_ = static_cast<size_type>(matcher_->lengths[index]);
+        return static_cast<size_type>(match - haystack.data());
+    }
+    size_type skip_length() const noexcept {
+        return std::is_same<overlaps_type, include_overlaps_type>() ? 1 : needle_length_;
+    }
+};
+
 /**
  *  @brief  A range of string slices representing the matches of a substring search.
  *          Compatible with C++23 ranges, C++11 string views, and of course, StringZilla.
@@ -978,6 +1103,37 @@ range_rsplits<string, matcher_rfind<string, exclude_overlaps_type>> rsplit(strin
     return {h, n};
 }
 
+/**
+ *  @brief  Find all @b non-overlapping inclusions of a needle substring, ignoring the case of ASCII letters.
+ *  @tparam string  A string-like type, ideally a view, like StringZilla or STL `string_view`.
+ */
+template <typename string>
+range_matches<string, matcher_find_caseless<string, exclude_overlaps_type>> find_all_caseless(
+    string const &h, string const &n) noexcept {
+    return {h, n};
+}
+
+/**
+ *  @brief  Splits a string around every @b non-overlapping inclusion of the second string, ignoring the case.
+ *  @tparam string  A string-like type, ideally a view, like StringZilla or STL `string_view`.
+ */
+template <typename string>
+range_splits<string, matcher_find_caseless<string, exclude_overlaps_type>> split_caseless(string const &h,
+                                                                                          string const &n) noexcept {
+    return {h, n};
+}
+
+/**
+ *  @brief  Splits a string around every @b non-overlapping inclusion of the second string in @b reverse order,
+ *          ignoring the case of ASCII letters.
+ *  @tparam string  A string-like type, ideally a view, like StringZilla or STL `string_view`.
+ */
+template <typename string>
+range_rsplits<string, matcher_rfind_caseless<string, exclude_overlaps_type>> rsplit_caseless(
+    string const &h, string const &n) noexcept {
+    return {h, n};
+}
+
 /**
  *  @brief  Splits a string around every character from the second string.
  *  @tparam string  A string-like type, ideally a view, like StringZilla or STL `string_view`.
@@ -1066,6 +1222,135 @@ static bool _with_alloc(allocator_callback_ &&callback) noexcept {
 
 #pragma endregion
 
+#pragma region Arena Allocation
+
+/**
+ *  @brief  Growable monotonic arena, wrapping `sz_memory_arena_t`. Allocations are bump-pointer,
+ *          individual deallocations are mostly no-ops, and all the memory is reclaimed at once with `reset()`.
+ *          ! Not thread-safe, so use a separate arena per thread.
+ *  @see    arena_scope, arena_allocator
+ */
+class arena {
+    sz_memory_arena_t arena_;
+
+  public:
+    /**
+     *  @param  chunk_size  Capacity of the first chunk. Every next chunk is twice as large.
+     *  @param  upstream    Optional allocator for the chunks, defaults to `malloc` and `free`.
+     */
+    explicit arena(std::size_t chunk_size = 4096, sz_memory_allocator_t *upstream = nullptr) noexcept {
+        sz_memory_arena_init(&arena_, chunk_size, upstream);
+    }
+    ~arena() noexcept { sz_memory_arena_free(&arena_); }
+    arena(arena const &) = delete;
+    arena &operator=(arena const &) = delete;
+
+    void *allocate(std::size_t n) noexcept { return sz_memory_arena_allocate(&arena_, n); }
+    void deallocate(void *ptr, std::size_t n) noexcept { sz_memory_arena_deallocate(&arena_, ptr, n); }
+    bool owns(void const *ptr) const noexcept { return sz_memory_arena_owns(&arena_, ptr) == sz_true_k; }
+
+    /** @brief  Invalidates all the allocations, keeping only the largest chunk for reuse. */
+    void reset() noexcept { sz_memory_arena_reset(&arena_); }
+    /** @brief  Returns all the chunks to the upstream allocator. */
+    void release() noexcept { sz_memory_arena_free(&arena_); }
+
+    std::size_t used_bytes() const noexcept { return arena_.used_bytes; }
+    std::size_t peak_bytes() const noexcept { return arena_.peak_bytes; }
+    std::size_t chunks_count() const noexcept { return arena_.chunks_count; }
+
+    /** @brief  Exports the arena as a C allocator, to be passed to the C API. */
+    sz_memory_allocator_t allocator() noexcept {
+        sz_memory_allocator_t alloc;
+        sz_memory_allocator_init_arena(&alloc, &arena_);
+        return alloc;
+    }
+
+    sz_memory_arena_t &raw() noexcept { return arena_; }
+    sz_memory_arena_t const &raw() const noexcept { return arena_; }
+
+    /** @brief  The arena, installed for the current thread by the innermost `arena_scope`, or `nullptr`. */
+    static arena *current() noexcept { return current_(); }
+
+  private:
+    friend class arena_scope;
+    static arena *&current_() noexcept {
+        static thread_local arena *current = nullptr;
+        return current;
+    }
+};
+
+/**
+ *  @brief  RAII guard, making the arena the target of every `arena_allocator` on the current thread,
+ *          until the scope exits. Scopes can be nested, restoring the previous arena on exit.
+ */
+class arena_scope {
+    arena *previous_;
+
+  public:
+    explicit arena_scope(arena &target) noexcept : previous_(arena::current_()) { arena::current_() = &target; }
+    ~arena_scope() noexcept { arena::current_() = previous_; }
+    arena_scope(arena_scope const &) = delete;
+    arena_scope &operator=(arena_scope const &) = delete;
+};
+
+/**
+ *  @brief  Stateless allocator, drawing from the thread's current `arena`, if any, and from the global heap
+ *          otherwise. Being stateless, it can be used with `basic_string` and the other StringZilla templates.
+ *          Every block is prefixed with a pointer to its owning arena, so it's returned to the right place,
+ *          even if it's freed in a different or no `arena_scope` at all.
+ *          ! Objects, allocated within an `arena_scope`, must be destroyed before their `arena` is.
+ *          ! Objects, allocated outside of any scope, come from the heap and can be destroyed anywhere.
+ *  @see    arena_string
+ */
+template <typename type_>
+struct arena_allocator {
+    using value_type = type_;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    template <typename other_type_>
+    struct rebind {
+        using other = arena_allocator<other_type_>;
+    };
+
+    arena_allocator() noexcept = default;
+    template <typename other_type_>
+    arena_allocator(arena_allocator<other_type_> const &) noexcept {}
+
+    type_ *allocate(size_type n) const noexcept {
+        size_type const bytes = n * sizeof(type_) + header_size_k;
+        arena *owner = arena::current();
+        void *block = owner ? owner->allocate(bytes) : ::operator new(bytes, std::nothrow);
+        if (!block) return nullptr;
+        *static_cast<arena **>(block) = owner;
+        return reinterpret_cast<type_ *>(static_cast<char *>(block) + header_size_k);
+    }
+
+    void deallocate(type_ *ptr, size_type n) const noexcept {
+        if (!ptr) return;
+        void *block = reinterpret_cast<char *>(ptr) - header_size_k;
+        if (arena *owner = *static_cast<arena **>(block)) owner->deallocate(block, n * sizeof(type_) + header_size_k);
+        else
+            ::operator delete(block);
+    }
+
+    template <typename other_type_>
+    bool operator==(arena_allocator<other_type_> const &) const noexcept {
+        return true;
+    }
+    template <typename other_type_>
+    bool operator!=(arena_allocator<other_type_> const &) const noexcept {
+        return false;
+    }
+
+  private:
+    /// Room for the owning arena pointer, matching the 16-byte alignment of both the heap and the arena blocks.
+    static constexpr size_type header_size_k = 16;
+    static_assert(sizeof(arena *) <= header_size_k, "The owner pointer must fit into the block header");
+};
+
+#pragma endregion
+
 #pragma region Helper Template Classes
 
 /**
@@ -1653,6 +1938,25 @@ class basic_string_slice {
     /**  @brief  Find the last occurrence of a character from a set. */
     size_type rfind(char_set set) const noexcept { return find_last_of(set); }
 
+    /**
+     *  @brief  Find the first occurrence of a substring, ignoring the case of ASCII letters.
+     *          The behavior is @b undefined if `skip > size()`.
+     *  @return The offset of the first character of the match, or `npos` if not found.
+     */
+    size_type find_caseless(string_view other, size_type skip = 0) const noexcept {
+        auto ptr = sz_find_caseless(start_ + skip, length_ - skip, other.data(), other.size());
+        return ptr ? ptr - start_ : npos;
+    }
+
+    /**
+     *  @brief  Find the last occurrence of a substring, ignoring the case of ASCII letters.
+     *  @return The offset of the first character of the match, or `npos` if not found.
+     */
+    size_type rfind_caseless(string_view other) const noexcept {
+        auto ptr = sz_rfind_caseless(start_, length_, other.data(), other.size());
+        return ptr ? ptr - start_ : npos;
+    }
+
 #pragma endregion
 #pragma region Returning Partitions
 
@@ -1883,6 +2187,50 @@ class basic_string_slice {
     /**  @brief  Find all occurrences of given characters in @b reverse order. */
     rfind_all_chars_type rfind_all(char_set set) const noexcept { return {*this, {set}}; }
 
+    /**
+     *  @brief  Exports the offsets of up to `capacity` potentially @b overlapping occurrences of a given string.
+     *          Unlike iterating through the `find_all` range, doesn't restart the search after every match.
+     *  @return Number of exported offsets. If equal to `capacity`, the search can be continued past the last one.
+     */
+    size_type find_all(string_view needle, size_type *offsets, size_type capacity,
+                       include_overlaps_type = {}) const noexcept {
+        return sz_find_all(start_, length_, needle.data(), needle.size(), sz_true_k,
+                           reinterpret_cast<sz_size_t *>(offsets), capacity);
+    }
+
+    /**
+     *  @brief  Exports the offsets of up to `capacity` @b non-overlapping occurrences of a given string.
+     *  @return Number of exported offsets. If equal to `capacity`, the search can be continued past the last one.
+     */
+    size_type find_all(string_view needle, size_type *offsets, size_type capacity,
+                       exclude_overlaps_type) const noexcept {
+        return sz_find_all(start_, length_, needle.data(), needle.size(), sz_false_k,
+                           reinterpret_cast<sz_size_t *>(offsets), capacity);
+    }
+
+    /**
+     *  @brief  Exports the offsets of up to `capacity` occurrences of given characters.
+     *  @return Number of exported offsets. If equal to `capacity`, the search can be continued past the last one.
+     */
+    size_type find_all(char_set set, size_type *offsets, size_type capacity) const noexcept {
+        return sz_find_all_charset(start_, length_, &set.raw(), reinterpret_cast<sz_size_t *>(offsets), capacity);
+    }
+
+    /**  @brief  Counts all potentially @b overlapping occurrences of a given string. */
+    size_type count(string_view needle, include_overlaps_type = {}) const noexcept {
+        return sz_count(start_, length_, needle.data(), needle.size(), sz_true_k);
+    }
+
+    /**  @brief  Counts all @b non-overlapping occurrences of a given string. */
+    size_type count(string_view needle, exclude_overlaps_type) const noexcept {
+        return sz_count(start_, length_, needle.data(), needle.size(), sz_false_k);
+    }
+
+    /**  @brief  Counts all occurrences of given characters. */
+    size_type count(char_set set) const noexcept {
+        return sz_find_all_charset(start_, length_, &set.raw(), nullptr, SZ_SIZE_MAX);
+    }
+
     using split_type = range_splits<string_slice, matcher_find<string_view, exclude_overlaps_type>>;
     using rsplit_type = range_rsplits<string_slice, matcher_rfind<string_view, exclude_overlaps_type>>;
 
@@ -1904,6 +2252,20 @@ class basic_string_slice {
     /**  @brief  Split around the occurrences of all newline characters. */
     split_chars_type splitlines() const noexcept { return split(newlines_set()); }
 
+    using find_caseless_type = range_matches<string_slice, matcher_find_caseless<string_view, exclude_overlaps_type>>;
+    using split_caseless_type = range_splits<string_slice, matcher_find_caseless<string_view, exclude_overlaps_type>>;
+    using rsplit_caseless_type =
+        range_rsplits<string_slice, matcher_rfind_caseless<string_view, exclude_overlaps_type>>;
+
+    /**  @brief  Find all @b non-overlapping occurrences of a given string, ignoring the case of ASCII letters. */
+    find_caseless_type find_all_caseless(string_view needle) const noexcept { return {*this, needle}; }
+
+    /**  @brief  Split around occurrences of a given string, ignoring the case of ASCII letters. */
+    split_caseless_type split_caseless(string_view delimiter) const noexcept { return {*this, delimiter}; }
+
+    /**  @brief  Split around occurrences of a given string in @b reverse order, ignoring the case. */
+    rsplit_caseless_type rsplit_caseless(string_view delimiter) const noexcept { return {*this, delimiter}; }
+
 #pragma endregion
 
     /**  @brief  Hashes the string, equivalent to `std::hash<string_view>{}(str)`. */
@@ -2476,6 +2838,15 @@ class basic_string {
     bool contains(value_type character) const noexcept { return view().contains(character); }
     bool contains(const_pointer other) const noexcept { return view().contains(other); }
 
+    /**  @brief  Counts all potentially @b overlapping occurrences of a given string. */
+    size_type count(string_view needle, include_overlaps_type = {}) const noexcept { return view().count(needle); }
+
+    /**  @brief  Counts all @b non-overlapping occurrences of a given string. */
+    size_type count(string_view needle, exclude_overlaps_type tag) const noexcept { return view().count(needle, tag); }
+
+    /**  @brief  Counts all occurrences of given characters. */
+    size_type count(char_set set) const noexcept { return view().count(set); }
+
 #pragma region Returning offsets
 
     /**
@@ -2539,6 +2910,21 @@ class basic_string {
     /**  @brief  Find the last occurrence of a character from a set. */
     size_type rfind(char_set set) const noexcept { return view().rfind(set); }
 
+    /**
+     *  @brief  Find the first occurrence of a substring, ignoring the case of ASCII letters.
+     *          The behavior is @b undefined if `skip > size()`.
+     *  @return The offset of the first character of the match, or `npos` if not found.
+     */
+    size_type find_caseless(string_view other, size_type skip = 0) const noexcept {
+        return view().find_caseless(other, skip);
+    }
+
+    /**
+     *  @brief  Find the last occurrence of a substring, ignoring the case of ASCII letters.
+     *  @return The offset of the first character of the match, or `npos` if not found.
+     */
+    size_type rfind_caseless(string_view other) const noexcept { return view().rfind_caseless(other); }
+
 #pragma endregion
 #pragma endregion
 
@@ -3443,6 +3829,9 @@ class basic_string {
 
 using string = basic_string<char, std::allocator<char>>;
 
+/** @brief  String drawing its memory from the thread's current `arena`, for request-scoped string building. */
+using arena_string = basic_string<char, arena_allocator<char>>;
+
 static_assert(sizeof(string) == 4 * sizeof(void *), "String size must be 4 pointers.");
 
 namespace literals {
@@ -3859,6 +4248,104 @@ std::size_t edit_distance_utf8(basic_string<char_type_, allocator_type_> const &
     return ashvardanian::stringzilla::edit_distance_utf8(a.view(), b.view(), bound, a.get_allocator());
 }
 
+template <typename candidates_type_>
+sz_cptr_t _call_candidates_member_start(struct sz_sequence_t const *sequence, sz_size_t i) {
+    candidates_type_ const &candidates = *reinterpret_cast<candidates_type_ const *>(sequence->handle);
+    string_view member = candidates[i];
+    return member.data();
+}
+
+template <typename candidates_type_>
+sz_size_t _call_candidates_member_length(struct sz_sequence_t const *sequence, sz_size_t i) {
+    candidates_type_ const &candidates = *reinterpret_cast<candidates_type_ const *>(sequence->handle);
+    string_view member = candidates[i];
+    return static_cast<sz_size_t>(member.size());
+}
+
+/**
+ *  @brief  Calculates the Levenshtein edit distances in @b bytes between the query and every candidate,
+ *          reusing the query-side state and the scratch memory between all of them.
+ *
+ *  @param[in] query        The string to compare against every candidate.
+ *  @param[in] candidates   Random-access container of elements convertible to `string_view`.
+ *  @param[out] distances   The output array of `candidates.size()` distances.
+ *  @param[in] bound        Upper bound on the distance, that allows us to exit early. Zero means no bound.
+ *  @throw  `std::bad_alloc` if the allocation fails.
+ *  @see    sz_edit_distances
+ */
+template <typename char_type_, typename candidates_type_,
+          typename allocator_type_ = std::allocator<typename std::remove_const<char_type_>::type>>
+void edit_distances(basic_string_slice<char_type_> const &query, candidates_type_ const &candidates,
+                    std::size_t *distances, std::size_t bound,
+                    allocator_type_ &&allocator = allocator_type_ {}) noexcept(false) {
+    static_assert(sizeof(std::size_t) == sizeof(sz_size_t), "The distances are exported as `sz_size_t`.");
+    sz_sequence_t sequence;
+    sequence.order = nullptr;
+    sequence.count = static_cast<sz_size_t>(candidates.size());
+    sequence.handle = &candidates;
+    sequence.get_start = _call_candidates_member_start<candidates_type_>;
+    sequence.get_length = _call_candidates_member_length<candidates_type_>;
+    if (!_with_alloc(allocator, [&](sz_memory_allocator_t &alloc) {
+            return sz_edit_distances(query.data(), query.size(), &sequence, bound, &alloc,
+                                     reinterpret_cast<sz_size_t *>(distances)) == sz_true_k;
+        }))
+        throw std::bad_alloc();
+}
+
+#if !SZ_AVOID_STL
+
+/**
+ *  @brief  Calculates the Levenshtein edit distances in @b bytes between the query and every candidate.
+ *  @return The array of `candidates.size()` distances.
+ *  @throw  `std::bad_alloc` if the allocation fails.
+ *  @see    sz_edit_distances
+ */
+template <typename char_type_, typename candidates_type_>
+std::vector<std::size_t> edit_distances(basic_string_slice<char_type_> const &query,
+                                        candidates_type_ const &candidates, std::size_t bound = 0) noexcept(false) {
+    std::vector<std::size_t> distances(candidates.size());
+    ashvardanian::stringzilla::edit_distances(query, candidates, distances.data(), bound);
+    return distances;
+}
+
+#endif
+
+/**
+ *  @brief  Hashes every string in a container, matching the individual `string_view::hash` results.
+ *          Is handy for building or probing hash-tables, processing short keys in parallel SIMD lanes.
+ *
+ *  @param[in] strings  Random-access container of elements convertible to `string_view`.
+ *  @param[out] hashes  The output array of `strings.size()` hashes.
+ *  @see    sz_hash_batch
+ */
+template <typename strings_type_>
+void hash_batch(strings_type_ const &strings, std::uint64_t *hashes) noexcept {
+    static_assert(sizeof(std::uint64_t) == sizeof(sz_u64_t), "The hashes are exported as `sz_u64_t`.");
+    sz_sequence_t sequence;
+    sequence.order = nullptr;
+    sequence.count = static_cast<sz_size_t>(strings.size());
+    sequence.handle = &strings;
+    sequence.get_start = _call_candidates_member_start<strings_type_>;
+    sequence.get_length = _call_candidates_member_length<strings_type_>;
+    sz_hash_batch(&sequence, reinterpret_cast<sz_u64_t *>(hashes));
+}
+
+#if !SZ_AVOID_STL
+
+/**
+ *  @brief  Hashes every string in a container, matching the individual `string_view::hash` results.
+ *  @return The array of `strings.size()` hashes.
+ *  @see    sz_hash_batch
+ */
+template <typename strings_type_>
+std::vector<std::uint64_t> hash_batch(strings_type_ const &strings) noexcept(false) {
+    std::vector<std::uint64_t> hashes(strings.size());
+    ashvardanian::stringzilla::hash_batch(strings, hashes.data());
+    return hashes;
+}
+
+#endif
+
 /**
  *  @brief  Calculates the Needleman-Wunsch alignment score between two strings.
  *  @see    sz_alignment_score
@@ -3892,6 +4379,91 @@ std::ptrdiff_t alignment_score(basic_string<char_type_, allocator_type_> const &
     return ashvardanian::stringzilla::alignment_score(a.view(), b.view(), subs, gap, a.get_allocator());
 }
 
+/**
+ *  @brief  Calculates the Smith-Waterman local alignment score, the best score of any pair of substrings.
+ *  @see    sz_local_alignment_score
+ */
+template <typename char_type_, typename allocator_type_ = std::allocator<typename std::remove_const<char_type_>::type>>
+std::ptrdiff_t local_alignment_score(basic_string_slice<char_type_> const &a, basic_string_slice<char_type_> const &b,
+                                     std::int8_t const (&subs)[256][256], std::int8_t gap = -1,
+                                     allocator_type_ &&allocator = allocator_type_ {}) noexcept(false) {
+
+    static_assert(sizeof(sz_error_cost_t) == sizeof(std::int8_t), "sz_error_cost_t must be 8-bit.");
+    static_assert(std::is_signed<sz_error_cost_t>() == std::is_signed<std::int8_t>(),
+                  "sz_error_cost_t must be signed.");
+
+    std::ptrdiff_t result;
+    if (!_with_alloc(allocator, [&](sz_memory_allocator_t &alloc) {
+            result = sz_local_alignment_score(a.data(), a.size(), b.data(), b.size(), &subs[0][0], gap, &alloc);
+            return result != SZ_SSIZE_MAX;
+        }))
+        throw std::bad_alloc();
+    return result;
+}
+
+/**
+ *  @brief  Calculates the Smith-Waterman local alignment score, the best score of any pair of substrings.
+ *  @see    sz_local_alignment_score
+ */
+template <typename char_type_, typename allocator_type_ = std::allocator<char_type_>>
+std::ptrdiff_t local_alignment_score(basic_string<char_type_, allocator_type_> const &a,
+                                     basic_string<char_type_, allocator_type_> const &b, //
+                                     std::int8_t const (&subs)[256][256], std::int8_t gap = -1) noexcept(false) {
+    return ashvardanian::stringzilla::local_alignment_score(a.view(), b.view(), subs, gap, a.get_allocator());
+}
+
+/**
+ *  @brief  Calculates the global or local alignment scores between the query and every candidate,
+ *          reusing the scratch memory between all of them.
+ *
+ *  @param[in] query        The string to compare against every candidate.
+ *  @param[in] candidates   Random-access container of elements convertible to `string_view`.
+ *  @param[out] scores      The output array of `candidates.size()` scores.
+ *  @param[in] subs         Substitution costs matrix.
+ *  @param[in] gap          Penalty cost for gaps - insertions and removals.
+ *  @param[in] local        Whether to compute Smith-Waterman local alignments instead of Needleman-Wunsch ones.
+ *  @throw  `std::bad_alloc` if the allocation fails.
+ *  @see    sz_alignment_scores
+ */
+template <typename char_type_, typename candidates_type_,
+          typename allocator_type_ = std::allocator<typename std::remove_const<char_type_>::type>>
+void alignment_scores(basic_string_slice<char_type_> const &query, candidates_type_ const &candidates,
+                      std::ptrdiff_t *scores, std::int8_t const (&subs)[256][256], std::int8_t gap = -1,
+                      bool local = false, allocator_type_ &&allocator = allocator_type_ {}) noexcept(false) {
+    static_assert(sizeof(std::ptrdiff_t) == sizeof(sz_ssize_t), "The scores are exported as `sz_ssize_t`.");
+    sz_sequence_t sequence;
+    sequence.order = nullptr;
+    sequence.count = static_cast<sz_size_t>(candidates.size());
+    sequence.handle = &candidates;
+    sequence.get_start = _call_candidates_member_start<candidates_type_>;
+    sequence.get_length = _call_candidates_member_length<candidates_type_>;
+    if (!_with_alloc(allocator, [&](sz_memory_allocator_t &alloc) {
+            return sz_alignment_scores(query.data(), query.size(), &sequence, &subs[0][0], gap,
+                                       local ? sz_true_k : sz_false_k, &alloc,
+                                       reinterpret_cast<sz_ssize_t *>(scores)) == sz_true_k;
+        }))
+        throw std::bad_alloc();
+}
+
+#if !SZ_AVOID_STL
+
+/**
+ *  @brief  Calculates the global or local alignment scores between the query and every candidate.
+ *  @return The array of `candidates.size()` scores.
+ *  @throw  `std::bad_alloc` if the allocation fails.
+ *  @see    sz_alignment_scores
+ */
+template <typename char_type_, typename candidates_type_>
+std::vector<std::ptrdiff_t> alignment_scores(basic_string_slice<char_type_> const &query,
+                                             candidates_type_ const &candidates, std::int8_t const (&subs)[256][256],
+                                             std::int8_t gap = -1, bool local = false) noexcept(false) {
+    std::vector<std::ptrdiff_t> scores(candidates.size());
+    ashvardanian::stringzilla::alignment_scores(query, candidates, scores.data(), subs, gap, local);
+    return scores;
+}
+
+#endif
+
 /**
  *  @brief  Overwrites the string slice with random characters from the given alphabet using the random generator.
  *
@@ -3928,18 +4500,893 @@ void transform(basic_string_slice<char_type_ const> source, basic_look_up_table<
 }
 
 /**
- *  @brief  Overwrites the string slice with random characters from the given alphabet
- *          using `std::rand` as the random generator.
- *
- *  @param  string     The string to overwrite.
- *  @param  alphabet   A string of characters to choose from.
+ *  @brief  Lowercases ( @b in-place ) all ASCII and Latin-1 letters in the string, using `sz_tolower`.
  */
 template <typename char_type_>
-void randomize(basic_string_slice<char_type_> string, string_view alphabet = "abcdefghijklmnopqrstuvwxyz") noexcept {
-    randomize(string, std::rand, alphabet);
+void to_lower(basic_string_slice<char_type_> string) noexcept {
+    static_assert(sizeof(char_type_) == 1, "The character type must be 1 byte long.");
+    sz_tolower((sz_cptr_t)string.data(), (sz_size_t)string.size(), (sz_ptr_t)string.data());
 }
 
-using sorted_idx_t = sz_sorted_idx_t;
+/**
+ *  @brief  Lowercases all ASCII and Latin-1 letters of the string into another buffer, using `sz_tolower`.
+ */
+template <typename char_type_>
+void to_lower(basic_string_slice<char_type_ const> source, char_type_ *target) noexcept {
+    static_assert(sizeof(char_type_) == 1, "The character type must be 1 byte long.");
+    sz_tolower((sz_cptr_t)source.data(), (sz_size_t)source.size(), (sz_ptr_t)target);
+}
+
+/**
+ *  @brief  Uppercases ( @b in-place ) all ASCII and Latin-1 letters in the string, using `sz_toupper`.
+ */
+template <typename char_type_>
+void to_upper(basic_string_slice<char_type_> string) noexcept {
+    static_assert(sizeof(char_type_) == 1, "The character type must be 1 byte long.");
+    sz_toupper((sz_cptr_t)string.data(), (sz_size_t)string.size(), (sz_ptr_t)string.data());
+}
+
+/**
+ *  @brief  Uppercases all ASCII and Latin-1 letters of the string into another buffer, using `sz_toupper`.
+ */
+template <typename char_type_>
+void to_upper(basic_string_slice<char_type_ const> source, char_type_ *target) noexcept {
+    static_assert(sizeof(char_type_) == 1, "The character type must be 1 byte long.");
+    sz_toupper((sz_cptr_t)source.data(), (sz_size_t)source.size(), (sz_ptr_t)target);
+}
+
+/**
+ *  @brief  Overwrites the string slice with random characters from the given alphabet
+ *          using `std::rand` as the random generator.
+ *
+ *  @param  string     The string to overwrite.
+ *  @param  alphabet   A string of characters to choose from.
+ */
+template <typename char_type_>
+void randomize(basic_string_slice<char_type_> string, string_view alphabet = "abcdefghijklmnopqrstuvwxyz") noexcept {
+    randomize(string, std::rand, alphabet);
+}
+
+/**
+ *  @brief  Compiled set of needles, that can all be located in a single pass over the haystack.
+ *          Wraps the ::sz_multi_matcher_t and copies the needles, so the original strings may be freed.
+ *
+ *  @code{.cpp}
+ *      sz::multi_matcher matcher({"error", "warning", "fatal"});
+ *      for (auto match : matcher.find_all(log)) std::cout << match << std::endl;
+ *  @endcode
+ *
+ *  @see    sz_multi_matcher_init, sz_find_multi
+ */
+template <typename allocator_type_ = std::allocator<char>>
+class basic_multi_matcher {
+  public:
+    using allocator_type = allocator_type_;
+    using size_type = std::size_t;
+    using find_all_type = range_matches<string_view, matcher_find_multi<string_view, include_overlaps_type>>;
+    using find_disjoint_type = range_matches<string_view, matcher_find_multi<string_view, exclude_overlaps_type>>;
+
+    static constexpr size_type npos = size_type(-1);
+
+  private:
+    sz_multi_matcher_t matcher_;
+    allocator_type allocator_;
+
+  public:
+    basic_multi_matcher(allocator_type allocator = {}) noexcept : allocator_(allocator) {
+        sz_multi_matcher_init(&matcher_, nullptr, 0, nullptr);
+    }
+
+    /**
+     *  @throw  `std::invalid_argument` if one of the needles is empty.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    basic_multi_matcher(std::initializer_list<string_view> needles, allocator_type allocator = {}) noexcept(false)
+        : basic_multi_matcher(needles.begin(), needles.end(), allocator) {}
+
+    /**
+     *  @brief  Compiles the needles from a range of objects convertible to `string_view`.
+     *  @throw  `std::invalid_argument` if one of the needles is empty.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    template <typename iterator_type_>
+    basic_multi_matcher(iterator_type_ first, iterator_type_ last, allocator_type allocator = {}) noexcept(false)
+        : basic_multi_matcher(allocator) {
+        for (iterator_type_ it = first; it != last; ++it)
+            if (string_view(*it).empty()) throw std::invalid_argument("sz::basic_multi_matcher");
+        if (!try_assign(first, last)) throw std::bad_alloc();
+    }
+
+    basic_multi_matcher(basic_multi_matcher const &) = delete;
+    basic_multi_matcher &operator=(basic_multi_matcher const &) = delete;
+
+    basic_multi_matcher(basic_multi_matcher &&other) noexcept
+        : matcher_(other.matcher_), allocator_(std::move(other.allocator_)) {
+        sz_multi_matcher_init(&other.matcher_, nullptr, 0, nullptr);
+    }
+
+    basic_multi_matcher &operator=(basic_multi_matcher &&other) noexcept {
+        if (this != &other) {
+            reset();
+            matcher_ = other.matcher_;
+            allocator_ = std::move(other.allocator_);
+            sz_multi_matcher_init(&other.matcher_, nullptr, 0, nullptr);
+        }
+        return *this;
+    }
+
+    ~basic_multi_matcher() noexcept { reset(); }
+
+    /**
+     *  @brief  Replaces the compiled needles with a new range of objects convertible to `string_view`.
+     *  @return `false` if the allocation fails or one of the needles is empty. The matcher is empty in that case.
+     */
+    template <typename iterator_type_>
+    bool try_assign(iterator_type_ first, iterator_type_ last) noexcept {
+        reset();
+        size_type count = static_cast<size_type>(std::distance(first, last));
+        if (!count) return true;
+
+        // The C API expects a contiguous array of views, so we have to export them first.
+        size_type views_bytes = count * sizeof(sz_string_view_t);
+        sz_string_view_t *views = reinterpret_cast<sz_string_view_t *>(allocator_.allocate(views_bytes));
+        if (!views) return false;
+        for (size_type i = 0; first != last; ++first, ++i) {
+            string_view needle = *first;
+            views[i].start = needle.data();
+            views[i].length = needle.size();
+        }
+        bool success = _with_alloc(allocator_, [&](sz_memory_allocator_t &alloc) {
+            return sz_multi_matcher_init(&matcher_, views, count, &alloc) == sz_true_k;
+        });
+        allocator_.deallocate(reinterpret_cast<char *>(views), views_bytes);
+        return success;
+    }
+
+    /**  @brief  Releases the compiled state, leaving an empty matcher. */
+    void reset() noexcept {
+        if (!matcher_.buffer) return;
+        _with_alloc(allocator_, [&](sz_memory_allocator_t &alloc) {
+            sz_multi_matcher_free(&matcher_, &alloc);
+            return true;
+        });
+    }
+
+    size_type size() const noexcept { return static_cast<size_type>(matcher_.count); }
+    bool empty() const noexcept { return matcher_.count == 0; }
+    string_view operator[](size_type i) const noexcept { return {matcher_.starts[i], matcher_.lengths[i]}; }
+    sz_multi_matcher_t const &raw() const noexcept { return matcher_; }
+    allocator_type get_allocator() const noexcept { return allocator_; }
+
+    /**
+     *  @brief  Locates the first occurrence of any needle, preferring the longest one at the same offset.
+     *  @param[out] needle_index    Optional output for the index of the matched needle.
+     *  @return The offset of the match or `npos`.
+     */
+    size_type find(string_view haystack, size_type *needle_index = nullptr) const noexcept {
+        sz_size_t index = 0;
+        sz_cptr_t match = sz_find_multi(&matcher_, haystack.data(), haystack.size(), &index);
+        if (!match) return npos;
+        if (needle_index) *needle_index = static_cast<size_type>(index);
+        return static_cast<size_type>(match - haystack.data());
+    }
+
+    /**  @brief  Find all potentially @b overlapping occurrences of any needle. */
+    find_all_type find_all(string_view haystack, include_overlaps_type = {}) const noexcept {
+        return {haystack, {&matcher_}};
+    }
+
+    /**  @brief  Find all @b non-overlapping occurrences of any needle. */
+    find_disjoint_type find_all(string_view haystack, exclude_overlaps_type) const noexcept {
+        return {haystack, {&matcher_}};
+    }
+};
+
+using multi_matcher = basic_multi_matcher<std::allocator<char>>;
+
+/**
+ *  @brief  Streaming substring matcher, that locates a needle across successive chunks of a stream,
+ *          reporting absolute offsets and carrying over only the last `needle.size() - 1` bytes.
+ *          Wraps the ::sz_stream_matcher_t and copies the needle, so the original string may be freed.
+ *
+ *  @code{.cpp}
+ *      sz::stream_matcher matcher("needle");
+ *      while (read_chunk(buffer)) matcher.feed(buffer, [](std::size_t offset) { std::cout << offset << std::endl; });
+ *  @endcode
+ *
+ *  @see    sz_stream_matcher_init, sz_stream_matcher_feed
+ */
+template <typename allocator_type_ = std::allocator<char>>
+class basic_stream_matcher {
+  public:
+    using allocator_type = allocator_type_;
+    using size_type = std::size_t;
+
+  private:
+    sz_stream_matcher_t matcher_;
+    allocator_type allocator_;
+
+    template <typename callback_type_>
+    static void _forward_match(void *context, sz_size_t offset) {
+        (*reinterpret_cast<callback_type_ *>(context))(static_cast<size_type>(offset));
+    }
+
+    void _release() noexcept {
+        if (!matcher_.buffer) return;
+        _with_alloc(allocator_, [&](sz_memory_allocator_t &alloc) {
+            sz_stream_matcher_free(&matcher_, &alloc);
+            return true;
+        });
+    }
+
+  public:
+    /**
+     *  @brief  Prepares the matcher for potentially @b overlapping occurrences of the ::needle.
+     *  @throw  `std::invalid_argument` if the needle is empty.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    basic_stream_matcher(string_view needle, include_overlaps_type = {}, allocator_type allocator = {}) noexcept(false)
+        : allocator_(allocator) {
+        _init(needle, sz_true_k);
+    }
+
+    /**
+     *  @brief  Prepares the matcher for @b non-overlapping occurrences of the ::needle.
+     *  @throw  `std::invalid_argument` if the needle is empty.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    basic_stream_matcher(string_view needle, exclude_overlaps_type, allocator_type allocator = {}) noexcept(false)
+        : allocator_(allocator) {
+        _init(needle, sz_false_k);
+    }
+
+    basic_stream_matcher(basic_stream_matcher const &) = delete;
+    basic_stream_matcher &operator=(basic_stream_matcher const &) = delete;
+
+    basic_stream_matcher(basic_stream_matcher &&other) noexcept
+        : matcher_(other.matcher_), allocator_(std::move(other.allocator_)) {
+        other.matcher_.buffer = nullptr;
+    }
+
+    basic_stream_matcher &operator=(basic_stream_matcher &&other) noexcept {
+        if (this != &other) {
+            _release();
+            matcher_ = other.matcher_;
+            allocator_ = std::move(other.allocator_);
+            other.matcher_.buffer = nullptr;
+        }
+        return *this;
+    }
+
+    ~basic_stream_matcher() noexcept { _release(); }
+
+    /**  @brief  Rewinds to the start of a new stream, keeping the needle. */
+    void reset() noexcept { sz_stream_matcher_reset(&matcher_); }
+
+    /**  @brief  Absolute offset of the first byte of the next chunk, equal to the number of bytes fed so far. */
+    size_type offset() const noexcept { return static_cast<size_type>(matcher_.offset); }
+    string_view needle() const noexcept { return {matcher_.needle, matcher_.needle_length}; }
+    sz_stream_matcher_t const &raw() const noexcept { return matcher_; }
+    allocator_type get_allocator() const noexcept { return allocator_; }
+
+    /**
+     *  @brief  Feeds the next chunk, invoking the ::callback with the absolute offset of every match ending in it.
+     *  @return The number of matches reported for this chunk.
+     */
+    template <typename callback_type_>
+    size_type feed(string_view chunk, callback_type_ &&callback) noexcept {
+        using callback_t = typename std::remove_reference<callback_type_>::type;
+        return static_cast<size_type>(sz_stream_matcher_feed(&matcher_, chunk.data(), chunk.size(),
+                                                             &_forward_match<callback_t>, (void *)&callback));
+    }
+
+    /**  @brief  Feeds the next chunk, only counting the matches ending in it. */
+    size_type feed(string_view chunk) noexcept {
+        return feed(chunk, [](size_type) {});
+    }
+
+  private:
+    void _init(string_view needle, sz_bool_t allow_overlaps) noexcept(false) {
+        if (needle.empty()) throw std::invalid_argument("sz::basic_stream_matcher");
+        bool success = _with_alloc(allocator_, [&](sz_memory_allocator_t &alloc) {
+            return sz_stream_matcher_init(&matcher_, needle.data(), needle.size(), allow_overlaps, &alloc) == sz_true_k;
+        });
+        if (!success) throw std::bad_alloc();
+    }
+};
+
+using stream_matcher = basic_stream_matcher<std::allocator<char>>;
+
+/**
+ *  @brief  Compiled glob-style pattern, supporting `*`, `?`, `[a-z]` and `[!a-z]` classes, and `\` escapes,
+ *          that checks if whole strings match it. The literal parts are located with SIMD-accelerated `find`,
+ *          and the classes are evaluated with the same bitsets, as the `char_set`.
+ *          Wraps the ::sz_glob_matcher_t and compiles the pattern, so the original string may be freed.
+ *
+ *  @code{.cpp}
+ *      sz::glob_matcher matcher("GET /api/v[12]/users?id=*");
+ *      for (auto line : log.split("\n")) if (matcher.match(line)) std::cout << line << std::endl;
+ *  @endcode
+ *
+ *  @see    sz_glob_matcher_init, sz_glob_match
+ */
+template <typename allocator_type_ = std::allocator<char>>
+class basic_glob_matcher {
+  public:
+    using allocator_type = allocator_type_;
+    using size_type = std::size_t;
+
+  private:
+    sz_glob_matcher_t matcher_;
+    allocator_type allocator_;
+
+    void _release() noexcept {
+        if (!matcher_.buffer) return;
+        _with_alloc(allocator_, [&](sz_memory_allocator_t &alloc) {
+            sz_glob_matcher_free(&matcher_, &alloc);
+            return true;
+        });
+    }
+
+  public:
+    /**
+     *  @brief  Compiles the ::pattern. An empty pattern only matches empty strings.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    basic_glob_matcher(string_view pattern, allocator_type allocator = {}) noexcept(false) : allocator_(allocator) {
+        bool success = _with_alloc(allocator_, [&](sz_memory_allocator_t &alloc) {
+            return sz_glob_matcher_init(&matcher_, pattern.data(), pattern.size(), &alloc) == sz_true_k;
+        });
+        if (!success) throw std::bad_alloc();
+    }
+
+    basic_glob_matcher(basic_glob_matcher const &) = delete;
+    basic_glob_matcher &operator=(basic_glob_matcher const &) = delete;
+
+    basic_glob_matcher(basic_glob_matcher &&other) noexcept
+        : matcher_(other.matcher_), allocator_(std::move(other.allocator_)) {
+        other.matcher_ = sz_glob_matcher_t {}; // The moved-from matcher matches nothing.
+    }
+
+    basic_glob_matcher &operator=(basic_glob_matcher &&other) noexcept {
+        if (this != &other) {
+            _release();
+            matcher_ = other.matcher_;
+            allocator_ = std::move(other.allocator_);
+            other.matcher_ = sz_glob_matcher_t {};
+        }
+        return *this;
+    }
+
+    ~basic_glob_matcher() noexcept { _release(); }
+
+    /**  @brief  Length of the shortest string that can match, equal to the number of non-star atoms. */
+    size_type min_length() const noexcept { return static_cast<size_type>(matcher_.atoms_count); }
+    sz_glob_matcher_t const &raw() const noexcept { return matcher_; }
+    allocator_type get_allocator() const noexcept { return allocator_; }
+
+    /**  @brief  Checks if the whole ::text matches the pattern. */
+    bool match(string_view text) const noexcept {
+        return sz_glob_match(&matcher_, text.data(), text.size()) == sz_true_k;
+    }
+    bool operator()(string_view text) const noexcept { return match(text); }
+};
+
+using glob_matcher = basic_glob_matcher<std::allocator<char>>;
+
+#pragma region Hash Tables
+
+/**
+ *  @brief  Group of control bytes of `basic_string_map`, probed in parallel.
+ *          Every control byte is either `empty_k`, `deleted_k`, or a 7-bit tag of the hash of the key in that slot.
+ *          The match masks contain `lane_bits` bits per control byte, of which only the lowest may be set.
+ */
+struct _string_map_group {
+    static constexpr sz_u8_t empty_k = 0x80;
+    static constexpr sz_u8_t deleted_k = 0xFE;
+
+#if (SZ_USE_X86_AVX2 || SZ_USE_X86_AVX512) && (defined(__SSE2__) || defined(_M_X64))
+    static constexpr std::size_t width = 16;
+    static constexpr std::size_t lane_bits = 1;
+    __m128i controls;
+
+    explicit _string_map_group(sz_u8_t const *start) noexcept
+        : controls(_mm_loadu_si128(reinterpret_cast<__m128i const *>(start))) {}
+    sz_u64_t match(sz_u8_t tag) const noexcept {
+        return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8((char)tag), controls)));
+    }
+    sz_u64_t match_empty() const noexcept { return match(empty_k); }
+    sz_u64_t match_empty_or_deleted() const noexcept { return static_cast<unsigned>(_mm_movemask_epi8(controls)); }
+#elif SZ_USE_ARM_NEON
+    static constexpr std::size_t width = 16;
+    static constexpr std::size_t lane_bits = 4;
+    uint8x16_t controls;
+
+    // Narrowing shift packs the 16 comparison bytes into 16 nibbles of a single 64-bit word.
+    static sz_u64_t _to_mask(uint8x16_t matches) noexcept {
+        uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x1111111111111111ull;
+    }
+    explicit _string_map_group(sz_u8_t const *start) noexcept : controls(vld1q_u8(start)) {}
+    sz_u64_t match(sz_u8_t tag) const noexcept { return _to_mask(vceqq_u8(controls, vdupq_n_u8(tag))); }
+    sz_u64_t match_empty() const noexcept { return match(empty_k); }
+    sz_u64_t match_empty_or_deleted() const noexcept {
+        return _to_mask(vreinterpretq_u8_s8(vshrq_n_s8(vreinterpretq_s8_u8(controls), 7)));
+    }
+#else
+    static constexpr std::size_t width = 8;
+    static constexpr std::size_t lane_bits = 8;
+    sz_u64_t controls;
+
+    explicit _string_map_group(sz_u8_t const *start) noexcept : controls(0) {
+        for (std::size_t i = 0; i != width; ++i) controls |= static_cast<sz_u64_t>(start[i]) << (i * 8);
+    }
+    // May report false positives, but only in the slots following a true match, which are always occupied.
+    sz_u64_t match(sz_u8_t tag) const noexcept {
+        sz_u64_t const xored = controls ^ (0x0101010101010101ull * tag);
+        return (xored - 0x0101010101010101ull) & ~xored & 0x8080808080808080ull;
+    }
+    sz_u64_t match_empty() const noexcept { return controls & ~(controls << 6) & 0x8080808080808080ull; }
+    sz_u64_t match_empty_or_deleted() const noexcept { return controls & 0x8080808080808080ull; }
+#endif
+};
+
+/**
+ *  @brief  Open-addressing hash map with string keys, modeled after the "Swiss Table" design.
+ *          Every slot has a control byte with 7 bits of the key hash, and whole groups of control bytes
+ *          are compared at once with SSE2, NEON, or SWAR, before the keys are compared with ::sz_equal.
+ *          Keys are copied into an internal ::sz_memory_arena_t tape, so the original strings may be freed,
+ *          and the memory of erased keys is only reclaimed on `clear()`.
+ *
+ *  @code{.cpp}
+ *      sz::string_map<int> counts;
+ *      for (auto word : text.split(" ")) counts[word]++;
+ *  @endcode
+ *
+ *  @tparam mapped_type_ Type of the values, stored inline in the slots next to the key views.
+ *  @tparam allocator_type_ Allocator for the slots and the keys tape.
+ *  @see    sz_hash, sz_memory_arena_t
+ */
+template <typename mapped_type_, typename allocator_type_ = std::allocator<char>>
+class basic_string_map {
+  public:
+    using key_type = string_view;
+    using mapped_type = mapped_type_;
+    using value_type = std::pair<string_view const, mapped_type_>;
+    using allocator_type = allocator_type_;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+
+  private:
+    using group_t = _string_map_group;
+
+    sz_u8_t *controls_ = nullptr; // `capacity_ + group_t::width - 1` bytes, mirroring the head at the tail.
+    value_type *slots_ = nullptr; // `capacity_` slots, following the controls in the same allocation.
+    size_type capacity_ = 0;      // Zero or a power of two, no smaller than `group_t::width`.
+    size_type size_ = 0;          // Number of occupied slots.
+    size_type growth_left_ = 0;   // Number of empty slots, that can be filled before the next rehash.
+    allocator_type allocator_;
+    sz_memory_arena_t keys_;
+
+    template <bool is_const_>
+    class iterator_template {
+        friend class basic_string_map;
+        template <bool>
+        friend class iterator_template;
+        using slot_type = typename std::conditional<is_const_, typename basic_string_map::value_type const,
+                                                    typename basic_string_map::value_type>::type;
+        sz_u8_t const *control_ = nullptr;
+        sz_u8_t const *end_ = nullptr;
+        slot_type *slot_ = nullptr;
+
+        iterator_template(sz_u8_t const *control, sz_u8_t const *end, slot_type *slot) noexcept
+            : control_(control), end_(end), slot_(slot) {
+            _skip_empty();
+        }
+        void _skip_empty() noexcept {
+            while (control_ != end_ && (*control_ & 0x80)) ++control_, ++slot_;
+        }
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename basic_string_map::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = slot_type *;
+        using reference = slot_type &;
+
+        iterator_template() noexcept = default;
+        template <bool other_const_, typename = typename std::enable_if<is_const_ && !other_const_>::type>
+        iterator_template(iterator_template<other_const_> const &other) noexcept
+            : control_(other.control_), end_(other.end_), slot_(other.slot_) {}
+
+        reference operator*() const noexcept { return *slot_; }
+        pointer operator->() const noexcept { return slot_; }
+        iterator_template &operator++() noexcept {
+            ++control_, ++slot_;
+            _skip_empty();
+            return *this;
+        }
+        iterator_template operator++(int) noexcept {
+            iterator_template copy = *this;
+            ++*this;
+            return copy;
+        }
+        bool operator==(iterator_template const &other) const noexcept { return control_ == other.control_; }
+        bool operator!=(iterator_template const &other) const noexcept { return control_ != other.control_; }
+    };
+
+  public:
+    using iterator = iterator_template<false>;
+    using const_iterator = iterator_template<true>;
+
+    basic_string_map(allocator_type allocator = {}) noexcept : allocator_(allocator) { _init_keys(); }
+
+    basic_string_map(std::initializer_list<value_type> values, allocator_type allocator = {}) noexcept(false)
+        : basic_string_map(allocator) {
+        reserve(values.size());
+        for (value_type const &value : values) try_emplace(value.first, value.second);
+    }
+
+    basic_string_map(basic_string_map const &other) noexcept(false) : basic_string_map(other.allocator_) {
+        reserve(other.size_);
+        for (value_type const &value : other) try_emplace(value.first, value.second);
+    }
+
+    basic_string_map &operator=(basic_string_map const &other) noexcept(false) {
+        if (this != &other) {
+            basic_string_map copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    basic_string_map(basic_string_map &&other) noexcept
+        : controls_(other.controls_), slots_(other.slots_), capacity_(other.capacity_), size_(other.size_),
+          growth_left_(other.growth_left_), allocator_(std::move(other.allocator_)), keys_(other.keys_) {
+        keys_.upstream.handle = &allocator_;
+        other._forget();
+    }
+
+    basic_string_map &operator=(basic_string_map &&other) noexcept {
+        if (this != &other) {
+            _release();
+            controls_ = other.controls_, slots_ = other.slots_, capacity_ = other.capacity_;
+            size_ = other.size_, growth_left_ = other.growth_left_;
+            allocator_ = std::move(other.allocator_);
+            keys_ = other.keys_;
+            keys_.upstream.handle = &allocator_;
+            other._forget();
+        }
+        return *this;
+    }
+
+    ~basic_string_map() noexcept { _release(); }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_type capacity() const noexcept { return capacity_; }
+    size_type bucket_count() const noexcept { return capacity_; }
+    float load_factor() const noexcept { return capacity_ ? static_cast<float>(size_) / capacity_ : 0.f; }
+    allocator_type get_allocator() const noexcept { return allocator_; }
+    /**  @brief  Number of bytes used by the keys tape, including the erased keys and the alignment padding. */
+    size_type keys_bytes() const noexcept { return keys_.used_bytes; }
+
+    iterator begin() noexcept { return {controls_, controls_ + capacity_, slots_}; }
+    iterator end() noexcept { return {controls_ + capacity_, controls_ + capacity_, slots_ + capacity_}; }
+    const_iterator begin() const noexcept { return {controls_, controls_ + capacity_, slots_}; }
+    const_iterator end() const noexcept { return {controls_ + capacity_, controls_ + capacity_, slots_ + capacity_}; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    iterator find(string_view key) noexcept {
+        size_type index = _find(key, sz_hash(key.data(), key.size()));
+        return index == capacity_ ? end() : _iterator_at(index);
+    }
+    const_iterator find(string_view key) const noexcept {
+        size_type index = _find(key, sz_hash(key.data(), key.size()));
+        return index == capacity_ ? end() : const_iterator(controls_ + index, controls_ + capacity_, slots_ + index);
+    }
+    bool contains(string_view key) const noexcept { return find(key) != end(); }
+    size_type count(string_view key) const noexcept { return contains(key); }
+
+    /**
+     *  @brief  Accesses the value of the ::key, throwing if it's missing.
+     *  @throw  `std::out_of_range` if the key is not present.
+     */
+    mapped_type &at(string_view key) noexcept(false) {
+        iterator it = find(key);
+        if (it == end()) throw std::out_of_range("sz::basic_string_map::at");
+        return it->second;
+    }
+    mapped_type const &at(string_view key) const noexcept(false) {
+        const_iterator it = find(key);
+        if (it == end()) throw std::out_of_range("sz::basic_string_map::at");
+        return it->second;
+    }
+
+    /**
+     *  @brief  Accesses the value of the ::key, default-constructing it if it's missing.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    mapped_type &operator[](string_view key) noexcept(false) { return try_emplace(key).first->second; }
+
+    /**
+     *  @brief  Inserts the ::key with a value constructed from ::args, unless the key is already present.
+     *  @return Iterator to the entry for the key, and whether the insertion took place.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    template <typename... args_types_>
+    std::pair<iterator, bool> try_emplace(string_view key, args_types_ &&...args) noexcept(false) {
+        sz_u64_t const hash = sz_hash(key.data(), key.size());
+        size_type index = _find(key, hash);
+        if (index != capacity_) return {_iterator_at(index), false};
+
+        if (!growth_left_) _rehash(size_ + 1 <= _max_size(capacity_) / 2 ? capacity_ : capacity_ * 2);
+        char *key_copy = static_cast<char *>(sz_memory_arena_allocate(&keys_, key.size()));
+        if (!key_copy) throw std::bad_alloc();
+        sz_copy(key_copy, key.data(), key.size());
+
+        index = _find_insertion_slot(hash);
+        growth_left_ -= controls_[index] == group_t::empty_k;
+        new (slots_ + index) value_type(std::piecewise_construct, std::forward_as_tuple(key_copy, key.size()),
+                                        std::forward_as_tuple(std::forward<args_types_>(args)...));
+        _set_control(index, static_cast<sz_u8_t>(hash & 0x7F));
+        ++size_;
+        return {_iterator_at(index), true};
+    }
+
+    std::pair<iterator, bool> insert(value_type const &value) noexcept(false) {
+        return try_emplace(value.first, value.second);
+    }
+
+    /**
+     *  @brief  Inserts or overwrites the value of the ::key.
+     *  @return Iterator to the entry for the key, and whether the insertion took place.
+     */
+    template <typename value_type_>
+    std::pair<iterator, bool> insert_or_assign(string_view key, value_type_ &&value) noexcept(false) {
+        std::pair<iterator, bool> result = try_emplace(key, std::forward<value_type_>(value));
+        if (!result.second) result.first->second = std::forward<value_type_>(value);
+        return result;
+    }
+
+    /**  @brief  Removes the ::key, leaving a tombstone in its slot. @return The number of removed entries. */
+    size_type erase(string_view key) noexcept {
+        size_type index = _find(key, sz_hash(key.data(), key.size()));
+        if (index == capacity_) return 0;
+        _erase_at(index);
+        return 1;
+    }
+
+    iterator erase(const_iterator position) noexcept {
+        size_type index = static_cast<size_type>(position.control_ - controls_);
+        _erase_at(index);
+        return _iterator_at(index + 1);
+    }
+
+    /**  @brief  Removes all the entries and invalidates the keys tape, keeping the slots allocated. */
+    void clear() noexcept {
+        _destroy_values();
+        if (capacity_) sz_fill((sz_ptr_t)controls_, capacity_ + group_t::width - 1, (char)group_t::empty_k);
+        size_ = 0;
+        growth_left_ = _max_size(capacity_);
+        sz_memory_arena_reset(&keys_);
+    }
+
+    /**
+     *  @brief  Prepares the slots for at least ::count entries, without rehashing on the way.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    void reserve(size_type count) noexcept(false) {
+        size_type capacity = 16;
+        while (_max_size(capacity) < count) capacity *= 2;
+        if (capacity > capacity_) _rehash(capacity);
+    }
+
+    void swap(basic_string_map &other) noexcept {
+        basic_string_map temporary(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temporary);
+    }
+
+  private:
+    /**  @brief  Keeps the load factor under 7/8. */
+    static size_type _max_size(size_type capacity) noexcept { return capacity - capacity / 8; }
+
+    /**  @brief  Size of the control bytes, padded to the alignment of the slots that follow them. */
+    static size_type _controls_bytes(size_type capacity) noexcept {
+        size_type const alignment = alignof(value_type);
+        return (capacity + group_t::width - 1 + alignment - 1) / alignment * alignment;
+    }
+    static size_type _total_bytes(size_type capacity) noexcept {
+        return _controls_bytes(capacity) + capacity * sizeof(value_type);
+    }
+
+    void _init_keys() noexcept {
+        sz_memory_allocator_t upstream;
+        upstream.allocate = &_call_allocate<allocator_type>;
+        upstream.free = &_call_free<allocator_type>;
+        upstream.handle = &allocator_;
+        sz_memory_arena_init(&keys_, 4096, &upstream);
+    }
+
+    void _forget() noexcept {
+        controls_ = nullptr, slots_ = nullptr;
+        capacity_ = size_ = growth_left_ = 0;
+        _init_keys();
+    }
+
+    void _destroy_values() noexcept {
+        for (size_type i = 0; i != capacity_ && size_; ++i)
+            if (!(controls_[i] & 0x80)) slots_[i].~value_type();
+    }
+
+    void _release() noexcept {
+        _destroy_values();
+        if (controls_) allocator_.deallocate(reinterpret_cast<char *>(controls_), _total_bytes(capacity_));
+        sz_memory_arena_free(&keys_);
+    }
+
+    iterator _iterator_at(size_type index) noexcept {
+        return {controls_ + index, controls_ + capacity_, slots_ + index};
+    }
+
+    /**  @brief  Updates the control byte, and its mirror past the end, if it's among the first `width - 1`. */
+    void _set_control(size_type index, sz_u8_t control) noexcept {
+        controls_[index] = control;
+        controls_[((index - (group_t::width - 1)) & (capacity_ - 1)) + (group_t::width - 1)] = control;
+    }
+
+    /**  @brief  Locates the slot with the ::key. @return Its index, or `capacity_` if it's missing. */
+    size_type _find(string_view key, sz_u64_t hash) const noexcept {
+        if (!capacity_) return capacity_;
+        size_type const mask = capacity_ - 1;
+        sz_u8_t const tag = static_cast<sz_u8_t>(hash & 0x7F);
+        // Triangular probing over groups visits every group once, as the capacity is a power of two.
+        size_type position = static_cast<size_type>(hash >> 7) & mask;
+        for (size_type step = group_t::width;; position = (position + step) & mask, step += group_t::width) {
+            group_t group(controls_ + position);
+            for (sz_u64_t matches = group.match(tag); matches; matches &= matches - 1) {
+                size_type index = (position + sz_u64_ctz(matches) / group_t::lane_bits) & mask;
+                string_view candidate = slots_[index].first;
+                if (candidate.size() == key.size() && sz_equal(candidate.data(), key.data(), key.size()))
+                    return index;
+            }
+            if (group.match_empty()) return capacity_;
+        }
+    }
+
+    /**  @brief  Locates the first empty or deleted slot on the probing path of the ::hash. */
+    size_type _find_insertion_slot(sz_u64_t hash) const noexcept {
+        size_type const mask = capacity_ - 1;
+        size_type position = static_cast<size_type>(hash >> 7) & mask;
+        for (size_type step = group_t::width;; position = (position + step) & mask, step += group_t::width) {
+            sz_u64_t free_slots = group_t(controls_ + position).match_empty_or_deleted();
+            if (free_slots) return (position + sz_u64_ctz(free_slots) / group_t::lane_bits) & mask;
+        }
+    }
+
+    void _erase_at(size_type index) noexcept {
+        slots_[index].~value_type();
+        _set_control(index, group_t::deleted_k);
+        --size_;
+    }
+
+    /**
+     *  @brief  Moves the entries into a new table with ::capacity slots, dropping the tombstones.
+     *          The keys remain in place on the tape, so only the views and the values are moved.
+     */
+    void _rehash(size_type capacity) noexcept(false) {
+        if (capacity < 16) capacity = 16;
+        char *block = allocator_.allocate(_total_bytes(capacity));
+        if (!block) throw std::bad_alloc();
+
+        sz_u8_t *old_controls = controls_;
+        value_type *old_slots = slots_;
+        size_type old_capacity = capacity_;
+        controls_ = reinterpret_cast<sz_u8_t *>(block);
+        slots_ = reinterpret_cast<value_type *>(block + _controls_bytes(capacity));
+        capacity_ = capacity;
+        sz_fill((sz_ptr_t)controls_, capacity + group_t::width - 1, (char)group_t::empty_k);
+
+        for (size_type i = 0; i != old_capacity; ++i) {
+            if (old_controls[i] & 0x80) continue;
+            value_type &old_slot = old_slots[i];
+            sz_u64_t hash = sz_hash(old_slot.first.data(), old_slot.first.size());
+            size_type index = _find_insertion_slot(hash);
+            new (slots_ + index) value_type(std::move(old_slot));
+            old_slot.~value_type();
+            _set_control(index, static_cast<sz_u8_t>(hash & 0x7F));
+        }
+        growth_left_ = _max_size(capacity) - size_;
+        if (old_controls) allocator_.deallocate(reinterpret_cast<char *>(old_controls), _total_bytes(old_capacity));
+    }
+};
+
+/**
+ *  @brief  Open-addressing hash set of strings, sharing the layout and the probing logic of `basic_string_map`.
+ *  @see    basic_string_map
+ */
+template <typename allocator_type_ = std::allocator<char>>
+class basic_string_set {
+    struct _nothing {};
+    using map_type = basic_string_map<_nothing, allocator_type_>;
+    map_type map_;
+
+  public:
+    using key_type = string_view;
+    using value_type = string_view;
+    using allocator_type = allocator_type_;
+    using size_type = std::size_t;
+
+    class const_iterator {
+        friend class basic_string_set;
+        typename map_type::const_iterator it_;
+        const_iterator(typename map_type::const_iterator it) noexcept : it_(it) {}
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = string_view const *;
+        using reference = string_view const &;
+
+        const_iterator() noexcept = default;
+        reference operator*() const noexcept { return it_->first; }
+        pointer operator->() const noexcept { return &it_->first; }
+        const_iterator &operator++() noexcept { return ++it_, *this; }
+        const_iterator operator++(int) noexcept {
+            const_iterator copy = *this;
+            ++it_;
+            return copy;
+        }
+        bool operator==(const_iterator const &other) const noexcept { return it_ == other.it_; }
+        bool operator!=(const_iterator const &other) const noexcept { return it_ != other.it_; }
+    };
+    using iterator = const_iterator;
+
+    basic_string_set(allocator_type allocator = {}) noexcept : map_(allocator) {}
+    basic_string_set(std::initializer_list<string_view> keys, allocator_type allocator = {}) noexcept(false)
+        : map_(allocator) {
+        reserve(keys.size());
+        for (string_view key : keys) insert(key);
+    }
+
+    size_type size() const noexcept { return map_.size(); }
+    bool empty() const noexcept { return map_.empty(); }
+    size_type capacity() const noexcept { return map_.capacity(); }
+    size_type keys_bytes() const noexcept { return map_.keys_bytes(); }
+    allocator_type get_allocator() const noexcept { return map_.get_allocator(); }
+
+    const_iterator begin() const noexcept { return map_.begin(); }
+    const_iterator end() const noexcept { return map_.end(); }
+    const_iterator find(string_view key) const noexcept { return map_.find(key); }
+    bool contains(string_view key) const noexcept { return map_.contains(key); }
+    size_type count(string_view key) const noexcept { return map_.count(key); }
+
+    /**
+     *  @brief  Inserts the ::key, unless it's already present.
+     *  @return Iterator to the key in the set, and whether the insertion took place.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    std::pair<const_iterator, bool> insert(string_view key) noexcept(false) {
+        auto result = map_.try_emplace(key);
+        return {const_iterator(result.first), result.second};
+    }
+    size_type erase(string_view key) noexcept { return map_.erase(key); }
+    void clear() noexcept { map_.clear(); }
+    void reserve(size_type count) noexcept(false) { map_.reserve(count); }
+};
+
+template <typename mapped_type_>
+using string_map = basic_string_map<mapped_type_, std::allocator<char>>;
+using string_set = basic_string_set<std::allocator<char>>;
+
+#pragma endregion
+
+using sorted_idx_t = sz_sorted_idx_t;
 
 /**
  *  @brief  Internal data-structure used to forward the arguments to the `sz_sort` function.
@@ -3984,6 +5431,53 @@ sz_size_t _call_sequence_member_length(struct sz_sequence_t const *sequence, sz_
 template <typename objects_type_, typename string_extractor_>
 void sorted_order(objects_type_ const *begin, objects_type_ const *end, sorted_idx_t *order,
                   string_extractor_ &&extractor) noexcept {
+    sorted_order(begin, end, order, std::forward<string_extractor_>(extractor), nullptr, nullptr);
+}
+
+/**
+ *  @brief  Computes the permutation of an array, that would lead to sorted order, using a custom executor.
+ *          Produces exactly the same permutation as the serial variant.
+ *
+ *  @param[in] parallel_for    The callback dispatching tasks, like a thread-pool. If NULL, sorts serially.
+ *  @param[in] executor        The opaque state passed to the ::parallel_for callback.
+ *
+ *  @see    sz_sort_parallel
+ */
+template <typename objects_type_, typename string_extractor_>
+void sorted_order(objects_type_ const *begin, objects_type_ const *end, sorted_idx_t *order,
+                  string_extractor_ &&extractor, sz_parallel_for_t parallel_for, void *executor) noexcept {
+
+    // Pack the arguments into a single structure to reference it from the callback.
+    _sequence_args<objects_type_, string_extractor_> args = {begin, static_cast<std::size_t>(end - begin), order,
+                                                             std::forward<string_extractor_>(extractor)};
+    // Populate the array with `iota`-style order.
+    for (std::size_t i = 0; i != args.count; ++i) order[i] = static_cast<sorted_idx_t>(i);
+
+    sz_sequence_t array;
+    array.order = reinterpret_cast<sorted_idx_t *>(order);
+    array.count = args.count;
+    array.handle = &args;
+    array.get_start = _call_sequence_member_start<objects_type_, string_extractor_>;
+    array.get_length = _call_sequence_member_length<objects_type_, string_extractor_>;
+    sz_sort_parallel(&array, parallel_for, executor);
+}
+
+/**
+ *  @brief  Computes the permutation of an array, that would place its ::k smallest elements in sorted order
+ *          at the front, like `std::partial_sort`. Only the radix buckets intersecting the top-k are sorted.
+ *
+ *  @param[in] begin       The pointer to the first element of the array.
+ *  @param[in] end         The pointer to the element after the last element of the array.
+ *  @param[out] order      The pointer to the output array of `end - begin` indices. Only the first `k` are sorted,
+ *                         the rest are the remaining indices in an unspecified order.
+ *  @param[in] k           The number of the smallest elements to sort.
+ *  @param[in] extractor   The function object that extracts the string from the object.
+ *
+ *  @see    sz_sort_partial
+ */
+template <typename objects_type_, typename string_extractor_>
+void partial_sorted_order(objects_type_ const *begin, objects_type_ const *end, sorted_idx_t *order, std::size_t k,
+                          string_extractor_ &&extractor) noexcept {
 
     // Pack the arguments into a single structure to reference it from the callback.
     _sequence_args<objects_type_, string_extractor_> args = {begin, static_cast<std::size_t>(end - begin), order,
@@ -3997,7 +5491,41 @@ void sorted_order(objects_type_ const *begin, objects_type_ const *end, sorted_i
     array.handle = &args;
     array.get_start = _call_sequence_member_start<objects_type_, string_extractor_>;
     array.get_length = _call_sequence_member_length<objects_type_, string_extractor_>;
-    sz_sort(&array);
+    sz_sort_partial(&array, k);
+}
+
+/**
+ *  @brief  Gathers the strings of an array into a contiguous tape with 64-bit offsets, like an Arrow `large_utf8`
+ *          column, so that the following passes over scattered or reordered strings are sequential.
+ *          The elements of the array must be convertible to a `string_view` with the given extractor.
+ *
+ *  @param[in] begin           The pointer to the first element of the array.
+ *  @param[in] end             The pointer to the element after the last element of the array.
+ *  @param[out] offsets        The pointer to the output array of `end - begin + 1` offsets into the ::tape.
+ *  @param[out] tape           The buffer of the returned length. If NULL, only the ::offsets are computed.
+ *  @param[in] extractor       The function object that extracts the string from the object.
+ *  @param[in] parallel_for    The callback dispatching tasks, like a thread-pool. If NULL, copies serially.
+ *  @param[in] executor        The opaque state passed to the ::parallel_for callback.
+ *  @return The total length of all strings.
+ *
+ *  @see    sz_sequence_to_u64tape
+ */
+template <typename objects_type_, typename string_extractor_>
+std::size_t gather_tape(objects_type_ const *begin, objects_type_ const *end, std::uint64_t *offsets, char *tape,
+                        string_extractor_ &&extractor, sz_parallel_for_t parallel_for = nullptr,
+                        void *executor = nullptr) noexcept {
+    static_assert(sizeof(std::uint64_t) == sizeof(sz_u64_t), "The offsets are exported as `sz_u64_t`.");
+
+    // Pack the arguments into a single structure to reference it from the callback.
+    _sequence_args<objects_type_, string_extractor_> args = {begin, static_cast<std::size_t>(end - begin), nullptr,
+                                                             std::forward<string_extractor_>(extractor)};
+    sz_sequence_t array;
+    array.order = nullptr;
+    array.count = args.count;
+    array.handle = &args;
+    array.get_start = _call_sequence_member_start<objects_type_, string_extractor_>;
+    array.get_length = _call_sequence_member_length<objects_type_, string_extractor_>;
+    return sz_sequence_to_u64tape(&array, reinterpret_cast<sz_u64_t *>(offsets), tape, parallel_for, executor);
 }
 
 #if !SZ_AVOID_STL
@@ -4034,6 +5562,178 @@ std::bitset<bitset_bits_> hashes_fingerprint(basic_string<char_type_> const &str
     return ashvardanian::stringzilla::hashes_fingerprint<bitset_bits_>(str.view(), window_length);
 }
 
+/**
+ *  @brief  Computes ::count MinHash signatures of a string over its ::window_length-byte windows.
+ *  @see    sz_hashes_minhash
+ */
+template <typename char_type_>
+void hashes_minhash(basic_string_slice<char_type_> const &str, std::size_t window_length, std::uint32_t *signatures,
+                    std::size_t count) noexcept {
+    static_assert(sizeof(std::uint32_t) == sizeof(sz_u32_t), "The signatures are exported as `sz_u32_t`.");
+    sz_hashes_minhash(str.data(), str.size(), window_length, count, reinterpret_cast<sz_u32_t *>(signatures));
+}
+
+/**
+ *  @brief  Computes ::count_ MinHash signatures of a string over its ::window_length-byte windows.
+ *  @see    sz_hashes_minhash
+ */
+template <std::size_t count_, typename char_type_>
+std::array<std::uint32_t, count_> hashes_minhash(basic_string_slice<char_type_> const &str,
+                                                 std::size_t window_length) noexcept {
+    std::array<std::uint32_t, count_> signatures;
+    ashvardanian::stringzilla::hashes_minhash(str, window_length, signatures.data(), count_);
+    return signatures;
+}
+
+/**
+ *  @brief  Computes ::count_ MinHash signatures of a string over its ::window_length-byte windows.
+ *  @see    sz_hashes_minhash
+ */
+template <std::size_t count_, typename char_type_>
+std::array<std::uint32_t, count_> hashes_minhash(basic_string<char_type_> const &str,
+                                                 std::size_t window_length) noexcept {
+    return ashvardanian::stringzilla::hashes_minhash<count_>(str.view(), window_length);
+}
+
+/**
+ *  @brief  Banded Locality-Sensitive Hashing index over MinHash signatures, used for near-duplicate detection.
+ *
+ *  Every signature of `bands * rows_per_band` words is split into bands, and each band is hashed into a key.
+ *  Two documents become candidates if they share at least one band key, which for a Jaccard similarity `s`
+ *  happens with probability `1 - (1 - s^rows_per_band)^bands`. The index only stores the band keys and the
+ *  identifiers in flat arrays, chained per band through an open bucket table, so no signature is copied.
+ *
+ *  @code{.cpp}
+ *      sz::lsh_index index(16, 4);
+ *      auto signature = sz::hashes_minhash<64>(document, 5);
+ *      index.insert(signature.data(), 42);
+ *      for (auto id : index.candidates(signature.data())) std::printf("%zu\n", (std::size_t)id);
+ *  @endcode
+ *
+ *  @see    sz_hashes_minhash
+ */
+template <typename allocator_type_ = std::allocator<char>>
+class basic_lsh_index {
+  public:
+    using allocator_type = allocator_type_;
+    using size_type = std::size_t;
+    using id_type = std::uint64_t;
+
+  private:
+    template <typename value_type_>
+    using rebound_vector =
+        std::vector<value_type_, typename std::allocator_traits<allocator_type_>::template rebind_alloc<value_type_>>;
+    using link_type = std::uint32_t;
+    static constexpr link_type missing_k = 0xFFFFFFFFu;
+
+    size_type bands_ = 0;
+    size_type rows_per_band_ = 0;
+    size_type buckets_per_band_ = 0;   // Always a power of two, or zero before the first insertion.
+    rebound_vector<id_type> ids_;      // Identifiers in insertion order.
+    rebound_vector<sz_u64_t> keys_;    // `bands_` band keys per identifier.
+    rebound_vector<link_type> next_;   // Next entry in the same bucket, parallel to `keys_`.
+    rebound_vector<link_type> heads_;  // First entry of every bucket, `buckets_per_band_` per band.
+
+    sz_u64_t _band_key(std::uint32_t const *signature, size_type band) const noexcept {
+        std::uint32_t const *rows = signature + band * rows_per_band_;
+        return sz_hash(reinterpret_cast<sz_cptr_t>(rows), rows_per_band_ * sizeof(std::uint32_t));
+    }
+
+    void _rehash(size_type buckets_per_band) noexcept(false) {
+        heads_.assign(bands_ * buckets_per_band, link_type(missing_k));
+        buckets_per_band_ = buckets_per_band;
+        for (size_type entry = 0; entry != keys_.size(); ++entry) _link(entry);
+    }
+
+    void _link(size_type entry) noexcept {
+        size_type band = entry % bands_;
+        link_type &head = heads_[band * buckets_per_band_ + (keys_[entry] & (buckets_per_band_ - 1))];
+        next_[entry] = head;
+        head = static_cast<link_type>(entry);
+    }
+
+  public:
+    /**
+     *  @brief  Constructs an empty index splitting signatures of `bands * rows_per_band` words.
+     *  @param  bands           Number of bands, raising recall as it grows.
+     *  @param  rows_per_band   Number of signature words per band, raising precision as it grows.
+     */
+    basic_lsh_index(size_type bands, size_type rows_per_band, allocator_type allocator = {}) noexcept
+        : bands_(bands ? bands : 1), rows_per_band_(rows_per_band ? rows_per_band : 1), ids_(allocator),
+          keys_(allocator), next_(allocator), heads_(allocator) {}
+
+    size_type size() const noexcept { return ids_.size(); }
+    bool empty() const noexcept { return ids_.empty(); }
+    size_type bands() const noexcept { return bands_; }
+    size_type rows_per_band() const noexcept { return rows_per_band_; }
+    size_type signature_length() const noexcept { return bands_ * rows_per_band_; }
+    allocator_type get_allocator() const noexcept { return ids_.get_allocator(); }
+
+    void clear() noexcept {
+        ids_.clear(), keys_.clear(), next_.clear();
+        heads_.clear(), buckets_per_band_ = 0;
+    }
+
+    /**
+     *  @brief  Preallocates space for ::count identifiers.
+     *  @throw  `std::bad_alloc` if the allocation fails, or `std::length_error` if the entries can't be indexed.
+     */
+    void reserve(size_type count) noexcept(false) {
+        if (count * bands_ >= missing_k) throw std::length_error("sz::basic_lsh_index::reserve");
+        ids_.reserve(count), keys_.reserve(count * bands_), next_.reserve(count * bands_);
+        size_type buckets_per_band = buckets_per_band_ ? buckets_per_band_ : 16;
+        while (buckets_per_band < count) buckets_per_band *= 2;
+        if (buckets_per_band != buckets_per_band_) _rehash(buckets_per_band);
+    }
+
+    /**
+     *  @brief  Adds a document to the index.
+     *  @param  signature   Array of `signature_length()` MinHash words, as produced by `sz_hashes_minhash`.
+     *  @param  id          Identifier reported back from queries, not required to be unique.
+     *  @throw  `std::bad_alloc` if the allocation fails, or `std::length_error` if the entries can't be indexed.
+     */
+    void insert(std::uint32_t const *signature, id_type id) noexcept(false) {
+        if ((ids_.size() + 1) * bands_ >= missing_k) throw std::length_error("sz::basic_lsh_index::insert");
+        if (ids_.size() >= buckets_per_band_) _rehash(buckets_per_band_ ? buckets_per_band_ * 2 : 16);
+        ids_.push_back(id);
+        for (size_type band = 0; band != bands_; ++band) {
+            keys_.push_back(_band_key(signature, band));
+            next_.push_back(link_type(missing_k));
+            _link(keys_.size() - 1);
+        }
+    }
+
+    /**
+     *  @brief  Invokes ::callback with the identifier of every document sharing a band with the ::signature.
+     *          Documents matching in several bands are reported once per matching band.
+     */
+    template <typename callback_type_>
+    void query(std::uint32_t const *signature, callback_type_ &&callback) const noexcept {
+        if (!buckets_per_band_) return;
+        for (size_type band = 0; band != bands_; ++band) {
+            sz_u64_t key = _band_key(signature, band);
+            link_type entry = heads_[band * buckets_per_band_ + (key & (buckets_per_band_ - 1))];
+            for (; entry != missing_k; entry = next_[entry])
+                if (keys_[entry] == key) callback(ids_[entry / bands_]);
+        }
+    }
+
+    /**
+     *  @brief  Collects the identifiers of all documents sharing at least one band with the ::signature.
+     *  @return Sorted array of unique identifiers.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    std::vector<id_type> candidates(std::uint32_t const *signature) const noexcept(false) {
+        std::vector<id_type> result;
+        query(signature, [&](id_type id) { result.push_back(id); });
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    }
+};
+
+using lsh_index = basic_lsh_index<std::allocator<char>>;
+
 /**
  *  @brief  Computes the permutation of an array, that would lead to sorted order.
  *  @return The array of indices, that will be populated with the permutation.
@@ -4072,6 +5772,428 @@ std::vector<sorted_idx_t> sorted_order(std::vector<string_like_type_> const &arr
                         [](string_like_type_ const &s) -> string_view { return s; });
 }
 
+/**
+ *  @brief  Computes the permutation of an array, that would lead to sorted order, using multiple threads.
+ *          Produces exactly the same permutation as the single-threaded variant.
+ *
+ *  @param[in] threads      The number of threads to use, including the calling one.
+ *  @see    sz_sort_parallel
+ */
+template <typename objects_type_, typename string_extractor_>
+void sorted_order(objects_type_ const *begin, objects_type_ const *end, sorted_idx_t *order,
+                  string_extractor_ &&extractor, std::size_t threads) noexcept {
+    if (threads <= 1) return sorted_order(begin, end, order, std::forward<string_extractor_>(extractor));
+    sorted_order(begin, end, order, std::forward<string_extractor_>(extractor), &_parallel_for_std_threads, &threads);
+}
+
+/**
+ *  @brief  Computes the permutation of an array, that would lead to sorted order, using multiple threads.
+ *  @param[in] threads      The number of threads to use, including the calling one.
+ *  @return The array of indices, that will be populated with the permutation.
+ *  @throw  `std::bad_alloc` if the allocation fails.
+ */
+template <typename string_like_type_>
+std::vector<sorted_idx_t> sorted_order(std::vector<string_like_type_> const &array,
+                                       std::size_t threads) noexcept(false) {
+    static_assert(std::is_convertible<string_like_type_, string_view>::value,
+                  "The type must be convertible to string_view.");
+    std::vector<sorted_idx_t> order(array.size());
+    sorted_order(array.data(), array.data() + array.size(), order.data(),
+                 [](string_like_type_ const &s) -> string_view { return s; }, threads);
+    return order;
+}
+
+/**
+ *  @brief  Computes the indices of the ::k smallest elements of an array in sorted order, like a top-k query.
+ *  @return The array of `min(k, array.size())` indices.
+ *  @throw  `std::bad_alloc` if the allocation fails.
+ *  @see    sz_sort_partial
+ */
+template <typename string_like_type_>
+std::vector<sorted_idx_t> partial_sorted_order(std::vector<string_like_type_> const &array,
+                                               std::size_t k) noexcept(false) {
+    static_assert(std::is_convertible<string_like_type_, string_view>::value,
+                  "The type must be convertible to string_view.");
+    std::vector<sorted_idx_t> order(array.size());
+    partial_sorted_order(array.data(), array.data() + array.size(), order.data(), k,
+                         [](string_like_type_ const &s) -> string_view { return s; });
+    if (k < order.size()) order.resize(k);
+    return order;
+}
+
+/**
+ *  @brief  Gathers the strings of an array into a contiguous ::tape, potentially using multiple threads.
+ *  @param[out] tape        The string to overwrite with the concatenation of all strings.
+ *  @param[in] threads      The number of threads to use, including the calling one.
+ *  @return The array of `array.size() + 1` offsets into the ::tape.
+ *  @throw  `std::bad_alloc` if the allocation fails.
+ *  @see    sz_sequence_to_u64tape
+ */
+template <typename string_like_type_>
+std::vector<std::uint64_t> gather_tape(std::vector<string_like_type_> const &array, std::string &tape,
+                                       std::size_t threads = 1) noexcept(false) {
+    static_assert(std::is_convertible<string_like_type_, string_view>::value,
+                  "The type must be convertible to string_view.");
+    auto extractor = [](string_like_type_ const &s) -> string_view { return s; };
+    std::vector<std::uint64_t> offsets(array.size() + 1);
+    string_like_type_ const *begin = array.data(), *end = array.data() + array.size();
+    tape.resize(gather_tape(begin, end, offsets.data(), nullptr, extractor));
+    if (threads <= 1) gather_tape(begin, end, offsets.data(), &tape[0], extractor);
+    else { gather_tape(begin, end, offsets.data(), &tape[0], extractor, &_parallel_for_std_threads, &threads); }
+    return offsets;
+}
+
+/**
+ *  @brief  Immutable front-coded array of sorted strings, like the term dictionaries of search engines.
+ *
+ *  Strings are split into blocks of `block_size()` consecutive entries. The first one in every block is stored
+ *  in full, and each following one only as the length of the prefix shared with its predecessor and the rest.
+ *  On sorted URLs, paths, or keys with long shared prefixes, it takes a fraction of the memory of a tape.
+ *  Lookups binary-search the block heads with ::sz_order, and then scan a single block, comparing only the
+ *  stored suffixes, without ever reconstructing the strings.
+ *
+ *  The whole array is a single buffer, that can be written to disk as-is, memory-mapped, and addressed in place
+ *  with `view()`. It starts with a 32-byte header of four 64-bit words in native byte order: the "sz-fc-01"
+ *  magic, the number of strings, the block size, and the number of blocks. It is followed by `blocks + 1`
+ *  64-bit offsets of the blocks after the table, and the blocks themselves, using LEB128 for all the lengths.
+ *
+ *  @code{.cpp}
+ *      sz::sorted_strings dictionary(urls); // Sorts a copy internally
+ *      std::size_t index = dictionary.find("https://example.com/");
+ *      std::string url = dictionary[index];
+ *  @endcode
+ *
+ *  @tparam allocator_type_ Allocator for the owned buffer.
+ *  @see    sz_order, sz_sort
+ */
+template <typename allocator_type_ = std::allocator<char>>
+class basic_sorted_strings {
+  public:
+    using allocator_type = allocator_type_;
+    using size_type = std::size_t;
+    static constexpr size_type npos = size_type(-1);
+    static constexpr size_type header_length_k = 32;
+
+  private:
+    using buffer_type = std::vector<char, typename std::allocator_traits<allocator_type_>::template rebind_alloc<char>>;
+
+    buffer_type owned_;                // The serialized array, unless it's a `view()` of external memory.
+    char const *external_ = nullptr;   // The serialized array, if it's a `view()` of external memory.
+    size_type count_ = 0;              // Number of strings.
+    size_type block_size_ = 1;         // Number of strings per block.
+    size_type blocks_ = 0;             // Number of blocks.
+
+    static string_view _magic() noexcept { return string_view("sz-fc-01", 8); }
+    char const *_bytes() const noexcept { return external_ ? external_ : owned_.data(); }
+    char const *_blocks() const noexcept { return _bytes() + header_length_k + (blocks_ + 1) * 8; }
+
+    static sz_u64_t _load(char const *source) noexcept {
+        sz_u64_t value;
+        sz_copy(reinterpret_cast<sz_ptr_t>(&value), source, 8);
+        return value;
+    }
+    static void _store(buffer_type &target, sz_u64_t value) noexcept(false) {
+        char const *bytes = reinterpret_cast<char const *>(&value);
+        target.insert(target.end(), bytes, bytes + 8);
+    }
+    static void _store_varint(buffer_type &target, size_type value) noexcept(false) {
+        for (; value >= 0x80; value >>= 7) target.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        target.push_back(static_cast<char>(value));
+    }
+    static size_type _load_varint(char const *&source) noexcept {
+        size_type value = 0;
+        for (unsigned shift = 0;; shift += 7) {
+            sz_u8_t byte = static_cast<sz_u8_t>(*source++);
+            value |= static_cast<size_type>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return value;
+        }
+    }
+    /** @brief  Bounds-checked `_load_varint`, reporting truncated or overlong encodings. */
+    static bool _load_varint(char const *&source, char const *end, size_type &value) noexcept {
+        value = 0;
+        for (unsigned shift = 0; source != end && shift < sizeof(size_type) * 8; shift += 7) {
+            sz_u8_t byte = static_cast<sz_u8_t>(*source++);
+            value |= static_cast<size_type>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return true;
+        }
+        return false;
+    }
+    /** @brief  Checks that a block of ::entries fits exactly in `[cursor, end)`, and every prefix is inherited. */
+    static bool _block_is_valid(char const *cursor, char const *end, size_type entries) noexcept {
+        size_type length, shared, suffix_length;
+        if (!_load_varint(cursor, end, length) || length > static_cast<size_type>(end - cursor)) return false;
+        cursor += length;
+        for (size_type i = 1; i != entries; ++i) {
+            if (!_load_varint(cursor, end, shared) || shared > length) return false;
+            if (!_load_varint(cursor, end, suffix_length) || suffix_length > static_cast<size_type>(end - cursor))
+                return false;
+            cursor += suffix_length;
+            length = shared + suffix_length;
+        }
+        return cursor == end;
+    }
+    static size_type _common_prefix(char const *a, char const *b, size_type length) noexcept {
+        size_type i = 0;
+        for (sz_u64_t a_word, b_word; i + 8 <= length; i += 8) {
+            sz_copy(reinterpret_cast<sz_ptr_t>(&a_word), a + i, 8);
+            sz_copy(reinterpret_cast<sz_ptr_t>(&b_word), b + i, 8);
+            if (a_word != b_word) break;
+        }
+        while (i != length && a[i] == b[i]) ++i;
+        return i;
+    }
+
+    /** @brief  The head of a block, stored in full, and the pointer to the entries following it. */
+    string_view _head(size_type block, char const *&following) const noexcept {
+        following = _blocks() + _load(_bytes() + header_length_k + block * 8);
+        size_type length = _load_varint(following);
+        string_view head(following, length);
+        following += length;
+        return head;
+    }
+
+    /**
+     *  @brief  Finds the first entry not less than the ::query, reporting if it's equal to it.
+     *          Front-coding means that, while scanning the block, every entry shares at least `matched` bytes
+     *          with the query, if it shares more than that with the previous entry, that was smaller.
+     */
+    size_type _lower_bound(string_view query, bool &is_equal) const noexcept {
+        is_equal = false;
+        if (!blocks_) return 0;
+
+        // Find the first block, whose head isn't less than the query
+        size_type first = 0, last = blocks_;
+        char const *following;
+        while (first < last) {
+            size_type middle = first + (last - first) / 2;
+            string_view head = _head(middle, following);
+            if (sz_order(head.data(), head.size(), query.data(), query.size()) == sz_less_k) first = middle + 1;
+            else { last = middle; }
+        }
+        if (first != blocks_) is_equal = _head(first, following) == query;
+        if (first == 0) return 0;
+
+        // The answer is either in the previous block, whose head is less than the query, or at the found head
+        size_type const block = first - 1;
+        string_view head = _head(block, following);
+        size_type matched = _common_prefix(head.data(), query.data(), sz_min_of_two(head.size(), query.size()));
+        size_type const begin = block * block_size_, end = sz_min_of_two(begin + block_size_, count_);
+        for (size_type index = begin + 1; index != end; ++index) {
+            size_type shared = _load_varint(following);
+            size_type suffix_length = _load_varint(following);
+            char const *suffix = following;
+            following += suffix_length;
+            if (shared > matched) continue; // Same as the previous one, at the first mismatch with the query
+            if (shared < matched) return is_equal = false, index; // Greater than the previous one, and the query
+
+            size_type rest = query.size() - matched;
+            size_type common = _common_prefix(suffix, query.data() + matched, sz_min_of_two(suffix_length, rest));
+            if (common == suffix_length) {
+                if (common == rest) return is_equal = true, index;
+                matched += common; // The entry is a prefix of the query
+                continue;
+            }
+            if (common == rest) return is_equal = false, index; // The query is a prefix of the entry
+            if (static_cast<sz_u8_t>(suffix[common]) > static_cast<sz_u8_t>(query[matched + common]))
+                return is_equal = false, index;
+            matched += common;
+        }
+        return end;
+    }
+
+    void _assign(sz_sequence_t const &sequence, size_type block_size) noexcept(false) {
+        count_ = sequence.count;
+        block_size_ = block_size ? block_size : 1;
+        blocks_ = (count_ + block_size_ - 1) / block_size_;
+
+        buffer_type blocks(owned_.get_allocator());
+        buffer_type offsets(owned_.get_allocator());
+        string_view previous;
+        for (size_type i = 0; i != count_; ++i) {
+            sz_size_t member = sequence.order ? sequence.order[i] : i;
+            string_view current(sequence.get_start(&sequence, member), sequence.get_length(&sequence, member));
+            if (i % block_size_ == 0) {
+                _store(offsets, blocks.size());
+                _store_varint(blocks, current.size());
+                blocks.insert(blocks.end(), current.begin(), current.end());
+            }
+            else {
+                size_type shared =
+                    _common_prefix(previous.data(), current.data(), sz_min_of_two(previous.size(), current.size()));
+                _store_varint(blocks, shared);
+                _store_varint(blocks, current.size() - shared);
+                blocks.insert(blocks.end(), current.begin() + shared, current.end());
+            }
+            previous = current;
+        }
+        _store(offsets, blocks.size());
+
+        owned_.clear();
+        owned_.reserve(header_length_k + offsets.size() + blocks.size());
+        owned_.insert(owned_.end(), _magic().begin(), _magic().end());
+        _store(owned_, count_), _store(owned_, block_size_), _store(owned_, blocks_);
+        owned_.insert(owned_.end(), offsets.begin(), offsets.end());
+        owned_.insert(owned_.end(), blocks.begin(), blocks.end());
+        external_ = nullptr;
+    }
+
+  public:
+    basic_sorted_strings(allocator_type allocator = {}) noexcept : owned_(allocator) {}
+
+    /**
+     *  @brief  Front-codes the strings of a ::sequence, following its `order`, if it's set, like after `sz_sort`.
+     *          The strings must already be sorted in that order.
+     *  @param  block_size  Number of strings per block, trading the lookup speed for space as it grows.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    basic_sorted_strings(sz_sequence_t const &sequence, size_type block_size = 16,
+                         allocator_type allocator = {}) noexcept(false)
+        : owned_(allocator) {
+        _assign(sequence, block_size);
+    }
+
+    /**
+     *  @brief  Sorts and front-codes an array of strings, leaving the array itself intact.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    template <typename string_like_type_>
+    explicit basic_sorted_strings(std::vector<string_like_type_> const &array, size_type block_size = 16,
+                                  allocator_type allocator = {}) noexcept(false)
+        : owned_(allocator) {
+        static_assert(std::is_convertible<string_like_type_, string_view>::value,
+                      "The type must be convertible to string_view.");
+        using extractor_type = string_view (*)(string_like_type_ const &);
+        extractor_type extractor = [](string_like_type_ const &s) -> string_view { return s; };
+        std::vector<sorted_idx_t> order = sorted_order(array.data(), array.data() + array.size(), extractor);
+        _sequence_args<string_like_type_, extractor_type> args = {array.data(), array.size(), order.data(),
+                                                                  extractor};
+        sz_sequence_t sequence;
+        sequence.order = order.data();
+        sequence.count = array.size();
+        sequence.handle = &args;
+        sequence.get_start = _call_sequence_member_start<string_like_type_, extractor_type>;
+        sequence.get_length = _call_sequence_member_length<string_like_type_, extractor_type>;
+        _assign(sequence, block_size);
+    }
+
+    /**
+     *  @brief  Addresses a previously `serialized()` array in place, like a memory-mapped file.
+     *          The ::buffer must outlive the view and all of its copies. Its structure is validated in linear
+     *          time, touching every byte once: the offsets table, and the lengths of every entry in every block.
+     *          The order of the strings isn't checked, so an unsorted array yields meaningless lookups.
+     *  @throw  `std::invalid_argument` if the ::buffer doesn't contain a well-formed front-coded array.
+     */
+    static basic_sorted_strings view(string_view buffer) noexcept(false) {
+        basic_sorted_strings result;
+        if (buffer.size() < header_length_k || !(buffer.substr(0, 8) == _magic()))
+            throw std::invalid_argument("sz::basic_sorted_strings::view");
+        result.count_ = static_cast<size_type>(_load(buffer.data() + 8));
+        result.block_size_ = static_cast<size_type>(_load(buffer.data() + 16));
+        result.blocks_ = static_cast<size_type>(_load(buffer.data() + 24));
+        bool const is_valid = result.block_size_ &&
+                              result.blocks_ == result.count_ / result.block_size_ +
+                                                    (result.count_ % result.block_size_ != 0) &&
+                              (buffer.size() - header_length_k) / 8 > result.blocks_;
+        if (!is_valid) throw std::invalid_argument("sz::basic_sorted_strings::view");
+
+        // Every block must start where the previous one ends, and fit its entries exactly
+        char const *table = buffer.data() + header_length_k;
+        size_type const table_length = header_length_k + (result.blocks_ + 1) * 8;
+        char const *blocks = buffer.data() + table_length;
+        sz_u64_t const payload_length = buffer.size() - table_length;
+        if (_load(table) != 0) throw std::invalid_argument("sz::basic_sorted_strings::view");
+        for (size_type block = 0; block != result.blocks_; ++block) {
+            sz_u64_t const begin = _load(table + block * 8), end = _load(table + block * 8 + 8);
+            size_type const entries = sz_min_of_two(result.block_size_, result.count_ - block * result.block_size_);
+            if (end < begin || end > payload_length || !_block_is_valid(blocks + begin, blocks + end, entries))
+                throw std::invalid_argument("sz::basic_sorted_strings::view");
+        }
+        result.external_ = buffer.data();
+        return result;
+    }
+
+    size_type size() const noexcept { return count_; }
+    bool empty() const noexcept { return count_ == 0; }
+    size_type block_size() const noexcept { return block_size_; }
+    allocator_type get_allocator() const noexcept { return owned_.get_allocator(); }
+
+    /** @brief  The whole array in its serialized form, that can be persisted and later passed to `view()`. */
+    string_view serialized() const noexcept {
+        if (external_) return {external_, header_length_k + (blocks_ + 1) * 8 + _load(_blocks() - 8)};
+        return {owned_.data(), owned_.size()};
+    }
+
+    /** @brief  Finds the index of the first string not less than the ::query, or `size()` if there is none. */
+    size_type lower_bound(string_view query) const noexcept {
+        bool is_equal;
+        return _lower_bound(query, is_equal);
+    }
+
+    /** @brief  Finds the index of the first string equal to the ::query, or `npos` if there is none. */
+    size_type find(string_view query) const noexcept {
+        bool is_equal;
+        size_type index = _lower_bound(query, is_equal);
+        if (!is_equal) return npos;
+        return index;
+    }
+
+    bool contains(string_view query) const noexcept { return find(query) != npos; }
+
+    /**
+     *  @brief  Invokes ::callback with the index and the reconstructed `string_view` of every string in order.
+     *          The views are only valid until the callback returns.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    template <typename callback_type_>
+    void for_each(callback_type_ &&callback) const noexcept(false) {
+        std::string current;
+        for (size_type block = 0; block != blocks_; ++block) {
+            char const *following;
+            string_view head = _head(block, following);
+            current.assign(head.data(), head.size());
+            size_type const begin = block * block_size_, end = sz_min_of_two(begin + block_size_, count_);
+            callback(begin, string_view(current.data(), current.size()));
+            for (size_type index = begin + 1; index != end; ++index) {
+                size_type shared = _load_varint(following);
+                size_type suffix_length = _load_varint(following);
+                current.resize(shared);
+                current.append(following, suffix_length);
+                following += suffix_length;
+                callback(index, string_view(current.data(), current.size()));
+            }
+        }
+    }
+
+    /**
+     *  @brief  Reconstructs the string at the given ::index, decoding at most one block.
+     *  @throw  `std::bad_alloc` if the allocation fails.
+     */
+    std::string operator[](size_type index) const noexcept(false) {
+        char const *following;
+        string_view head = _head(index / block_size_, following);
+        std::string current(head.data(), head.size());
+        for (size_type i = index % block_size_; i != 0; --i) {
+            size_type shared = _load_varint(following);
+            size_type suffix_length = _load_varint(following);
+            current.resize(shared);
+            current.append(following, suffix_length);
+            following += suffix_length;
+        }
+        return current;
+    }
+
+    /**
+     *  @brief  Reconstructs the string at the given ::index, checking the bounds.
+     *  @throw  `std::out_of_range` if the ::index is out of bounds, or `std::bad_alloc` if the allocation fails.
+     */
+    std::string at(size_type index) const noexcept(false) {
+        if (index >= count_) throw std::out_of_range("sz::basic_sorted_strings::at");
+        return operator[](index);
+    }
+};
+
+using sorted_strings = basic_sorted_strings<std::allocator<char>>;
+
 #endif
 
 } // namespace stringzilla
@@ -14,24 +14,141 @@
 
 #include <stringzilla/stringzilla.h> // `sz_*` functions
 
+/**
+ *  @brief  Borrows the bytes of a `Buffer`, any other `TypedArray`, a `DataView`, or an `ArrayBuffer` in-place,
+ *          or exports a string into a new UTF-8 buffer, as JavaScript strings are not stored in UTF-8.
+ *          The exported strings are marked as @b owned and must be released with `free`.
+ *  @return `true` on success, `false` if the value is of an unsupported type, throwing a `TypeError`.
+ */
+static bool viewFromValue(napi_env env, napi_value value, sz_string_view_t *view, bool *owned) {
+    static size_t const typed_array_element_sizes[] = {1, 1, 1, 2, 2, 4, 4, 4, 8, 8, 8};
+    bool is_typed_array = false, is_data_view = false, is_array_buffer = false;
+    void *data = NULL;
+    size_t length = 0;
+    *owned = false;
+
+    napi_is_typedarray(env, value, &is_typed_array);
+    if (is_typed_array) {
+        napi_typedarray_type type;
+        napi_get_typedarray_info(env, value, &type, &length, &data, NULL, NULL);
+        view->start = (sz_cptr_t)data;
+        view->length = length * typed_array_element_sizes[type];
+        return true;
+    }
+    napi_is_dataview(env, value, &is_data_view);
+    if (is_data_view) {
+        napi_get_dataview_info(env, value, &length, &data, NULL, NULL);
+        view->start = (sz_cptr_t)data;
+        view->length = length;
+        return true;
+    }
+    napi_is_arraybuffer(env, value, &is_array_buffer);
+    if (is_array_buffer) {
+        napi_get_arraybuffer_info(env, value, &data, &length);
+        view->start = (sz_cptr_t)data;
+        view->length = length;
+        return true;
+    }
+
+    // Strings have to be exported, first measuring the UTF-8 length, then copying the contents
+    if (napi_get_value_string_utf8(env, value, NULL, 0, &length) != napi_ok) {
+        napi_throw_type_error(env, NULL, "Expected a string, a Buffer, a TypedArray, or an ArrayBuffer");
+        return false;
+    }
+    char *copy = malloc(length + 1);
+    if (!copy) {
+        napi_throw_error(env, NULL, "Failed to allocate memory for the string");
+        return false;
+    }
+    napi_get_value_string_utf8(env, value, copy, length + 1, &length);
+    view->start = copy;
+    view->length = length;
+    *owned = true;
+    return true;
+}
+
+/** @brief  Releases the views exported with `viewsFromArray`, freeing the strings copies. */
+static void releaseViews(sz_string_view_t *views, bool *owned, uint32_t count) {
+    for (uint32_t i = 0; i != count; ++i)
+        if (owned[i]) free((void *)views[i].start);
+    free(views);
+    free(owned);
+}
+
+/**
+ *  @brief  Borrows or exports every entry of a JavaScript `Array` of strings or binary buffers.
+ *          On success, the @b views and @b owned arrays must be released with `releaseViews`.
+ */
+static bool viewsFromArray(napi_env env, napi_value array, sz_string_view_t **views, bool **owned, uint32_t *count) {
+    bool is_array = false;
+    napi_is_array(env, array, &is_array);
+    if (!is_array) {
+        napi_throw_type_error(env, NULL, "Expected an Array of strings or binary buffers");
+        return false;
+    }
+    napi_get_array_length(env, array, count);
+    *views = malloc(sizeof(sz_string_view_t) * (*count + 1));
+    *owned = calloc(*count + 1, sizeof(bool));
+    if (!*views || !*owned) {
+        free(*views), free(*owned);
+        napi_throw_error(env, NULL, "Failed to allocate memory for the views");
+        return false;
+    }
+    for (uint32_t i = 0; i != *count; ++i) {
+        napi_value element;
+        napi_get_element(env, array, i, &element);
+        if (!viewFromValue(env, element, *views + i, *owned + i)) {
+            *count = i;
+            releaseViews(*views, *owned, *count);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ *  @brief  Allocates a `BigInt64Array` or a `BigUint64Array` of @b count entries, into which the `sz_size_t`
+ *          results can be written directly, once widened with `widenSizes` on 32-bit platforms.
+ *  @return `true` on success, `false` if the allocation failed, throwing an `Error`.
+ */
+static bool createBigIntArray(napi_env env, napi_typedarray_type type, size_t count, sz_size_t **data,
+                              napi_value *result) {
+    napi_value buffer;
+    if (napi_create_arraybuffer(env, count * sizeof(sz_u64_t), (void **)data, &buffer) != napi_ok ||
+        napi_create_typedarray(env, type, count, buffer, 0, result) != napi_ok) {
+        napi_throw_error(env, NULL, "Failed to allocate memory for the results");
+        *result = NULL;
+        return false;
+    }
+    return true;
+}
+
+static void widenSizes(sz_size_t *sizes, size_t count) {
+#if !SZ_DETECT_64_BIT
+    // Going backwards, every 64-bit entry only overwrites the narrower ones, that were already widened
+    for (size_t i = count; i != 0; --i) {
+        sz_size_t size = sizes[i - 1];
+        ((sz_i64_t *)sizes)[i - 1] = size == SZ_SIZE_MAX ? -1 : (sz_i64_t)size;
+    }
+#else
+    sz_unused(sizes && count);
+#endif
+}
+
 napi_value indexOfAPI(napi_env env, napi_callback_info info) {
     size_t argc = 2;
     napi_value args[2];
     napi_get_cb_info(env, info, &argc, args, NULL, NULL);
 
-    // Extract the C string from the JavaScript string for haystack and needle
+    // Borrow or export the haystack and the needle
     sz_string_view_t haystack = {NULL, 0};
     sz_string_view_t needle = {NULL, 0};
-
-    // For haystack
-    napi_get_value_string_utf8(env, args[0], NULL, 0, (size_t *)&haystack.length);
-    haystack.start = malloc(haystack.length + 1);
-    napi_get_value_string_utf8(env, args[0], (char *)haystack.start, haystack.length + 1, (size_t *)&haystack.length);
-
-    // For needle
-    napi_get_value_string_utf8(env, args[1], NULL, 0, (size_t *)&needle.length);
-    needle.start = malloc(needle.length + 1);
-    napi_get_value_string_utf8(env, args[1], (char *)needle.start, needle.length + 1, (size_t *)&needle.length);
+    bool haystack_owned, needle_owned;
+    if (!viewFromValue(env, args[0], &haystack, &haystack_owned)) return NULL;
+    if (!viewFromValue(env, args[1], &needle, &needle_owned)) {
+        if (haystack_owned) free((void *)haystack.start);
+        return NULL;
+    }
 
     // Convert the result to JavaScript BigInt and return
     napi_value js_result;
@@ -45,8 +162,8 @@ napi_value indexOfAPI(napi_env env, napi_callback_info info) {
     }
 
     // Cleanup
-    free((void *)haystack.start);
-    free((void *)needle.start);
+    if (haystack_owned) free((void *)haystack.start);
+    if (needle_owned) free((void *)needle.start);
     return js_result;
 }
 
@@ -55,51 +172,25 @@ napi_value countAPI(napi_env env, napi_callback_info info) {
     napi_value args[3];
     napi_get_cb_info(env, info, &argc, args, NULL, NULL);
 
-    // Extract the C string from the JavaScript string for haystack and needle
+    // Borrow or export the haystack and the needle
     sz_string_view_t haystack = {NULL, 0};
     sz_string_view_t needle = {NULL, 0};
-
-    // For haystack
-    napi_get_value_string_utf8(env, args[0], NULL, 0, (size_t *)&haystack.length);
-    haystack.start = malloc(haystack.length + 1);
-    napi_get_value_string_utf8(env, args[0], (char *)haystack.start, haystack.length + 1, (size_t *)&haystack.length);
-
-    // For needle
-    napi_get_value_string_utf8(env, args[1], NULL, 0, (size_t *)&needle.length);
-    needle.start = malloc(needle.length + 1);
-    napi_get_value_string_utf8(env, args[1], (char *)needle.start, needle.length + 1, (size_t *)&needle.length);
+    bool haystack_owned, needle_owned;
+    if (!viewFromValue(env, args[0], &haystack, &haystack_owned)) return NULL;
+    if (!viewFromValue(env, args[1], &needle, &needle_owned)) {
+        if (haystack_owned) free((void *)haystack.start);
+        return NULL;
+    }
 
     bool overlap = false;
     if (argc > 2) { napi_get_value_bool(env, args[2], &overlap); }
 
-    void const *haystack_start = haystack.start, *needle_start = needle.start;
-
-    size_t count = 0;
-    if (needle.length == 0 || haystack.length == 0 || haystack.length < needle.length) { count = 0; }
-    else if (overlap) {
-        while (haystack.length) {
-            sz_cptr_t ptr = sz_find(haystack.start, haystack.length, needle.start, needle.length);
-            sz_bool_t found = ptr != NULL;
-            sz_size_t offset = found ? (sz_size_t)(ptr - haystack.start) : haystack.length;
-            count += found;
-            haystack.start += offset + found;
-            haystack.length -= offset + found;
-        }
-    }
-    else {
-        while (haystack.length) {
-            sz_cptr_t ptr = sz_find(haystack.start, haystack.length, needle.start, needle.length);
-            sz_bool_t found = ptr != NULL;
-            sz_size_t offset = found ? (sz_size_t)(ptr - haystack.start) : haystack.length;
-            count += found;
-            haystack.start += offset + needle.length;
-            haystack.length -= offset + needle.length * found;
-        }
-    }
+    // Empty needles are never counted
+    size_t count = sz_count(haystack.start, haystack.length, needle.start, needle.length, (sz_bool_t)overlap);
 
     // Cleanup
-    free((void *)haystack_start);
-    free((void *)needle_start);
+    if (haystack_owned) free((void *)haystack.start);
+    if (needle_owned) free((void *)needle.start);
 
     // Convert the `count` to JavaScript `BigInt` and return
     napi_value js_count;
@@ -108,12 +199,152 @@ napi_value countAPI(napi_env env, napi_callback_info info) {
     return js_count;
 }
 
+napi_value findAllAPI(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    napi_get_cb_info(env, info, &argc, args, NULL, NULL);
+
+    sz_string_view_t haystack = {NULL, 0};
+    sz_string_view_t needle = {NULL, 0};
+    bool haystack_owned, needle_owned;
+    if (!viewFromValue(env, args[0], &haystack, &haystack_owned)) return NULL;
+    if (!viewFromValue(env, args[1], &needle, &needle_owned)) {
+        if (haystack_owned) free((void *)haystack.start);
+        return NULL;
+    }
+
+    bool overlap = false;
+    if (argc > 2) { napi_get_value_bool(env, args[2], &overlap); }
+
+    // Count the matches first, to export their offsets straight into the `BigUint64Array`
+    napi_value js_offsets;
+    sz_size_t *offsets;
+    size_t count = sz_count(haystack.start, haystack.length, needle.start, needle.length, (sz_bool_t)overlap);
+    if (createBigIntArray(env, napi_biguint64_array, count, &offsets, &js_offsets)) {
+        sz_find_all(haystack.start, haystack.length, needle.start, needle.length, (sz_bool_t)overlap, offsets,
+                    count);
+        widenSizes(offsets, count);
+    }
+
+    if (haystack_owned) free((void *)haystack.start);
+    if (needle_owned) free((void *)needle.start);
+    return js_offsets;
+}
+
+napi_value indexOfBatchAPI(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, NULL, NULL);
+
+    sz_string_view_t *haystacks = NULL;
+    bool *haystacks_owned = NULL;
+    uint32_t count = 0;
+    sz_string_view_t needle = {NULL, 0};
+    bool needle_owned;
+    if (!viewsFromArray(env, args[0], &haystacks, &haystacks_owned, &count)) return NULL;
+    if (!viewFromValue(env, args[1], &needle, &needle_owned)) {
+        releaseViews(haystacks, haystacks_owned, count);
+        return NULL;
+    }
+
+    // The missing matches are reported as `SZ_SIZE_MAX`, which becomes -1 in the `BigInt64Array`
+    napi_value js_offsets;
+    sz_size_t *offsets;
+    if (createBigIntArray(env, napi_bigint64_array, count, &offsets, &js_offsets)) {
+        sz_sequence_t sequence;
+        sz_sequence_from_views(haystacks, count, &sequence);
+        sz_find_batch(&sequence, needle.start, needle.length, offsets);
+        widenSizes(offsets, count);
+    }
+
+    releaseViews(haystacks, haystacks_owned, count);
+    if (needle_owned) free((void *)needle.start);
+    return js_offsets;
+}
+
+napi_value countBatchAPI(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    napi_get_cb_info(env, info, &argc, args, NULL, NULL);
+
+    sz_string_view_t *haystacks = NULL;
+    bool *haystacks_owned = NULL;
+    uint32_t count = 0;
+    sz_string_view_t needle = {NULL, 0};
+    bool needle_owned;
+    if (!viewsFromArray(env, args[0], &haystacks, &haystacks_owned, &count)) return NULL;
+    if (!viewFromValue(env, args[1], &needle, &needle_owned)) {
+        releaseViews(haystacks, haystacks_owned, count);
+        return NULL;
+    }
+
+    bool overlap = false;
+    if (argc > 2) { napi_get_value_bool(env, args[2], &overlap); }
+
+    napi_value js_counts;
+    sz_size_t *counts;
+    if (createBigIntArray(env, napi_biguint64_array, count, &counts, &js_counts)) {
+        sz_sequence_t sequence;
+        sz_sequence_from_views(haystacks, count, &sequence);
+        sz_count_batch(&sequence, needle.start, needle.length, (sz_bool_t)overlap, counts);
+        widenSizes(counts, count);
+    }
+
+    releaseViews(haystacks, haystacks_owned, count);
+    if (needle_owned) free((void *)needle.start);
+    return js_counts;
+}
+
+napi_value editDistancesAPI(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    napi_get_cb_info(env, info, &argc, args, NULL, NULL);
+
+    sz_string_view_t query = {NULL, 0};
+    bool query_owned;
+    sz_string_view_t *candidates = NULL;
+    bool *candidates_owned = NULL;
+    uint32_t count = 0;
+    if (!viewFromValue(env, args[0], &query, &query_owned)) return NULL;
+    if (!viewsFromArray(env, args[1], &candidates, &candidates_owned, &count)) {
+        if (query_owned) free((void *)query.start);
+        return NULL;
+    }
+
+    int64_t bound = 0;
+    if (argc > 2) { napi_get_value_int64(env, args[2], &bound); }
+
+    napi_value js_distances;
+    sz_size_t *distances;
+    if (createBigIntArray(env, napi_biguint64_array, count, &distances, &js_distances)) {
+        sz_sequence_t sequence;
+        sz_sequence_from_views(candidates, count, &sequence);
+        sz_size_t const limit = bound > 0 ? (sz_size_t)bound : 0;
+        if (sz_edit_distances(query.start, query.length, &sequence, limit, NULL, distances)) {
+            widenSizes(distances, count);
+        }
+        else {
+            napi_throw_error(env, NULL, "Failed to allocate memory for the edit distances");
+            js_distances = NULL;
+        }
+    }
+
+    if (query_owned) free((void *)query.start);
+    releaseViews(candidates, candidates_owned, count);
+    return js_distances;
+}
+
 napi_value Init(napi_env env, napi_value exports) {
 
     // Define an array of property descriptors
     napi_property_descriptor findDesc = {"indexOf", 0, indexOfAPI, 0, 0, 0, napi_default, 0};
     napi_property_descriptor countDesc = {"count", 0, countAPI, 0, 0, 0, napi_default, 0};
-    napi_property_descriptor properties[] = {findDesc, countDesc};
+    napi_property_descriptor findAllDesc = {"findAll", 0, findAllAPI, 0, 0, 0, napi_default, 0};
+    napi_property_descriptor findBatchDesc = {"indexOfBatch", 0, indexOfBatchAPI, 0, 0, 0, napi_default, 0};
+    napi_property_descriptor countBatchDesc = {"countBatch", 0, countBatchAPI, 0, 0, 0, napi_default, 0};
+    napi_property_descriptor editDistancesDesc = {"editDistances", 0, editDistancesAPI, 0, 0, 0, napi_default, 0};
+    napi_property_descriptor properties[] = {findDesc,       countDesc,         findAllDesc, findBatchDesc,
+                                             countBatchDesc, editDistancesDesc};
 
     // Define the properties on the `exports` object
     size_t propertyCount = sizeof(properties) / sizeof(properties[0]);
@@ -18,5 +18,45 @@ module.exports = {
      * @param {boolean} overlap 
      * @returns {bigint}
      */
-    count: compiled.count
+    count: compiled.count,
+
+    /**
+     * Finds all occurrences of a substring, exporting their offsets in one call.
+     * Like all other functions, accepts strings, as well as Buffers and TypedArrays, addressed without copies.
+     * 
+     * @param {string|Buffer|TypedArray} haystack 
+     * @param {string|Buffer|TypedArray} needle 
+     * @param {boolean} overlap 
+     * @returns {BigUint64Array}
+     */
+    findAll: compiled.findAll,
+
+    /**
+     * Searches for the first occurrence of the same substring in many strings, in one call.
+     * 
+     * @param {Array<string|Buffer|TypedArray>} haystacks 
+     * @param {string|Buffer|TypedArray} needle 
+     * @returns {BigInt64Array} Offsets of the first matches, or -1 where missing.
+     */
+    indexOfBatch: compiled.indexOfBatch,
+
+    /**
+     * Counts the occurrences of the same substring in many strings, in one call.
+     * 
+     * @param {Array<string|Buffer|TypedArray>} haystacks 
+     * @param {string|Buffer|TypedArray} needle 
+     * @param {boolean} overlap 
+     * @returns {BigUint64Array}
+     */
+    countBatch: compiled.countBatch,
+
+    /**
+     * Computes the Levenshtein distances in bytes between one query and many candidates, in one call.
+     * 
+     * @param {string|Buffer|TypedArray} query 
+     * @param {Array<string|Buffer|TypedArray>} candidates 
+     * @param {number} bound Optional upper bound on the distances, to exit early.
+     * @returns {BigUint64Array}
+     */
+    editDistances: compiled.editDistances
 };
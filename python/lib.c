@@ -14,6 +14,7 @@
 #include <windows.h>
 #else
 #include <fcntl.h>    // `O_RDNLY`
+#include <pthread.h>  // `pthread_create`
 #include <sys/mman.h> // `mmap`
 #include <sys/stat.h> // `stat`
 #include <sys/types.h>
@@ -48,6 +49,8 @@ static PyTypeObject FileType;
 static PyTypeObject StrType;
 static PyTypeObject StrsType;
 static PyTypeObject SplitIteratorType;
+static PyTypeObject StreamMatcherType;
+static PyTypeObject GlobType;
 
 static sz_string_view_t temporary_memory = {NULL, 0};
 
@@ -65,6 +68,9 @@ typedef struct {
     int file_descriptor;
 #endif
     sz_string_view_t memory;
+
+    /// @brief  How many bytes ahead of the current position `split_iter` should prefetch. Zero disables it.
+    sz_size_t readahead;
 } File;
 
 /**
@@ -118,8 +124,41 @@ typedef struct {
     /// @brief  Indicates that we've already reported the tail of the split, and should return NULL next.
     sz_bool_t reached_tail;
 
+    /// @brief  Prefetching window inherited from the parent `File`, zero if disabled.
+    sz_size_t readahead;
+
+    /// @brief  Boundary of the already prefetched region: its end for forward and its start for reverse order.
+    sz_cptr_t prefetched;
+
 } SplitIterator;
 
+/**
+ *  @brief  Streaming substring matcher, that accepts successive chunks of a stream,
+ *          like the reads from a socket or a decompressor, and reports the absolute offsets of matches,
+ *          including the ones straddling the chunk boundaries.
+ *
+ *      - StreamMatcher("needle") # Non-overlapping matches
+ *      - StreamMatcher("needle", allowoverlap=True)
+ */
+typedef struct {
+    PyObject ob_base;
+
+    sz_stream_matcher_t matcher;
+} StreamMatcher;
+
+/**
+ *  @brief  Compiled glob-style pattern, that checks if whole strings match it,
+ *          locating the literal parts with SIMD-accelerated substring search.
+ *
+ *      - Glob("*.log").match("server.log")
+ *      - Glob("*.gz").filter(lines) # Indices of the matching lines
+ */
+typedef struct {
+    PyObject ob_base;
+
+    sz_glob_matcher_t matcher;
+} Glob;
+
 /**
  *  @brief  Variable length Python object similar to `Tuple[Union[Str, str]]`,
  *          for faster sorting, shuffling, joins, and lookups.
@@ -131,6 +170,7 @@ typedef struct {
         STRS_CONSECUTIVE_32,
         STRS_CONSECUTIVE_64,
         STRS_REORDERED,
+        STRS_ARROW,
         STRS_MULTI_SOURCE,
     } type;
 
@@ -185,6 +225,19 @@ typedef struct {
             sz_string_view_t *parts;
         } reordered;
 
+        /**
+         *  Apache Arrow string column, imported through the C Data Interface and addressed in place.
+         *  The `parent_string` is a capsule owning the `ArrowArray`, which the `sequence` references.
+         *  The `first` index allows slicing without touching the Arrow offsets or views.
+         *  https://arrow.apache.org/docs/format/CDataInterface.html
+         */
+        struct arrow_slices_t {
+            size_t count;
+            size_t first;
+            PyObject *parent_string;
+            sz_sequence_t sequence;
+        } arrow;
+
     } data;
 
 } Strs;
@@ -216,6 +269,301 @@ static sz_size_t parts_get_length(sz_sequence_t *seq, sz_size_t i) {
     return ((sz_string_view_t const *)seq->handle)[i].length;
 }
 
+/**
+ *  @brief  State of the `parallel_for_threads` executor, shared between all of the spawned threads.
+ */
+typedef struct {
+    sz_parallel_task_t task;
+    void *context;
+    size_t tasks_count;
+    size_t volatile next_task;
+} parallel_for_state_t;
+
+static size_t parallel_for_next_task(parallel_for_state_t *state) {
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
+    return (size_t)InterlockedIncrement64((LONG64 volatile *)&state->next_task) - 1;
+#else
+    return __atomic_fetch_add(&state->next_task, 1, __ATOMIC_RELAXED);
+#endif
+}
+
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
+static DWORD WINAPI parallel_for_worker(LPVOID argument) {
+#else
+static void *parallel_for_worker(void *argument) {
+#endif
+    parallel_for_state_t *state = (parallel_for_state_t *)argument;
+    for (size_t i = parallel_for_next_task(state); i < state->tasks_count; i = parallel_for_next_task(state))
+        state->task(state->context, i);
+    return 0;
+}
+
+/**
+ *  @brief  Executor compatible with `sz_parallel_for_t`, spawning OS threads on every call.
+ *          The `executor` must point to the `size_t` number of threads to use, including the calling one.
+ *          If some threads can't be spawned, the work is completed by the remaining ones.
+ *          Doesn't touch the Python interpreter state, so works with or without the GIL.
+ */
+static void parallel_for_threads(void *executor, sz_parallel_task_t task, void *context, sz_size_t tasks_count) {
+    parallel_for_state_t state = {task, context, tasks_count, 0};
+    size_t threads_count = *(size_t const *)executor;
+    if (threads_count > tasks_count) threads_count = tasks_count;
+    if (threads_count > 256) threads_count = 256;
+
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
+    HANDLE threads[256];
+    size_t spawned_count = 0;
+    for (; spawned_count + 1 < threads_count; ++spawned_count) {
+        threads[spawned_count] = CreateThread(NULL, 0, parallel_for_worker, &state, 0, NULL);
+        if (!threads[spawned_count]) break;
+    }
+    parallel_for_worker(&state);
+    for (size_t i = 0; i != spawned_count; ++i) {
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+    }
+#else
+    pthread_t threads[256];
+    size_t spawned_count = 0;
+    for (; spawned_count + 1 < threads_count; ++spawned_count)
+        if (pthread_create(&threads[spawned_count], NULL, parallel_for_worker, &state) != 0) break;
+    parallel_for_worker(&state);
+    for (size_t i = 0; i != spawned_count; ++i) pthread_join(threads[i], NULL);
+#endif
+}
+
+/**
+ *  @brief  Estimates the number of logical cores available to the process, defaulting to one.
+ */
+static size_t cores_count(void) {
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors ? (size_t)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (size_t)count : 1;
+#endif
+}
+
+/**
+ *  @brief  Helper function to parse the `threads` argument, where zero stands for all available cores.
+ *          On failure, sets a Python exception and returns 0.
+ */
+static sz_bool_t export_threads_count(PyObject *object, size_t *threads_count) {
+    if (!PyLong_Check(object)) {
+        PyErr_SetString(PyExc_TypeError, "The threads count must be an integer");
+        return 0;
+    }
+    Py_ssize_t value = PyLong_AsSsize_t(object);
+    if (value < 0) {
+        if (!PyErr_Occurred()) PyErr_SetString(PyExc_ValueError, "The threads count can't be negative");
+        return 0;
+    }
+    *threads_count = value == 0 ? cores_count() : (size_t)value;
+    return 1;
+}
+
+/**
+ *  @brief  Helper function to parse the `k` argument of partial sorts, that must be a non-negative integer.
+ */
+static sz_bool_t export_partial_order_length(PyObject *object, sz_size_t *partial_order_length) {
+    if (!PyLong_Check(object)) {
+        PyErr_SetString(PyExc_TypeError, "The k must be an integer");
+        return 0;
+    }
+    Py_ssize_t value = PyLong_AsSsize_t(object);
+    if (value < 0) {
+        if (!PyErr_Occurred()) PyErr_SetString(PyExc_ValueError, "The k can't be negative");
+        return 0;
+    }
+    *partial_order_length = (sz_size_t)value;
+    return 1;
+}
+
+/**
+ *  @brief  Number of matches fetched from the bulk search kernels at once.
+ */
+#define find_all_batch_capacity 256
+
+/**
+ *  @brief  Locates up to ::capacity matches of the ::needle, exporting their offsets from the start of the ::haystack.
+ *          The exact and character-set finders are served by the bulk search kernels, that don't restart after
+ *          every match, while the others are called in a loop.
+ *  @param  skip_length How many bytes to skip after each match, 1 for overlapping matches.
+ *  @return Number of exported offsets. If equal to ::capacity, there may be more matches.
+ */
+static size_t find_all_matches(sz_find_t finder, sz_string_view_t haystack, sz_string_view_t needle,
+                               sz_size_t skip_length, sz_size_t *offsets, size_t capacity) {
+    if (finder == &sz_find) {
+        sz_bool_t allow_overlap = skip_length < needle.length;
+        return sz_find_all(haystack.start, haystack.length, needle.start, needle.length, allow_overlap, offsets,
+                           capacity);
+    }
+    if (finder == &sz_find_char_from) {
+        sz_charset_t set;
+        sz_charset_init(&set);
+        for (sz_size_t i = 0; i != needle.length; ++i) sz_charset_add(&set, needle.start[i]);
+        return sz_find_all_charset(haystack.start, haystack.length, &set, offsets, capacity);
+    }
+
+    size_t count = 0;
+    for (sz_size_t offset = 0; count != capacity; ++count) {
+        sz_cptr_t match = finder(haystack.start + offset, haystack.length - offset, needle.start, needle.length);
+        if (!match) break;
+        offsets[count] = (sz_size_t)(match - haystack.start);
+        offset = offsets[count] + skip_length;
+    }
+    return count;
+}
+
+/**
+ *  @brief  State of the parallel search over one haystack, split into partitions at "needle-safe" boundaries,
+ *          where no occurrence of the needle starts before the boundary and ends after it. That way, the greedy
+ *          non-overlapping matches within every partition are identical to the ones of a single-threaded scan.
+ */
+typedef struct {
+    sz_string_view_t haystack;
+    sz_string_view_t needle;
+    sz_find_t finder;
+    sz_size_t match_length; //< Length of every match, the needle length or 1 for character sets.
+    sz_size_t skip_length;  //< How many bytes to skip after each match, 1 for overlapping matches.
+
+    size_t *bounds; //< Starting offsets of `partitions_count + 1` partitions, the last being the haystack length.
+    size_t *counts; //< Number of matches in every partition.
+
+    /// @brief  Optional outputs for the offsets of the first bytes after the matches, if `collect_ends` is set.
+    sz_size_t **ends;
+    size_t *ends_capacities;
+    sz_bool_t collect_ends;
+    sz_bool_t failed;
+} parallel_search_t;
+
+/**
+ *  @brief  Smallest partition worth handing to a separate thread.
+ */
+static size_t const parallel_search_min_partition = 64 * 1024;
+
+/**
+ *  @brief  How far a partition boundary may move forward, before it's dropped, merging the neighboring partitions.
+ *          Bounds the cost of placing the boundaries on periodic haystacks, where the overlapping occurrences of
+ *          a self-overlapping needle, like "aa" in "aaaa...", would otherwise chain until the haystack's end.
+ */
+static size_t const parallel_search_max_adjustment = 4 * 1024;
+
+/**
+ *  @brief  Moves the ::candidate boundary forward, until no match starting before it would end after it.
+ *  @return The safe boundary, or `SZ_SIZE_MAX` if it would have to move past the ::limit.
+ */
+static size_t parallel_search_safe_boundary(parallel_search_t const *search, size_t candidate, size_t limit) {
+    // Overlapping matches are attributed to the partition they start in, so any boundary is safe for them.
+    if (search->skip_length == 1) return candidate;
+    sz_size_t const overlap = search->match_length - 1;
+    while (overlap && candidate < search->haystack.length) {
+        if (candidate > limit) return SZ_SIZE_MAX;
+        size_t window_start = candidate >= overlap ? candidate - overlap : 0;
+        size_t window_end = sz_min_of_two(candidate + overlap, search->haystack.length);
+        sz_cptr_t match = search->finder(search->haystack.start + window_start, window_end - window_start,
+                                         search->needle.start, search->needle.length);
+        if (!match) break;
+        size_t match_offset = (size_t)(match - search->haystack.start);
+        if (match_offset >= candidate) break;
+        candidate = match_offset + search->match_length;
+    }
+    return sz_min_of_two(candidate, search->haystack.length);
+}
+
+static void parallel_search_task(void *context, sz_size_t partition_index) {
+    parallel_search_t *search = (parallel_search_t *)context;
+    size_t const begin = search->bounds[partition_index], end = search->bounds[partition_index + 1];
+    // Matches starting in this partition may end in the next one.
+    size_t const window_end = sz_min_of_two(end + search->match_length - 1, search->haystack.length);
+    size_t count = 0, capacity = 0;
+    sz_size_t *ends = NULL;
+
+    sz_size_t batch[find_all_batch_capacity];
+    sz_bool_t reached_end = sz_false_k;
+    for (size_t offset = begin; offset < end && !reached_end;) {
+        sz_string_view_t window;
+        window.start = search->haystack.start + offset;
+        window.length = window_end - offset;
+        size_t batch_count = find_all_matches(search->finder, window, search->needle, search->skip_length, batch,
+                                              find_all_batch_capacity);
+        reached_end = batch_count != find_all_batch_capacity;
+        for (size_t i = 0; i != batch_count; ++i) {
+            size_t match_offset = offset + batch[i];
+            if (match_offset >= end) {
+                reached_end = sz_true_k;
+                break;
+            }
+            if (search->collect_ends) {
+                if (count == capacity) {
+                    capacity = (capacity + 1) * 2;
+                    sz_size_t *new_ends = (sz_size_t *)realloc(ends, capacity * sizeof(sz_size_t));
+                    if (!new_ends) {
+                        search->failed = sz_true_k;
+                        reached_end = sz_true_k;
+                        break;
+                    }
+                    ends = new_ends;
+                }
+                ends[count] = match_offset + search->match_length;
+            }
+            ++count;
+        }
+        if (batch_count) offset += batch[batch_count - 1] + search->skip_length;
+    }
+
+    search->counts[partition_index] = count;
+    if (search->collect_ends) search->ends[partition_index] = ends, search->ends_capacities[partition_index] = capacity;
+}
+
+/**
+ *  @brief  Splits the haystack into at most ::threads_count partitions and locates all matches in parallel.
+ *          On success, the caller owns the `bounds`, `counts`, and `ends` arrays of the ::search state,
+ *          and must release them with `parallel_search_free`.
+ *  @return Number of partitions, or zero if the allocation failed. If the haystack can't be split, returns
+ *          one without searching, so that the caller can use the faster serial path instead.
+ */
+static size_t parallel_search(parallel_search_t *search, size_t threads_count) {
+    size_t partitions_count = search->haystack.length / parallel_search_min_partition;
+    if (partitions_count > threads_count) partitions_count = threads_count;
+    if (partitions_count == 0) partitions_count = 1;
+
+    search->failed = sz_false_k;
+    search->bounds = (size_t *)malloc((partitions_count + 1) * sizeof(size_t));
+    search->counts = (size_t *)calloc(partitions_count, sizeof(size_t));
+    search->ends = search->collect_ends ? (sz_size_t **)calloc(partitions_count, sizeof(sz_size_t *)) : NULL;
+    search->ends_capacities = search->collect_ends ? (size_t *)calloc(partitions_count, sizeof(size_t)) : NULL;
+    if (!search->bounds || !search->counts || (search->collect_ends && (!search->ends || !search->ends_capacities))) {
+        free(search->bounds), free(search->counts), free(search->ends), free(search->ends_capacities);
+        return 0;
+    }
+
+    // Boundaries only move forward, and those moving too far are dropped, so the partitions may end up merged,
+    // down to a single serial one on periodic haystacks, or empty in other degenerate cases.
+    size_t const step = search->haystack.length / partitions_count;
+    size_t bounds_count = 1;
+    search->bounds[0] = 0;
+    for (size_t i = 1; i != partitions_count; ++i) {
+        size_t candidate = sz_max_of_two(step * i, search->bounds[bounds_count - 1]);
+        size_t limit = sz_min_of_two(candidate + parallel_search_max_adjustment, step * (i + 1));
+        size_t boundary = parallel_search_safe_boundary(search, candidate, limit);
+        if (boundary != SZ_SIZE_MAX) search->bounds[bounds_count++] = boundary;
+    }
+    partitions_count = bounds_count;
+    search->bounds[partitions_count] = search->haystack.length;
+
+    if (partitions_count > 1) parallel_for_threads(&threads_count, parallel_search_task, search, partitions_count);
+    return partitions_count;
+}
+
+static void parallel_search_free(parallel_search_t *search, size_t partitions_count) {
+    if (search->ends)
+        for (size_t i = 0; i != partitions_count; ++i) free(search->ends[i]);
+    free(search->bounds), free(search->counts), free(search->ends), free(search->ends_capacities);
+}
+
 void reverse_offsets(sz_sorted_idx_t *array, size_t length) {
     size_t i, j;
     // Swap array[i] and array[j]
@@ -365,11 +713,21 @@ void str_at_offset_reordered(Strs *strs, Py_ssize_t i, Py_ssize_t count, //
     *parent_string = strs->data.reordered.parent_string;
 }
 
+void str_at_offset_arrow(Strs *strs, Py_ssize_t i, Py_ssize_t count, //
+                         PyObject **parent_string, char const **start, size_t *length) {
+    sz_sequence_t const *sequence = &strs->data.arrow.sequence;
+    sz_size_t index = strs->data.arrow.first + (sz_size_t)i;
+    *start = sequence->get_start(sequence, index);
+    *length = sequence->get_length(sequence, index);
+    *parent_string = strs->data.arrow.parent_string;
+}
+
 get_string_at_offset_t str_at_offset_getter(Strs *strs) {
     switch (strs->type) {
     case STRS_CONSECUTIVE_32: return str_at_offset_consecutive_32bit;
     case STRS_CONSECUTIVE_64: return str_at_offset_consecutive_64bit;
     case STRS_REORDERED: return str_at_offset_reordered;
+    case STRS_ARROW: return str_at_offset_arrow;
     default:
         // Unsupported type
         PyErr_SetString(PyExc_TypeError, "Unsupported type for conversion");
@@ -397,6 +755,11 @@ sz_bool_t prepare_strings_for_reordering(Strs *strs) {
         parent_string = strs->data.consecutive_64bit.parent_string;
         getter = str_at_offset_consecutive_64bit;
         break;
+    case STRS_ARROW:
+        count = strs->data.arrow.count;
+        parent_string = strs->data.arrow.parent_string;
+        getter = str_at_offset_arrow;
+        break;
     // Already in reordered form
     case STRS_REORDERED: return 1;
     case STRS_MULTI_SOURCE: return 1;
@@ -483,12 +846,78 @@ static PyObject *File_new(PyTypeObject *type, PyObject *positional_args, PyObjec
 #endif
     self->memory.start = NULL;
     self->memory.length = 0;
+    self->readahead = 0;
     return (PyObject *)self;
 }
 
-static int File_init(File *self, PyObject *positional_args, PyObject *named_args) {
-    char const *path;
-    if (!PyArg_ParseTuple(positional_args, "s", &path)) return -1;
+static int File_init(File *self, PyObject *args, PyObject *kwargs) {
+    Py_ssize_t nargs = PyTuple_Size(args);
+    if (nargs < 1 || nargs > 5) {
+        PyErr_SetString(PyExc_TypeError, "File() takes from 1 to 5 positional arguments");
+        return -1;
+    }
+    PyObject *path_obj = PyTuple_GET_ITEM(args, 0);
+    PyObject *access_obj = nargs > 1 ? PyTuple_GET_ITEM(args, 1) : NULL;
+    PyObject *populate_obj = nargs > 2 ? PyTuple_GET_ITEM(args, 2) : NULL;
+    PyObject *hugepages_obj = nargs > 3 ? PyTuple_GET_ITEM(args, 3) : NULL;
+    PyObject *readahead_obj = nargs > 4 ? PyTuple_GET_ITEM(args, 4) : NULL;
+    if (kwargs) {
+        PyObject *key, *value;
+        Py_ssize_t pos = 0;
+        while (PyDict_Next(kwargs, &pos, &key, &value))
+            if (PyUnicode_CompareWithASCIIString(key, "access") == 0 && !access_obj) { access_obj = value; }
+            else if (PyUnicode_CompareWithASCIIString(key, "populate") == 0 && !populate_obj) { populate_obj = value; }
+            else if (PyUnicode_CompareWithASCIIString(key, "hugepages") == 0 && !hugepages_obj) {
+                hugepages_obj = value;
+            }
+            else if (PyUnicode_CompareWithASCIIString(key, "readahead") == 0 && !readahead_obj) {
+                readahead_obj = value;
+            }
+            else {
+                PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key);
+                return -1;
+            }
+    }
+
+    if (!PyUnicode_Check(path_obj)) {
+        PyErr_SetString(PyExc_TypeError, "The path must be a string");
+        return -1;
+    }
+    char const *path = PyUnicode_AsUTF8(path_obj);
+    if (!path) return -1;
+
+    sz_memory_advice_t access = sz_memory_advice_normal_k;
+    if (access_obj && access_obj != Py_None) {
+        if (!PyUnicode_Check(access_obj)) {
+            PyErr_SetString(PyExc_TypeError, "The `access` argument must be a string");
+            return -1;
+        }
+        if (PyUnicode_CompareWithASCIIString(access_obj, "normal") == 0) access = sz_memory_advice_normal_k;
+        else if (PyUnicode_CompareWithASCIIString(access_obj, "sequential") == 0)
+            access = sz_memory_advice_sequential_k;
+        else if (PyUnicode_CompareWithASCIIString(access_obj, "random") == 0) access = sz_memory_advice_random_k;
+        else {
+            PyErr_SetString(PyExc_ValueError, "The `access` must be 'normal', 'sequential', or 'random'");
+            return -1;
+        }
+    }
+    int populate = populate_obj ? PyObject_IsTrue(populate_obj) : 0;
+    if (populate == -1) return -1;
+    int hugepages = hugepages_obj ? PyObject_IsTrue(hugepages_obj) : 0;
+    if (hugepages == -1) return -1;
+    Py_ssize_t readahead = 0;
+    if (readahead_obj) {
+        readahead = PyLong_AsSsize_t(readahead_obj);
+        if (readahead == -1 && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "The `readahead` argument must be an integer");
+            return -1;
+        }
+        if (readahead < 0) {
+            PyErr_SetString(PyExc_ValueError, "The `readahead` argument can't be negative");
+            return -1;
+        }
+    }
+    int populated_on_mapping = 0;
 
 #if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
     DWORD path_attributes = GetFileAttributes(path);
@@ -548,7 +977,15 @@ static int File_init(File *self, PyObject *positional_args, PyObject *named_args
         return -1;
     }
     size_t file_size = sb.st_size;
-    void *map = mmap(NULL, sb.st_size, PROT_READ, MAP_SHARED, self->file_descriptor, 0);
+    int map_flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+    // Linux can fault-in the whole mapping synchronously, avoiding page faults on the first pass.
+    if (populate) {
+        map_flags |= MAP_POPULATE;
+        populated_on_mapping = 1;
+    }
+#endif
+    void *map = mmap(NULL, sb.st_size, PROT_READ, map_flags, self->file_descriptor, 0);
     if (map == MAP_FAILED) {
         close(self->file_descriptor);
         self->file_descriptor = 0;
@@ -559,6 +996,12 @@ static int File_init(File *self, PyObject *positional_args, PyObject *named_args
     self->memory.length = file_size;
 #endif
 
+    // All of the hints are best-effort, the mapping remains usable even if the OS rejects them.
+    if (hugepages) sz_memory_advise(self->memory.start, self->memory.length, sz_memory_advice_hugepages_k);
+    if (access != sz_memory_advice_normal_k) sz_memory_advise(self->memory.start, self->memory.length, access);
+    if (populate && !populated_on_mapping)
+        sz_memory_advise(self->memory.start, self->memory.length, sz_memory_advice_willneed_k);
+    self->readahead = (sz_size_t)readahead;
     return 0;
 }
 
@@ -568,7 +1011,13 @@ static PyMethodDef File_methods[] = { //
 static PyTypeObject FileType = {
     PyVarObject_HEAD_INIT(NULL, 0) //
         .tp_name = "stringzilla.File",
-    .tp_doc = "Memory mapped file class, that exposes the memory range for low-level access",
+    .tp_doc = "Memory mapped file class, that exposes the memory range for low-level access.\n\n"
+              "Args:\n"
+              "  path (str): Path to the file.\n"
+              "  access (str, optional): Expected access pattern - 'normal', 'sequential', or 'random'.\n"
+              "  populate (bool, optional): Fault-in the whole file upfront (default is False).\n"
+              "  hugepages (bool, optional): Request transparent huge pages, where supported (default is False).\n"
+              "  readahead (int, optional): Bytes to prefetch ahead of `split_iter` position (default is 0).",
     .tp_basicsize = sizeof(File),
     .tp_flags = Py_TPFLAGS_DEFAULT,
     .tp_methods = File_methods,
@@ -601,8 +1050,10 @@ static int Str_init(Str *self, PyObject *args, PyObject *kwargs) {
             if (PyUnicode_CompareWithASCIIString(key, "parent") == 0 && !parent_obj) { parent_obj = value; }
             else if (PyUnicode_CompareWithASCIIString(key, "from") == 0 && !from_obj) { from_obj = value; }
             else if (PyUnicode_CompareWithASCIIString(key, "to") == 0 && !to_obj) { to_obj = value; }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key))
+            else {
+                PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key);
                 return -1;
+            }
     }
 
     // Now, type-check and cast each argument
@@ -895,6 +1346,7 @@ static Py_ssize_t Strs_len(Strs *self) {
     case STRS_CONSECUTIVE_32: return self->data.consecutive_32bit.count;
     case STRS_CONSECUTIVE_64: return self->data.consecutive_64bit.count;
     case STRS_REORDERED: return self->data.reordered.count;
+    case STRS_ARROW: return self->data.arrow.count;
     default: return 0;
     }
 }
@@ -1020,7 +1472,7 @@ static PyObject *Strs_subscript(Strs *self, PyObject *key) {
             to->end_offsets[i - 1] += from->separator_length;
             PyObject *element_parent = NULL;
             char const *element_start = NULL;
-            str_at_offset_consecutive_32bit(self, start, count, &element_parent, &element_start, &element_length);
+            str_at_offset_consecutive_32bit(self, start + i, count, &element_parent, &element_start, &element_length);
             to->end_offsets[i] = element_length + to->end_offsets[i - 1];
         }
         Py_INCREF(to->parent_string);
@@ -1049,7 +1501,7 @@ static PyObject *Strs_subscript(Strs *self, PyObject *key) {
             to->end_offsets[i - 1] += from->separator_length;
             PyObject *element_parent = NULL;
             char const *element_start = NULL;
-            str_at_offset_consecutive_64bit(self, start, count, &element_parent, &element_start, &element_length);
+            str_at_offset_consecutive_64bit(self, start + i, count, &element_parent, &element_start, &element_length);
             to->end_offsets[i] = element_length + to->end_offsets[i - 1];
         }
         Py_INCREF(to->parent_string);
@@ -1071,6 +1523,15 @@ static PyObject *Strs_subscript(Strs *self, PyObject *key) {
         Py_INCREF(to->parent_string);
         break;
     }
+
+    case STRS_ARROW: {
+        // The Arrow buffers are shared, only the window into them changes
+        result->data.arrow = self->data.arrow;
+        result->data.arrow.first += start;
+        result->data.arrow.count = result_count;
+        Py_INCREF(result->data.arrow.parent_string);
+        break;
+    }
     default:
         // Unsupported type
         PyErr_SetString(PyExc_TypeError, "Unsupported type for conversion");
@@ -1327,8 +1788,10 @@ static PyObject *Str_decode(PyObject *self, PyObject *args, PyObject *kwargs) {
         while (PyDict_Next(kwargs, &pos, &key, &value))
             if (PyUnicode_CompareWithASCIIString(key, "encoding") == 0 && !encoding_obj) { encoding_obj = value; }
             else if (PyUnicode_CompareWithASCIIString(key, "errors") == 0 && !errors_obj) { errors_obj = value; }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key))
+            else {
+                PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key);
                 return NULL;
+            }
     }
 
     // Convert `encoding` and `errors` to `NULL` if they are `None`
@@ -1346,11 +1809,83 @@ static PyObject *Str_decode(PyObject *self, PyObject *args, PyObject *kwargs) {
     if (encoding_obj == NULL) encoding = (sz_string_view_t) {"utf-8", 5};
     if (errors_obj == NULL) errors = (sz_string_view_t) {"strict", 6};
 
+    // Well-formed non-ASCII UTF-8 is transcoded with SIMD kernels, leaving CPython to narrow the runes to
+    // the smallest fitting representation. The corrupted inputs go through CPython to report the errors.
+    int const is_utf8 = (encoding.length == 5 && sz_equal(encoding.start, "utf-8", 5)) ||
+                        (encoding.length == 4 && sz_equal(encoding.start, "utf8", 4));
+    if (is_utf8 && text.length > 64 && !sz_isascii(text.start, text.length) &&
+        sz_utf8_validate(text.start, text.length)) {
+        sz_rune_t *runes = (sz_rune_t *)PyMem_Malloc(text.length * sizeof(sz_rune_t));
+        if (!runes) return PyErr_NoMemory();
+        sz_size_t count = sz_utf8_to_utf32(text.start, text.length, runes);
+        PyObject *result = PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND, runes, (Py_ssize_t)count);
+        PyMem_Free(runes);
+        return result;
+    }
+
     // Python docs: https://docs.python.org/3/library/stdtypes.html#bytes.decode
     // CPython docs: https://docs.python.org/3/c-api/unicode.html#c.PyUnicode_Decode
     return PyUnicode_Decode(text.start, text.length, encoding.start, errors.start);
 }
 
+static char const doc_isutf8[] = //
+    "Check if the string is well-formed UTF-8, without overlong encodings, surrogates, or truncated runes.\n"
+    "\n"
+    "Args:\n"
+    "  text (Str or str or bytes): The string object.\n"
+    "Returns:\n"
+    "  bool: True if the string is valid UTF-8.";
+
+static PyObject *Str_isutf8(PyObject *self, PyObject *args, PyObject *kwargs) {
+    int is_member = self != NULL && PyObject_TypeCheck(self, &StrType);
+    Py_ssize_t nargs = PyTuple_Size(args);
+    if (nargs != !is_member) {
+        PyErr_SetString(PyExc_TypeError, "Invalid number of arguments");
+        return NULL;
+    }
+    if (kwargs && PyDict_Size(kwargs)) {
+        PyErr_SetString(PyExc_TypeError, "Got an unexpected keyword argument");
+        return NULL;
+    }
+
+    PyObject *text_obj = is_member ? self : PyTuple_GET_ITEM(args, 0);
+    sz_string_view_t text;
+    if (!export_string_like(text_obj, &text.start, &text.length)) {
+        wrap_current_exception("The text must be string-like");
+        return NULL;
+    }
+    return PyBool_FromLong(sz_utf8_validate(text.start, text.length) == sz_true_k);
+}
+
+static char const doc_utf8_count[] = //
+    "Count the Unicode codepoints in a UTF-8 string, like `len(text.decode())` without decoding.\n"
+    "\n"
+    "Args:\n"
+    "  text (Str or str or bytes): The string object.\n"
+    "Returns:\n"
+    "  int: The number of codepoints, equal to the number of bytes, that aren't UTF-8 continuation bytes.";
+
+static PyObject *Str_utf8_count(PyObject *self, PyObject *args, PyObject *kwargs) {
+    int is_member = self != NULL && PyObject_TypeCheck(self, &StrType);
+    Py_ssize_t nargs = PyTuple_Size(args);
+    if (nargs != !is_member) {
+        PyErr_SetString(PyExc_TypeError, "Invalid number of arguments");
+        return NULL;
+    }
+    if (kwargs && PyDict_Size(kwargs)) {
+        PyErr_SetString(PyExc_TypeError, "Got an unexpected keyword argument");
+        return NULL;
+    }
+
+    PyObject *text_obj = is_member ? self : PyTuple_GET_ITEM(args, 0);
+    sz_string_view_t text;
+    if (!export_string_like(text_obj, &text.start, &text.length)) {
+        wrap_current_exception("The text must be string-like");
+        return NULL;
+    }
+    return PyLong_FromSize_t(sz_utf8_count(text.start, text.length));
+}
+
 static char const doc_write_to[] = //
     "Write the string to a file.\n"
     "\n"
@@ -1477,11 +2012,12 @@ static PyObject *Str_offset_within(PyObject *self, PyObject *args, PyObject *kwa
 
 /**
  *  @brief  Implementation function for all search-like operations, parameterized by a function callback.
+ *          If the `caseless_finder` is provided, the `ignore_case` keyword argument is accepted to switch to it.
  *  @return 1 on success, 0 on failure.
  */
 static int _Str_find_implementation_( //
-    PyObject *self, PyObject *args, PyObject *kwargs, sz_find_t finder, sz_bool_t is_reverse, Py_ssize_t *offset_out,
-    sz_string_view_t *haystack_out, sz_string_view_t *needle_out) {
+    PyObject *self, PyObject *args, PyObject *kwargs, sz_find_t finder, sz_find_t caseless_finder,
+    sz_bool_t is_reverse, Py_ssize_t *offset_out, sz_string_view_t *haystack_out, sz_string_view_t *needle_out) {
 
     int is_member = self != NULL && PyObject_TypeCheck(self, &StrType);
     Py_ssize_t nargs = PyTuple_Size(args);
@@ -1494,6 +2030,7 @@ static int _Str_find_implementation_( //
     PyObject *needle_obj = PyTuple_GET_ITEM(args, !is_member + 0);
     PyObject *start_obj = nargs > !is_member + 1 ? PyTuple_GET_ITEM(args, !is_member + 1) : NULL;
     PyObject *end_obj = nargs > !is_member + 2 ? PyTuple_GET_ITEM(args, !is_member + 2) : NULL;
+    PyObject *ignore_case_obj = NULL;
 
     // Parse keyword arguments
     if (kwargs) {
@@ -1502,8 +2039,23 @@ static int _Str_find_implementation_( //
         while (PyDict_Next(kwargs, &pos, &key, &value))
             if (PyUnicode_CompareWithASCIIString(key, "start") == 0 && !start_obj) { start_obj = value; }
             else if (PyUnicode_CompareWithASCIIString(key, "end") == 0 && !end_obj) { end_obj = value; }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key))
+            else if (caseless_finder && PyUnicode_CompareWithASCIIString(key, "ignore_case") == 0) {
+                ignore_case_obj = value;
+            }
+            else {
+                PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key);
                 return 0;
+            }
+    }
+
+    // Validate and convert `ignore_case`
+    if (ignore_case_obj) {
+        int ignore_case = PyObject_IsTrue(ignore_case_obj);
+        if (ignore_case == -1) {
+            PyErr_SetString(PyExc_TypeError, "The ignore_case argument must be a boolean");
+            return 0;
+        }
+        if (ignore_case) finder = caseless_finder;
     }
 
     sz_string_view_t haystack;
@@ -1569,6 +2121,7 @@ static char const doc_contains[] = //
     "  substring (str): The substring to search for.\n"
     "  start (int, optional): The starting index (default is 0).\n"
     "  end (int, optional): The ending index (default is the string length).\n"
+    "  ignore_case (bool, optional): Fold the case of ASCII letters while matching (default is False).\n"
     "Returns:\n"
     "  bool: True if the substring is found, False otherwise.";
 
@@ -1576,7 +2129,8 @@ static PyObject *Str_contains(PyObject *self, PyObject *args, PyObject *kwargs)
     Py_ssize_t signed_offset;
     sz_string_view_t text;
     sz_string_view_t separator;
-    if (!_Str_find_implementation_(self, args, kwargs, &sz_find, sz_false_k, &signed_offset, &text, &separator))
+    if (!_Str_find_implementation_(self, args, kwargs, &sz_find, &sz_find_caseless, sz_false_k, &signed_offset, &text,
+                                   &separator))
         return NULL;
     if (signed_offset == -1) { Py_RETURN_FALSE; }
     else { Py_RETURN_TRUE; }
@@ -1590,6 +2144,7 @@ static char const doc_find[] = //
     "  substring (str): The substring to find.\n"
     "  start (int, optional): The starting index (default is 0).\n"
     "  end (int, optional): The ending index (default is the string length).\n"
+    "  ignore_case (bool, optional): Fold the case of ASCII letters while matching (default is False).\n"
     "Returns:\n"
     "  int: The index of the first occurrence, or -1 if not found.";
 
@@ -1597,7 +2152,8 @@ static PyObject *Str_find(PyObject *self, PyObject *args, PyObject *kwargs) {
     Py_ssize_t signed_offset;
     sz_string_view_t text;
     sz_string_view_t separator;
-    if (!_Str_find_implementation_(self, args, kwargs, &sz_find, sz_false_k, &signed_offset, &text, &separator))
+    if (!_Str_find_implementation_(self, args, kwargs, &sz_find, &sz_find_caseless, sz_false_k, &signed_offset, &text,
+                                   &separator))
         return NULL;
     return PyLong_FromSsize_t(signed_offset);
 }
@@ -1610,6 +2166,7 @@ static char const doc_index[] = //
     "  substring (str): The substring to find.\n"
     "  start (int, optional): The starting index (default is 0).\n"
     "  end (int, optional): The ending index (default is the string length).\n"
+    "  ignore_case (bool, optional): Fold the case of ASCII letters while matching (default is False).\n"
     "Returns:\n"
     "  int: The index of the first occurrence.\n"
     "Raises:\n"
@@ -1619,7 +2176,8 @@ static PyObject *Str_index(PyObject *self, PyObject *args, PyObject *kwargs) {
     Py_ssize_t signed_offset;
     sz_string_view_t text;
     sz_string_view_t separator;
-    if (!_Str_find_implementation_(self, args, kwargs, &sz_find, sz_false_k, &signed_offset, &text, &separator))
+    if (!_Str_find_implementation_(self, args, kwargs, &sz_find, &sz_find_caseless, sz_false_k, &signed_offset, &text,
+                                   &separator))
         return NULL;
     if (signed_offset == -1) {
         PyErr_SetString(PyExc_ValueError, "substring not found");
@@ -1636,6 +2194,7 @@ static char const doc_rfind[] = //
     "  substring (str): The substring to find.\n"
     "  start (int, optional): The starting index (default is 0).\n"
     "  end (int, optional): The ending index (default is the string length).\n"
+    "  ignore_case (bool, optional): Fold the case of ASCII letters while matching (default is False).\n"
     "Returns:\n"
     "  int: The index of the last occurrence, or -1 if not found.";
 
@@ -1643,7 +2202,8 @@ static PyObject *Str_rfind(PyObject *self, PyObject *args, PyObject *kwargs) {
     Py_ssize_t signed_offset;
     sz_string_view_t text;
     sz_string_view_t separator;
-    if (!_Str_find_implementation_(self, args, kwargs, &sz_rfind, sz_true_k, &signed_offset, &text, &separator))
+    if (!_Str_find_implementation_(self, args, kwargs, &sz_rfind, &sz_rfind_caseless, sz_true_k, &signed_offset, &text,
+                                   &separator))
         return NULL;
     return PyLong_FromSsize_t(signed_offset);
 }
@@ -1656,6 +2216,7 @@ static char const doc_rindex[] = //
     "  substring (str): The substring to find.\n"
     "  start (int, optional): The starting index (default is 0).\n"
     "  end (int, optional): The ending index (default is the string length).\n"
+    "  ignore_case (bool, optional): Fold the case of ASCII letters while matching (default is False).\n"
     "Returns:\n"
     "  int: The index of the last occurrence.\n"
     "Raises:\n"
@@ -1665,7 +2226,8 @@ static PyObject *Str_rindex(PyObject *self, PyObject *args, PyObject *kwargs) {
     Py_ssize_t signed_offset;
     sz_string_view_t text;
     sz_string_view_t separator;
-    if (!_Str_find_implementation_(self, args, kwargs, &sz_rfind, sz_true_k, &signed_offset, &text, &separator))
+    if (!_Str_find_implementation_(self, args, kwargs, &sz_rfind, &sz_rfind_caseless, sz_true_k, &signed_offset, &text,
+                                   &separator))
         return NULL;
     if (signed_offset == -1) {
         PyErr_SetString(PyExc_ValueError, "substring not found");
@@ -1675,14 +2237,15 @@ static PyObject *Str_rindex(PyObject *self, PyObject *args, PyObject *kwargs) {
 }
 
 static PyObject *_Str_partition_implementation(PyObject *self, PyObject *args, PyObject *kwargs, sz_find_t finder,
-                                               sz_bool_t is_reverse) {
+                                               sz_find_t caseless_finder, sz_bool_t is_reverse) {
     Py_ssize_t separator_index;
     sz_string_view_t text;
     sz_string_view_t separator;
     PyObject *result_tuple;
 
     // Use _Str_find_implementation_ to get the index of the separator
-    if (!_Str_find_implementation_(self, args, kwargs, finder, is_reverse, &separator_index, &text, &separator))
+    if (!_Str_find_implementation_(self, args, kwargs, finder, caseless_finder, is_reverse, &separator_index, &text,
+                                   &separator))
         return NULL;
 
     // If the separator length is zero, we must raise a `ValueError`
@@ -1735,11 +2298,12 @@ static char const doc_partition[] = //
     "Args:\n"
     "  text (Str or str or bytes): The string object.\n"
     "  separator (str): The separator to partition by.\n"
+    "  ignore_case (bool, optional): Fold the case of ASCII letters while matching (default is False).\n"
     "Returns:\n"
     "  tuple: A 3-tuple (head, separator, tail). If the separator is not found, returns (self, '', '').";
 
 static PyObject *Str_partition(PyObject *self, PyObject *args, PyObject *kwargs) {
-    return _Str_partition_implementation(self, args, kwargs, &sz_find, sz_false_k);
+    return _Str_partition_implementation(self, args, kwargs, &sz_find, &sz_find_caseless, sz_false_k);
 }
 
 static char const doc_rpartition[] = //
@@ -1748,11 +2312,12 @@ static char const doc_rpartition[] = //
     "Args:\n"
     "  text (Str or str or bytes): The string object.\n"
     "  separator (str): The separator to partition by.\n"
+    "  ignore_case (bool, optional): Fold the case of ASCII letters while matching (default is False).\n"
     "Returns:\n"
     "  tuple: A 3-tuple (head, separator, tail). If the separator is not found, returns ('', '', self).";
 
 static PyObject *Str_rpartition(PyObject *self, PyObject *args, PyObject *kwargs) {
-    return _Str_partition_implementation(self, args, kwargs, &sz_rfind, sz_true_k);
+    return _Str_partition_implementation(self, args, kwargs, &sz_rfind, &sz_rfind_caseless, sz_true_k);
 }
 
 static char const doc_count[] = //
@@ -1764,9 +2329,43 @@ static char const doc_count[] = //
     "  start (int, optional): The starting index (default is 0).\n"
     "  end (int, optional): The ending index (default is the string length).\n"
     "  allowoverlap (bool, optional): Count overlapping occurrences (default is False).\n"
+    "  threads (int, optional): Number of threads to scan with, 0 for all cores (default is 1).\n"
+    "  ignore_case (bool, optional): Fold the case of ASCII letters while matching (default is False).\n"
     "Returns:\n"
     "  int: The number of occurrences of the substring.";
 
+/**
+ *  @brief  Single-threaded counting, used directly or as a fallback for haystacks that can't be partitioned.
+ */
+static size_t Str_count_serial_(sz_find_t finder, sz_string_view_t haystack, sz_string_view_t needle,
+                                int allowoverlap) {
+    size_t count = 0;
+    if (finder == &sz_find) {
+        count = sz_count(haystack.start, haystack.length, needle.start, needle.length, (sz_bool_t)allowoverlap);
+    }
+    else if (allowoverlap) {
+        while (haystack.length) {
+            sz_cptr_t ptr = finder(haystack.start, haystack.length, needle.start, needle.length);
+            sz_bool_t found = ptr != NULL;
+            sz_size_t offset = found ? (sz_size_t)(ptr - haystack.start) : haystack.length;
+            count += found;
+            haystack.start += offset + found;
+            haystack.length -= offset + found;
+        }
+    }
+    else {
+        while (haystack.length) {
+            sz_cptr_t ptr = finder(haystack.start, haystack.length, needle.start, needle.length);
+            sz_bool_t found = ptr != NULL;
+            sz_size_t offset = found ? (sz_size_t)(ptr - haystack.start) : haystack.length;
+            count += found;
+            haystack.start += offset + needle.length;
+            haystack.length -= offset + needle.length * found;
+        }
+    }
+    return count;
+}
+
 static PyObject *Str_count(PyObject *self, PyObject *args, PyObject *kwargs) {
     int is_member = self != NULL && PyObject_TypeCheck(self, &StrType);
     Py_ssize_t nargs = PyTuple_Size(args);
@@ -1780,6 +2379,8 @@ static PyObject *Str_count(PyObject *self, PyObject *args, PyObject *kwargs) {
     PyObject *start_obj = nargs > !is_member + 1 ? PyTuple_GET_ITEM(args, !is_member + 1) : NULL;
     PyObject *end_obj = nargs > !is_member + 2 ? PyTuple_GET_ITEM(args, !is_member + 2) : NULL;
     PyObject *allowoverlap_obj = nargs > !is_member + 3 ? PyTuple_GET_ITEM(args, !is_member + 3) : NULL;
+    PyObject *threads_obj = NULL;
+    PyObject *ignore_case_obj = NULL;
 
     if (kwargs) {
         Py_ssize_t pos = 0;
@@ -1788,15 +2389,23 @@ static PyObject *Str_count(PyObject *self, PyObject *args, PyObject *kwargs) {
             if (PyUnicode_CompareWithASCIIString(key, "start") == 0) { start_obj = value; }
             else if (PyUnicode_CompareWithASCIIString(key, "end") == 0) { end_obj = value; }
             else if (PyUnicode_CompareWithASCIIString(key, "allowoverlap") == 0) { allowoverlap_obj = value; }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key))
+            else if (PyUnicode_CompareWithASCIIString(key, "threads") == 0) { threads_obj = value; }
+            else if (PyUnicode_CompareWithASCIIString(key, "ignore_case") == 0) { ignore_case_obj = value; }
+            else {
+                PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key);
                 return NULL;
+            }
     }
 
+    size_t threads_count = 1;
+    if (threads_obj && !export_threads_count(threads_obj, &threads_count)) return NULL;
+
     sz_string_view_t haystack;
     sz_string_view_t needle;
     Py_ssize_t start = start_obj ? PyLong_AsSsize_t(start_obj) : 0;
     Py_ssize_t end = end_obj ? PyLong_AsSsize_t(end_obj) : PY_SSIZE_T_MAX;
     int allowoverlap = allowoverlap_obj ? PyObject_IsTrue(allowoverlap_obj) : 0;
+    int ignore_case = ignore_case_obj ? PyObject_IsTrue(ignore_case_obj) : 0;
 
     if (!export_string_like(haystack_obj, &haystack.start, &haystack.length) ||
         !export_string_like(needle_obj, &needle.start, &needle.length)) {
@@ -1804,7 +2413,8 @@ static PyObject *Str_count(PyObject *self, PyObject *args, PyObject *kwargs) {
         return NULL;
     }
 
-    if ((start == -1 || end == -1 || allowoverlap == -1) && PyErr_Occurred()) return NULL;
+    if ((start == -1 || end == -1 || allowoverlap == -1 || ignore_case == -1) && PyErr_Occurred()) return NULL;
+    sz_find_t finder = ignore_case ? &sz_find_caseless : &sz_find;
 
     size_t normalized_offset, normalized_length;
     sz_ssize_clamp_interval(haystack.length, start, end, &normalized_offset, &normalized_length);
@@ -1813,26 +2423,23 @@ static PyObject *Str_count(PyObject *self, PyObject *args, PyObject *kwargs) {
 
     size_t count = 0;
     if (needle.length == 0 || haystack.length == 0 || haystack.length < needle.length) { count = 0; }
-    else if (allowoverlap) {
-        while (haystack.length) {
-            sz_cptr_t ptr = sz_find(haystack.start, haystack.length, needle.start, needle.length);
-            sz_bool_t found = ptr != NULL;
-            sz_size_t offset = found ? (sz_size_t)(ptr - haystack.start) : haystack.length;
-            count += found;
-            haystack.start += offset + found;
-            haystack.length -= offset + found;
-        }
-    }
-    else {
-        while (haystack.length) {
-            sz_cptr_t ptr = sz_find(haystack.start, haystack.length, needle.start, needle.length);
-            sz_bool_t found = ptr != NULL;
-            sz_size_t offset = found ? (sz_size_t)(ptr - haystack.start) : haystack.length;
-            count += found;
-            haystack.start += offset + needle.length;
-            haystack.length -= offset + needle.length * found;
+    else if (threads_count > 1) {
+        parallel_search_t search;
+        sz_fill((sz_ptr_t)&search, sizeof(search), 0);
+        search.haystack = haystack;
+        search.needle = needle;
+        search.finder = finder;
+        search.match_length = needle.length;
+        search.skip_length = allowoverlap ? 1 : needle.length;
+        size_t partitions_count = parallel_search(&search, threads_count);
+        if (!partitions_count) return PyErr_NoMemory();
+        if (partitions_count == 1) { count = Str_count_serial_(finder, haystack, needle, allowoverlap); }
+        else {
+            for (size_t i = 0; i != partitions_count; ++i) count += search.counts[i];
         }
+        parallel_search_free(&search, partitions_count);
     }
+    else { count = Str_count_serial_(finder, haystack, needle, allowoverlap); }
 
     return PyLong_FromSize_t(count);
 }
@@ -1854,8 +2461,10 @@ static PyObject *_Str_edit_distance(PyObject *self, PyObject *args, PyObject *kw
         PyObject *key, *value;
         while (PyDict_Next(kwargs, &pos, &key, &value))
             if (PyUnicode_CompareWithASCIIString(key, "bound") == 0 && !bound_obj) { bound_obj = value; }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key))
+            else {
+                PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key);
                 return NULL;
+            }
     }
 
     Py_ssize_t bound = 0; // Default value for bound
@@ -1935,8 +2544,10 @@ static PyObject *_Str_hamming_distance(PyObject *self, PyObject *args, PyObject
         PyObject *key, *value;
         while (PyDict_Next(kwargs, &pos, &key, &value))
             if (PyUnicode_CompareWithASCIIString(key, "bound") == 0 && !bound_obj) { bound_obj = value; }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key))
+            else {
+                PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key);
                 return NULL;
+            }
     }
 
     Py_ssize_t bound = 0; // Default value for bound
@@ -2024,8 +2635,10 @@ static PyObject *Str_alignment_score(PyObject *self, PyObject *args, PyObject *k
             else if (PyUnicode_CompareWithASCIIString(key, "substitution_matrix") == 0 && !substitution_matrix_obj) {
                 substitution_matrix_obj = value;
             }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key))
+            else {
+                PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key);
                 return NULL;
+            }
     }
 
     Py_ssize_t gap = 1; // Default value for gap costs
@@ -2236,8 +2849,10 @@ static PyObject *Str_translate(PyObject *self, PyObject *args, PyObject *kwargs)
             if (PyUnicode_CompareWithASCIIString(key, "inplace") == 0 && !inplace_obj) { inplace_obj = value; }
             else if (PyUnicode_CompareWithASCIIString(key, "start") == 0 && !start_obj) { start_obj = value; }
             else if (PyUnicode_CompareWithASCIIString(key, "end") == 0 && !end_obj) { end_obj = value; }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key))
+            else {
+                PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key);
                 return NULL;
+            }
     }
 
     // Optional start and end arguments
@@ -2355,7 +2970,7 @@ static PyObject *Str_find_first_of(PyObject *self, PyObject *args, PyObject *kwa
     Py_ssize_t signed_offset;
     sz_string_view_t text;
     sz_string_view_t separator;
-    if (!_Str_find_implementation_(self, args, kwargs, &sz_find_char_from, sz_false_k, &signed_offset, &text,
+    if (!_Str_find_implementation_(self, args, kwargs, &sz_find_char_from, NULL, sz_false_k, &signed_offset, &text,
                                    &separator))
         return NULL;
     return PyLong_FromSsize_t(signed_offset);
@@ -2376,7 +2991,7 @@ static PyObject *Str_find_first_not_of(PyObject *self, PyObject *args, PyObject
     Py_ssize_t signed_offset;
     sz_string_view_t text;
     sz_string_view_t separator;
-    if (!_Str_find_implementation_(self, args, kwargs, &sz_find_char_not_from, sz_false_k, &signed_offset, &text,
+    if (!_Str_find_implementation_(self, args, kwargs, &sz_find_char_not_from, NULL, sz_false_k, &signed_offset, &text,
                                    &separator))
         return NULL;
     return PyLong_FromSsize_t(signed_offset);
@@ -2397,7 +3012,7 @@ static PyObject *Str_find_last_of(PyObject *self, PyObject *args, PyObject *kwar
     Py_ssize_t signed_offset;
     sz_string_view_t text;
     sz_string_view_t separator;
-    if (!_Str_find_implementation_(self, args, kwargs, &sz_rfind_char_from, sz_true_k, &signed_offset, &text,
+    if (!_Str_find_implementation_(self, args, kwargs, &sz_rfind_char_from, NULL, sz_true_k, &signed_offset, &text,
                                    &separator))
         return NULL;
     return PyLong_FromSsize_t(signed_offset);
@@ -2418,7 +3033,7 @@ static PyObject *Str_find_last_not_of(PyObject *self, PyObject *args, PyObject *
     Py_ssize_t signed_offset;
     sz_string_view_t text;
     sz_string_view_t separator;
-    if (!_Str_find_implementation_(self, args, kwargs, &sz_rfind_char_not_from, sz_true_k, &signed_offset, &text,
+    if (!_Str_find_implementation_(self, args, kwargs, &sz_rfind_char_not_from, NULL, sz_true_k, &signed_offset, &text,
                                    &separator))
         return NULL;
     return PyLong_FromSsize_t(signed_offset);
@@ -2449,6 +3064,13 @@ static SplitIterator *Str_split_iter_(PyObject *text_obj, PyObject *separator_ob
     result_obj->max_parts = (sz_size_t)maxsplit + 1;
     result_obj->reached_tail = 0;
 
+    // Inherit the prefetching window from the memory-mapped file, if the text is backed by one
+    PyObject *backing_obj = text_obj;
+    while (PyObject_TypeCheck(backing_obj, &StrType) && ((Str *)backing_obj)->parent)
+        backing_obj = ((Str *)backing_obj)->parent;
+    result_obj->readahead = PyObject_TypeCheck(backing_obj, &FileType) ? ((File *)backing_obj)->readahead : 0;
+    result_obj->prefetched = is_reverse ? text.start + text.length : text.start;
+
     // Increment the reference count of the parent
     Py_INCREF(result_obj->text_obj);
     Py_XINCREF(result_obj->separator_obj);
@@ -2488,27 +3110,23 @@ static Strs *Str_split_(PyObject *parent_string, sz_string_view_t const text, sz
     sz_bool_t reached_tail = 0;
     sz_size_t total_skipped = 0;
     sz_size_t max_parts = (sz_size_t)maxsplit + 1;
+    sz_size_t batch[find_all_batch_capacity];
     while (!reached_tail) {
 
-        sz_cptr_t match =
-            offsets_count + 1 < max_parts
-                ? finder(text.start + total_skipped, text.length - total_skipped, separator.start, separator.length)
-                : NULL;
-
-        sz_size_t part_end_offset;
-        if (match) {
-            part_end_offset = (match - text.start) + match_length;
-            total_skipped = part_end_offset;
-        }
-        else {
-            part_end_offset = text.length;
-            total_skipped = text.length;
-            reached_tail = 1;
-        }
-
-        // Reallocate offsets array if needed
-        if (offsets_count >= offsets_capacity) {
-            offsets_capacity = (offsets_capacity + 1) * 2;
+        // Fetch the next batch of separators, unless the `maxsplit` limit is reached
+        sz_size_t matches_allowed = offsets_count + 1 < max_parts ? max_parts - 1 - offsets_count : 0;
+        sz_size_t batch_capacity = sz_min_of_two(matches_allowed, find_all_batch_capacity);
+        sz_string_view_t rest;
+        rest.start = text.start + total_skipped;
+        rest.length = text.length - total_skipped;
+        sz_size_t batch_count =
+            batch_capacity ? find_all_matches(finder, rest, separator, match_length, batch, batch_capacity) : 0;
+        reached_tail = batch_count != batch_capacity || !batch_capacity;
+
+        // Reallocate offsets array if needed, reserving space for the tail
+        sz_size_t offsets_required = offsets_count + batch_count + reached_tail;
+        if (offsets_required > offsets_capacity) {
+            while (offsets_capacity < offsets_required) offsets_capacity = (offsets_capacity + 1) * 2;
             void *new_offsets = realloc(offsets_endings, offsets_capacity * bytes_per_offset);
             if (!new_offsets) {
                 if (offsets_endings) free(offsets_endings);
@@ -2523,10 +3141,13 @@ static Strs *Str_split_(PyObject *parent_string, sz_string_view_t const text, sz
             return NULL;
         }
 
-        // Export the offset
-        if (bytes_per_offset == 8) { ((uint64_t *)offsets_endings)[offsets_count] = (uint64_t)part_end_offset; }
-        else { ((uint32_t *)offsets_endings)[offsets_count] = (uint32_t)part_end_offset; }
-        offsets_count++;
+        // Export the offsets of the first bytes after the separators, followed by the end of the text
+        for (sz_size_t i = 0; i != batch_count + reached_tail; ++i, ++offsets_count) {
+            sz_size_t part_end_offset = i != batch_count ? total_skipped + batch[i] + match_length : text.length;
+            if (bytes_per_offset == 8) { ((uint64_t *)offsets_endings)[offsets_count] = (uint64_t)part_end_offset; }
+            else { ((uint32_t *)offsets_endings)[offsets_count] = (uint32_t)part_end_offset; }
+        }
+        if (batch_count) total_skipped += batch[batch_count - 1] + match_length;
     }
 
     // Populate the Strs object with the offsets
@@ -2543,6 +3164,76 @@ static Strs *Str_split_(PyObject *parent_string, sz_string_view_t const text, sz
     return result;
 }
 
+/**
+ *  @brief  Implements the forward order split logic on multiple threads, for both string-delimiters
+ *          and character sets, producing the same consecutive layouts as the `Str_split_`.
+ */
+static Strs *Str_split_parallel_(PyObject *parent_string, sz_string_view_t const text,
+                                 sz_string_view_t const separator, int keepseparator, sz_find_t finder,
+                                 sz_size_t match_length, size_t threads_count) {
+
+    parallel_search_t search;
+    sz_fill((sz_ptr_t)&search, sizeof(search), 0);
+    search.haystack = text;
+    search.needle = separator;
+    search.finder = finder;
+    search.match_length = match_length;
+    search.skip_length = match_length;
+    search.collect_ends = sz_true_k;
+    size_t partitions_count = parallel_search(&search, threads_count);
+    if (!partitions_count) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    if (partitions_count == 1) {
+        parallel_search_free(&search, partitions_count);
+        return Str_split_(parent_string, text, separator, keepseparator, PY_SSIZE_T_MAX, finder, match_length);
+    }
+
+    // Concatenate the per-partition ends of the separators, followed by the end of the text
+    size_t offsets_count = 1;
+    for (size_t i = 0; i != partitions_count; ++i) offsets_count += search.counts[i];
+    size_t bytes_per_offset = text.length >= UINT32_MAX ? 8 : 4;
+    void *offsets_endings = malloc(offsets_count * bytes_per_offset);
+    Strs *result = search.failed || !offsets_endings ? NULL : (Strs *)PyObject_New(Strs, &StrsType);
+    if (!result) {
+        free(offsets_endings);
+        parallel_search_free(&search, partitions_count);
+        if (!PyErr_Occurred()) PyErr_NoMemory();
+        return NULL;
+    }
+
+    for (size_t i = 0, exported = 0; i <= partitions_count; ++i) {
+        size_t partition_count = i != partitions_count ? search.counts[i] : 1;
+        for (size_t j = 0; j != partition_count; ++j, ++exported) {
+            sz_size_t end_offset = i != partitions_count ? search.ends[i][j] : text.length;
+            if (bytes_per_offset == 8) { ((uint64_t *)offsets_endings)[exported] = (uint64_t)end_offset; }
+            else { ((uint32_t *)offsets_endings)[exported] = (uint32_t)end_offset; }
+        }
+    }
+    parallel_search_free(&search, partitions_count);
+
+    if (bytes_per_offset == 8) {
+        result->type = STRS_CONSECUTIVE_64;
+        result->data.consecutive_64bit.start = text.start;
+        result->data.consecutive_64bit.parent_string = parent_string;
+        result->data.consecutive_64bit.separator_length = !keepseparator * match_length;
+        result->data.consecutive_64bit.end_offsets = offsets_endings;
+        result->data.consecutive_64bit.count = offsets_count;
+    }
+    else {
+        result->type = STRS_CONSECUTIVE_32;
+        result->data.consecutive_32bit.start = text.start;
+        result->data.consecutive_32bit.parent_string = parent_string;
+        result->data.consecutive_32bit.separator_length = !keepseparator * match_length;
+        result->data.consecutive_32bit.end_offsets = offsets_endings;
+        result->data.consecutive_32bit.count = offsets_count;
+    }
+
+    Py_INCREF(parent_string);
+    return result;
+}
+
 /**
  *  @brief  Implements the reverse order split logic for both string-delimiters and character sets.
  *          Unlike the `Str_split_` can't use consecutive layouts and produces a `REAORDERED` one.
@@ -2627,7 +3318,8 @@ static Strs *Str_rsplit_(PyObject *parent_string, sz_string_view_t const text, s
  *          to `Str_split_` and `Str_rsplit_` implementations, parsing function arguments.
  */
 static PyObject *Str_split_with_known_callback(PyObject *self, PyObject *args, PyObject *kwargs, //
-                                               sz_find_t finder, sz_size_t match_length,         //
+                                               sz_find_t finder, sz_find_t caseless_finder,      //
+                                               sz_size_t match_length,                           //
                                                sz_bool_t is_reverse, sz_bool_t is_lazy_iterator) {
     // Check minimum arguments
     int is_member = self != NULL && PyObject_TypeCheck(self, &StrType);
@@ -2641,6 +3333,11 @@ static PyObject *Str_split_with_known_callback(PyObject *self, PyObject *args, P
     PyObject *separator_obj = nargs > !is_member + 0 ? PyTuple_GET_ITEM(args, !is_member + 0) : NULL;
     PyObject *maxsplit_obj = nargs > !is_member + 1 ? PyTuple_GET_ITEM(args, !is_member + 1) : NULL;
     PyObject *keepseparator_obj = nargs > !is_member + 2 ? PyTuple_GET_ITEM(args, !is_member + 2) : NULL;
+    PyObject *threads_obj = NULL;
+    PyObject *ignore_case_obj = NULL;
+
+    // Only the forward eager splits can be parallelized
+    sz_bool_t const can_be_parallel = !is_reverse && !is_lazy_iterator;
 
     if (kwargs) {
         PyObject *key, *value;
@@ -2651,11 +3348,22 @@ static PyObject *Str_split_with_known_callback(PyObject *self, PyObject *args, P
             else if (PyUnicode_CompareWithASCIIString(key, "keepseparator") == 0 && !keepseparator_obj) {
                 keepseparator_obj = value;
             }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key))
+            else if (can_be_parallel && PyUnicode_CompareWithASCIIString(key, "threads") == 0 && !threads_obj) {
+                threads_obj = value;
+            }
+            else if (caseless_finder && PyUnicode_CompareWithASCIIString(key, "ignore_case") == 0) {
+                ignore_case_obj = value;
+            }
+            else {
+                PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key);
                 return NULL;
+            }
         }
     }
 
+    size_t threads_count = 1;
+    if (threads_obj && !export_threads_count(threads_obj, &threads_count)) return NULL;
+
     sz_string_view_t text;
     sz_string_view_t separator;
     int keepseparator;
@@ -2705,8 +3413,20 @@ static PyObject *Str_split_with_known_callback(PyObject *self, PyObject *args, P
     }
     else { maxsplit = PY_SSIZE_T_MAX; }
 
-    // Dispatch the right backend
-    if (is_lazy_iterator)
+    // Validate and convert `ignore_case`
+    if (ignore_case_obj) {
+        int ignore_case = PyObject_IsTrue(ignore_case_obj);
+        if (ignore_case == -1) {
+            PyErr_SetString(PyExc_TypeError, "The ignore_case argument must be a boolean");
+            return NULL;
+        }
+        if (ignore_case) finder = caseless_finder;
+    }
+
+    // Dispatch the right backend, where the `maxsplit` limit requires a sequential scan
+    if (threads_count > 1 && maxsplit == PY_SSIZE_T_MAX)
+        return Str_split_parallel_(text_obj, text, separator, keepseparator, finder, match_length, threads_count);
+    else if (is_lazy_iterator)
         return Str_split_iter_(text_obj, separator_obj, text, separator, //
                                keepseparator, maxsplit, finder, match_length, is_reverse);
     else
@@ -2722,13 +3442,15 @@ static char const doc_split[] = //
     "  separator (str): The separator to split by (cannot be empty).\n"
     "  maxsplit (int, optional): Maximum number of splits (default is no limit).\n"
     "  keepseparator (bool, optional): Include the separator in results (default is False).\n"
+    "  threads (int, optional): Number of threads to scan with, 0 for all cores (default is 1).\n"
+    "  ignore_case (bool, optional): Fold the case of ASCII letters while matching (default is False).\n"
     "Returns:\n"
     "  Strs: A list of strings split by the separator.\n"
     "Raises:\n"
     "  ValueError: If the separator is an empty string.";
 
 static PyObject *Str_split(PyObject *self, PyObject *args, PyObject *kwargs) {
-    return Str_split_with_known_callback(self, args, kwargs, &sz_find, 0, sz_false_k, sz_false_k);
+    return Str_split_with_known_callback(self, args, kwargs, &sz_find, &sz_find_caseless, 0, sz_false_k, sz_false_k);
 }
 
 static char const doc_rsplit[] = //
@@ -2739,13 +3461,14 @@ static char const doc_rsplit[] = //
     "  separator (str): The separator to split by (cannot be empty).\n"
     "  maxsplit (int, optional): Maximum number of splits (default is no limit).\n"
     "  keepseparator (bool, optional): Include the separator in results (default is False).\n"
+    "  ignore_case (bool, optional): Fold the case of ASCII letters while matching (default is False).\n"
     "Returns:\n"
     "  Strs: A list of strings split by the separator.\n"
     "Raises:\n"
     "  ValueError: If the separator is an empty string.";
 
 static PyObject *Str_rsplit(PyObject *self, PyObject *args, PyObject *kwargs) {
-    return Str_split_with_known_callback(self, args, kwargs, &sz_rfind, 0, sz_true_k, sz_false_k);
+    return Str_split_with_known_callback(self, args, kwargs, &sz_rfind, &sz_rfind_caseless, 0, sz_true_k, sz_false_k);
 }
 
 static char const doc_split_charset[] = //
@@ -2756,11 +3479,12 @@ static char const doc_split_charset[] = //
     "  separators (str): A string containing separator characters.\n"
     "  maxsplit (int, optional): Maximum number of splits (default is no limit).\n"
     "  keepseparator (bool, optional): Include separators in results (default is False).\n"
+    "  threads (int, optional): Number of threads to scan with, 0 for all cores (default is 1).\n"
     "Returns:\n"
     "  Strs: A list of strings split by the character set.";
 
 static PyObject *Str_split_charset(PyObject *self, PyObject *args, PyObject *kwargs) {
-    return Str_split_with_known_callback(self, args, kwargs, &sz_find_char_from, 1, sz_false_k, sz_false_k);
+    return Str_split_with_known_callback(self, args, kwargs, &sz_find_char_from, NULL, 1, sz_false_k, sz_false_k);
 }
 
 static char const doc_rsplit_charset[] = //
@@ -2775,7 +3499,7 @@ static char const doc_rsplit_charset[] = //
     "  Strs: A list of strings split by the character set.";
 
 static PyObject *Str_rsplit_charset(PyObject *self, PyObject *args, PyObject *kwargs) {
-    return Str_split_with_known_callback(self, args, kwargs, &sz_rfind_char_from, 1, sz_true_k, sz_false_k);
+    return Str_split_with_known_callback(self, args, kwargs, &sz_rfind_char_from, NULL, 1, sz_true_k, sz_false_k);
 }
 
 static char const doc_split_iter[] = //
@@ -2785,13 +3509,14 @@ static char const doc_split_iter[] = //
     "  text (Str or str or bytes): The string object.\n"
     "  separator (str): The separator to split by (cannot be empty).\n"
     "  keepseparator (bool, optional): Include separator in results (default is False).\n"
+    "  ignore_case (bool, optional): Fold the case of ASCII letters while matching (default is False).\n"
     "Returns:\n"
     "  iterator: An iterator yielding split substrings.\n"
     "Raises:\n"
     "  ValueError: If the separator is an empty string.";
 
 static PyObject *Str_split_iter(PyObject *self, PyObject *args, PyObject *kwargs) {
-    return Str_split_with_known_callback(self, args, kwargs, &sz_find, 0, sz_false_k, sz_true_k);
+    return Str_split_with_known_callback(self, args, kwargs, &sz_find, &sz_find_caseless, 0, sz_false_k, sz_true_k);
 }
 
 static char const doc_rsplit_iter[] = //
@@ -2801,13 +3526,14 @@ static char const doc_rsplit_iter[] = //
     "  text (Str or str or bytes): The string object.\n"
     "  separator (str): The separator to split by (cannot be empty).\n"
     "  keepseparator (bool, optional): Include separator in results (default is False).\n"
+    "  ignore_case (bool, optional): Fold the case of ASCII letters while matching (default is False).\n"
     "Returns:\n"
     "  iterator: An iterator yielding split substrings in reverse.\n"
     "Raises:\n"
     "  ValueError: If the separator is an empty string.";
 
 static PyObject *Str_rsplit_iter(PyObject *self, PyObject *args, PyObject *kwargs) {
-    return Str_split_with_known_callback(self, args, kwargs, &sz_rfind, 0, sz_true_k, sz_true_k);
+    return Str_split_with_known_callback(self, args, kwargs, &sz_rfind, &sz_rfind_caseless, 0, sz_true_k, sz_true_k);
 }
 
 static char const doc_split_charset_iter[] = //
@@ -2821,7 +3547,7 @@ static char const doc_split_charset_iter[] = //
     "  iterator: An iterator yielding split substrings.";
 
 static PyObject *Str_split_charset_iter(PyObject *self, PyObject *args, PyObject *kwargs) {
-    return Str_split_with_known_callback(self, args, kwargs, &sz_find_char_from, 1, sz_false_k, sz_true_k);
+    return Str_split_with_known_callback(self, args, kwargs, &sz_find_char_from, NULL, 1, sz_false_k, sz_true_k);
 }
 
 static char const doc_rsplit_charset_iter[] = //
@@ -2835,7 +3561,7 @@ static char const doc_rsplit_charset_iter[] = //
     "  iterator: An iterator yielding split substrings in reverse.";
 
 static PyObject *Str_rsplit_charset_iter(PyObject *self, PyObject *args, PyObject *kwargs) {
-    return Str_split_with_known_callback(self, args, kwargs, &sz_rfind_char_from, 1, sz_true_k, sz_true_k);
+    return Str_split_with_known_callback(self, args, kwargs, &sz_rfind_char_from, NULL, 1, sz_true_k, sz_true_k);
 }
 
 static char const doc_splitlines[] = //
@@ -2869,7 +3595,7 @@ static PyObject *Str_splitlines(PyObject *self, PyObject *args, PyObject *kwargs
                 keeplinebreaks_obj = value;
             }
             else if (PyUnicode_CompareWithASCIIString(key, "maxsplit") == 0 && !maxsplit_obj) { maxsplit_obj = value; }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key)) { return NULL; }
+            else { PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key); return NULL; }
         }
     }
 
@@ -2997,6 +3723,8 @@ static PyMethodDef Str_methods[] = {
     {"endswith", (PyCFunction)Str_endswith, SZ_METHOD_FLAGS, doc_endswith},
     {"translate", (PyCFunction)Str_translate, SZ_METHOD_FLAGS, doc_translate},
     {"decode", (PyCFunction)Str_decode, SZ_METHOD_FLAGS, doc_decode},
+    {"isutf8", (PyCFunction)Str_isutf8, SZ_METHOD_FLAGS, doc_isutf8},
+    {"utf8_count", (PyCFunction)Str_utf8_count, SZ_METHOD_FLAGS, doc_utf8_count},
 
     // Bidirectional operations
     {"find", (PyCFunction)Str_find, SZ_METHOD_FLAGS, doc_find},
@@ -3062,9 +3790,36 @@ static PyTypeObject StrType = {
 
 #pragma region Split Iterator
 
+/**
+ *  @brief  Asks the OS to fault-in the next `readahead` bytes of the remaining text, re-issuing the
+ *          hint only after half of the previously prefetched window was consumed.
+ */
+static void SplitIteratorType_prefetch_(SplitIterator *self) {
+    sz_cptr_t const text_start = self->text.start;
+    sz_cptr_t const text_end = self->text.start + self->text.length;
+    sz_size_t const window = self->readahead;
+    if (!self->is_reverse) {
+        if (self->prefetched >= text_end) return;
+        if (self->prefetched > text_start && (sz_size_t)(self->prefetched - text_start) > window / 2) return;
+        sz_cptr_t from = self->prefetched > text_start ? self->prefetched : text_start;
+        sz_cptr_t until = self->text.length > window ? text_start + window : text_end;
+        sz_memory_advise(from, (sz_size_t)(until - from), sz_memory_advice_willneed_k);
+        self->prefetched = until;
+    }
+    else {
+        if (self->prefetched <= text_start) return;
+        if (self->prefetched < text_end && (sz_size_t)(text_end - self->prefetched) > window / 2) return;
+        sz_cptr_t until = self->prefetched < text_end ? self->prefetched : text_end;
+        sz_cptr_t from = self->text.length > window ? text_end - window : text_start;
+        sz_memory_advise(from, (sz_size_t)(until - from), sz_memory_advice_willneed_k);
+        self->prefetched = from;
+    }
+}
+
 static PyObject *SplitIteratorType_next(SplitIterator *self) {
     // No more data to split
     if (self->reached_tail) return NULL;
+    if (self->readahead) SplitIteratorType_prefetch_(self);
 
     // Create a new `Str` object
     Str *result_obj = (Str *)StrType.tp_alloc(&StrType, 0);
@@ -3135,6 +3890,284 @@ static PyTypeObject SplitIteratorType = {
 
 #pragma endregion
 
+#pragma region Stream Matcher
+
+static void StreamMatcher_dealloc(StreamMatcher *self) {
+    if (self->matcher.buffer) sz_stream_matcher_free(&self->matcher, NULL);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *StreamMatcher_new(PyTypeObject *type, PyObject *args, PyObject *kwargs) {
+    StreamMatcher *self = (StreamMatcher *)type->tp_alloc(type, 0);
+    if (!self) return NULL;
+    sz_fill((sz_ptr_t)&self->matcher, sizeof(self->matcher), 0);
+    return (PyObject *)self;
+}
+
+static int StreamMatcher_init(StreamMatcher *self, PyObject *args, PyObject *kwargs) {
+    Py_ssize_t nargs = PyTuple_Size(args);
+    if (nargs < 1 || nargs > 2) {
+        PyErr_SetString(PyExc_TypeError, "StreamMatcher() takes 1 or 2 positional arguments");
+        return -1;
+    }
+    PyObject *needle_obj = PyTuple_GET_ITEM(args, 0);
+    PyObject *allowoverlap_obj = nargs > 1 ? PyTuple_GET_ITEM(args, 1) : NULL;
+    if (kwargs) {
+        PyObject *key, *value;
+        Py_ssize_t pos = 0;
+        while (PyDict_Next(kwargs, &pos, &key, &value))
+            if (PyUnicode_CompareWithASCIIString(key, "allowoverlap") == 0 && !allowoverlap_obj) {
+                allowoverlap_obj = value;
+            }
+            else {
+                PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key);
+                return -1;
+            }
+    }
+
+    sz_string_view_t needle;
+    if (!export_string_like(needle_obj, &needle.start, &needle.length)) {
+        wrap_current_exception("The needle must be string-like");
+        return -1;
+    }
+    if (!needle.length) {
+        PyErr_SetString(PyExc_ValueError, "The needle can't be empty");
+        return -1;
+    }
+    int allowoverlap = allowoverlap_obj ? PyObject_IsTrue(allowoverlap_obj) : 0;
+    if (allowoverlap == -1) return -1;
+
+    // Re-initialization replaces the previous needle.
+    if (self->matcher.buffer) sz_stream_matcher_free(&self->matcher, NULL);
+    if (!sz_stream_matcher_init(&self->matcher, needle.start, needle.length, allowoverlap ? sz_true_k : sz_false_k,
+                                NULL)) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ *  @brief  Appends the absolute offsets of matches to a Python list, remembering the first failure.
+ */
+typedef struct {
+    PyObject *list;
+    int failed;
+} stream_matches_collector_t;
+
+static void stream_matches_collect(void *context, sz_size_t offset) {
+    stream_matches_collector_t *collector = (stream_matches_collector_t *)context;
+    if (collector->failed) return;
+    PyObject *offset_obj = PyLong_FromSize_t(offset);
+    if (!offset_obj || PyList_Append(collector->list, offset_obj) < 0) collector->failed = 1;
+    Py_XDECREF(offset_obj);
+}
+
+static char const doc_StreamMatcher_feed[] = //
+    "Feed the next chunk of the stream, returning the absolute offsets of the matches found so far.\n"
+    "\n"
+    "Only the last `len(needle) - 1` bytes are retained between the calls, so the chunk can be\n"
+    "discarded or overwritten right after the call. Matches straddling the boundary with the previous\n"
+    "chunks are reported as soon as their last byte arrives.\n"
+    "\n"
+    "Args:\n"
+    "  chunk (Str or str or bytes or File): The next part of the stream.\n"
+    "Returns:\n"
+    "  list: Absolute offsets of the matches, in the increasing order.";
+
+static PyObject *StreamMatcher_feed(StreamMatcher *self, PyObject *args, PyObject *kwargs) {
+    if (PyTuple_Size(args) != 1 || (kwargs && PyDict_Size(kwargs))) {
+        PyErr_SetString(PyExc_TypeError, "feed() takes exactly one positional argument");
+        return NULL;
+    }
+    sz_string_view_t chunk;
+    if (!export_string_like(PyTuple_GET_ITEM(args, 0), &chunk.start, &chunk.length)) {
+        wrap_current_exception("The chunk must be string-like");
+        return NULL;
+    }
+
+    stream_matches_collector_t collector;
+    collector.list = PyList_New(0);
+    collector.failed = 0;
+    if (!collector.list) return NULL;
+    sz_stream_matcher_feed(&self->matcher, chunk.start, chunk.length, stream_matches_collect, &collector);
+    if (collector.failed) {
+        Py_DECREF(collector.list);
+        return NULL;
+    }
+    return collector.list;
+}
+
+static char const doc_StreamMatcher_reset[] = //
+    "Rewind to the start of a new stream, keeping the needle.";
+
+static PyObject *StreamMatcher_reset(StreamMatcher *self, PyObject *Py_UNUSED(ignored)) {
+    sz_stream_matcher_reset(&self->matcher);
+    Py_RETURN_NONE;
+}
+
+static PyObject *StreamMatcher_get_offset(StreamMatcher *self, void *closure) {
+    return PyLong_FromSize_t(self->matcher.offset);
+}
+
+static PyObject *StreamMatcher_get_needle(StreamMatcher *self, void *closure) {
+    return PyBytes_FromStringAndSize(self->matcher.needle, (Py_ssize_t)self->matcher.needle_length);
+}
+
+static PyGetSetDef StreamMatcher_getsetters[] = {
+    {"offset", (getter)StreamMatcher_get_offset, NULL, "Number of bytes fed so far", NULL},
+    {"needle", (getter)StreamMatcher_get_needle, NULL, "Copy of the needle", NULL},
+    {NULL} // Sentinel
+};
+
+static PyMethodDef StreamMatcher_methods[] = {
+    {"feed", (PyCFunction)StreamMatcher_feed, SZ_METHOD_FLAGS, doc_StreamMatcher_feed},
+    {"reset", (PyCFunction)StreamMatcher_reset, METH_NOARGS, doc_StreamMatcher_reset},
+    {NULL, NULL, 0, NULL} // Sentinel
+};
+
+static PyTypeObject StreamMatcherType = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "stringzilla.StreamMatcher",
+    .tp_doc = "Substring matcher for streams, fed in chunks, that keeps the state across the chunk boundaries",
+    .tp_basicsize = sizeof(StreamMatcher),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_methods = StreamMatcher_methods,
+    .tp_getset = StreamMatcher_getsetters,
+    .tp_new = (newfunc)StreamMatcher_new,
+    .tp_init = (initproc)StreamMatcher_init,
+    .tp_dealloc = (destructor)StreamMatcher_dealloc,
+};
+
+#pragma endregion
+
+#pragma region Glob
+
+static void Glob_dealloc(Glob *self) {
+    if (self->matcher.buffer) sz_glob_matcher_free(&self->matcher, NULL);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *Glob_new(PyTypeObject *type, PyObject *args, PyObject *kwargs) {
+    Glob *self = (Glob *)type->tp_alloc(type, 0);
+    if (!self) return NULL;
+    sz_fill((sz_ptr_t)&self->matcher, sizeof(self->matcher), 0);
+    return (PyObject *)self;
+}
+
+static int Glob_init(Glob *self, PyObject *args, PyObject *kwargs) {
+    if (PyTuple_Size(args) != 1 || (kwargs && PyDict_Size(kwargs))) {
+        PyErr_SetString(PyExc_TypeError, "Glob() takes exactly one positional argument");
+        return -1;
+    }
+    sz_string_view_t pattern;
+    if (!export_string_like(PyTuple_GET_ITEM(args, 0), &pattern.start, &pattern.length)) {
+        wrap_current_exception("The pattern must be string-like");
+        return -1;
+    }
+
+    // Re-initialization replaces the previous pattern.
+    if (self->matcher.buffer) sz_glob_matcher_free(&self->matcher, NULL);
+    if (!sz_glob_matcher_init(&self->matcher, pattern.start, pattern.length, NULL)) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
+static char const doc_Glob_match[] = //
+    "Check if the whole string matches the pattern.\n"
+    "\n"
+    "Args:\n"
+    "  text (Str or str or bytes or File): The string to check.\n"
+    "Returns:\n"
+    "  bool: Whether the string matches.";
+
+static PyObject *Glob_match(Glob *self, PyObject *args, PyObject *kwargs) {
+    if (PyTuple_Size(args) != 1 || (kwargs && PyDict_Size(kwargs))) {
+        PyErr_SetString(PyExc_TypeError, "match() takes exactly one positional argument");
+        return NULL;
+    }
+    sz_string_view_t text;
+    if (!export_string_like(PyTuple_GET_ITEM(args, 0), &text.start, &text.length)) {
+        wrap_current_exception("The text must be string-like");
+        return NULL;
+    }
+    return PyBool_FromLong(sz_glob_match(&self->matcher, text.start, text.length));
+}
+
+static char const doc_Glob_filter[] = //
+    "Check every string of a `Strs` collection against the pattern, in a single native loop.\n"
+    "\n"
+    "Args:\n"
+    "  strings (Strs): The strings to check.\n"
+    "Returns:\n"
+    "  list: Indices of the matching strings, in the increasing order.";
+
+static PyObject *Glob_filter(Glob *self, PyObject *args, PyObject *kwargs) {
+    if (PyTuple_Size(args) != 1 || (kwargs && PyDict_Size(kwargs))) {
+        PyErr_SetString(PyExc_TypeError, "filter() takes exactly one positional argument");
+        return NULL;
+    }
+    PyObject *strings_obj = PyTuple_GET_ITEM(args, 0);
+    if (!PyObject_TypeCheck(strings_obj, &StrsType)) {
+        PyErr_SetString(PyExc_TypeError, "The argument must be a Strs object");
+        return NULL;
+    }
+    Strs *strings = (Strs *)strings_obj;
+    get_string_at_offset_t getter = str_at_offset_getter(strings);
+    if (!getter) return NULL;
+
+    PyObject *indices = PyList_New(0);
+    if (!indices) return NULL;
+    Py_ssize_t count = Strs_len(strings);
+    for (Py_ssize_t i = 0; i < count; ++i) {
+        PyObject *parent = NULL;
+        char const *start = NULL;
+        size_t length = 0;
+        getter(strings, i, count, &parent, &start, &length);
+        if (!sz_glob_match(&self->matcher, start, length)) continue;
+        PyObject *index_obj = PyLong_FromSsize_t(i);
+        if (!index_obj || PyList_Append(indices, index_obj) < 0) {
+            Py_XDECREF(index_obj);
+            Py_DECREF(indices);
+            return NULL;
+        }
+        Py_DECREF(index_obj);
+    }
+    return indices;
+}
+
+static PyObject *Glob_get_min_length(Glob *self, void *closure) {
+    return PyLong_FromSize_t(self->matcher.atoms_count);
+}
+
+static PyGetSetDef Glob_getsetters[] = {
+    {"min_length", (getter)Glob_get_min_length, NULL, "Length of the shortest matching string", NULL},
+    {NULL} // Sentinel
+};
+
+static PyMethodDef Glob_methods[] = {
+    {"match", (PyCFunction)Glob_match, SZ_METHOD_FLAGS, doc_Glob_match},
+    {"filter", (PyCFunction)Glob_filter, SZ_METHOD_FLAGS, doc_Glob_filter},
+    {NULL, NULL, 0, NULL} // Sentinel
+};
+
+static PyTypeObject GlobType = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "stringzilla.Glob",
+    .tp_doc = "Compiled glob-style pattern with `*`, `?`, `[...]` classes and `\\` escapes, matching whole strings",
+    .tp_basicsize = sizeof(Glob),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_methods = Glob_methods,
+    .tp_getset = Glob_getsetters,
+    .tp_new = (newfunc)Glob_new,
+    .tp_init = (initproc)Glob_init,
+    .tp_dealloc = (destructor)Glob_dealloc,
+};
+
+#pragma endregion
+
 #pragma region Strs
 
 static PyObject *Strs_shuffle(Strs *self, PyObject *args, PyObject *kwargs) {
@@ -3153,7 +4186,7 @@ static PyObject *Strs_shuffle(Strs *self, PyObject *args, PyObject *kwargs) {
         Py_ssize_t pos = 0;
         while (PyDict_Next(kwargs, &pos, &key, &value)) {
             if (PyUnicode_CompareWithASCIIString(key, "seed") == 0 && !seed_obj) { seed_obj = value; }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key)) { return NULL; }
+            else { PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key); return NULL; }
         }
     }
 
@@ -3182,8 +4215,18 @@ static PyObject *Strs_shuffle(Strs *self, PyObject *args, PyObject *kwargs) {
     Py_RETURN_NONE;
 }
 
+/**
+ *  @brief  Sorts the ::sequence, using multiple threads or, if only the ::partial_order_length smallest entries
+ *          are needed, the partial sort, that skips the radix buckets beyond them.
+ */
+static void sort_sequence(sz_sequence_t *sequence, size_t threads_count, sz_size_t partial_order_length) {
+    if (partial_order_length < sequence->count) sz_sort_partial(sequence, partial_order_length);
+    else if (threads_count > 1) sz_sort_parallel(sequence, parallel_for_threads, &threads_count);
+    else { sz_sort(sequence); }
+}
+
 static sz_bool_t Strs_sort_(Strs *self, sz_string_view_t **parts_output, sz_sorted_idx_t **order_output,
-                            sz_size_t *count_output) {
+                            sz_size_t *count_output, size_t threads_count, sz_size_t partial_order_length) {
     // Change the layout
     if (!prepare_strings_for_reordering(self)) {
         PyErr_Format(PyExc_TypeError, "Failed to prepare the sequence for sorting");
@@ -3215,7 +4258,7 @@ static sz_bool_t Strs_sort_(Strs *self, sz_string_view_t **parts_output, sz_sort
     sequence.get_start = parts_get_start;
     sequence.get_length = parts_get_length;
     for (sz_sorted_idx_t i = 0; i != sequence.count; ++i) sequence.order[i] = i;
-    sz_sort(&sequence);
+    sort_sequence(&sequence, threads_count, partial_order_length);
 
     // Export results
     *parts_output = parts;
@@ -3224,8 +4267,42 @@ static sz_bool_t Strs_sort_(Strs *self, sz_string_view_t **parts_output, sz_sort
     return 1;
 }
 
+/**
+ *  @brief  Sorts the indices of an Arrow-backed `Strs`, addressing the Arrow buffers directly,
+ *          without materializing the views of all strings, like the `Strs_sort_` does.
+ */
+static sz_bool_t Strs_order_arrow_(Strs *self, sz_sorted_idx_t **order_output, sz_size_t *count_output,
+                                   size_t threads_count, sz_size_t partial_order_length) {
+    size_t count = self->data.arrow.count;
+    size_t memory_needed = sizeof(sz_sorted_idx_t) * count;
+    if (temporary_memory.length < memory_needed) {
+        temporary_memory.start = realloc(temporary_memory.start, memory_needed);
+        temporary_memory.length = memory_needed;
+    }
+    if (!temporary_memory.start && count) {
+        PyErr_Format(PyExc_MemoryError, "Unable to allocate memory for the order");
+        return 0;
+    }
+
+    // Shift a shallow copy of the array to the first element of this slice
+    struct ArrowArray window = *(struct ArrowArray const *)self->data.arrow.sequence.handle;
+    window.offset += (sz_i64_t)self->data.arrow.first;
+    sz_sequence_t sequence = self->data.arrow.sequence;
+    sequence.handle = &window;
+    sequence.count = count;
+    sequence.order = (sz_sorted_idx_t *)temporary_memory.start;
+    for (sz_sorted_idx_t i = 0; i != sequence.count; ++i) sequence.order[i] = i;
+    sort_sequence(&sequence, threads_count, partial_order_length);
+
+    *order_output = sequence.order;
+    *count_output = sequence.count;
+    return 1;
+}
+
 static PyObject *Strs_sort(Strs *self, PyObject *args, PyObject *kwargs) {
     PyObject *reverse_obj = NULL; // Default is not reversed
+    PyObject *threads_obj = NULL; // Default is single-threaded
+    PyObject *k_obj = NULL;       // Default is sorting everything
 
     // Check for positional arguments
     Py_ssize_t nargs = PyTuple_Size(args);
@@ -3241,7 +4318,9 @@ static PyObject *Strs_sort(Strs *self, PyObject *args, PyObject *kwargs) {
         Py_ssize_t pos = 0;
         while (PyDict_Next(kwargs, &pos, &key, &value)) {
             if (PyUnicode_CompareWithASCIIString(key, "reverse") == 0 && !reverse_obj) { reverse_obj = value; }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key)) { return NULL; }
+            else if (PyUnicode_CompareWithASCIIString(key, "threads") == 0) { threads_obj = value; }
+            else if (PyUnicode_CompareWithASCIIString(key, "k") == 0) { k_obj = value; }
+            else { PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key); return NULL; }
         }
     }
 
@@ -3254,10 +4333,18 @@ static PyObject *Strs_sort(Strs *self, PyObject *args, PyObject *kwargs) {
         reverse = PyObject_IsTrue(reverse_obj);
     }
 
+    size_t threads_count = 1;
+    if (threads_obj && !export_threads_count(threads_obj, &threads_count)) return NULL;
+
+    // The radix buckets are only skipped from the end, so the reversed top-k has to sort everything
+    sz_size_t partial_order_length = SZ_SIZE_MAX;
+    if (k_obj && !export_partial_order_length(k_obj, &partial_order_length)) return NULL;
+    if (reverse) partial_order_length = SZ_SIZE_MAX;
+
     sz_string_view_t *parts = NULL;
     sz_size_t *order = NULL;
     sz_size_t count = 0;
-    if (!Strs_sort_(self, &parts, &order, &count)) return NULL;
+    if (!Strs_sort_(self, &parts, &order, &count, threads_count, partial_order_length)) return NULL;
 
     // Apply the sorting algorithm here, considering the `reverse` value
     if (reverse) reverse_offsets(order, count);
@@ -3270,6 +4357,8 @@ static PyObject *Strs_sort(Strs *self, PyObject *args, PyObject *kwargs) {
 
 static PyObject *Strs_order(Strs *self, PyObject *args, PyObject *kwargs) {
     PyObject *reverse_obj = NULL; // Default is not reversed
+    PyObject *threads_obj = NULL; // Default is single-threaded
+    PyObject *k_obj = NULL;       // Default is sorting everything
 
     // Check for positional arguments
     Py_ssize_t nargs = PyTuple_Size(args);
@@ -3285,7 +4374,9 @@ static PyObject *Strs_order(Strs *self, PyObject *args, PyObject *kwargs) {
         Py_ssize_t pos = 0;
         while (PyDict_Next(kwargs, &pos, &key, &value)) {
             if (PyUnicode_CompareWithASCIIString(key, "reverse") == 0 && !reverse_obj) { reverse_obj = value; }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key)) { return NULL; }
+            else if (PyUnicode_CompareWithASCIIString(key, "threads") == 0) { threads_obj = value; }
+            else if (PyUnicode_CompareWithASCIIString(key, "k") == 0) { k_obj = value; }
+            else { PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key); return NULL; }
         }
     }
 
@@ -3298,13 +4389,26 @@ static PyObject *Strs_order(Strs *self, PyObject *args, PyObject *kwargs) {
         reverse = PyObject_IsTrue(reverse_obj);
     }
 
+    size_t threads_count = 1;
+    if (threads_obj && !export_threads_count(threads_obj, &threads_count)) return NULL;
+
+    // The radix buckets are only skipped from the end, so the reversed top-k has to sort everything
+    sz_size_t k = SZ_SIZE_MAX;
+    if (k_obj && !export_partial_order_length(k_obj, &k)) return NULL;
+    sz_size_t partial_order_length = reverse ? SZ_SIZE_MAX : k;
+
     sz_string_view_t *parts = NULL;
     sz_sorted_idx_t *order = NULL;
     sz_size_t count = 0;
-    if (!Strs_sort_(self, &parts, &order, &count)) return NULL;
+    if (self->type == STRS_ARROW) {
+        if (!Strs_order_arrow_(self, &order, &count, threads_count, partial_order_length)) return NULL;
+    }
+    else if (!Strs_sort_(self, &parts, &order, &count, threads_count, partial_order_length))
+        return NULL;
 
     // Apply the sorting algorithm here, considering the `reverse` value
     if (reverse) reverse_offsets(order, count);
+    if (k < count) count = k;
 
     // Here, instead of applying the order, we want to return the copy of the
     // order as a NumPy array of 64-bit unsigned integers.
@@ -3338,35 +4442,506 @@ static PyObject *Strs_order(Strs *self, PyObject *args, PyObject *kwargs) {
     return tuple;
 }
 
-static PyObject *Strs_sample(Strs *self, PyObject *args, PyObject *kwargs) {
-    PyObject *sample_size_obj = NULL;
-    PyObject *seed_obj = NULL;
+/**
+ *  @brief  State for `sz_sequence_t` callbacks, addressing the members of any `Strs` layout without copies.
+ */
+typedef struct {
+    Strs *strs;
+    get_string_at_offset_t getter;
+    Py_ssize_t count;
+} strs_sequence_handle_t;
 
-    // Check for positional arguments
+static sz_cptr_t strs_sequence_get_start(sz_sequence_t const *seq, sz_size_t i) {
+    strs_sequence_handle_t const *handle = (strs_sequence_handle_t const *)seq->handle;
+    PyObject *parent_string;
+    char const *start;
+    size_t length;
+    handle->getter(handle->strs, (Py_ssize_t)i, handle->count, &parent_string, &start, &length);
+    return start;
+}
+
+static sz_size_t strs_sequence_get_length(sz_sequence_t const *seq, sz_size_t i) {
+    strs_sequence_handle_t const *handle = (strs_sequence_handle_t const *)seq->handle;
+    PyObject *parent_string;
+    char const *start;
+    size_t length;
+    handle->getter(handle->strs, (Py_ssize_t)i, handle->count, &parent_string, &start, &length);
+    return length;
+}
+
+static char const doc_edit_distances[] = //
+    "Compute the Levenshtein edit distances between a query and every string in the collection.\n"
+    "Faster than calling `edit_distance` in a loop, as the query-side state and buffers are reused.\n"
+    "\n"
+    "Args:\n"
+    "  query (Str or str or bytes): The string to compare against every member.\n"
+    "  bound (int, optional): Optional maximum distance to compute (default is no bound).\n"
+    "Returns:\n"
+    "  tuple: The edit distances in bytes, one per member of the collection.";
+
+static PyObject *Strs_edit_distances(Strs *self, PyObject *args, PyObject *kwargs) {
     Py_ssize_t nargs = PyTuple_Size(args);
-    if (nargs > 1) {
-        PyErr_SetString(PyExc_TypeError, "sample() takes 1 positional argument and 1 keyword argument");
+    if (nargs < 1 || nargs > 2) {
+        PyErr_SetString(PyExc_TypeError, "edit_distances() takes 1 or 2 positional arguments");
         return NULL;
     }
-    else if (nargs == 1) { sample_size_obj = PyTuple_GET_ITEM(args, 0); }
 
-    // Parse keyword arguments
+    PyObject *query_obj = PyTuple_GET_ITEM(args, 0);
+    PyObject *bound_obj = nargs > 1 ? PyTuple_GET_ITEM(args, 1) : NULL;
     if (kwargs) {
         PyObject *key, *value;
         Py_ssize_t pos = 0;
         while (PyDict_Next(kwargs, &pos, &key, &value)) {
-            if (PyUnicode_CompareWithASCIIString(key, "seed") == 0 && !seed_obj) { seed_obj = value; }
-            else if (PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key)) { return NULL; }
+            if (PyUnicode_CompareWithASCIIString(key, "bound") == 0 && !bound_obj) { bound_obj = value; }
+            else { PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key); return NULL; }
         }
     }
 
-    // Translate the seed and the sample size to C types
-    size_t sample_size = 0;
-    if (sample_size_obj) {
-        if (!PyLong_Check(sample_size_obj)) {
-            PyErr_SetString(PyExc_TypeError, "The sample size must be an integer");
-            return NULL;
-        }
+    Py_ssize_t bound = 0; // Default value for bound
+    if (bound_obj && ((bound = PyLong_AsSsize_t(bound_obj)) < 0)) {
+        PyErr_Format(PyExc_ValueError, "Bound must be a non-negative integer");
+        return NULL;
+    }
+
+    sz_string_view_t query;
+    if (!export_string_like(query_obj, &query.start, &query.length)) {
+        wrap_current_exception("The query must be string-like");
+        return NULL;
+    }
+
+    strs_sequence_handle_t handle;
+    handle.strs = self;
+    handle.count = Strs_len(self);
+    handle.getter = str_at_offset_getter(self);
+    if (!handle.getter) {
+        PyErr_SetString(PyExc_TypeError, "Unknown Strs kind");
+        return NULL;
+    }
+
+    sz_sequence_t sequence;
+    sz_fill(&sequence, sizeof(sequence), 0);
+    sequence.count = (sz_size_t)handle.count;
+    sequence.handle = &handle;
+    sequence.get_start = strs_sequence_get_start;
+    sequence.get_length = strs_sequence_get_length;
+
+    sz_size_t *distances = (sz_size_t *)malloc(sizeof(sz_size_t) * (sequence.count ? sequence.count : 1));
+    if (!distances) return PyErr_NoMemory();
+
+    // Reuse the same scratch memory as the pairwise `edit_distance`
+    sz_memory_allocator_t reusing_allocator;
+    reusing_allocator.allocate = &temporary_memory_allocate;
+    reusing_allocator.free = &temporary_memory_free;
+    reusing_allocator.handle = &temporary_memory;
+    if (!sz_edit_distances(query.start, query.length, &sequence, (sz_size_t)bound, &reusing_allocator, distances)) {
+        free(distances);
+        return PyErr_NoMemory();
+    }
+
+    PyObject *tuple = PyTuple_New(handle.count);
+    if (!tuple) {
+        free(distances);
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i != handle.count; ++i) {
+        PyObject *distance = PyLong_FromSize_t(distances[i]);
+        if (!distance) {
+            free(distances);
+            Py_DECREF(tuple);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(tuple, i, distance);
+    }
+    free(distances);
+    return tuple;
+}
+
+/**
+ *  @brief  Distinct members of a `Strs`, in the order of their first occurrences.
+ *          Produced by `Strs_group_` and released with `strs_groups_free`.
+ */
+typedef struct {
+    size_t count;      // Number of distinct members
+    sz_size_t *firsts; // Index of the first occurrence of every distinct member
+    sz_size_t *counts; // Number of occurrences of every distinct member
+} strs_groups_t;
+
+static void strs_groups_free(strs_groups_t *groups) { free(groups->firsts), free(groups->counts); }
+
+/**
+ *  @brief  Minimum number of members hashed by a single thread in `Strs_group_`.
+ */
+#define strs_group_min_partition 4096
+
+/**
+ *  @brief  State of the parallel hashing pass of `Strs_group_`, splitting the ::sequence into partitions
+ *          of ::partition_size members, each hashed with the batched `sz_hash_batch`.
+ */
+typedef struct {
+    sz_sequence_t const *sequence;
+    sz_u64_t *hashes;
+    size_t partition_size;
+} strs_hashing_t;
+
+/**
+ *  @brief  Window into a parent sequence, that starts at its `first` member.
+ */
+typedef struct {
+    sz_sequence_t const *parent;
+    sz_size_t first;
+} strs_window_t;
+
+static sz_cptr_t strs_window_get_start(sz_sequence_t const *seq, sz_size_t i) {
+    strs_window_t const *window = (strs_window_t const *)seq->handle;
+    return window->parent->get_start(window->parent, window->first + i);
+}
+
+static sz_size_t strs_window_get_length(sz_sequence_t const *seq, sz_size_t i) {
+    strs_window_t const *window = (strs_window_t const *)seq->handle;
+    return window->parent->get_length(window->parent, window->first + i);
+}
+
+static void strs_hashing_task(void *context, sz_size_t partition_index) {
+    strs_hashing_t const *hashing = (strs_hashing_t const *)context;
+    strs_window_t window;
+    window.parent = hashing->sequence;
+    window.first = partition_index * hashing->partition_size;
+
+    sz_sequence_t partition;
+    sz_fill(&partition, sizeof(partition), 0);
+    partition.count = sz_min_of_two(hashing->partition_size, hashing->sequence->count - window.first);
+    partition.handle = &window;
+    partition.get_start = strs_window_get_start;
+    partition.get_length = strs_window_get_length;
+    sz_hash_batch(&partition, hashing->hashes + window.first);
+}
+
+/**
+ *  @brief  Groups the equal members of a `Strs` without sorting them. All members are hashed first,
+ *          potentially on ::threads_count threads, and then inserted into an open-addressing table,
+ *          comparing the contents with `sz_equal` only when the hashes and the lengths match.
+ *          On failure, sets a Python exception and returns 0.
+ */
+static sz_bool_t Strs_group_(Strs *self, size_t threads_count, strs_groups_t *groups) {
+    strs_sequence_handle_t handle;
+    handle.strs = self;
+    handle.count = Strs_len(self);
+    handle.getter = str_at_offset_getter(self);
+    if (!handle.getter) return 0;
+
+    sz_sequence_t sequence;
+    sz_fill(&sequence, sizeof(sequence), 0);
+    sequence.count = (sz_size_t)handle.count;
+    sequence.handle = &handle;
+    sequence.get_start = strs_sequence_get_start;
+    sequence.get_length = strs_sequence_get_length;
+
+    // Keep the load factor of the linear-probing table under 2/3, zero marking the empty slots
+    size_t const count = sequence.count;
+    size_t capacity = 16;
+    while (capacity < count + count / 2) capacity *= 2;
+    sz_u64_t *hashes = (sz_u64_t *)malloc(sizeof(sz_u64_t) * (count ? count : 1));
+    sz_size_t *slots = (sz_size_t *)calloc(capacity, sizeof(sz_size_t));
+    groups->count = 0;
+    groups->firsts = (sz_size_t *)malloc(sizeof(sz_size_t) * (count ? count : 1));
+    groups->counts = (sz_size_t *)malloc(sizeof(sz_size_t) * (count ? count : 1));
+    if (!hashes || !slots || !groups->firsts || !groups->counts) {
+        free(hashes), free(slots), strs_groups_free(groups);
+        PyErr_NoMemory();
+        return 0;
+    }
+
+    // Hashing is the only pass touching the contents of all strings, so it's the one worth parallelizing
+    strs_hashing_t hashing;
+    hashing.sequence = &sequence;
+    hashing.hashes = hashes;
+    hashing.partition_size = count;
+    size_t partitions_count = count / strs_group_min_partition;
+    if (partitions_count > threads_count) partitions_count = threads_count;
+    if (partitions_count > 1) {
+        hashing.partition_size = (count + partitions_count - 1) / partitions_count;
+        partitions_count = (count + hashing.partition_size - 1) / hashing.partition_size;
+        parallel_for_threads(&threads_count, strs_hashing_task, &hashing, partitions_count);
+    }
+    else { sz_hash_batch(&sequence, hashes); }
+
+    size_t const mask = capacity - 1;
+    for (size_t i = 0; i != count; ++i) {
+        sz_u64_t hash = hashes[i];
+        sz_cptr_t start = sequence.get_start(&sequence, i);
+        sz_size_t length = sequence.get_length(&sequence, i);
+        for (size_t slot = (size_t)hash & mask;; slot = (slot + 1) & mask) {
+            sz_size_t group = slots[slot];
+            if (!group) {
+                slots[slot] = ++groups->count;
+                groups->firsts[groups->count - 1] = i;
+                groups->counts[groups->count - 1] = 1;
+                break;
+            }
+            sz_size_t first = groups->firsts[group - 1];
+            if (hashes[first] == hash && sequence.get_length(&sequence, first) == length &&
+                sz_equal(sequence.get_start(&sequence, first), start, length)) {
+                ++groups->counts[group - 1];
+                break;
+            }
+        }
+    }
+
+    free(hashes), free(slots);
+    return 1;
+}
+
+/**
+ *  @brief  Parses the arguments of the methods, that only accept the `threads` keyword argument.
+ */
+static sz_bool_t Strs_threads_arguments_(char const *name, PyObject *args, PyObject *kwargs, size_t *threads_count) {
+    if (PyTuple_Size(args) != 0) {
+        PyErr_Format(PyExc_TypeError, "%s() takes no positional arguments", name);
+        return 0;
+    }
+
+    PyObject *threads_obj = NULL; // Default is single-threaded
+    if (kwargs) {
+        PyObject *key, *value;
+        Py_ssize_t pos = 0;
+        while (PyDict_Next(kwargs, &pos, &key, &value)) {
+            if (PyUnicode_CompareWithASCIIString(key, "threads") == 0) { threads_obj = value; }
+            else { PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key); return 0; }
+        }
+    }
+
+    *threads_count = 1;
+    return !threads_obj || export_threads_count(threads_obj, threads_count);
+}
+
+/**
+ *  @brief  Creates a `STRS_REORDERED` collection of views into the members of ::self at given ::indices.
+ */
+static PyObject *Strs_gather_(Strs *self, sz_size_t const *indices, size_t count) {
+    get_string_at_offset_t getter = str_at_offset_getter(self);
+    if (!getter) return NULL;
+
+    Strs *result = (Strs *)StrsType.tp_alloc(&StrsType, 0);
+    if (!result) return PyErr_NoMemory();
+    sz_string_view_t *parts = (sz_string_view_t *)malloc(sizeof(sz_string_view_t) * (count ? count : 1));
+    if (!parts) {
+        Py_DECREF(result);
+        return PyErr_NoMemory();
+    }
+
+    PyObject *parent_string = NULL;
+    Py_ssize_t self_count = Strs_len(self);
+    for (size_t i = 0; i != count; ++i)
+        getter(self, (Py_ssize_t)indices[i], self_count, &parent_string, &parts[i].start, &parts[i].length);
+
+    // The views must keep the original string alive
+    Py_XINCREF(parent_string);
+    result->type = STRS_REORDERED;
+    result->data.reordered.count = count;
+    result->data.reordered.parts = parts;
+    result->data.reordered.parent_string = parent_string;
+    return (PyObject *)result;
+}
+
+/**
+ *  @brief  Exports an array of sizes to a tuple of Python integers.
+ */
+static PyObject *tuple_from_sizes_(sz_size_t const *values, size_t count) {
+    PyObject *tuple = PyTuple_New((Py_ssize_t)count);
+    if (!tuple) return NULL;
+    for (size_t i = 0; i != count; ++i) {
+        PyObject *value = PyLong_FromSize_t(values[i]);
+        if (!value) {
+            Py_DECREF(tuple);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(tuple, (Py_ssize_t)i, value);
+    }
+    return tuple;
+}
+
+static char const doc_unique[] = //
+    "Deduplicate the collection, without sorting it or creating a Python object per member.\n"
+    "The distinct members are hashed into a table, keeping the order of their first occurrences.\n"
+    "\n"
+    "Args:\n"
+    "  threads (int, optional): Number of threads hashing the members, 0 for all cores (default is 1).\n"
+    "Returns:\n"
+    "  Strs: Views of the distinct members, referencing the same memory.";
+
+static PyObject *Strs_unique(Strs *self, PyObject *args, PyObject *kwargs) {
+    size_t threads_count;
+    if (!Strs_threads_arguments_("unique", args, kwargs, &threads_count)) return NULL;
+
+    strs_groups_t groups;
+    if (!Strs_group_(self, threads_count, &groups)) return NULL;
+    PyObject *result = Strs_gather_(self, groups.firsts, groups.count);
+    strs_groups_free(&groups);
+    return result;
+}
+
+static char const doc_argunique[] = //
+    "Locate the first occurrence of every distinct member, in the same order as `unique`.\n"
+    "\n"
+    "Args:\n"
+    "  threads (int, optional): Number of threads hashing the members, 0 for all cores (default is 1).\n"
+    "Returns:\n"
+    "  tuple: The indices of the first occurrences, in increasing order.";
+
+static PyObject *Strs_argunique(Strs *self, PyObject *args, PyObject *kwargs) {
+    size_t threads_count;
+    if (!Strs_threads_arguments_("argunique", args, kwargs, &threads_count)) return NULL;
+
+    strs_groups_t groups;
+    if (!Strs_group_(self, threads_count, &groups)) return NULL;
+    PyObject *result = tuple_from_sizes_(groups.firsts, groups.count);
+    strs_groups_free(&groups);
+    return result;
+}
+
+static char const doc_counts[] = //
+    "Count the occurrences of every distinct member, like a `collections.Counter`.\n"
+    "\n"
+    "Args:\n"
+    "  threads (int, optional): Number of threads hashing the members, 0 for all cores (default is 1).\n"
+    "Returns:\n"
+    "  tuple: The `Strs` of distinct members, same as `unique`, and the `tuple` of their counts.";
+
+static PyObject *Strs_counts(Strs *self, PyObject *args, PyObject *kwargs) {
+    size_t threads_count;
+    if (!Strs_threads_arguments_("counts", args, kwargs, &threads_count)) return NULL;
+
+    strs_groups_t groups;
+    if (!Strs_group_(self, threads_count, &groups)) return NULL;
+    PyObject *unique = Strs_gather_(self, groups.firsts, groups.count);
+    PyObject *counts = unique ? tuple_from_sizes_(groups.counts, groups.count) : NULL;
+    strs_groups_free(&groups);
+    if (!counts) {
+        Py_XDECREF(unique);
+        return NULL;
+    }
+
+    PyObject *result = PyTuple_Pack(2, unique, counts);
+    Py_DECREF(unique);
+    Py_DECREF(counts);
+    return result;
+}
+
+static char const doc_compact[] = //
+    "Gather the members into a new contiguous buffer, like after a `split`, but without separators.\n"
+    "Useful after `sort`, `shuffle`, or `sample`, that leave the views scattered all over the original string.\n"
+    "The result doesn't reference the original string, and the following passes over it are sequential.\n"
+    "\n"
+    "Args:\n"
+    "  threads (int, optional): Number of threads copying the members, 0 for all cores (default is 1).\n"
+    "Returns:\n"
+    "  Strs: The same members, backed by a single buffer with 32-bit or 64-bit offsets.";
+
+static PyObject *Strs_compact(Strs *self, PyObject *args, PyObject *kwargs) {
+    size_t threads_count;
+    if (!Strs_threads_arguments_("compact", args, kwargs, &threads_count)) return NULL;
+
+    strs_sequence_handle_t handle;
+    handle.strs = self;
+    handle.count = Strs_len(self);
+    handle.getter = str_at_offset_getter(self);
+    if (!handle.getter) return NULL;
+
+    sz_sequence_t sequence;
+    sz_fill(&sequence, sizeof(sequence), 0);
+    sequence.count = (sz_size_t)handle.count;
+    sequence.handle = &handle;
+    sequence.get_start = strs_sequence_get_start;
+    sequence.get_length = strs_sequence_get_length;
+
+    // Size the tape first, and then let the threads gather into it
+    size_t const count = sequence.count;
+    sz_u64_t *offsets = (sz_u64_t *)malloc(sizeof(sz_u64_t) * (count + 1));
+    if (!offsets) return PyErr_NoMemory();
+    sz_size_t const length = sz_sequence_to_u64tape(&sequence, offsets, NULL, NULL, NULL);
+    Str *tape = (Str *)StrType.tp_alloc(&StrType, 0);
+    if (!tape) {
+        free(offsets);
+        return PyErr_NoMemory();
+    }
+    tape->parent = NULL;
+    tape->memory.length = length;
+    tape->memory.start = (sz_ptr_t)malloc(length ? length : 1);
+    if (!tape->memory.start) {
+        free(offsets);
+        Py_DECREF(tape);
+        return PyErr_NoMemory();
+    }
+    if (threads_count > 1)
+        sz_sequence_to_u64tape(&sequence, offsets, tape->memory.start, parallel_for_threads, &threads_count);
+    else { sz_sequence_to_u64tape(&sequence, offsets, tape->memory.start, NULL, NULL); }
+
+    Strs *result = (Strs *)StrsType.tp_alloc(&StrsType, 0);
+    if (!result) {
+        free(offsets);
+        Py_DECREF(tape);
+        return PyErr_NoMemory();
+    }
+
+    // The `Strs` layouts only store the end offsets, and prefer 32-bit ones, when the tape is small enough
+    if (length <= UINT32_MAX) {
+        uint32_t *end_offsets = (uint32_t *)malloc(sizeof(uint32_t) * (count ? count : 1));
+        if (!end_offsets) {
+            free(offsets);
+            Py_DECREF(tape);
+            Py_DECREF(result);
+            return PyErr_NoMemory();
+        }
+        for (size_t i = 0; i != count; ++i) end_offsets[i] = (uint32_t)offsets[i + 1];
+        free(offsets);
+        result->type = STRS_CONSECUTIVE_32;
+        result->data.consecutive_32bit.count = count;
+        result->data.consecutive_32bit.separator_length = 0;
+        result->data.consecutive_32bit.parent_string = (PyObject *)tape;
+        result->data.consecutive_32bit.start = tape->memory.start;
+        result->data.consecutive_32bit.end_offsets = end_offsets;
+    }
+    else {
+        sz_move((sz_ptr_t)offsets, (sz_cptr_t)(offsets + 1), sizeof(sz_u64_t) * count);
+        result->type = STRS_CONSECUTIVE_64;
+        result->data.consecutive_64bit.count = count;
+        result->data.consecutive_64bit.separator_length = 0;
+        result->data.consecutive_64bit.parent_string = (PyObject *)tape;
+        result->data.consecutive_64bit.start = tape->memory.start;
+        result->data.consecutive_64bit.end_offsets = (uint64_t *)offsets;
+    }
+    return (PyObject *)result;
+}
+
+static PyObject *Strs_sample(Strs *self, PyObject *args, PyObject *kwargs) {
+    PyObject *sample_size_obj = NULL;
+    PyObject *seed_obj = NULL;
+
+    // Check for positional arguments
+    Py_ssize_t nargs = PyTuple_Size(args);
+    if (nargs > 1) {
+        PyErr_SetString(PyExc_TypeError, "sample() takes 1 positional argument and 1 keyword argument");
+        return NULL;
+    }
+    else if (nargs == 1) { sample_size_obj = PyTuple_GET_ITEM(args, 0); }
+
+    // Parse keyword arguments
+    if (kwargs) {
+        PyObject *key, *value;
+        Py_ssize_t pos = 0;
+        while (PyDict_Next(kwargs, &pos, &key, &value)) {
+            if (PyUnicode_CompareWithASCIIString(key, "seed") == 0 && !seed_obj) { seed_obj = value; }
+            else { PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key); return NULL; }
+        }
+    }
+
+    // Translate the seed and the sample size to C types
+    size_t sample_size = 0;
+    if (sample_size_obj) {
+        if (!PyLong_Check(sample_size_obj)) {
+            PyErr_SetString(PyExc_TypeError, "The sample size must be an integer");
+            return NULL;
+        }
         sample_size = PyLong_AsSize_t(sample_size_obj);
     }
     unsigned int seed = time(NULL); // Default seed
@@ -3581,6 +5156,311 @@ static PyObject *Strs_str(Strs *self) {
     return PyUnicode_FromStringAndSize(result_buffer, total_bytes);
 }
 
+static char const doc_arrow_c_array[] = //
+    "Export the strings as an Apache Arrow array through the PyCapsule interface, sharing the string bytes.\n"
+    "Splits without separators produce `utf8` or `large_utf8` arrays, and the rest produce `string_view`\n"
+    "arrays, referencing the original memory. Only the offsets or the 16-byte views are allocated.\n"
+    "\n"
+    "Args:\n"
+    "  requested_schema (object, optional): Ignored, as the layout is chosen to avoid copies.\n"
+    "Returns:\n"
+    "  tuple: The `arrow_schema` and `arrow_array` capsules.";
+
+/**
+ *  @brief  Memory owned by an exported `ArrowArray`, released once the consumer is done with it.
+ *          The `parent_string` reference keeps the string bytes alive.
+ */
+typedef struct {
+    PyObject *parent_string;
+    void const **buffers;
+    void *metadata;          // Arrow offsets or views.
+    sz_i64_t *buffers_sizes; // Sizes of the variadic buffers, for the `string_view` layout.
+} strs_arrow_export_t;
+
+static void Strs_arrow_release_schema(struct ArrowSchema *schema) { schema->release = NULL; }
+
+static void Strs_arrow_release_array(struct ArrowArray *array) {
+    strs_arrow_export_t *exported = (strs_arrow_export_t *)array->private_data;
+    // The consumer may release the array from any thread
+    PyGILState_STATE gil = PyGILState_Ensure();
+    Py_XDECREF(exported->parent_string);
+    PyGILState_Release(gil);
+    free(exported->buffers);
+    free(exported->metadata);
+    free(exported->buffers_sizes);
+    free(exported);
+    array->release = NULL;
+}
+
+static void Strs_arrow_schema_capsule_free(PyObject *capsule) {
+    struct ArrowSchema *schema = (struct ArrowSchema *)PyCapsule_GetPointer(capsule, "arrow_schema");
+    if (schema->release) schema->release(schema);
+    free(schema);
+}
+
+static void Strs_arrow_array_capsule_free(PyObject *capsule) {
+    struct ArrowArray *array = (struct ArrowArray *)PyCapsule_GetPointer(capsule, "arrow_array");
+    if (array->release) array->release(array);
+    free(array);
+}
+
+/**
+ *  @brief  Fills the tape layout for consecutive slices without separators, only materializing the
+ *          `count + 1` offsets, as our layout lacks the leading zero.
+ */
+static sz_bool_t Strs_arrow_export_tape_(Strs *self, struct ArrowArray *array, strs_arrow_export_t *exported,
+                                         char const **format) {
+    size_t count = Strs_len(self);
+    sz_bool_t is_large = self->type == STRS_CONSECUTIVE_64;
+    char const *start = is_large ? self->data.consecutive_64bit.start : self->data.consecutive_32bit.start;
+    sz_u64_t tape_length = !count ? 0
+                           : is_large ? self->data.consecutive_64bit.end_offsets[count - 1]
+                                      : self->data.consecutive_32bit.end_offsets[count - 1];
+    is_large = tape_length > 0x7FFFFFFF;
+
+    exported->metadata = malloc((count + 1) * (is_large ? sizeof(sz_i64_t) : sizeof(sz_i32_t)));
+    exported->buffers = (void const **)malloc(3 * sizeof(void const *));
+    if (!exported->metadata || !exported->buffers) return 0;
+    for (size_t i = 0; i <= count; ++i) {
+        sz_u64_t offset = !i ? 0
+                          : self->type == STRS_CONSECUTIVE_64 ? self->data.consecutive_64bit.end_offsets[i - 1]
+                                                              : self->data.consecutive_32bit.end_offsets[i - 1];
+        if (is_large) ((sz_i64_t *)exported->metadata)[i] = (sz_i64_t)offset;
+        else
+            ((sz_i32_t *)exported->metadata)[i] = (sz_i32_t)offset;
+    }
+    exported->buffers[0] = NULL;
+    exported->buffers[1] = exported->metadata;
+    exported->buffers[2] = start ? start : "";
+    array->n_buffers = 3;
+    *format = is_large ? "U" : "u";
+    return 1;
+}
+
+/**
+ *  @brief  Fills the `string_view` layout for arbitrary slices of the parent string. Views can only address
+ *          32-bit offsets, so the parent is covered by overlapping variadic buffers, starting every 1 GB.
+ */
+static sz_bool_t Strs_arrow_export_views_(Strs *self, struct ArrowArray *array, strs_arrow_export_t *exported,
+                                          char const **format) {
+    Py_ssize_t count = Strs_len(self);
+    get_string_at_offset_t getter = str_at_offset_getter(self);
+    if (!getter) return 0;
+
+    // Find the range of memory, covered by the non-inlined strings
+    char const *lowest = NULL, *highest = NULL;
+    PyObject *parent;
+    char const *start;
+    size_t length;
+    for (Py_ssize_t i = 0; i < count; ++i) {
+        getter(self, i, count, &parent, &start, &length);
+        if (length > 0x7FFFFFFF) {
+            PyErr_SetString(PyExc_OverflowError, "Arrow string views are limited to 2 GB");
+            return 0;
+        }
+        if (length <= 12) continue;
+        if (!lowest || start < lowest) lowest = start;
+        if (!highest || start + length > highest) highest = start + length;
+    }
+    size_t const window = (size_t)1 << 30;
+    size_t const span = lowest ? (size_t)(highest - lowest) : 0;
+    size_t const buffers_count = span ? (span - 1) / window + 1 : 0;
+
+    exported->metadata = calloc(count ? count : 1, 16);
+    exported->buffers = (void const **)malloc((3 + buffers_count) * sizeof(void const *));
+    exported->buffers_sizes = (sz_i64_t *)malloc((buffers_count ? buffers_count : 1) * sizeof(sz_i64_t));
+    if (!exported->metadata || !exported->buffers || !exported->buffers_sizes) {
+        PyErr_NoMemory();
+        return 0;
+    }
+    for (size_t i = 0; i != buffers_count; ++i) {
+        exported->buffers[2 + i] = lowest + i * window;
+        exported->buffers_sizes[i] = (sz_i64_t)(span - i * window);
+    }
+
+    char *views = (char *)exported->metadata;
+    for (Py_ssize_t i = 0; i < count; ++i, views += 16) {
+        getter(self, i, count, &parent, &start, &length);
+        sz_i32_t length_i32 = (sz_i32_t)length;
+        sz_copy(views, (sz_cptr_t)&length_i32, 4);
+        if (length <= 12) {
+            sz_copy(views + 4, start, length);
+            continue;
+        }
+        sz_i32_t buffer_index = (sz_i32_t)((size_t)(start - lowest) / window);
+        sz_i32_t offset = (sz_i32_t)((size_t)(start - lowest) % window);
+        sz_copy(views + 4, start, 4);
+        sz_copy(views + 8, (sz_cptr_t)&buffer_index, 4);
+        sz_copy(views + 12, (sz_cptr_t)&offset, 4);
+    }
+    exported->buffers[0] = NULL;
+    exported->buffers[1] = exported->metadata;
+    exported->buffers[2 + buffers_count] = exported->buffers_sizes;
+    array->n_buffers = 3 + buffers_count;
+    *format = "vu";
+    return 1;
+}
+
+static PyObject *Strs_arrow_c_array(Strs *self, PyObject *args, PyObject *kwargs) {
+    // The `requested_schema` is accepted for protocol compatibility, but ignored
+    Py_ssize_t nargs = PyTuple_Size(args);
+    if (nargs > 1) {
+        PyErr_SetString(PyExc_TypeError, "__arrow_c_array__() takes at most 1 positional argument");
+        return NULL;
+    }
+    if (kwargs) {
+        PyObject *key, *value;
+        Py_ssize_t pos = 0;
+        while (PyDict_Next(kwargs, &pos, &key, &value)) {
+            if (PyUnicode_CompareWithASCIIString(key, "requested_schema") == 0 && !nargs) {}
+            else { PyErr_Format(PyExc_TypeError, "Got an unexpected keyword argument '%U'", key); return NULL; }
+        }
+    }
+
+    struct ArrowSchema *schema = (struct ArrowSchema *)calloc(1, sizeof(struct ArrowSchema));
+    struct ArrowArray *array = (struct ArrowArray *)calloc(1, sizeof(struct ArrowArray));
+    strs_arrow_export_t *exported = (strs_arrow_export_t *)calloc(1, sizeof(strs_arrow_export_t));
+    if (!schema || !array || !exported) {
+        free(schema), free(array), free(exported);
+        return PyErr_NoMemory();
+    }
+
+    // Consecutive slices without separators already form a tape, others are exported as views
+    char const *format = NULL;
+    sz_bool_t is_tape = (self->type == STRS_CONSECUTIVE_32 && !self->data.consecutive_32bit.separator_length) ||
+                        (self->type == STRS_CONSECUTIVE_64 && !self->data.consecutive_64bit.separator_length);
+    sz_bool_t exported_ok = is_tape ? Strs_arrow_export_tape_(self, array, exported, &format)
+                                    : Strs_arrow_export_views_(self, array, exported, &format);
+    if (!exported_ok) {
+        if (!PyErr_Occurred()) PyErr_NoMemory();
+        free(exported->buffers), free(exported->metadata), free(exported->buffers_sizes);
+        free(schema), free(array), free(exported);
+        return NULL;
+    }
+
+    Py_ssize_t count = Strs_len(self);
+    if (count) {
+        PyObject *parent;
+        char const *start;
+        size_t length;
+        str_at_offset_getter(self)(self, 0, count, &parent, &start, &length);
+        exported->parent_string = parent;
+        Py_XINCREF(parent);
+    }
+
+    schema->format = format;
+    schema->name = "";
+    schema->metadata = NULL;
+    schema->flags = ARROW_FLAG_NULLABLE;
+    schema->release = &Strs_arrow_release_schema;
+
+    array->length = count;
+    array->null_count = 0;
+    array->offset = 0;
+    array->buffers = exported->buffers;
+    array->private_data = exported;
+    array->release = &Strs_arrow_release_array;
+
+    PyObject *schema_capsule = PyCapsule_New(schema, "arrow_schema", &Strs_arrow_schema_capsule_free);
+    if (!schema_capsule) {
+        schema->release(schema), array->release(array);
+        free(schema), free(array);
+        return NULL;
+    }
+    PyObject *array_capsule = PyCapsule_New(array, "arrow_array", &Strs_arrow_array_capsule_free);
+    if (!array_capsule) {
+        Py_DECREF(schema_capsule);
+        array->release(array);
+        free(array);
+        return NULL;
+    }
+    PyObject *result = PyTuple_Pack(2, schema_capsule, array_capsule);
+    Py_DECREF(schema_capsule);
+    Py_DECREF(array_capsule);
+    return result;
+}
+
+static char const doc_from_arrow[] = //
+    "Wrap an Apache Arrow string array as `Strs` without copying, through the PyCapsule interface.\n"
+    "Supports `utf8`, `large_utf8`, `string_view` arrays and their binary counterparts, with nulls\n"
+    "appearing as empty strings. Works with PyArrow arrays, Polars series, and other `Strs`.\n"
+    "\n"
+    "Args:\n"
+    "  array (object): Any object, implementing the `__arrow_c_array__` method.\n"
+    "Returns:\n"
+    "  Strs: The strings, referencing the Arrow buffers.";
+
+static void Strs_arrow_owner_capsule_free(PyObject *capsule) {
+    struct ArrowArray *array = (struct ArrowArray *)PyCapsule_GetPointer(capsule, "stringzilla.arrow");
+    if (array->release) array->release(array);
+    free(array);
+}
+
+static PyObject *Strs_from_arrow(PyObject *cls, PyObject *args, PyObject *kwargs) {
+    if (PyTuple_Size(args) != 1 || (kwargs && PyDict_Size(kwargs))) {
+        PyErr_SetString(PyExc_TypeError, "from_arrow() takes exactly 1 positional argument");
+        return NULL;
+    }
+    PyObject *source = PyTuple_GET_ITEM(args, 0);
+    PyObject *capsules = PyObject_CallMethod(source, "__arrow_c_array__", NULL);
+    if (!capsules) {
+        PyErr_Clear();
+        PyErr_SetString(PyExc_TypeError, "Expected an object with the `__arrow_c_array__` method, "
+                                         "chunked arrays must be combined first");
+        return NULL;
+    }
+    if (!PyTuple_Check(capsules) || PyTuple_GET_SIZE(capsules) != 2) {
+        Py_DECREF(capsules);
+        PyErr_SetString(PyExc_TypeError, "`__arrow_c_array__` must return a pair of capsules");
+        return NULL;
+    }
+    struct ArrowSchema *schema =
+        (struct ArrowSchema *)PyCapsule_GetPointer(PyTuple_GET_ITEM(capsules, 0), "arrow_schema");
+    struct ArrowArray *source_array =
+        (struct ArrowArray *)PyCapsule_GetPointer(PyTuple_GET_ITEM(capsules, 1), "arrow_array");
+    if (!schema || !source_array) {
+        Py_DECREF(capsules);
+        return NULL;
+    }
+
+    // Move the array out of the consumer capsule, so its lifetime is tied to the `Strs`
+    struct ArrowArray *array = (struct ArrowArray *)malloc(sizeof(struct ArrowArray));
+    if (!array) {
+        Py_DECREF(capsules);
+        return PyErr_NoMemory();
+    }
+    sz_sequence_t sequence;
+    if (!sz_sequence_from_arrow(schema->format, source_array, &sequence)) {
+        PyErr_Format(PyExc_TypeError, "Unsupported Arrow format '%s', expected strings or binary",
+                     schema->format ? schema->format : "");
+        Py_DECREF(capsules);
+        free(array);
+        return NULL;
+    }
+    *array = *source_array;
+    source_array->release = NULL;
+    Py_DECREF(capsules);
+    sequence.handle = array;
+
+    PyObject *owner = PyCapsule_New(array, "stringzilla.arrow", &Strs_arrow_owner_capsule_free);
+    if (!owner) {
+        array->release(array);
+        free(array);
+        return NULL;
+    }
+    Strs *result = (Strs *)StrsType.tp_alloc(&StrsType, 0);
+    if (!result) {
+        Py_DECREF(owner);
+        return PyErr_NoMemory();
+    }
+    result->type = STRS_ARROW;
+    result->data.arrow.count = sequence.count;
+    result->data.arrow.first = 0;
+    result->data.arrow.parent_string = owner;
+    result->data.arrow.sequence = sequence;
+    return (PyObject *)result;
+}
+
 static PySequenceMethods Strs_as_sequence = {
     .sq_length = Strs_len,   //
     .sq_item = Strs_getitem, //
@@ -3606,9 +5486,16 @@ static PyGetSetDef Strs_getsetters[] = {
 
 static PyMethodDef Strs_methods[] = {
     {"shuffle", Strs_shuffle, SZ_METHOD_FLAGS, "Shuffle (in-place) the elements of the Strs object."}, //
-    {"sort", Strs_sort, SZ_METHOD_FLAGS, "Sort (in-place) the elements of the Strs object."},          //
-    {"order", Strs_order, SZ_METHOD_FLAGS, "Provides the indexes to achieve sorted order."},           //
+    {"sort", Strs_sort, SZ_METHOD_FLAGS, "Sort (in-place) the elements, or just the smallest k."},     //
+    {"order", Strs_order, SZ_METHOD_FLAGS, "Provides the sorted order indexes, or just its first k."}, //
     {"sample", Strs_sample, SZ_METHOD_FLAGS, "Provides a random sample of a given size."},             //
+    {"edit_distances", Strs_edit_distances, SZ_METHOD_FLAGS, doc_edit_distances},                     //
+    {"unique", Strs_unique, SZ_METHOD_FLAGS, doc_unique},                                             //
+    {"argunique", Strs_argunique, SZ_METHOD_FLAGS, doc_argunique},                                    //
+    {"counts", Strs_counts, SZ_METHOD_FLAGS, doc_counts},                                             //
+    {"compact", Strs_compact, SZ_METHOD_FLAGS, doc_compact},                                          //
+    {"__arrow_c_array__", Strs_arrow_c_array, SZ_METHOD_FLAGS, doc_arrow_c_array},                    //
+    {"from_arrow", Strs_from_arrow, SZ_METHOD_FLAGS | METH_STATIC, doc_from_arrow},                   //
     // {"to_pylist", Strs_to_pylist, SZ_METHOD_FLAGS, "Exports string-views to a native list of native strings."},
     // //
     {NULL, NULL, 0, NULL}};
@@ -3631,6 +5518,113 @@ static PyTypeObject StrsType = {
 
 #pragma endregion
 
+#pragma region Dispatch
+
+/**
+ *  @brief  Formats a capabilities mask as a comma-terminated list of names, like "serial,avx2,".
+ *          The buffer must fit at least 128 characters.
+ */
+static void capabilities_to_string(sz_capability_t caps, char *caps_str) {
+    char const *serial = (caps & sz_cap_serial_k) ? "serial," : "";
+    char const *neon = (caps & sz_cap_arm_neon_k) ? "neon," : "";
+    char const *sve = (caps & sz_cap_arm_sve_k) ? "sve," : "";
+    char const *avx2 = (caps & sz_cap_x86_avx2_k) ? "avx2," : "";
+    char const *avx512f = (caps & sz_cap_x86_avx512f_k) ? "avx512f," : "";
+    char const *avx512vl = (caps & sz_cap_x86_avx512vl_k) ? "avx512vl," : "";
+    char const *avx512bw = (caps & sz_cap_x86_avx512bw_k) ? "avx512bw," : "";
+    char const *avx512vbmi = (caps & sz_cap_x86_avx512vbmi_k) ? "avx512vbmi," : "";
+    char const *gfni = (caps & sz_cap_x86_gfni_k) ? "gfni," : "";
+    char const *avx512vbmi2 = (caps & sz_cap_x86_avx512vbmi2_k) ? "avx512vbmi2," : "";
+    sprintf(caps_str, "%s%s%s%s%s%s%s%s%s%s", serial, neon, sve, avx2, avx512f, avx512vl, avx512bw, avx512vbmi,
+            avx512vbmi2, gfni);
+}
+
+static char const doc_use_backend[] = //
+    "Limit the dispatched kernels to the given backends, overriding the detected capabilities.\n"
+    "\n"
+    "Args:\n"
+    "  names (str): Comma-separated backends, like 'avx2', 'avx512', 'neon', 'sve', 'serial', or 'any'.\n"
+    "Returns:\n"
+    "  str: The capabilities in use after the update, formatted like `__capabilities__`.\n"
+    "Raises:\n"
+    "  ValueError: If any of the backend names is unknown.";
+
+static PyObject *module_use_backend(PyObject *self, PyObject *names_obj) {
+    if (!PyUnicode_Check(names_obj)) {
+        PyErr_SetString(PyExc_TypeError, "use_backend() expects a string argument");
+        return NULL;
+    }
+    char const *names = PyUnicode_AsUTF8(names_obj);
+    if (!names) return NULL;
+
+    sz_capability_t requested = sz_capabilities_from_names(names);
+    if (!requested) {
+        PyErr_Format(PyExc_ValueError, "Unknown backend names: '%s'", names);
+        return NULL;
+    }
+
+    char caps_str[128];
+    capabilities_to_string(sz_dispatch_use(requested), caps_str);
+    return PyUnicode_FromString(caps_str);
+}
+
+static char const doc_kernels[] = //
+    "Report the kernels currently serving the dispatched operations.\n"
+    "\n"
+    "Returns:\n"
+    "  dict: Mapping from operation names, like 'find', to kernel names, like 'sz_find_avx512'.";
+
+static PyObject *module_kernels(PyObject *self, PyObject *unused) {
+    PyObject *result = PyDict_New();
+    if (!result) return NULL;
+    for (sz_size_t i = 0; i != sz_dispatch_count(); ++i) {
+        PyObject *kernel = PyUnicode_FromString(sz_dispatch_kernel(i));
+        if (!kernel || PyDict_SetItemString(result, sz_dispatch_operation(i), kernel) < 0) {
+            Py_XDECREF(kernel);
+            Py_DECREF(result);
+            return NULL;
+        }
+        Py_DECREF(kernel);
+    }
+    return result;
+}
+
+static char const doc_stats[] = //
+    "Report the number of calls and input bytes of every dispatched operation since the last reset.\n"
+    "\n"
+    "Only collected, if the library is compiled with `SZ_ENABLE_STATS=1`.\n"
+    "Returns:\n"
+    "  dict or None: Mapping from operation names to (calls, bytes) tuples, or None if disabled.";
+
+static PyObject *module_stats(PyObject *self, PyObject *unused) {
+    sz_u64_t calls, bytes;
+    if (!sz_dispatch_stats(0, &calls, &bytes)) Py_RETURN_NONE;
+
+    PyObject *result = PyDict_New();
+    if (!result) return NULL;
+    for (sz_size_t i = 0; i != sz_dispatch_count(); ++i) {
+        sz_dispatch_stats(i, &calls, &bytes);
+        PyObject *counters = Py_BuildValue("(KK)", (unsigned long long)calls, (unsigned long long)bytes);
+        if (!counters || PyDict_SetItemString(result, sz_dispatch_operation(i), counters) < 0) {
+            Py_XDECREF(counters);
+            Py_DECREF(result);
+            return NULL;
+        }
+        Py_DECREF(counters);
+    }
+    return result;
+}
+
+static char const doc_reset_stats[] = //
+    "Zero the counters reported by `stats()`.";
+
+static PyObject *module_reset_stats(PyObject *self, PyObject *unused) {
+    sz_dispatch_stats_reset();
+    Py_RETURN_NONE;
+}
+
+#pragma endregion
+
 static void stringzilla_cleanup(PyObject *m) {
     if (temporary_memory.start) free(temporary_memory.start);
     temporary_memory.start = NULL;
@@ -3646,6 +5640,8 @@ static PyMethodDef stringzilla_methods[] = {
     {"endswith", Str_endswith, SZ_METHOD_FLAGS, doc_endswith},
     {"translate", Str_translate, SZ_METHOD_FLAGS, doc_translate},
     {"decode", Str_decode, SZ_METHOD_FLAGS, doc_decode},
+    {"isutf8", Str_isutf8, SZ_METHOD_FLAGS, doc_isutf8},
+    {"utf8_count", Str_utf8_count, SZ_METHOD_FLAGS, doc_utf8_count},
     {"equal", Str_like_equal, SZ_METHOD_FLAGS, doc_like_equal},
 
     // Bidirectional operations
@@ -3687,6 +5683,12 @@ static PyMethodDef stringzilla_methods[] = {
     {"hash", Str_like_hash, SZ_METHOD_FLAGS, doc_like_hash},
     {"checksum", Str_like_checksum, SZ_METHOD_FLAGS, doc_like_checksum},
 
+    // Introspection and control of the dispatched kernels
+    {"use_backend", module_use_backend, METH_O, doc_use_backend},
+    {"kernels", module_kernels, METH_NOARGS, doc_kernels},
+    {"stats", module_stats, METH_NOARGS, doc_stats},
+    {"reset_stats", module_reset_stats, METH_NOARGS, doc_reset_stats},
+
     {NULL, NULL, 0, NULL}};
 
 static PyModuleDef stringzilla_module = {
@@ -3708,6 +5710,8 @@ PyMODINIT_FUNC PyInit_stringzilla(void) {
     if (PyType_Ready(&FileType) < 0) return NULL;
     if (PyType_Ready(&StrsType) < 0) return NULL;
     if (PyType_Ready(&SplitIteratorType) < 0) return NULL;
+    if (PyType_Ready(&StreamMatcherType) < 0) return NULL;
+    if (PyType_Ready(&GlobType) < 0) return NULL;
 
     m = PyModule_Create(&stringzilla_module);
     if (m == NULL) return NULL;
@@ -3722,20 +5726,8 @@ PyMODINIT_FUNC PyInit_stringzilla(void) {
 
     // Define SIMD capabilities
     {
-        sz_capability_t caps = sz_capabilities();
-        char caps_str[512];
-        char const *serial = (caps & sz_cap_serial_k) ? "serial," : "";
-        char const *neon = (caps & sz_cap_arm_neon_k) ? "neon," : "";
-        char const *sve = (caps & sz_cap_arm_sve_k) ? "sve," : "";
-        char const *avx2 = (caps & sz_cap_x86_avx2_k) ? "avx2," : "";
-        char const *avx512f = (caps & sz_cap_x86_avx512f_k) ? "avx512f," : "";
-        char const *avx512vl = (caps & sz_cap_x86_avx512vl_k) ? "avx512vl," : "";
-        char const *avx512bw = (caps & sz_cap_x86_avx512bw_k) ? "avx512bw," : "";
-        char const *avx512vbmi = (caps & sz_cap_x86_avx512vbmi_k) ? "avx512vbmi," : "";
-        char const *gfni = (caps & sz_cap_x86_gfni_k) ? "gfni," : "";
-        char const *avx512vbmi2 = (caps & sz_cap_x86_avx512vbmi2_k) ? "avx512vbmi2," : "";
-        sprintf(caps_str, "%s%s%s%s%s%s%s%s%s%s", serial, neon, sve, avx2, avx512f, avx512vl, avx512bw, avx512vbmi,
-                avx512vbmi2, gfni);
+        char caps_str[128];
+        capabilities_to_string(sz_capabilities(), caps_str);
         PyModule_AddStringConstant(m, "__capabilities__", caps_str);
     }
 
@@ -3773,6 +5765,29 @@ PyMODINIT_FUNC PyInit_stringzilla(void) {
         return NULL;
     }
 
+    Py_INCREF(&StreamMatcherType);
+    if (PyModule_AddObject(m, "StreamMatcher", (PyObject *)&StreamMatcherType) < 0) {
+        Py_XDECREF(&StreamMatcherType);
+        Py_XDECREF(&SplitIteratorType);
+        Py_XDECREF(&StrsType);
+        Py_XDECREF(&FileType);
+        Py_XDECREF(&StrType);
+        Py_XDECREF(m);
+        return NULL;
+    }
+
+    Py_INCREF(&GlobType);
+    if (PyModule_AddObject(m, "Glob", (PyObject *)&GlobType) < 0) {
+        Py_XDECREF(&GlobType);
+        Py_XDECREF(&StreamMatcherType);
+        Py_XDECREF(&SplitIteratorType);
+        Py_XDECREF(&StrsType);
+        Py_XDECREF(&FileType);
+        Py_XDECREF(&StrType);
+        Py_XDECREF(m);
+        return NULL;
+    }
+
     // Initialize temporary_memory, if needed
     temporary_memory.start = malloc(4096);
     temporary_memory.length = 4096 * (temporary_memory.start != NULL);
@@ -1,4 +1,4 @@
-#![cfg_attr(not(test), no_std)]
+#![cfg_attr(not(any(test, feature = "rayon")), no_std)]
 
 /// The `sz` module provides a collection of string searching and manipulation functionality,
 /// designed for high efficiency and compatibility with no_std environments. This module offers
@@ -10,6 +10,40 @@ pub mod sz {
 
     use core::ffi::c_void;
 
+    #[cfg(feature = "rayon")]
+    use rayon::prelude::*;
+
+    /// Mirrors the `sz_sequence_t` structure of the C library, addressing a slice of string-like keys in place.
+    #[repr(C)]
+    struct Sequence {
+        order: *mut u64,
+        count: usize,
+        get_start: extern "C" fn(*const Sequence, usize) -> *const c_void,
+        get_length: extern "C" fn(*const Sequence, usize) -> usize,
+        handle: *const c_void,
+    }
+
+    extern "C" fn sequence_start<K: AsRef<[u8]>>(sequence: *const Sequence, i: usize) -> *const c_void {
+        unsafe { (*((*sequence).handle as *const K).add(i)).as_ref().as_ptr() as _ }
+    }
+
+    extern "C" fn sequence_length<K: AsRef<[u8]>>(sequence: *const Sequence, i: usize) -> usize {
+        unsafe { (*((*sequence).handle as *const K).add(i)).as_ref().len() }
+    }
+
+    impl Sequence {
+        /// Views the `keys` without copying them, optionally with a mutable permutation `order` for sorting.
+        fn new<K: AsRef<[u8]>>(keys: &[K], order: *mut u64) -> Self {
+            Sequence {
+                order,
+                count: keys.len(),
+                get_start: sequence_start::<K>,
+                get_length: sequence_length::<K>,
+                handle: keys.as_ptr() as _,
+            }
+        }
+    }
+
     // Import the functions from the StringZilla C library.
     extern "C" {
         fn sz_copy(target: *const c_void, source: *const c_void, length: usize);
@@ -112,6 +146,39 @@ pub mod sz {
             generate: *const c_void,
             generator: *mut c_void,
         );
+
+        fn sz_checksum(text: *const c_void, length: usize) -> u64;
+
+        fn sz_hash(text: *const c_void, length: usize) -> u64;
+
+        fn sz_hashes(
+            text: *const c_void,
+            length: usize,
+            window_length: usize,
+            window_step: usize,
+            callback: extern "C" fn(*const c_void, usize, u64, *mut c_void),
+            callback_handle: *mut c_void,
+        );
+
+        fn sz_hash_batch(sequence: *const Sequence, hashes: *mut u64);
+
+        fn sz_sort(sequence: *mut Sequence);
+
+        #[cfg(feature = "rayon")]
+        fn sz_sort_parallel(
+            sequence: *mut Sequence,
+            parallel_for: extern "C" fn(*mut c_void, extern "C" fn(*mut c_void, usize), *mut c_void, usize),
+            executor: *mut c_void,
+        );
+
+        fn sz_edit_distances(
+            query: *const c_void,
+            query_length: usize,
+            candidates: *const Sequence,
+            bound: usize,
+            allocator: *const c_void,
+            distances: *mut usize,
+        ) -> u32;
     }
 
     /// Moves the contents of `source` into `target`, overwriting the existing contents of `target`.
@@ -753,6 +820,302 @@ pub mod sz {
             );
         }
     }
+
+    /// Computes the sum of all bytes in the `text`, a cheap checksum.
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use stringzilla::sz;
+    /// assert_eq!(sz::checksum("ab"), 97 + 98);
+    /// ```
+    pub fn checksum<T>(text: T) -> u64
+    where
+        T: AsRef<[u8]>,
+    {
+        let text_ref = text.as_ref();
+        unsafe { sz_checksum(text_ref.as_ptr() as _, text_ref.len()) }
+    }
+
+    /// Computes the 64-bit hash of the `text`, the same as returned by the C, C++, and Python interfaces.
+    pub fn hash<T>(text: T) -> u64
+    where
+        T: AsRef<[u8]>,
+    {
+        let text_ref = text.as_ref();
+        unsafe { sz_hash(text_ref.as_ptr() as _, text_ref.len()) }
+    }
+
+    /// Computes the Karp-Rabin rolling hashes of every `window_length`-byte window of the `text`,
+    /// reporting every `window_step`-th of them to the `callback`, along with the offset of the window.
+    ///
+    /// # Arguments
+    ///
+    /// * `text`: The byte slice to hash.
+    /// * `window_length`: The length of the rolling window in bytes.
+    /// * `window_step`: The step between the reported windows. Must be a power of two.
+    /// * `callback`: The closure receiving the offset of every reported window and its hash.
+    pub fn hashes<T, F>(text: T, window_length: usize, window_step: usize, mut callback: F)
+    where
+        T: AsRef<[u8]>,
+        F: FnMut(usize, u64),
+    {
+        struct State<'a, F> {
+            text: *const u8,
+            callback: &'a mut F,
+        }
+        extern "C" fn trampoline<F: FnMut(usize, u64)>(
+            start: *const c_void,
+            _length: usize,
+            hash: u64,
+            handle: *mut c_void,
+        ) {
+            let state = unsafe { &mut *(handle as *mut State<F>) };
+            let offset = start as usize - state.text as usize;
+            (state.callback)(offset, hash);
+        }
+
+        let text_ref = text.as_ref();
+        let mut state = State {
+            text: text_ref.as_ptr(),
+            callback: &mut callback,
+        };
+        unsafe {
+            sz_hashes(
+                text_ref.as_ptr() as _,
+                text_ref.len(),
+                window_length,
+                window_step,
+                trampoline::<F>,
+                &mut state as *mut State<F> as *mut c_void,
+            );
+        }
+    }
+
+    /// Computes a binary fingerprint of the `text`, setting one bit for the rolling hash of every
+    /// `window_length`-byte window, like `sz_hashes_fingerprint`. Such fingerprints can be compared
+    /// with the Hamming or Jaccard distances to estimate the similarity of strings.
+    ///
+    /// The `fingerprint` isn't cleared beforehand, so calling this function repeatedly with different
+    /// window lengths or for different parts of a document accumulates a multi-resolution fingerprint.
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use stringzilla::sz;
+    /// let mut fingerprint = [0u8; 64];
+    /// sz::fingerprint("The quick brown fox", 4, &mut fingerprint);
+    /// assert!(fingerprint.iter().any(|&byte| byte != 0));
+    /// ```
+    pub fn fingerprint<T>(text: T, window_length: usize, fingerprint: &mut [u8])
+    where
+        T: AsRef<[u8]>,
+    {
+        let bytes = fingerprint.len();
+        if bytes == 0 {
+            return;
+        }
+        if bytes.is_power_of_two() {
+            hashes(text, window_length, 1, |_, hash| {
+                fingerprint[(hash / 8) as usize & (bytes - 1)] |= 1 << (hash & 7);
+            });
+        } else {
+            hashes(text, window_length, 1, |_, hash| {
+                fingerprint[((hash / 8) % bytes as u64) as usize] |= 1 << (hash & 7);
+            });
+        }
+    }
+
+    /// Computes the `hash` of every key in one call, and on AVX-512 capable CPUs, many keys at a time.
+    ///
+    /// # Panics
+    ///
+    /// If the `hashes` slice is not as long as the `keys` slice.
+    pub fn hash_batch<K>(keys: &[K], hashes: &mut [u64])
+    where
+        K: AsRef<[u8]>,
+    {
+        assert_eq!(keys.len(), hashes.len(), "Expecting one hash per key");
+        let sequence = Sequence::new(keys, core::ptr::null_mut());
+        unsafe { sz_hash_batch(&sequence, hashes.as_mut_ptr()) }
+    }
+
+    /// Computes the permutation, that sorts the `keys` in the lexicographic order of their bytes,
+    /// using the radix sort of the C library. The `keys` themselves are not copied or moved.
+    ///
+    /// # Panics
+    ///
+    /// If the `order` slice is not as long as the `keys` slice, or there are more than 2^32 keys.
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use stringzilla::sz;
+    /// let keys = ["banana", "apple", "cherry"];
+    /// let mut order = [0u64; 3];
+    /// sz::argsort(&keys, &mut order);
+    /// assert_eq!(order, [1, 0, 2]);
+    /// ```
+    pub fn argsort<K>(keys: &[K], order: &mut [u64])
+    where
+        K: AsRef<[u8]>,
+    {
+        let mut sequence = sequence_for_sorting(keys, order);
+        unsafe { sz_sort(&mut sequence) }
+    }
+
+    /// Sorts the `keys` in place in the lexicographic order of their bytes, using the `order` slice of
+    /// the same length as a scratch space, so that no memory is allocated.
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use stringzilla::sz;
+    /// let mut keys: Vec<&[u8]> = vec![b"banana", b"apple", b"cherry"];
+    /// let mut order = vec![0u64; keys.len()];
+    /// sz::sort(&mut keys, &mut order);
+    /// assert_eq!(keys, [&b"apple"[..], b"banana", b"cherry"]);
+    /// ```
+    pub fn sort<K>(keys: &mut [K], order: &mut [u64])
+    where
+        K: AsRef<[u8]>,
+    {
+        argsort(keys, order);
+        permute(keys, order);
+    }
+
+    /// Computes the Levenshtein edit distances in bytes between the `query` and every one of the
+    /// `candidates` in one call, reusing the query-side state. Queries up to 64 bytes long don't allocate.
+    ///
+    /// # Arguments
+    ///
+    /// * `query`: The byte slice to compare against every candidate.
+    /// * `candidates`: The slice of string-like candidates.
+    /// * `bound`: The maximum distance to compute, allowing early exits. Zero means no bound.
+    /// * `distances`: The output slice, as long as the `candidates`.
+    ///
+    /// # Returns
+    ///
+    /// `false` if the memory allocation for a long query failed, `true` otherwise.
+    pub fn edit_distances<Q, K>(query: Q, candidates: &[K], bound: usize, distances: &mut [usize]) -> bool
+    where
+        Q: AsRef<[u8]>,
+        K: AsRef<[u8]>,
+    {
+        assert_eq!(candidates.len(), distances.len(), "Expecting one distance per candidate");
+        let query_ref = query.as_ref();
+        let sequence = Sequence::new(candidates, core::ptr::null_mut());
+        unsafe {
+            sz_edit_distances(
+                query_ref.as_ptr() as _,
+                query_ref.len(),
+                &sequence,
+                bound,
+                core::ptr::null(),
+                distances.as_mut_ptr(),
+            ) != 0
+        }
+    }
+
+    /// Parallel version of `argsort`, producing the same permutation, sorting the radix buckets
+    /// on the `rayon` thread-pool.
+    #[cfg(feature = "rayon")]
+    pub fn par_argsort<K>(keys: &[K], order: &mut [u64])
+    where
+        K: AsRef<[u8]> + Sync,
+    {
+        let mut sequence = sequence_for_sorting(keys, order);
+        unsafe { sz_sort_parallel(&mut sequence, rayon_parallel_for, core::ptr::null_mut()) }
+    }
+
+    /// Parallel version of `sort`, sorting the radix buckets on the `rayon` thread-pool.
+    #[cfg(feature = "rayon")]
+    pub fn par_sort<K>(keys: &mut [K], order: &mut [u64])
+    where
+        K: AsRef<[u8]> + Sync,
+    {
+        par_argsort(keys, order);
+        permute(keys, order);
+    }
+
+    /// Parallel version of `hash_batch`, hashing the chunks of keys on the `rayon` thread-pool.
+    #[cfg(feature = "rayon")]
+    pub fn par_hash_batch<K>(keys: &[K], hashes: &mut [u64])
+    where
+        K: AsRef<[u8]> + Sync,
+    {
+        assert_eq!(keys.len(), hashes.len(), "Expecting one hash per key");
+        keys.par_chunks(PARALLEL_CHUNK_LENGTH)
+            .zip(hashes.par_chunks_mut(PARALLEL_CHUNK_LENGTH))
+            .for_each(|(keys, hashes)| hash_batch(keys, hashes));
+    }
+
+    /// Parallel version of `edit_distances`, comparing the chunks of candidates on the `rayon` thread-pool.
+    #[cfg(feature = "rayon")]
+    pub fn par_edit_distances<Q, K>(query: Q, candidates: &[K], bound: usize, distances: &mut [usize]) -> bool
+    where
+        Q: AsRef<[u8]> + Sync,
+        K: AsRef<[u8]> + Sync,
+    {
+        assert_eq!(candidates.len(), distances.len(), "Expecting one distance per candidate");
+        let query_ref = query.as_ref();
+        candidates
+            .par_chunks(PARALLEL_CHUNK_LENGTH)
+            .zip(distances.par_chunks_mut(PARALLEL_CHUNK_LENGTH))
+            .all(|(candidates, distances)| edit_distances(query_ref, candidates, bound, distances))
+    }
+
+    /// The number of keys processed by one `rayon` task in the batch operations.
+    #[cfg(feature = "rayon")]
+    const PARALLEL_CHUNK_LENGTH: usize = 4096;
+
+    /// Implements the `sz_parallel_for_t` callback, running the tasks of the C kernels on the `rayon` thread-pool.
+    #[cfg(feature = "rayon")]
+    extern "C" fn rayon_parallel_for(
+        _executor: *mut c_void,
+        task: extern "C" fn(*mut c_void, usize),
+        context: *mut c_void,
+        tasks_count: usize,
+    ) {
+        // The C kernels synchronize the tasks themselves, only sharing the `context` between them.
+        struct Context(*mut c_void);
+        unsafe impl Send for Context {}
+        unsafe impl Sync for Context {}
+        impl Context {
+            fn get(&self) -> *mut c_void {
+                self.0
+            }
+        }
+        let context = Context(context);
+        (0..tasks_count)
+            .into_par_iter()
+            .for_each(|i| task(context.get(), i));
+    }
+
+    /// Initializes the `order` with the identity permutation, and a sequence over the `keys` to sort.
+    fn sequence_for_sorting<K: AsRef<[u8]>>(keys: &[K], order: &mut [u64]) -> Sequence {
+        assert_eq!(keys.len(), order.len(), "Expecting one order entry per key");
+        assert!(keys.len() as u64 <= u32::MAX as u64, "The radix sort packs the indices into 32 bits");
+        for (i, entry) in order.iter_mut().enumerate() {
+            *entry = i as u64;
+        }
+        Sequence::new(keys, order.as_mut_ptr())
+    }
+
+    /// Reorders the `keys` in place, so that `keys[i]` becomes the old `keys[order[i]]`, following the
+    /// cycles of the permutation. The `order` is consumed, becoming the identity permutation.
+    fn permute<K>(keys: &mut [K], order: &mut [u64]) {
+        for i in 0..keys.len() {
+            let mut current = i;
+            while order[current] as usize != i {
+                let next = order[current] as usize;
+                keys.swap(current, next);
+                order[current] = current as u64;
+                current = next;
+            }
+            order[current] = current as u64;
+        }
+    }
 }
 
 pub trait Matcher<'a> {
@@ -1527,6 +1890,54 @@ mod tests {
             .all(|&b| b == b'd' || b == b'c' || b == b'b' || b == b'a'));
     }
 
+    #[test]
+    fn hashing() {
+        assert_eq!(sz::checksum("hello"), "hello".bytes().map(|b| b as u64).sum());
+        assert_eq!(sz::hash("hello"), sz::hash(String::from("hello")));
+        assert_ne!(sz::hash("hello"), sz::hash("hellO"));
+
+        let keys = ["", "a", "hello", "hello world, this is a longer key to hash"];
+        let mut hashes = [0u64; 4];
+        sz::hash_batch(&keys, &mut hashes);
+        for (key, hash) in keys.iter().zip(hashes.iter()) {
+            assert_eq!(sz::hash(key), *hash);
+        }
+
+        let mut offsets = Vec::new();
+        sz::hashes("abcdefgh", 3, 1, |offset, _| offsets.push(offset));
+        assert_eq!(offsets, vec![0, 1, 2, 3, 4, 5]);
+
+        let mut fingerprint = [0u8; 32];
+        sz::fingerprint("abcabcabc", 3, &mut fingerprint);
+        let bits: u32 = fingerprint.iter().map(|byte| byte.count_ones()).sum();
+        assert!(bits >= 1 && bits <= 3);
+    }
+
+    #[test]
+    fn sorting() {
+        let words: Vec<String> = "the quick brown fox jumps over the lazy dog, \u{80} \u{ff} and Zebras"
+            .split(' ')
+            .map(String::from)
+            .collect();
+
+        let mut order = vec![0u64; words.len()];
+        sz::argsort(&words, &mut order);
+        let mut expected = words.clone();
+        expected.sort();
+        let sorted: Vec<&String> = order.iter().map(|&i| &words[i as usize]).collect();
+        assert_eq!(sorted, expected.iter().collect::<Vec<_>>());
+
+        let mut keys = words.clone();
+        sz::sort(&mut keys, &mut order);
+        assert_eq!(keys, expected);
+
+        let mut distances = vec![0usize; words.len()];
+        assert!(sz::edit_distances("the", &words, 0, &mut distances));
+        for (word, distance) in words.iter().zip(distances.iter()) {
+            assert_eq!(sz::edit_distance("the", word), *distance);
+        }
+    }
+
     mod search_split_iterators {
         use super::*;
         use crate::{MatcherType, RangeMatches, RangeRMatches};
@@ -1,10 +1,20 @@
 /**
  *  @brief  Helper structures and functions for C++ benchmarks.
+ *
+ *  Every benchmark accepts the same command-line interface:
+ *
+ *      stringzilla_bench_* <path> [seconds_per_benchmark] [--json=<path>] [--csv=<path>] [--pin=<core>]
+ *                                  [--warmup=<seconds>]
+ *
+ *  Besides the human-readable output, all of the results are collected into a `bench_report_t`, that is exported
+ *  into JSON and CSV files at exit, including the hardware counters, where `perf_event_open` is available.
  */
 #pragma once
 #include <algorithm>
 #include <chrono>     // `std::chrono::high_resolution_clock`
 #include <clocale>    // `std::setlocale`
+#include <cstdarg>    // `va_list`
+#include <cstdint>    // `std::int64_t`
 #include <cstring>    // `std::memcpy`
 #include <functional> // `std::equal_to`
 #include <limits>     // `std::numeric_limits`
@@ -14,6 +24,14 @@
 
 #include <string_view> // Requires C++17
 
+#if defined(__linux__)
+#include <linux/perf_event.h> // `perf_event_attr`
+#include <sched.h>            // `sched_setaffinity`
+#include <sys/ioctl.h>        // `ioctl`
+#include <sys/syscall.h>      // `SYS_perf_event_open`
+#include <unistd.h>           // `syscall`, `sysconf`
+#endif
+
 #include <stringzilla/stringzilla.h>
 #include <stringzilla/stringzilla.hpp>
 
@@ -36,8 +54,317 @@ struct benchmark_result_t {
     std::size_t iterations = 0;
     std::size_t bytes_passed = 0;
     seconds_t seconds = 0;
+
+    // Hardware counters for the measured period, negative if unavailable.
+    std::int64_t cycles = -1;
+    std::int64_t instructions = -1;
+    std::int64_t cache_misses = -1;
+    std::int64_t branch_misses = -1;
+};
+
+/**
+ *  @brief  Result of a single benchmarked function, labeled with the section it was a part of.
+ */
+struct bench_record_t {
+    std::string section;
+    std::string name;
+    benchmark_result_t results;
+    std::size_t failed_count = 0;
 };
 
+/**
+ *  @brief  Guesses the backend from the suffix of the function name, like `sz_find_avx512`.
+ *  @return One of "serial", "avx2", "avx512", "neon", "sve", or an empty string for baselines.
+ */
+inline std::string backend_of(std::string const &name) {
+    for (char const *backend : {"serial", "avx2", "avx512", "neon", "sve"}) {
+        std::string suffix = std::string("_") + backend;
+        if (name.size() > suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0)
+            return backend;
+    }
+    return {};
+}
+
+inline std::string json_escape(std::string const &text) {
+    std::string result;
+    for (char c : text) {
+        if (c == '"' || c == '\\') result += '\\', result += c;
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+            result += escaped;
+        }
+        else { result += c; }
+    }
+    return result;
+}
+
+inline std::string csv_escape(std::string const &text) {
+    if (text.find_first_of(",\"\n") == std::string::npos) return text;
+    std::string result = "\"";
+    for (char c : text) result += c == '"' ? std::string("\"\"") : std::string(1, c);
+    return result + "\"";
+}
+
+/**
+ *  @brief  Collects the results of all benchmarks in the process, and exports them at exit into JSON and CSV files,
+ *          if the paths were passed, so that the runs can be diffed across library versions and CPU generations.
+ */
+struct bench_report_t {
+    std::string suite;        // Name of the executable.
+    std::string dataset_path; // Path to the dataset file.
+    std::string json_path;    // Output path for the JSON report, or empty.
+    std::string csv_path;     // Output path for the CSV report, or empty.
+    std::string section;      // Title of the current group of benchmarks.
+    int pinned_core = -1;     // Core the main thread is pinned to, or negative.
+    std::vector<bench_record_t> records;
+
+    bench_report_t() = default;
+    bench_report_t(bench_report_t const &) = delete;
+    bench_report_t &operator=(bench_report_t const &) = delete;
+    ~bench_report_t() noexcept {
+        if (!json_path.empty()) export_json();
+        if (!csv_path.empty()) export_csv();
+    }
+
+    void record(std::string const &name, benchmark_result_t const &results, std::size_t failed_count = 0) {
+        records.push_back({section, name, results, failed_count});
+    }
+
+    /**  @brief  Lists the SIMD backends compiled into the benchmark, which are the ones benchmarked explicitly. */
+    static std::string compiled_backends() {
+        std::string result = "serial";
+        if (SZ_USE_X86_AVX2) result += ",avx2";
+        if (SZ_USE_X86_AVX512) result += ",avx512";
+        if (SZ_USE_ARM_NEON) result += ",neon";
+        if (SZ_USE_ARM_SVE) result += ",sve";
+        return result;
+    }
+
+    static std::string compiler() {
+#if defined(__VERSION__)
+        return __VERSION__;
+#elif defined(_MSC_FULL_VER)
+        return "MSVC " + std::to_string(_MSC_FULL_VER);
+#else
+        return "unknown";
+#endif
+    }
+
+  private:
+    static double gigabytes_per_second(benchmark_result_t const &results) noexcept {
+        return results.seconds ? results.bytes_passed / results.seconds / 1.e9 : 0.0;
+    }
+    static double nanoseconds_per_operation(benchmark_result_t const &results) noexcept {
+        return results.iterations ? results.seconds * 1e9 / results.iterations : 0.0;
+    }
+
+    /**  @brief  Prints the counter after the ::prefix, or the ::missing placeholder, if it's unavailable. */
+    static void print_counter(std::FILE *file, char const *prefix, std::int64_t value, char const *missing) {
+        if (value < 0) std::fprintf(file, "%s%s", prefix, missing);
+        else std::fprintf(file, "%s%lld", prefix, static_cast<long long>(value));
+    }
+
+    static void print_ipc(std::FILE *file, char const *prefix, benchmark_result_t const &results,
+                          char const *missing) {
+        if (results.cycles > 0 && results.instructions >= 0)
+            std::fprintf(file, "%s%.3f", prefix, double(results.instructions) / double(results.cycles));
+        else std::fprintf(file, "%s%s", prefix, missing);
+    }
+
+    void export_json() const noexcept {
+        std::FILE *file = std::fopen(json_path.c_str(), "w");
+        if (!file) return (void)std::fprintf(stderr, "Failed to write the report to %s\n", json_path.c_str());
+        std::fprintf(file, "{\n");
+        std::fprintf(file, "  \"suite\": \"%s\",\n", json_escape(suite).c_str());
+        std::fprintf(file, "  \"version\": \"%d.%d.%d\",\n", STRINGZILLA_VERSION_MAJOR, STRINGZILLA_VERSION_MINOR,
+                     STRINGZILLA_VERSION_PATCH);
+        std::fprintf(file, "  \"compiler\": \"%s\",\n", json_escape(compiler()).c_str());
+        std::fprintf(file, "  \"backends\": \"%s\",\n", compiled_backends().c_str());
+        std::fprintf(file, "  \"dataset\": \"%s\",\n", json_escape(dataset_path).c_str());
+        std::fprintf(file, "  \"pinned_core\": %d,\n", pinned_core);
+        std::fprintf(file, "  \"results\": [");
+        for (std::size_t i = 0; i != records.size(); ++i) {
+            bench_record_t const &record = records[i];
+            benchmark_result_t const &results = record.results;
+            std::fprintf(file, "%s\n    {\"section\": \"%s\", \"name\": \"%s\", \"backend\": \"%s\", ", i ? "," : "",
+                         json_escape(record.section).c_str(), json_escape(record.name).c_str(),
+                         backend_of(record.name).c_str());
+            std::fprintf(file, "\"iterations\": %zu, \"bytes\": %zu, \"seconds\": %.6f, ", results.iterations,
+                         results.bytes_passed, results.seconds);
+            std::fprintf(file, "\"gb_per_second\": %.6f, \"ns_per_op\": %.3f, \"errors\": %zu",
+                         gigabytes_per_second(results), nanoseconds_per_operation(results), record.failed_count);
+            print_counter(file, ", \"cycles\": ", results.cycles, "null");
+            print_counter(file, ", \"instructions\": ", results.instructions, "null");
+            print_ipc(file, ", \"ipc\": ", results, "null");
+            print_counter(file, ", \"cache_misses\": ", results.cache_misses, "null");
+            print_counter(file, ", \"branch_misses\": ", results.branch_misses, "null");
+            std::fprintf(file, "}");
+        }
+        std::fprintf(file, "\n  ]\n}\n");
+        std::fclose(file);
+    }
+
+    void export_csv() const noexcept {
+        std::FILE *file = std::fopen(csv_path.c_str(), "w");
+        if (!file) return (void)std::fprintf(stderr, "Failed to write the report to %s\n", csv_path.c_str());
+        std::fprintf(file, "suite,section,name,backend,iterations,bytes,seconds,gb_per_second,ns_per_op,errors,"
+                           "cycles,instructions,ipc,cache_misses,branch_misses\n");
+        for (bench_record_t const &record : records) {
+            benchmark_result_t const &results = record.results;
+            std::fprintf(file, "%s,%s,%s,%s,%zu,%zu,%.6f,%.6f,%.3f,%zu", csv_escape(suite).c_str(),
+                         csv_escape(record.section).c_str(), csv_escape(record.name).c_str(),
+                         backend_of(record.name).c_str(), results.iterations, results.bytes_passed, results.seconds,
+                         gigabytes_per_second(results), nanoseconds_per_operation(results), record.failed_count);
+            print_counter(file, ",", results.cycles, "");
+            print_counter(file, ",", results.instructions, "");
+            print_ipc(file, ",", results, "");
+            print_counter(file, ",", results.cache_misses, "");
+            print_counter(file, ",", results.branch_misses, "");
+            std::fprintf(file, "\n");
+        }
+        std::fclose(file);
+    }
+};
+
+inline bench_report_t &bench_report() {
+    static bench_report_t report;
+    return report;
+}
+
+/**
+ *  @brief  Prints the title of the next group of benchmarks, and labels their records in the report with it.
+ */
+#if defined(__GNUC__)
+__attribute__((format(printf, 1, 2)))
+#endif
+inline void
+bench_section(char const *format, ...) {
+    char title[512];
+    va_list args;
+    va_start(args, format);
+    std::vsnprintf(title, sizeof(title), format, args);
+    va_end(args);
+    std::fputs(title, stdout);
+
+    // Strip the decorations, like in "---- Sorting:\n".
+    std::string section = title;
+    while (!section.empty() && (section.back() == '\n' || section.back() == ':')) section.pop_back();
+    section.erase(0, section.find_first_not_of("- "));
+    bench_report().section = section;
+}
+
+/**
+ *  @brief  Group of hardware performance counters for the calling thread: cycles, instructions, cache misses,
+ *          and branch misses. Uses `perf_event_open` on Linux, and quietly stays unavailable elsewhere,
+ *          as well as in containers and VMs without a PMU, or if the `perf_event_paranoid` level forbids it.
+ */
+class perf_counters_t {
+    static constexpr std::size_t count_k = 4;
+    int descriptors_[count_k] = {-1, -1, -1, -1};
+
+  public:
+    perf_counters_t() noexcept {
+#if defined(__linux__)
+        std::uint64_t const configs[count_k] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+        for (std::size_t i = 0; i != count_k; ++i) {
+            perf_event_attr attributes;
+            std::memset(&attributes, 0, sizeof(attributes));
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.size = sizeof(attributes);
+            attributes.config = configs[i];
+            attributes.disabled = i == 0; // The whole group is enabled through the leader.
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            descriptors_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, descriptors_[0], 0));
+            if (descriptors_[0] < 0) return; // Without the cycles, the rest is meaningless.
+        }
+#endif
+    }
+
+    perf_counters_t(perf_counters_t const &) = delete;
+    perf_counters_t &operator=(perf_counters_t const &) = delete;
+
+    ~perf_counters_t() noexcept {
+#if defined(__linux__)
+        for (int descriptor : descriptors_)
+            if (descriptor >= 0) close(descriptor);
+#endif
+    }
+
+    bool available() const noexcept { return descriptors_[0] >= 0; }
+
+    void start() noexcept {
+#if defined(__linux__)
+        if (!available()) return;
+        ioctl(descriptors_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(descriptors_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    /**  @brief  Stops counting and exports the counted values, leaving the unavailable ones negative. */
+    void stop(benchmark_result_t &result) noexcept {
+#if defined(__linux__)
+        if (!available()) return;
+        ioctl(descriptors_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        std::int64_t *outputs[count_k] = {&result.cycles, &result.instructions, &result.cache_misses,
+                                          &result.branch_misses};
+        for (std::size_t i = 0; i != count_k; ++i) {
+            std::uint64_t value = 0;
+            if (descriptors_[i] >= 0 && read(descriptors_[i], &value, sizeof(value)) == sizeof(value))
+                *outputs[i] = static_cast<std::int64_t>(value);
+        }
+#else
+        (void)result;
+#endif
+    }
+};
+
+/**
+ *  @brief  Pins the calling thread to a single core, to avoid the migrations between the cores
+ *          and the cache warm-ups they entail. Only supported on Linux.
+ */
+inline bool pin_current_thread(int core) noexcept {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)core;
+    return false;
+#endif
+}
+
+/**
+ *  @brief  Input size, that fits into a certain level of the memory hierarchy.
+ */
+struct memory_level_t {
+    char const *name;
+    std::size_t bytes;
+};
+
+/**
+ *  @brief  Lists the input sizes resident in every level of the memory hierarchy: halves of the L1d, L2, and L3
+ *          capacities, queried from `sysconf` where available, and the whole ::max_bytes for the DRAM,
+ *          if it exceeds the L3. The levels larger than ::max_bytes are skipped.
+ */
+inline std::vector<memory_level_t> memory_levels(std::size_t max_bytes) {
+    std::size_t l1_bytes = 32 * 1024, l2_bytes = 1024 * 1024, l3_bytes = 32 * 1024 * 1024;
+#if defined(__linux__) && defined(_SC_LEVEL1_DCACHE_SIZE)
+    if (long bytes = sysconf(_SC_LEVEL1_DCACHE_SIZE); bytes > 0) l1_bytes = static_cast<std::size_t>(bytes);
+    if (long bytes = sysconf(_SC_LEVEL2_CACHE_SIZE); bytes > 0) l2_bytes = static_cast<std::size_t>(bytes);
+    if (long bytes = sysconf(_SC_LEVEL3_CACHE_SIZE); bytes > 0) l3_bytes = static_cast<std::size_t>(bytes);
+#endif
+    std::vector<memory_level_t> levels;
+    for (memory_level_t level : {memory_level_t {"L1", l1_bytes / 2}, memory_level_t {"L2", l2_bytes / 2},
+                                 memory_level_t {"L3", l3_bytes / 2}})
+        if (level.bytes <= max_bytes) levels.push_back(level);
+    if (max_bytes > l3_bytes) levels.push_back({"DRAM", max_bytes});
+    return levels;
+}
+
 using unary_function_t = std::function<std::size_t(std::string_view)>;
 using binary_function_t = std::function<std::size_t(std::string_view, std::string_view)>;
 
@@ -98,6 +425,7 @@ struct tracked_function_gt {
                     results.seconds * 1e9 / results.iterations, failed_count, results.iterations,
                     failed_strings.size() ? failed_strings[0].c_str() : "",
                     failed_strings.size() >= 2 && is_binary ? failed_strings[1].c_str() : "");
+        if (results.iterations) bench_report().record(name, results, failed_count);
     }
 };
 
@@ -162,6 +490,7 @@ inline std::vector<result_string_type> filter_by_length(std::vector<from_string_
 }
 
 inline static std::size_t seconds_per_benchmark = SZ_DEBUG ? 1 : 5;
+inline static seconds_t seconds_for_warmup = SZ_DEBUG ? 0 : 0.5;
 
 struct dataset_t {
     std::string text;
@@ -205,17 +534,46 @@ inline dataset_t make_dataset_from_path(std::string path) {
 }
 
 /**
- *  @brief  Loads a dataset, depending on the passed CLI arguments.
+ *  @brief  Loads a dataset, depending on the passed CLI arguments, pins the thread, and configures the report.
  */
 inline dataset_t prepare_benchmark_environment(int argc, char const *argv[]) {
-    if (argc < 2 || argc > 3)
-        throw std::runtime_error("Usage: " + std::string(argv[0]) + " <path> [seconds_per_benchmark]");
+    std::vector<std::string> positional;
+    bench_report_t &report = bench_report();
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument.rfind("--", 0) != 0) {
+            positional.push_back(argument);
+            continue;
+        }
+        std::size_t separator = argument.find('=');
+        std::string key = argument.substr(2, separator == std::string::npos ? std::string::npos : separator - 2);
+        std::string value = separator == std::string::npos ? std::string() : argument.substr(separator + 1);
+        if (key == "json") report.json_path = value;
+        else if (key == "csv") report.csv_path = value;
+        else if (key == "pin") report.pinned_core = std::stoi(value);
+        else if (key == "warmup") seconds_for_warmup = std::stod(value);
+        else throw std::invalid_argument("Unknown option: " + argument);
+    }
+    if (positional.size() < 1 || positional.size() > 2)
+        throw std::runtime_error("Usage: " + std::string(argv[0]) +
+                                 " <path> [seconds_per_benchmark] [--json=<path>] [--csv=<path>] [--pin=<core>]"
+                                 " [--warmup=<seconds>]");
+
+    std::string suite = argv[0];
+    report.suite = suite.substr(suite.find_last_of("/\\") + 1);
+    report.dataset_path = positional[0];
+    if (report.pinned_core >= 0 && !pin_current_thread(report.pinned_core)) {
+        std::fprintf(stderr, "Failed to pin the thread to core %d, continuing unpinned.\n", report.pinned_core);
+        report.pinned_core = -1;
+    }
+    if (!perf_counters_t {}.available())
+        std::fprintf(stderr, "Hardware counters are unavailable, so they will be missing from the reports.\n");
 
-    dataset_t data = make_dataset_from_path(argv[1]);
+    dataset_t data = make_dataset_from_path(positional[0]);
 
     // If the seconds_per_benchmark argument is provided, update the value in the dataset
-    if (argc == 3) {
-        seconds_per_benchmark = std::stoi(argv[2]);
+    if (positional.size() == 2) {
+        seconds_per_benchmark = std::stoi(positional[1]);
         if (seconds_per_benchmark == 0)
             throw std::invalid_argument("The number of seconds per task must be greater than 0.");
     }
@@ -229,6 +587,39 @@ inline sz_string_view_t to_c(sz::string_view str) noexcept { return {str.data(),
 inline sz_string_view_t to_c(sz::string const &str) noexcept { return {str.data(), str.size()}; }
 inline sz_string_view_t to_c(sz_string_view_t str) noexcept { return str; }
 
+/**
+ *  @brief  Repeats the ::step with growing iteration indices: first for the warm-up period, that isn't reported,
+ *          letting the caches, the branch predictors, and the clock frequency settle, and then for the
+ *          `seconds_per_benchmark`, collecting the hardware counters where available.
+ *  @param  step Function receiving the index of the first of 4 iterations, returning the number of bytes passed.
+ */
+template <typename step_type>
+benchmark_result_t bench_loop(step_type &&step) {
+
+    namespace stdc = std::chrono;
+    using stdcc = stdc::high_resolution_clock;
+    auto seconds_since = [](stdcc::time_point start) {
+        return stdc::duration_cast<stdc::nanoseconds>(stdcc::now() - start).count() / 1.e9;
+    };
+
+    std::size_t warmup_iterations = 0;
+    for (stdcc::time_point t0 = stdcc::now(); seconds_since(t0) < seconds_for_warmup; warmup_iterations += 4)
+        do_not_optimize(step(warmup_iterations));
+
+    benchmark_result_t result;
+    perf_counters_t counters;
+    counters.start();
+    stdcc::time_point t1 = stdcc::now();
+    while (true) {
+        result.bytes_passed += step(result.iterations);
+        result.iterations += 4;
+        result.seconds = seconds_since(t1);
+        if (result.seconds > seconds_per_benchmark) break;
+    }
+    counters.stop(result);
+    return result;
+}
+
 /**
  *  @brief  Loop over all elements in a dataset in somewhat random order, benchmarking the function cost.
  *  @param  strings Strings to loop over. Length must be a power of two.
@@ -238,28 +629,13 @@ inline sz_string_view_t to_c(sz_string_view_t str) noexcept { return str; }
 template <typename strings_type, typename function_type>
 benchmark_result_t bench_on_tokens(strings_type &&strings, function_type &&function) {
 
-    namespace stdc = std::chrono;
-    using stdcc = stdc::high_resolution_clock;
-    stdcc::time_point t1 = stdcc::now();
-    benchmark_result_t result;
     std::size_t lookup_mask = bit_floor(strings.size()) - 1;
 
-    while (true) {
-        // Unroll a few iterations, to avoid some for-loops overhead and minimize impact of time-tracking
-        {
-            result.bytes_passed += function(strings[(result.iterations + 0) & lookup_mask]) +
-                                   function(strings[(result.iterations + 1) & lookup_mask]) +
-                                   function(strings[(result.iterations + 2) & lookup_mask]) +
-                                   function(strings[(result.iterations + 3) & lookup_mask]);
-            result.iterations += 4;
-        }
-
-        stdcc::time_point t2 = stdcc::now();
-        result.seconds = stdc::duration_cast<stdc::nanoseconds>(t2 - t1).count() / 1.e9;
-        if (result.seconds > seconds_per_benchmark) break;
-    }
-
-    return result;
+    // Unroll a few iterations, to avoid some for-loops overhead and minimize impact of time-tracking
+    return bench_loop([&](std::size_t iteration) -> std::size_t {
+        return function(strings[(iteration + 0) & lookup_mask]) + function(strings[(iteration + 1) & lookup_mask]) +
+               function(strings[(iteration + 2) & lookup_mask]) + function(strings[(iteration + 3) & lookup_mask]);
+    });
 }
 
 /**
@@ -272,30 +648,17 @@ benchmark_result_t bench_on_tokens(strings_type &&strings, function_type &&funct
 template <typename strings_type, typename function_type>
 benchmark_result_t bench_on_token_pairs(strings_type &&strings, function_type &&function) {
 
-    namespace stdc = std::chrono;
-    using stdcc = stdc::high_resolution_clock;
-    stdcc::time_point t1 = stdcc::now();
-    benchmark_result_t result;
     std::size_t lookup_mask = bit_floor(strings.size()) - 1;
     std::size_t largest_prime = static_cast<std::size_t>(18446744073709551557ull);
 
-    while (true) {
-        // Unroll a few iterations, to avoid some for-loops overhead and minimize impact of time-tracking
-        {
-            auto second = (result.iterations * largest_prime) & lookup_mask;
-            result.bytes_passed += function(strings[(result.iterations + 0) & lookup_mask], strings[second]) +
-                                   function(strings[(result.iterations + 1) & lookup_mask], strings[second]) +
-                                   function(strings[(result.iterations + 2) & lookup_mask], strings[second]) +
-                                   function(strings[(result.iterations + 3) & lookup_mask], strings[second]);
-            result.iterations += 4;
-        }
-
-        stdcc::time_point t2 = stdcc::now();
-        result.seconds = stdc::duration_cast<stdc::nanoseconds>(t2 - t1).count() / 1.e9;
-        if (result.seconds > seconds_per_benchmark) break;
-    }
-
-    return result;
+    // Unroll a few iterations, to avoid some for-loops overhead and minimize impact of time-tracking
+    return bench_loop([&](std::size_t iteration) -> std::size_t {
+        auto second = (iteration * largest_prime) & lookup_mask;
+        return function(strings[(iteration + 0) & lookup_mask], strings[second]) +
+               function(strings[(iteration + 1) & lookup_mask], strings[second]) +
+               function(strings[(iteration + 2) & lookup_mask], strings[second]) +
+               function(strings[(iteration + 3) & lookup_mask], strings[second]);
+    });
 }
 
 /**
@@ -5,7 +5,7 @@
  *  This file is the sibling of `bench_sort.cpp`, `bench_search.cpp` and `bench_token.cpp`.
  *  It accepts a file with a list of words, constructs associative containers with string keys,
  *  using `std::string`, `std::string_view`, `sz::string_view`, and `sz::string`, and then
- *  evaluates the latency of lookups.
+ *  evaluates the latency of lookups. The open-addressing `sz::string_map` is compared against them.
  */
 #include <map>
 #include <unordered_map>
@@ -55,6 +55,7 @@ void bench_tokens(strings_type const &strings) {
     bench<std::map<sz::string_view, int>>("map<sz::string_view>", s);
     bench<std::unordered_map<sz::string, int>>("unordered_map<sz::string>", s);
     bench<std::unordered_map<sz::string_view, int>>("unordered_map<sz::string_view>", s);
+    bench<sz::string_map<int>>("sz::string_map", s);
 
     // Pure STL
     bench<std::map<std::string, int>>("map<std::string>", s);
@@ -75,12 +76,12 @@ int main(int argc, char const **argv) {
     dataset_t dataset = prepare_benchmark_environment(argc, argv);
 
     // Baseline benchmarks for real words, coming in all lengths
-    std::printf("Benchmarking on real words:\n");
+    bench_section("Benchmarking on real words:\n");
     bench_tokens(dataset.tokens);
 
     // Run benchmarks on tokens of different length
     for (std::size_t token_length : {1, 2, 3, 4, 5, 6, 7, 8, 16, 32}) {
-        std::printf("Benchmarking on real words of length %zu:\n", token_length);
+        bench_section("Benchmarking on real words of length %zu:\n", token_length);
         bench_tokens(filter_by_length(dataset.tokens, token_length));
     }
 
@@ -9,6 +9,7 @@
 #include <memory>  // `std::unique_ptr`
 #include <numeric> // `std::iota`
 #include <string>  // `std::string`
+#include <thread>  // `std::thread::hardware_concurrency`
 
 #ifdef _WIN32
 #include <malloc.h> // `_aligned_malloc`
@@ -200,6 +201,9 @@ tracked_unary_functions_t transform_functions() {
 #endif
 #if SZ_USE_ARM_NEON
         {"sz_look_up_transform_neon", wrap_sz(sz_look_up_transform_neon)},
+#endif
+#if SZ_USE_ARM_SVE
+        {"sz_look_up_transform_sve", wrap_sz(sz_look_up_transform_sve)},
 #endif
     };
     return result;
@@ -239,12 +243,73 @@ void bench_memory(std::vector<std::string_view> const &slices, sz_cptr_t dataset
     bench_memory(slices, transform_functions());
 }
 
+/**
+ *  @brief  Benchmarks `memcpy`-like and `memset`-like operations on a single buffer of every power-of-two size,
+ *          from L1-resident to far beyond the LLC capacity, to locate the crossover points for streaming stores,
+ *          controlled by `SZ_NON_TEMPORAL_THRESHOLD`, and for the multi-threaded variants.
+ *
+ *  @param  max_length The largest buffer size to try. Halved until both buffers can be allocated.
+ */
+void bench_memory_sweep(std::size_t max_length) {
+
+    std::unique_ptr<char, page_alloc_and_free_t> source, target;
+    for (; max_length >= 4096; max_length /= 2) {
+        source.reset(page_alloc_and_free_t {}(4096, max_length));
+        target.reset(page_alloc_and_free_t {}(4096, max_length));
+        if (source && target) break;
+    }
+    if (!source || !target) {
+        std::fprintf(stderr, "Failed to allocate the buffers for the sweep.\n");
+        return;
+    }
+    std::memset(source.get(), 'x', max_length);
+    std::memset(target.get(), '-', max_length);
+
+    std::size_t const threads = sz_max_of_two(std::thread::hardware_concurrency(), 1u);
+    std::string const suffix = "<" + std::to_string(threads) + " threads>";
+    sz_ptr_t const output = target.get();
+    for (std::size_t length = 4096; length <= max_length; length *= 2) {
+        bench_section("Benchmarking on buffers of %zu KB:\n", length / 1024);
+        tracked_unary_functions_t variants = {
+            {"memcpy", unary_function_t([output](std::string_view slice) {
+                 std::memcpy(output, slice.data(), slice.size());
+                 return slice.size();
+             })},
+            {"sz_copy", unary_function_t([output](std::string_view slice) {
+                 sz_copy(output, slice.data(), slice.size());
+                 return slice.size();
+             })},
+            {"sz_copy_parallel" + suffix, unary_function_t([output, threads](std::string_view slice) {
+                 sz::memcpy(output, slice.data(), slice.size(), threads);
+                 return slice.size();
+             })},
+            {"memset", unary_function_t([output](std::string_view slice) {
+                 std::memset(output, slice.front(), slice.size());
+                 return slice.size();
+             })},
+            {"sz_fill", unary_function_t([output](std::string_view slice) {
+                 sz_fill(output, slice.size(), slice.front());
+                 return slice.size();
+             })},
+            {"sz_fill_parallel" + suffix, unary_function_t([output, threads](std::string_view slice) {
+                 sz::memset(output, slice.front(), slice.size(), threads);
+                 return slice.size();
+             })},
+        };
+        bench_memory({std::string_view(source.get(), length)}, std::move(variants));
+    }
+}
+
 int main(int argc, char const **argv) {
     std::printf("StringZilla. Starting memory benchmarks.\n");
 
     dataset_t dataset = prepare_benchmark_environment(argc, argv);
     sz_cptr_t const dataset_start_ptr = dataset.text.data();
 
+    // Sweep the buffer sizes from the L1 cache to the DRAM, independent of the dataset
+    bench_section("Benchmarking on buffers of different size:\n");
+    bench_memory_sweep(1024ull * 1024ull * 1024ull);
+
     // These benchmarks should be heavier than substring search and other less critical operations.
     if (!SZ_DEBUG) seconds_per_benchmark *= 5;
 
@@ -260,16 +325,16 @@ int main(int argc, char const **argv) {
     std::memcpy(output_buffer.get(), dataset.text.data(), dataset.text.size());
 
     // Baseline benchmarks for present tokens, coming in all lengths
-    std::printf("Benchmarking on entire dataset:\n");
+    bench_section("Benchmarking on entire dataset:\n");
     bench_memory({dataset.text}, dataset_start_ptr, output_buffer.get());
-    std::printf("Benchmarking on lines:\n");
+    bench_section("Benchmarking on lines:\n");
     bench_memory(dataset.lines, dataset_start_ptr, output_buffer.get());
-    std::printf("Benchmarking on tokens:\n");
+    bench_section("Benchmarking on tokens:\n");
     bench_memory(dataset.tokens, dataset_start_ptr, output_buffer.get());
 
     // Run benchmarks on tokens of different length
     for (std::size_t token_length : {1, 2, 3, 4, 5, 6, 7, 8, 16, 32}) {
-        std::printf("Benchmarking on tokens of length %zu:\n", token_length);
+        bench_section("Benchmarking on tokens of length %zu:\n", token_length);
         bench_memory(filter_by_length<std::string_view>(dataset.tokens, token_length), dataset_start_ptr,
                      output_buffer.get());
     }
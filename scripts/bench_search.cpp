@@ -123,6 +123,50 @@ tracked_binary_functions_t rfind_functions() {
     return result;
 }
 
+tracked_binary_functions_t find_caseless_functions() {
+    auto wrap_sz = [](auto function) -> binary_function_t {
+        return binary_function_t([function](std::string_view h, std::string_view n) {
+            sz_cptr_t match = function(h.data(), h.size(), n.data(), n.size());
+            return (match ? match - h.data() : h.size());
+        });
+    };
+    tracked_binary_functions_t result = {
+        {"sz_find_caseless_serial", wrap_sz(sz_find_caseless_serial)},
+#if SZ_USE_X86_AVX512
+        {"sz_find_caseless_avx512", wrap_sz(sz_find_caseless_avx512), true},
+#endif
+#if SZ_USE_X86_AVX2
+        {"sz_find_caseless_avx2", wrap_sz(sz_find_caseless_avx2), true},
+#endif
+#if SZ_USE_ARM_NEON
+        {"sz_find_caseless_neon", wrap_sz(sz_find_caseless_neon), true},
+#endif
+    };
+    return result;
+}
+
+tracked_binary_functions_t rfind_caseless_functions() {
+    auto wrap_sz = [](auto function) -> binary_function_t {
+        return binary_function_t([function](std::string_view h, std::string_view n) {
+            sz_cptr_t match = function(h.data(), h.size(), n.data(), n.size());
+            return (match ? match - h.data() : 0);
+        });
+    };
+    tracked_binary_functions_t result = {
+        {"sz_rfind_caseless_serial", wrap_sz(sz_rfind_caseless_serial)},
+#if SZ_USE_X86_AVX512
+        {"sz_rfind_caseless_avx512", wrap_sz(sz_rfind_caseless_avx512), true},
+#endif
+#if SZ_USE_X86_AVX2
+        {"sz_rfind_caseless_avx2", wrap_sz(sz_rfind_caseless_avx2), true},
+#endif
+#if SZ_USE_ARM_NEON
+        {"sz_rfind_caseless_neon", wrap_sz(sz_rfind_caseless_neon), true},
+#endif
+    };
+    return result;
+}
+
 tracked_binary_functions_t find_charset_functions() {
     // ! Despite receiving string-views, following functions are assuming the strings are null-terminated.
     auto wrap_sz = [](auto function) -> binary_function_t {
@@ -287,6 +331,8 @@ void bench_search(std::string const &haystack, std::vector<std::string> const &s
 
     bench_finds(haystack, strings, find_functions());
     bench_rfinds(haystack, strings, rfind_functions());
+    bench_finds(haystack, strings, find_caseless_functions());
+    bench_rfinds(haystack, strings, rfind_caseless_functions());
 }
 
 int main(int argc, char const **argv) {
@@ -295,50 +341,50 @@ int main(int argc, char const **argv) {
     dataset_t dataset = prepare_benchmark_environment(argc, argv);
 
     // Splitting by new lines
-    std::printf("Benchmarking for a newline symbol:\n");
+    bench_section("Benchmarking for a newline symbol:\n");
     bench_finds(dataset.text, {"\n"}, find_functions());
     bench_rfinds(dataset.text, {"\n"}, rfind_functions());
 
-    std::printf("Benchmarking for one whitespace:\n");
+    bench_section("Benchmarking for one whitespace:\n");
     bench_finds(dataset.text, {" "}, find_functions());
     bench_rfinds(dataset.text, {" "}, rfind_functions());
 
-    std::printf("Benchmarking for an [\\n\\r\\v\\f] RegEx:\n");
+    bench_section("Benchmarking for an [\\n\\r\\v\\f] RegEx:\n");
     bench_finds(dataset.text, {"\n\r\v\f"}, find_charset_functions());
     bench_rfinds(dataset.text, {"\n\r\v\f"}, rfind_charset_functions());
 
     // Typical ASCII tokenization and validation benchmarks
-    std::printf("Benchmarking for all whitespaces:\n");
+    bench_section("Benchmarking for all whitespaces:\n");
     bench_finds(dataset.text, {{sz::whitespaces(), sizeof(sz::whitespaces())}}, find_charset_functions());
     bench_rfinds(dataset.text, {{sz::whitespaces(), sizeof(sz::whitespaces())}}, rfind_charset_functions());
 
-    std::printf("Benchmarking for HTML tag start/end:\n");
+    bench_section("Benchmarking for HTML tag start/end:\n");
     bench_finds(dataset.text, {"<>"}, find_charset_functions());
     bench_rfinds(dataset.text, {"<>"}, rfind_charset_functions());
 
-    std::printf("Benchmarking for punctuation marks:\n");
+    bench_section("Benchmarking for punctuation marks:\n");
     bench_finds(dataset.text, {{sz::punctuation(), sizeof(sz::punctuation())}}, find_charset_functions());
     bench_rfinds(dataset.text, {{sz::punctuation(), sizeof(sz::punctuation())}}, rfind_charset_functions());
 
-    std::printf("Benchmarking for non-printable characters:\n");
+    bench_section("Benchmarking for non-printable characters:\n");
     bench_finds(dataset.text, {{sz::ascii_controls(), sizeof(sz::ascii_controls())}}, find_charset_functions());
     bench_rfinds(dataset.text, {{sz::ascii_controls(), sizeof(sz::ascii_controls())}}, rfind_charset_functions());
 
     // Baseline benchmarks for present tokens, coming in all lengths
-    std::printf("Benchmarking on present lines:\n");
+    bench_section("Benchmarking on present lines:\n");
     bench_search(dataset.text, {dataset.lines.begin(), dataset.lines.end()});
-    std::printf("Benchmarking on present tokens:\n");
+    bench_section("Benchmarking on present tokens:\n");
     bench_search(dataset.text, {dataset.tokens.begin(), dataset.tokens.end()});
 
     // Run benchmarks on tokens of different length
     for (std::size_t token_length : {1, 2, 3, 4, 5, 6, 7, 8, 16, 32}) {
-        std::printf("Benchmarking on present tokens of length %zu:\n", token_length);
+        bench_section("Benchmarking on present tokens of length %zu:\n", token_length);
         bench_search(dataset.text, filter_by_length<std::string>(dataset.tokens, token_length));
     }
 
     // Run bechnmarks on abstract tokens of different length
     for (std::size_t token_length : {1, 2, 3, 4, 5, 6, 7, 8, 16, 32}) {
-        std::printf("Benchmarking for missing tokens of length %zu:\n", token_length);
+        bench_section("Benchmarking for missing tokens of length %zu:\n", token_length);
         bench_search(dataset.text, std::vector<std::string> {
                                        std::string(token_length, '\1'),
                                        std::string(token_length, '\2'),
@@ -347,6 +393,15 @@ int main(int argc, char const **argv) {
                                    });
     }
 
+    // Sweep the haystack sizes from the L1 cache to the DRAM, with missing needles to scan the whole haystack
+    for (memory_level_t const &level : memory_levels(dataset.text.size())) {
+        std::string haystack = dataset.text.substr(0, level.bytes);
+        bench_section("Benchmarking for missing tokens in %s-resident haystack of %zu KB:\n", level.name,
+                      level.bytes / 1024);
+        bench_finds(haystack, {std::string(1, '\1'), std::string(8, '\1')}, find_functions());
+        bench_rfinds(haystack, {std::string(1, '\1'), std::string(8, '\1')}, rfind_functions());
+    }
+
     std::printf("All benchmarks passed.\n");
     return 0;
 }
\ No newline at end of file
@@ -54,9 +54,63 @@ tracked_binary_functions_t distance_functions() {
         {"naive", wrap_baseline},
         {"sz_edit_distance", wrap_sz_distance(sz_edit_distance_serial), true},
         {"sz_alignment_score", wrap_sz_scoring(sz_alignment_score_serial), true},
+        {"sz_local_alignment_score", wrap_sz_scoring(sz_local_alignment_score_serial)},
 #if SZ_USE_X86_AVX512
         {"sz_edit_distance_avx512", wrap_sz_distance(sz_edit_distance_avx512), true},
         {"sz_alignment_score_avx512", wrap_sz_scoring(sz_alignment_score_avx512), true},
+#endif
+#if SZ_USE_X86_AVX2
+        {"sz_alignment_score_avx2", wrap_sz_scoring(sz_alignment_score_avx2), true},
+        {"sz_local_alignment_score_avx2", wrap_sz_scoring(sz_local_alignment_score_avx2)},
+#endif
+#if SZ_USE_ARM_NEON
+        {"sz_alignment_score_neon", wrap_sz_scoring(sz_alignment_score_neon), true},
+        {"sz_local_alignment_score_neon", wrap_sz_scoring(sz_local_alignment_score_neon)},
+#endif
+    };
+    return result;
+}
+
+/**
+ *  @brief  Compares every query against a fixed batch of candidates, reporting the sum of distances.
+ *          The baseline calls the pairwise `sz_edit_distance_serial` in a loop.
+ */
+tracked_unary_functions_t batch_distance_functions(std::vector<std::string_view> const &candidates) {
+    sz_memory_allocator_t alloc;
+    alloc.allocate = &allocate_from_vector;
+    alloc.free = &free_from_vector;
+    alloc.handle = &temporary_memory;
+
+    auto wrap_baseline = unary_function_t([&candidates, alloc](std::string_view query) mutable -> std::size_t {
+        std::size_t sum = 0;
+        for (std::string_view candidate : candidates)
+            sum += sz_edit_distance_serial(query.data(), query.size(), candidate.data(), candidate.size(), 0, &alloc);
+        return sum;
+    });
+    auto wrap_sz_batch = [&candidates, alloc](auto function) mutable -> unary_function_t {
+        return unary_function_t([function, &candidates, alloc](std::string_view query) mutable -> std::size_t {
+            sz_sequence_t sequence;
+            sequence.count = candidates.size();
+            sequence.handle = &candidates;
+            sequence.get_start = [](sz_sequence_t const *seq, sz_size_t i) -> sz_cptr_t {
+                return (*reinterpret_cast<std::vector<std::string_view> const *>(seq->handle))[i].data();
+            };
+            sequence.get_length = [](sz_sequence_t const *seq, sz_size_t i) -> sz_size_t {
+                return (*reinterpret_cast<std::vector<std::string_view> const *>(seq->handle))[i].size();
+            };
+            static std::vector<sz_size_t> distances;
+            distances.resize(candidates.size());
+            function(query.data(), query.size(), &sequence, (sz_size_t)0, &alloc, distances.data());
+            std::size_t sum = 0;
+            for (sz_size_t distance : distances) sum += distance;
+            return sum;
+        });
+    };
+    tracked_unary_functions_t result = {
+        {"sz_edit_distance x batch", wrap_baseline},
+        {"sz_edit_distances", wrap_sz_batch(sz_edit_distances_serial), true},
+#if SZ_USE_X86_AVX512
+        {"sz_edit_distances_avx512", wrap_sz_batch(sz_edit_distances_avx512), true},
 #endif
     };
     return result;
@@ -66,6 +120,11 @@ template <typename strings_at>
 void bench_similarity(strings_at &&strings) {
     if (strings.size() == 0) return;
     bench_binary_functions(strings, distance_functions());
+
+    // Compare every string against a batch of up to 256 candidates from the same dataset.
+    std::size_t const candidates_count = std::min<std::size_t>(strings.size(), 256);
+    std::vector<std::string_view> candidates(strings.begin(), strings.begin() + candidates_count);
+    bench_unary_functions(strings, batch_distance_functions(candidates));
 }
 
 void bench_similarity_on_bio_data() {
@@ -99,7 +158,7 @@ void bench_similarity_on_bio_data() {
             proteins.push_back(protein);
         }
 
-        std::printf("Benchmarking on protein-like sequences with %s:\n", bio_case.name);
+        bench_section("Benchmarking on protein-like sequences with %s:\n", bio_case.name);
         bench_similarity(proteins);
         proteins.clear();
     }
@@ -110,12 +169,12 @@ void bench_similarity_on_input_data(int argc, char const **argv) {
     dataset_t dataset = prepare_benchmark_environment(argc, argv);
 
     // Baseline benchmarks for real words, coming in all lengths
-    std::printf("Benchmarking on real words:\n");
+    bench_section("Benchmarking on real words:\n");
     bench_similarity(dataset.tokens);
 
     // Run benchmarks on tokens of different length
     for (std::size_t token_length : {20}) {
-        std::printf("Benchmarking on real words of length %zu and longer:\n", token_length);
+        bench_section("Benchmarking on real words of length %zu and longer:\n", token_length);
         bench_similarity(filter_by_length(dataset.tokens, token_length, std::greater_equal<std::size_t> {}));
     }
 }
@@ -8,6 +8,7 @@
  */
 #include <memory>  // `std::memcpy`
 #include <numeric> // `std::iota`
+#include <thread>  // `std::thread::hardware_concurrency`
 
 #if __linux__ && defined(_GNU_SOURCE)
 #include <stdlib.h> // `qsort_r`
@@ -129,9 +130,14 @@ void bench_permute(char const *name, strings_t &strings, permute_t &permute, alg
     namespace stdc = std::chrono;
     using stdcc = stdc::high_resolution_clock;
     constexpr std::size_t iterations = 3;
-    stdcc::time_point t1 = stdcc::now();
+    std::size_t bytes_per_iteration = 0;
+    for (std::string const &string : strings) bytes_per_iteration += string.size();
 
     // Run multiple iterations
+    benchmark_result_t result;
+    perf_counters_t counters;
+    counters.start();
+    stdcc::time_point t1 = stdcc::now();
     for (std::size_t i = 0; i != iterations; ++i) {
         std::iota(permute.begin(), permute.end(), 0);
         algo(strings, permute);
@@ -139,9 +145,15 @@ void bench_permute(char const *name, strings_t &strings, permute_t &permute, alg
 
     // Measure elapsed time
     stdcc::time_point t2 = stdcc::now();
+    counters.stop(result);
     double dif = stdc::duration_cast<stdc::nanoseconds>(t2 - t1).count() * 1.0;
     double milisecs = dif / (iterations * 1e6);
     std::printf("Elapsed time is %.2lf miliseconds/iteration for %s.\n", milisecs, name);
+
+    result.iterations = iterations;
+    result.bytes_passed = bytes_per_iteration * iterations;
+    result.seconds = dif / 1e9;
+    bench_report().record(name, result);
 }
 
 int main(int argc, char const **argv) {
@@ -155,7 +167,7 @@ int main(int argc, char const **argv) {
 
     // Partitioning
     {
-        std::printf("---- Partitioning:\n");
+        bench_section("---- Partitioning:\n");
         bench_permute("std::partition", strings, permute_base, [](strings_t const &strings, permute_t &permute) {
             std::partition(permute.begin(), permute.end(), [&](size_t i) { return strings[i].size() < 4; });
         });
@@ -179,7 +191,7 @@ int main(int argc, char const **argv) {
 
     // Sorting
     {
-        std::printf("---- Sorting:\n");
+        bench_section("---- Sorting:\n");
         bench_permute("std::sort", strings, permute_base, [](strings_t const &strings, permute_t &permute) {
             std::sort(permute.begin(), permute.end(), [&](idx_t i, idx_t j) { return strings[i] < strings[j]; });
         });
@@ -196,6 +208,18 @@ int main(int argc, char const **argv) {
         });
         expect_sorted(strings, permute_new);
 
+        bench_permute("sz_sort_parallel", strings, permute_new, [](strings_t const &strings, permute_t &permute) {
+            sz_sequence_t array;
+            array.order = permute.data();
+            array.count = strings.size();
+            array.handle = &strings;
+            array.get_start = get_start;
+            array.get_length = get_length;
+            std::size_t threads = std::thread::hardware_concurrency();
+            sz_sort_parallel(&array, &sz::_parallel_for_std_threads, &threads);
+        });
+        expect_sorted(strings, permute_new);
+
 #if __linux__ && defined(_GNU_SOURCE)
         bench_permute("qsort_r", strings, permute_new, [](strings_t const &strings, permute_t &permute) {
             sz_sequence_t array;
@@ -226,7 +250,7 @@ int main(int argc, char const **argv) {
                       [](strings_t const &strings, permute_t &permute) { hybrid_sort_cpp(strings, permute.data()); });
         expect_sorted(strings, permute_new);
 
-        std::printf("---- Stable Sorting:\n");
+        bench_section("---- Stable Sorting:\n");
         bench_permute("std::stable_sort", strings, permute_base, [](strings_t const &strings, permute_t &permute) {
             std::stable_sort(permute.begin(), permute.end(), [&](idx_t i, idx_t j) { return strings[i] < strings[j]; });
         });
@@ -239,5 +263,31 @@ int main(int argc, char const **argv) {
         expect_same(permute_base, permute_new);
     }
 
+    // Sorting URL-like strings with long shared prefixes, where comparisons are expensive
+    {
+        bench_section("---- Sorting with Long Shared Prefixes:\n");
+        strings_t prefixed_strings(strings.size());
+        char const *prefixes[] = {"https://github.com/ashvardanian/StringZilla/blob/main/include/stringzilla/",
+                                  "https://github.com/ashvardanian/StringZilla/blob/main/scripts/"};
+        for (std::size_t i = 0; i != strings.size(); ++i)
+            prefixed_strings[i] = std::string(prefixes[i % 2]) + strings[i];
+
+        bench_permute("std::sort", prefixed_strings, permute_base, [](strings_t const &strings, permute_t &permute) {
+            std::sort(permute.begin(), permute.end(), [&](idx_t i, idx_t j) { return strings[i] < strings[j]; });
+        });
+        expect_sorted(prefixed_strings, permute_base);
+
+        bench_permute("sz_sort", prefixed_strings, permute_new, [](strings_t const &strings, permute_t &permute) {
+            sz_sequence_t array;
+            array.order = permute.data();
+            array.count = strings.size();
+            array.handle = &strings;
+            array.get_start = get_start;
+            array.get_length = get_length;
+            sz_sort(&array);
+        });
+        expect_sorted(prefixed_strings, permute_new);
+    }
+
     return 0;
 }
\ No newline at end of file
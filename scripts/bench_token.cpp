@@ -35,12 +35,59 @@ tracked_unary_functions_t checksum_functions() {
     return result;
 }
 
+tracked_unary_functions_t utf8_counting_functions() {
+    auto wrap_sz = [](auto function) -> unary_function_t {
+        return unary_function_t([function](std::string_view s) { return (std::size_t)function(s.data(), s.size()); });
+    };
+    tracked_unary_functions_t result = {
+        {"sz_utf8_count_serial", wrap_sz(sz_utf8_count_serial)},
+#if SZ_USE_X86_AVX2
+        {"sz_utf8_count_avx2", wrap_sz(sz_utf8_count_avx2), true},
+#endif
+#if SZ_USE_X86_AVX512
+        {"sz_utf8_count_avx512", wrap_sz(sz_utf8_count_avx512), true},
+#endif
+#if SZ_USE_ARM_NEON
+        {"sz_utf8_count_neon", wrap_sz(sz_utf8_count_neon), true},
+#endif
+    };
+    return result;
+}
+
+tracked_unary_functions_t utf8_validation_functions() {
+    auto wrap_sz = [](auto function) -> unary_function_t {
+        return unary_function_t([function](std::string_view s) { return (std::size_t)function(s.data(), s.size()); });
+    };
+    tracked_unary_functions_t result = {
+        {"sz_utf8_validate_serial", wrap_sz(sz_utf8_validate_serial)},
+#if SZ_USE_X86_AVX2
+        {"sz_utf8_validate_avx2", wrap_sz(sz_utf8_validate_avx2), true},
+#endif
+#if SZ_USE_X86_AVX512
+        {"sz_utf8_validate_avx512", wrap_sz(sz_utf8_validate_avx512), true},
+#endif
+#if SZ_USE_ARM_NEON
+        {"sz_utf8_validate_neon", wrap_sz(sz_utf8_validate_neon), true},
+#endif
+    };
+    return result;
+}
+
 tracked_unary_functions_t hashing_functions() {
     auto wrap_sz = [](auto function) -> unary_function_t {
         return unary_function_t([function](std::string_view s) { return function(s.data(), s.size()); });
     };
     tracked_unary_functions_t result = {
         {"sz_hash_serial", wrap_sz(sz_hash_serial)},
+#if SZ_USE_X86_AVX512
+        {"sz_hash_avx512", wrap_sz(sz_hash_avx512), true},
+#endif
+#if SZ_USE_X86_AVX2
+        {"sz_hash_avx2", wrap_sz(sz_hash_avx2), true},
+#endif
+#if SZ_USE_ARM_NEON
+        {"sz_hash_neon", wrap_sz(sz_hash_neon), true},
+#endif
         {"std::hash", [](std::string_view s) { return std::hash<std::string_view> {}(s); }},
     };
     return result;
@@ -57,12 +104,66 @@ tracked_unary_functions_t sliding_hashing_functions(std::size_t window_width, st
     std::string suffix = std::to_string(window_width) + ":step" + std::to_string(step);
     tracked_unary_functions_t result = {
 #if SZ_USE_X86_AVX512
-        {"sz_hashes_avx512:" + suffix, wrap_sz(sz_hashes_avx512)},
+        {"sz_hashes_avx512:" + suffix, wrap_sz(sz_hashes_avx512), true},
 #endif
 #if SZ_USE_X86_AVX2
-        {"sz_hashes_avx2:" + suffix, wrap_sz(sz_hashes_avx2)},
+        {"sz_hashes_avx2:" + suffix, wrap_sz(sz_hashes_avx2), true},
+#endif
+#if SZ_USE_ARM_SVE
+        {"sz_hashes_sve:" + suffix, wrap_sz(sz_hashes_sve), true},
+#endif
+#if SZ_USE_ARM_NEON
+        {"sz_hashes_neon:" + suffix, wrap_sz(sz_hashes_neon), true},
+#endif
+        {"sz_hashes_serial:" + suffix, wrap_sz(sz_hashes_serial), true},
+    };
+    return result;
+}
+
+tracked_unary_functions_t minhash_functions(std::size_t window_width, std::size_t count) {
+    static std::vector<sz_u32_t> signatures;
+    signatures.resize(count);
+    auto wrap_sz = [=](auto function) -> unary_function_t {
+        return unary_function_t([function, window_width, count](std::string_view s) {
+            function(s.data(), s.size(), window_width, count, signatures.data());
+            return signatures[0];
+        });
+    };
+    // The callback-based baseline, that MinHash would otherwise be built on.
+    auto wrap_callback = [=](std::string_view s) {
+        struct state_t {
+            std::size_t count;
+            sz_u32_t *signatures;
+        } state = {count, signatures.data()};
+        std::fill(signatures.begin(), signatures.end(), 0xFFFFFFFFu);
+        sz_hashes_serial(
+            s.data(), s.size(), window_width, 1,
+            [](sz_cptr_t, sz_size_t, sz_u64_t hash, void *handle) {
+                state_t &state = *reinterpret_cast<state_t *>(handle);
+                for (std::size_t i = 0; i != state.count; ++i) {
+                    sz_u32_t multiplier_low, multiplier_high;
+                    sz_u64_t addend;
+                    _sz_hashes_minhash_seeds(i, &multiplier_low, &multiplier_high, &addend);
+                    sz_u64_t mixed = (hash & 0xFFFFFFFFu) * multiplier_low + (hash >> 32) * multiplier_high + addend;
+                    state.signatures[i] = std::min(state.signatures[i], (sz_u32_t)(mixed >> 32));
+                }
+            },
+            &state);
+        return signatures[0];
+    };
+    std::string suffix = std::to_string(window_width) + ":k" + std::to_string(count);
+    tracked_unary_functions_t result = {
+#if SZ_USE_X86_AVX512
+        {"sz_hashes_minhash_avx512:" + suffix, wrap_sz(sz_hashes_minhash_avx512)},
+#endif
+#if SZ_USE_X86_AVX2
+        {"sz_hashes_minhash_avx2:" + suffix, wrap_sz(sz_hashes_minhash_avx2)},
+#endif
+#if SZ_USE_ARM_NEON
+        {"sz_hashes_minhash_neon:" + suffix, wrap_sz(sz_hashes_minhash_neon)},
 #endif
-        {"sz_hashes_serial:" + suffix, wrap_sz(sz_hashes_serial)},
+        {"sz_hashes_minhash_serial:" + suffix, wrap_sz(sz_hashes_minhash_serial)},
+        {"sz_hashes_serial + callback:" + suffix, wrap_callback},
     };
     return result;
 }
@@ -175,8 +276,13 @@ void bench(strings_type &&strings) {
 
     // Benchmark logical operations
     bench_unary_functions(strings, checksum_functions());
+    bench_unary_functions(strings, utf8_counting_functions());
+    bench_unary_functions(strings, utf8_validation_functions());
     bench_unary_functions(strings, hashing_functions());
     bench_unary_functions(strings, sliding_hashing_functions(8, 1));
+    bench_unary_functions(strings, sliding_hashing_functions(8, 4));
+    bench_unary_functions(strings, sliding_hashing_functions(33, 1));
+    bench_unary_functions(strings, minhash_functions(5, 64));
     bench_unary_functions(strings, fingerprinting_functions());
     bench_binary_functions(strings, equality_functions());
     bench_binary_functions(strings, ordering_functions());
@@ -192,7 +298,7 @@ void bench(strings_type &&strings) {
 void bench_on_input_data(int argc, char const **argv) {
     dataset_t dataset = prepare_benchmark_environment(argc, argv);
 #if 0
-    std::printf("Benchmarking on the entire dataset:\n");
+    bench_section("Benchmarking on the entire dataset:\n");
     bench_unary_functions(dataset.tokens, random_generation_functions(100));
     bench_unary_functions(dataset.tokens, random_generation_functions(20));
     bench_unary_functions(dataset.tokens, random_generation_functions(5));
@@ -215,16 +321,16 @@ void bench_on_input_data(int argc, char const **argv) {
     bench_unary_functions<std::vector<std::string_view>>({dataset.text}, fingerprinting_functions(128, 1024 * 1024));
 #endif
     // Baseline benchmarks for real words, coming in all lengths
-    std::printf("Benchmarking on real words:\n");
+    bench_section("Benchmarking on real words:\n");
     bench(dataset.tokens);
-    std::printf("Benchmarking on real lines:\n");
+    bench_section("Benchmarking on real lines:\n");
     bench(dataset.lines);
-    std::printf("Benchmarking on entire dataset:\n");
+    bench_section("Benchmarking on entire dataset:\n");
     bench<std::vector<std::string_view>>({dataset.text});
 
     // Run benchmarks on tokens of different length
     for (std::size_t token_length : {1, 2, 3, 4, 5, 6, 7, 8, 16, 32}) {
-        std::printf("Benchmarking on real words of length %zu:\n", token_length);
+        bench_section("Benchmarking on real words of length %zu:\n", token_length);
         bench(filter_by_length(dataset.tokens, token_length));
     }
 }
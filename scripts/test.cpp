@@ -26,6 +26,7 @@
 
 #include <algorithm>     // `std::transform`
 #include <cstdio>        // `std::printf`
+#include <cstdlib>       // `std::malloc`
 #include <cstring>       // `std::memcpy`
 #include <iterator>      // `std::distance`
 #include <map>           // `std::map`
@@ -59,6 +60,7 @@ template class sz::basic_string_slice<char>;
 template class std::basic_string<char>;
 template class sz::basic_string<char>;
 template class sz::basic_charset<char>;
+template class sz::basic_multi_matcher<>;
 
 template class std::vector<sz::string>;
 template class std::map<sz::string, int>;
@@ -259,23 +261,115 @@ static void test_memory_utilities( //
 #endif
 }
 
+/**
+ *  @brief  Validates the memory operations on buffers beyond the `SZ_NON_TEMPORAL_THRESHOLD`, where the kernels
+ *          switch to bidirectional traversals and streaming stores, as well as the multi-threaded variants.
+ *          The fills are checked beyond the `SZ_NON_TEMPORAL_FILL_THRESHOLD` separately.
+ */
+static void test_memory_utilities_huge() {
+
+    std::size_t const max_length = 3 * sz_max_of_two((std::size_t)SZ_NON_TEMPORAL_THRESHOLD, 1024ull * 1024ull) + 256;
+    std::mt19937 &generator = global_random_generator();
+    std::string source(max_length, '-'), target_stl(max_length, '-'), target_sz(max_length, '-');
+    std::generate(source.begin(), source.end(), [&]() { return (char)(generator() % 256); });
+
+    std::size_t const threshold = SZ_NON_TEMPORAL_THRESHOLD;
+    std::size_t const lengths[] = {threshold - 1, threshold, threshold + 95, max_length - 128};
+    std::size_t const offsets[] = {0, 1, 33};
+    for (std::size_t length : lengths) {
+        for (std::size_t source_offset : offsets) {
+            for (std::size_t target_offset : offsets) {
+                sz_cptr_t const from = source.data() + source_offset;
+                sz_ptr_t const to = &target_sz[target_offset];
+
+                // The checksums are independent from the target, so only test them once per source
+                if (target_offset == 0) assert(sz_checksum(from, length) == sz_checksum_serial(from, length));
+
+#define check_against_stl(operation)                                                                                 \
+    {                                                                                                                \
+        std::fill(target_stl.begin(), target_stl.end(), '-');                                                        \
+        std::fill(target_sz.begin(), target_sz.end(), '-');                                                          \
+        std::memcpy(&target_stl[target_offset], from, length);                                                       \
+        operation;                                                                                                   \
+        assert(target_stl == target_sz);                                                                             \
+    }
+                check_against_stl(sz_copy(to, from, length));
+                check_against_stl(sz_move(to, from, length));
+                check_against_stl(sz::memcpy(to, from, length, 4));
+#if SZ_USE_X86_AVX2
+                check_against_stl(sz_copy_avx2(to, from, length));
+                check_against_stl(sz_move_avx2(to, from, length));
+                if (target_offset == 0) assert(sz_checksum_avx2(from, length) == sz_checksum_serial(from, length));
+#endif
+#if SZ_USE_X86_AVX512
+                check_against_stl(sz_copy_avx512(to, from, length));
+                check_against_stl(sz_move_avx512(to, from, length));
+                if (target_offset == 0) assert(sz_checksum_avx512(from, length) == sz_checksum_serial(from, length));
+#endif
+#undef check_against_stl
+            }
+        }
+    }
+
+    // Regular stores in fills remain competitive with the streaming ones for much larger buffers
+    std::size_t const fill_threshold = SZ_NON_TEMPORAL_FILL_THRESHOLD;
+    std::size_t const fill_lengths[] = {threshold + 1, fill_threshold - 1, fill_threshold + 95};
+    std::string fill_stl(fill_threshold + 128, '-'), fill_sz(fill_threshold + 128, '-');
+    for (std::size_t length : fill_lengths) {
+        for (std::size_t target_offset : {0, 33}) {
+            sz_ptr_t const to = &fill_sz[target_offset];
+            char const value = (char)(length + target_offset);
+#define check_against_stl(operation)                                                                                 \
+    {                                                                                                                \
+        std::fill(fill_stl.begin(), fill_stl.end(), '-');                                                            \
+        std::fill(fill_sz.begin(), fill_sz.end(), '-');                                                              \
+        std::memset(&fill_stl[target_offset], value, length);                                                        \
+        operation;                                                                                                   \
+        assert(fill_stl == fill_sz);                                                                                 \
+    }
+            check_against_stl(sz_fill(to, length, (sz_u8_t)value));
+            check_against_stl(sz::memset(to, value, length, 4));
+#if SZ_USE_X86_AVX2
+            check_against_stl(sz_fill_avx2(to, length, (sz_u8_t)value));
+#endif
+#if SZ_USE_X86_AVX512
+            check_against_stl(sz_fill_avx512(to, length, (sz_u8_t)value));
+#endif
+#undef check_against_stl
+        }
+    }
+
+    // Overlapping moves of huge buffers can't use the streaming stores, but should still work in both directions
+    std::memcpy(&target_stl[0], source.data(), max_length);
+    std::memcpy(&target_sz[0], source.data(), max_length);
+    for (std::size_t shift : {1, 63, 64, 4097}) {
+        std::size_t const length = max_length - shift;
+        std::memmove(&target_stl[shift], &target_stl[0], length);
+        sz_move(&target_sz[shift], &target_sz[0], length);
+        assert(target_stl == target_sz);
+        std::memmove(&target_stl[0], &target_stl[shift], length);
+        sz_move(&target_sz[0], &target_sz[shift], length);
+        assert(target_stl == target_sz);
+    }
+}
+
 #define assert_scoped(init, operation, condition) \
-    {                                             \
-        init;                                     \
-        operation;                                \
-        assert(condition);                        \
+    {                                                                                                                \
+        init;                                                                                                        \
+        operation;                                                                                                   \
+        assert(condition);                                                                                           \
     }
 
 #define assert_throws(expression, exception_type) \
-    {                                             \
-        bool threw = false;                       \
-        try {                                     \
-            sz_unused(expression);                \
-        }                                         \
-        catch (exception_type const &) {          \
-            threw = true;                         \
-        }                                         \
-        assert(threw);                            \
+    {                                                                                                                \
+        bool threw = false;                                                                                          \
+        try {                                                                                                        \
+            sz_unused(expression);                                                                                   \
+        }                                                                                                            \
+        catch (exception_type const &) {                                                                             \
+            threw = true;                                                                                            \
+        }                                                                                                            \
+        assert(threw);                                                                                               \
     }
 
 /**
@@ -1030,6 +1124,123 @@ static void test_memory_stability_for_length(std::size_t len = 1ull << 10) {
     assert(accounting_allocator::counter_ref() == 0);
 }
 
+/**
+ *  @brief  Tests the chained arena allocator, its statistics, and its C++ adapters.
+ */
+static void test_arena_allocation() {
+    // Count the upstream calls, to make sure the arena reuses its chunks.
+    struct upstream_counter {
+        static std::size_t &calls() {
+            static std::size_t count = 0;
+            return count;
+        }
+        static void *allocate(sz_size_t length, void *) { return calls()++, std::malloc(length); }
+        static void free(void *start, sz_size_t, void *) { std::free(start); }
+    };
+    sz_memory_allocator_t upstream;
+    upstream.allocate = &upstream_counter::allocate;
+    upstream.free = &upstream_counter::free;
+    upstream.handle = nullptr;
+
+    sz_memory_arena_t arena;
+    sz_memory_arena_init(&arena, 256, &upstream);
+    assert(arena.chunks_count == 0 && upstream_counter::calls() == 0);
+
+    // Allocations are 16-byte aligned and grow the chain of chunks geometrically.
+    std::size_t total = 0;
+    for (std::size_t i = 1; i <= 100; ++i) {
+        char *block = (char *)sz_memory_arena_allocate(&arena, i);
+        assert(block && (reinterpret_cast<std::uintptr_t>(block) % 16) == 0);
+        assert(sz_memory_arena_owns(&arena, block) == sz_true_k);
+        std::memset(block, (int)i, i);
+        total += i;
+    }
+    assert(arena.used_bytes >= total && arena.peak_bytes == arena.used_bytes);
+    assert(arena.chunks_count > 1 && arena.chunks_count < 10);
+    assert(upstream_counter::calls() == arena.chunks_count);
+
+    // Only the most recent block can be returned.
+    void *last = sz_memory_arena_allocate(&arena, 40);
+    std::size_t used_before_rollback = arena.used_bytes;
+    sz_memory_arena_deallocate(&arena, last, 40);
+    assert(arena.used_bytes == used_before_rollback - 48);
+    assert(sz_memory_arena_allocate(&arena, 40) == last);
+
+    // After a reset, the same workload fits into the kept chunk without upstream calls.
+    std::size_t peak = arena.peak_bytes;
+    sz_memory_arena_reset(&arena);
+    assert(arena.used_bytes == 0 && arena.chunks_count == 1 && arena.peak_bytes == peak);
+    std::size_t calls_before_reuse = upstream_counter::calls();
+    for (std::size_t i = 1; i <= 16; ++i) assert(sz_memory_arena_allocate(&arena, i));
+    assert(upstream_counter::calls() == calls_before_reuse);
+
+    // The generic allocator interface plugs the arena into any C API.
+    sz_memory_allocator_t alloc;
+    sz_memory_allocator_init_arena(&alloc, &arena);
+    assert(sz_edit_distance("kitten", 6, "sitting", 7, 0, &alloc) == 3);
+    sz_memory_arena_free(&arena);
+    assert(arena.chunks_count == 0 && arena.used_bytes == 0);
+    assert(sz_memory_arena_owns(&arena, last) == sz_false_k);
+
+    // The fixed-capacity allocator must hand out its own buffer.
+    char fixed_buffer[256];
+    sz_memory_allocator_init_fixed(&alloc, fixed_buffer, sizeof(fixed_buffer));
+    char *fixed_block = (char *)alloc.allocate(128, alloc.handle);
+    assert(fixed_block > fixed_buffer && fixed_block + 128 <= fixed_buffer + sizeof(fixed_buffer));
+    assert(alloc.allocate(512, alloc.handle) == nullptr);
+
+    // C++ strings draw from the innermost arena scope, and from the heap outside of it.
+    sz::arena scratch(128);
+    {
+        sz::arena_scope scope(scratch);
+        assert(sz::arena::current() == &scratch);
+        sz::arena_string text;
+        for (std::size_t i = 0; i != 1000; ++i) text.push_back('a' + (i % 26));
+        assert(text.size() == 1000 && text[27] == 'b');
+        assert(scratch.owns(text.data()) && scratch.peak_bytes() >= 1000);
+        sz::arena_string copy = text;
+        assert(copy == text && scratch.owns(copy.data()));
+        assert(sz::edit_distance(copy.view(), text.view(), 0, sz::arena_allocator<char> {}) == 0);
+        {
+            sz::arena nested;
+            sz::arena_scope nested_scope(nested);
+            assert(sz::arena::current() == &nested);
+        }
+        assert(sz::arena::current() == &scratch);
+    }
+    assert(sz::arena::current() == nullptr);
+
+    // Blocks return to their owning arena, even if reallocated under a different innermost scope.
+    sz::arena outer(128), inner(128);
+    sz::arena_string survivor;
+    {
+        sz::arena_scope outer_scope(outer);
+        sz::arena_string grown("some string, long enough to be allocated in the outer arena");
+        assert(outer.owns(grown.data()));
+        {
+            sz::arena_scope inner_scope(inner);
+            for (std::size_t i = 0; i != 1000; ++i) grown.push_back('a' + (i % 26));
+            assert(inner.owns(grown.data()) && !outer.owns(grown.data()));
+        }
+        survivor = grown;
+        assert(outer.owns(survivor.data()));
+    }
+    // ... or after their scope has exited, as long as the arena itself is still alive.
+    for (std::size_t i = 0; i != 1000; ++i) survivor.push_back('z');
+    assert(!outer.owns(survivor.data()) && survivor.size() == 2059 && survivor.back() == 'z');
+    {
+        sz::arena_scope outer_scope(outer);
+        sz::arena_string heap_survivor = std::move(survivor); //< Heap blocks can be freed inside scopes, too
+    }
+
+    std::size_t chunks = scratch.chunks_count();
+    scratch.reset();
+    assert(scratch.used_bytes() == 0 && scratch.chunks_count() == 1 && chunks >= 1);
+
+    sz::arena_string heap_text("some string, long enough to be allocated on the heap");
+    assert(!scratch.owns(heap_text.data()));
+}
+
 /**
  *  @brief  Tests the correctness of the string class update methods, such as `push_back` and `erase`.
  */
@@ -1071,6 +1282,11 @@ static void test_comparisons() {
     assert("a"_sz == "a"_sz);
     assert("a"_sz != "a\0"_sz);
     assert("a\0"_sz == "a\0"_sz);
+
+    // Bytes past the ASCII range must compare as unsigned, like `memcmp`
+    assert("a\x80"_sz.compare("a\x7f") == 1);
+    assert("a\xff"_sz.compare("a\x01") == 1);
+    assert("a\x01"_sz.compare("a\xff") == -1);
 }
 
 /**
@@ -1193,6 +1409,181 @@ static void test_search() {
     assert(rsplits[4] == "");
 }
 
+/**
+ *  Evaluates the correctness of case-insensitive substring search against a lowercased copy of the
+ *  haystack, comparing all of the available backends on randomly cased inputs.
+ */
+static void test_search_caseless() {
+
+    assert("Hello World"_sz.find_caseless("WORLD") == 6);
+    assert("Hello World"_sz.find_caseless("o") == 4);
+    assert("Hello World"_sz.rfind_caseless("O") == 7);
+    assert("Hello World"_sz.find_caseless("worlds") == sz::string_view::npos);
+    assert("Hello World"_sz.find_caseless("") == sz::string_view::npos);
+    assert("[@`{"_sz.find_caseless("{") == 3); // Neighbors of the letters are not folded
+    assert("[@`{"_sz.find_caseless("[") == 0);
+    assert("@"_sz.find_caseless("`") == sz::string_view::npos);
+    assert("\xC3\x80"_sz.find_caseless("\xE3\x80") == sz::string_view::npos); // Neither are non-ASCII bytes
+    assert(sz::string("Hello World").find_caseless("hello") == 0);
+    assert(sz::string("Hello World").rfind_caseless("L") == 9);
+
+    assert("a.B.c.D"_sz.find_all_caseless("b").size() == 1);
+    assert("aXbxc"_sz.split_caseless("x").size() == 3);
+    assert(*advanced("aXbxc"_sz.split_caseless("x").begin(), 1) == "b");
+    assert(*advanced("aXbxc"_sz.rsplit_caseless("X").begin(), 0) == "c");
+    assert(sz::split_caseless(sz::string_view("a--B--c"), sz::string_view("-b-")).size() == 2);
+
+    auto lowered = [](std::string text) {
+        for (char &c : text)
+            if (c >= 'A' && c <= 'Z') c = (char)(c + ('a' - 'A'));
+        return text;
+    };
+
+    // Randomized tests over a tiny alphabet with different cases of the same letters.
+    std::mt19937 &generator = global_random_generator();
+    char const alphabet[] = {'a', 'A', 'b', 'B', 'z', 'Z', '@', '`', '\xC1', '\xE1'};
+    std::uniform_int_distribution<std::size_t> length_distribution(0, 300);
+    for (std::size_t iteration = 0; iteration != 3000; ++iteration) {
+        std::string haystack(length_distribution(generator), 'a');
+        for (char &c : haystack) c = alphabet[generator() % sizeof(alphabet)];
+        std::string needle(1 + generator() % (iteration % 3 ? 4 : 80), 'a');
+        for (char &c : needle) c = alphabet[generator() % sizeof(alphabet)];
+
+        // Often take the needle from the haystack itself, toggling the case of its letters.
+        if (haystack.size() >= needle.size() && generator() % 2) {
+            needle = haystack.substr(generator() % (haystack.size() - needle.size() + 1), needle.size());
+            for (char &c : needle)
+                if ((c | 0x20) >= 'a' && (c | 0x20) <= 'z' && generator() % 2) c ^= 0x20;
+        }
+
+        std::string const haystack_lowered = lowered(haystack), needle_lowered = lowered(needle);
+        std::size_t const expected_forward = haystack_lowered.find(needle_lowered);
+        std::size_t const expected_backward = haystack_lowered.rfind(needle_lowered);
+        sz_cptr_t const h = haystack.data(), n = needle.data();
+        sz_size_t const h_length = haystack.size(), n_length = needle.size();
+        auto offset = [&](sz_cptr_t match) { return match ? (std::size_t)(match - h) : std::string::npos; };
+
+        assert(offset(sz_find_caseless_serial(h, h_length, n, n_length)) == expected_forward);
+        assert(offset(sz_rfind_caseless_serial(h, h_length, n, n_length)) == expected_backward);
+        assert(offset(sz_find_caseless(h, h_length, n, n_length)) == expected_forward);
+        assert(offset(sz_rfind_caseless(h, h_length, n, n_length)) == expected_backward);
+#define check_backend(suffix)                                                                 \
+    assert(offset(sz_find_caseless_##suffix(h, h_length, n, n_length)) == expected_forward); \
+    assert(offset(sz_rfind_caseless_##suffix(h, h_length, n, n_length)) == expected_backward);
+#if SZ_USE_X86_AVX2
+        check_backend(avx2);
+#endif
+#if SZ_USE_X86_AVX512
+        check_backend(avx512);
+#endif
+#if SZ_USE_ARM_NEON
+        check_backend(neon);
+#endif
+#undef check_backend
+    }
+}
+
+/**
+ *  @brief  Tests the bulk search kernels, exporting the offsets of all matches at once, against a brute-force
+ *          baseline, including the outputs too small to fit all of the matches.
+ */
+static void test_find_all() {
+
+    // Check the C++ interface
+    {
+        std::size_t offsets[4];
+        assert("aaaa"_sz.count("aa") == 3);
+        assert("aaaa"_sz.count("aa", sz::exclude_overlaps_type {}) == 2);
+        assert("aaaa"_sz.count("") == 0);
+        assert(sz::string("a\nb\r\nc").count(sz::newlines_set()) == 3);
+        assert("abcabcab"_sz.find_all("ab", offsets, 4) == 3 && offsets[0] == 0 && offsets[1] == 3 && offsets[2] == 6);
+        assert("abcabcab"_sz.find_all("ab", offsets, 2) == 2 && offsets[1] == 3);
+        assert("a b  c"_sz.find_all(sz::whitespaces_set(), offsets, 4) == 3 && offsets[2] == 4);
+    }
+
+    auto baseline = [](std::string const &haystack, std::string const &needle, bool allow_overlap) {
+        std::vector<sz_size_t> offsets;
+        if (needle.empty()) return offsets;
+        for (std::size_t offset = haystack.find(needle); offset != std::string::npos;
+             offset = haystack.find(needle, offset + (allow_overlap ? 1 : needle.size())))
+            offsets.push_back(offset);
+        return offsets;
+    };
+
+    // Tiny alphabets produce a lot of overlapping matches, and long haystacks cross many SIMD blocks
+    std::mt19937 &generator = global_random_generator();
+    std::vector<sz_size_t> offsets;
+    for (std::size_t iteration = 0; iteration != 3000; ++iteration) {
+        std::string haystack = random_string(generator() % (iteration % 10 ? 300 : 3000), "aab\n", 4);
+        std::string needle = random_string(1 + generator() % (iteration % 4 ? 4 : 70), "aab", 3);
+        if (haystack.size() >= needle.size() && iteration % 3 == 0)
+            needle = haystack.substr(generator() % (haystack.size() - needle.size() + 1), needle.size());
+        sz_bool_t const allow_overlap = (sz_bool_t)(iteration % 2);
+        std::vector<sz_size_t> const expected = baseline(haystack, needle, allow_overlap);
+        sz_charset_t set;
+        sz_charset_init(&set);
+        for (char c : needle) sz_charset_add(&set, c);
+        std::vector<sz_size_t> expected_chars;
+        for (std::size_t i = 0; i != haystack.size(); ++i)
+            if (sz_charset_contains(&set, haystack[i])) expected_chars.push_back(i);
+
+        // Make sure the capacity is respected in all backends, and the outputs are a prefix of the full list
+        sz_cptr_t const h = haystack.data(), n = needle.data();
+        sz_size_t const h_length = haystack.size(), n_length = needle.size();
+        sz_size_t const capacity = iteration % 3 ? haystack.size() : generator() % 10;
+        auto matches = [&](std::vector<sz_size_t> const &all, sz_size_t found) {
+            return found == sz_min_of_two(all.size(), capacity) &&
+                   std::equal(offsets.begin(), offsets.begin() + found, all.begin());
+        };
+        offsets.assign(capacity + 1, 0);
+        assert(
+            matches(expected, sz_find_all_serial(h, h_length, n, n_length, allow_overlap, offsets.data(), capacity)));
+        assert(matches(expected, sz_find_all(h, h_length, n, n_length, allow_overlap, offsets.data(), capacity)));
+        assert(matches(expected_chars, sz_find_all_charset_serial(h, h_length, &set, offsets.data(), capacity)));
+        assert(matches(expected_chars, sz_find_all_charset(h, h_length, &set, offsets.data(), capacity)));
+        assert(sz_count(h, h_length, n, n_length, allow_overlap) == expected.size());
+        assert(sz_find_all_charset(h, h_length, &set, SZ_NULL, SZ_SIZE_MAX) == expected_chars.size());
+#define check_backend(suffix)                                                                                        \
+    assert(matches(expected,                                                                                         \
+                   sz_find_all_##suffix(h, h_length, n, n_length, allow_overlap, offsets.data(), capacity)));        \
+    assert(matches(expected_chars, sz_find_all_charset_##suffix(h, h_length, &set, offsets.data(), capacity)));      \
+    assert(sz_find_all_##suffix(h, h_length, n, n_length, allow_overlap, SZ_NULL, capacity) ==                       \
+           sz_min_of_two(expected.size(), capacity));                                                                \
+    assert(sz_find_all_charset_##suffix(h, h_length, &set, SZ_NULL, SZ_SIZE_MAX) == expected_chars.size());
+#if SZ_USE_X86_AVX2
+        check_backend(avx2);
+#endif
+#if SZ_USE_X86_AVX512
+        check_backend(avx512);
+#endif
+#if SZ_USE_ARM_NEON
+        check_backend(neon);
+#endif
+#undef check_backend
+    }
+
+    // Batched searches over scattered strings, as used by the bindings, must match the individual calls
+    for (std::string const needle : {"", "a", "ab", "aab\n"}) {
+        std::vector<std::string> haystacks;
+        for (std::size_t i = 0; i != 300; ++i) haystacks.push_back(random_string(generator() % 100, "aab\n", 4));
+        std::vector<sz_string_view_t> views(haystacks.size());
+        for (std::size_t i = 0; i != haystacks.size(); ++i) views[i] = {haystacks[i].data(), haystacks[i].size()};
+        sz_sequence_t sequence;
+        sz_sequence_from_views(views.data(), views.size(), &sequence);
+
+        std::vector<sz_size_t> found(haystacks.size()), overlapping(haystacks.size()), greedy(haystacks.size());
+        sz_find_batch(&sequence, needle.data(), needle.size(), found.data());
+        sz_count_batch(&sequence, needle.data(), needle.size(), sz_true_k, overlapping.data());
+        sz_count_batch(&sequence, needle.data(), needle.size(), sz_false_k, greedy.data());
+        for (std::size_t i = 0; i != haystacks.size(); ++i) {
+            std::size_t const expected = haystacks[i].find(needle);
+            assert(found[i] == (expected == std::string::npos ? SZ_SIZE_MAX : expected));
+            assert(overlapping[i] == baseline(haystacks[i], needle, true).size());
+            assert(greedy[i] == baseline(haystacks[i], needle, false).size());
+        }
+    }
+}
+
 #if SZ_DETECT_CPP_17 && __cpp_lib_string_view
 
 /**
@@ -1384,6 +1775,232 @@ static void test_search_with_misaligned_repetitions() {
 
 #endif
 
+/**
+ *  @brief  Tests the multi-pattern matcher against a brute-force baseline, looking for the leftmost
+ *          and then the longest match among all needles, on random haystacks of different lengths.
+ */
+static void test_multi_search() {
+
+    // Check the range-based interface
+    {
+        sz::multi_matcher matcher({"he", "hell", "llo", "o"});
+        assert(matcher.size() == 4);
+        assert(matcher.find("hello") == 0);
+        std::size_t needle_index = 0;
+        assert(matcher.find("xhello", &needle_index) == 1 && needle_index == 1);
+        assert(matcher.find("xyz") == sz::multi_matcher::npos);
+        auto overlapping = matcher.find_all("hello").template to<std::vector<std::string>>();
+        assert((overlapping == std::vector<std::string> {"hell", "llo", "o"}));
+        auto disjoint = matcher.find_all("hello", sz::exclude_overlaps_type {}).template to<std::vector<std::string>>();
+        assert((disjoint == std::vector<std::string> {"hell", "o"}));
+        assert(sz::multi_matcher().find_all("hello").size() == 0);
+        assert_throws((sz::multi_matcher({"a", ""})), std::invalid_argument);
+    }
+
+    auto baseline = [](std::vector<std::string> const &needles, std::string const &haystack,
+                       std::size_t &needle_index) -> std::size_t {
+        for (std::size_t offset = 0; offset != haystack.size(); ++offset) {
+            std::size_t best_length = 0;
+            for (std::size_t i = 0; i != needles.size(); ++i)
+                if (needles[i].size() > best_length && haystack.compare(offset, needles[i].size(), needles[i]) == 0)
+                    best_length = needles[i].size(), needle_index = i;
+            if (best_length) return offset;
+        }
+        return std::string::npos;
+    };
+
+    // Stress-test the SIMD prefilters with small alphabets and many collisions
+    for (std::size_t needles_count : {1, 2, 7, 33, 200}) {
+        for (std::size_t experiment_idx = 0; experiment_idx != 20; ++experiment_idx) {
+            std::vector<std::string> needles;
+            for (std::size_t i = 0; i != needles_count; ++i)
+                needles.push_back(random_string(1 + (i + experiment_idx) % 9, "abcdefgh", 8));
+            sz::multi_matcher matcher(needles.begin(), needles.end());
+
+            std::string haystack = random_string(experiment_idx * 37 % 300, "abcdefghij", 10);
+            for (std::size_t offset = 0; offset <= haystack.size(); ++offset) {
+                std::size_t expected_index = 0, serial_index = 0, dispatched_index = 0;
+                std::size_t expected = baseline(needles, haystack.substr(offset), expected_index);
+                sz_cptr_t serial = sz_find_multi_serial(&matcher.raw(), haystack.data() + offset,
+                                                        haystack.size() - offset, &serial_index);
+                sz_cptr_t dispatched = sz_find_multi(&matcher.raw(), haystack.data() + offset,
+                                                     haystack.size() - offset, &dispatched_index);
+                if (expected == std::string::npos) {
+                    assert(serial == SZ_NULL_CHAR && dispatched == SZ_NULL_CHAR);
+                    continue;
+                }
+                assert(serial == haystack.data() + offset + expected && serial_index == expected_index);
+                assert(dispatched == haystack.data() + offset + expected && dispatched_index == expected_index);
+            }
+        }
+    }
+}
+
+/**
+ *  @brief  Tests the streaming matcher against the whole-haystack search, splitting the haystack
+ *          into random chunks, including empty ones and those shorter than the needle.
+ */
+static void test_stream_search() {
+
+    // Matches straddling the boundaries, in both overlapping and disjoint modes
+    {
+        std::vector<std::size_t> offsets;
+        auto collect = [&](std::size_t offset) { offsets.push_back(offset); };
+        sz::stream_matcher overlapping("aa");
+        assert(overlapping.feed("xa", collect) == 0);
+        assert(overlapping.feed("a", collect) == 1);
+        assert(overlapping.feed("", collect) == 0);
+        assert(overlapping.feed("ab", collect) == 1);
+        assert((offsets == std::vector<std::size_t> {1, 2}));
+        assert(overlapping.offset() == 5);
+
+        offsets.clear();
+        sz::stream_matcher disjoint("aa", sz::exclude_overlaps_type {});
+        disjoint.feed("a", collect), disjoint.feed("aa", collect), disjoint.feed("a", collect);
+        assert((offsets == std::vector<std::size_t> {0, 2}));
+        disjoint.reset();
+        assert(disjoint.offset() == 0 && disjoint.feed("aa") == 1);
+        assert_throws(sz::stream_matcher(""), std::invalid_argument);
+
+        // The boundary windows are short, and the needles may contain NUL bytes, that must not match the padding
+        assert(sz::string_view("ba\0", 3).find(sz::string_view("\0\0", 2)) == sz::string_view::npos);
+        assert(sz::string_view("\0ab", 3).rfind(sz::string_view("\0\0", 2)) == sz::string_view::npos);
+    }
+
+    std::mt19937 &generator = global_random_generator();
+    for (std::size_t needle_length : {1, 2, 3, 5, 17, 64}) {
+        for (std::size_t experiment_idx = 0; experiment_idx != 50; ++experiment_idx) {
+            std::string needle = random_string(needle_length, "ab", 2);
+            std::string haystack = random_string(generator() % 2000, "ab", 2);
+            for (bool allow_overlaps : {true, false}) {
+                std::vector<std::size_t> expected, received;
+                for (std::size_t offset = haystack.find(needle); offset != std::string::npos;
+                     offset = haystack.find(needle, offset + (allow_overlaps ? 1 : needle_length)))
+                    expected.push_back(offset);
+
+                auto collect = [&](std::size_t offset) { received.push_back(offset); };
+                sz_stream_matcher_t matcher;
+                sz_stream_matcher_init(&matcher, needle.data(), needle.size(), allow_overlaps ? sz_true_k : sz_false_k,
+                                       NULL);
+                std::size_t reported = 0;
+                for (std::size_t offset = 0; offset < haystack.size();) {
+                    // Some of the chunks will be empty or shorter than the needle.
+                    std::size_t chunk_length = std::min<std::size_t>(generator() % (needle_length * 2 + 2),
+                                                                     haystack.size() - offset);
+                    reported += sz_stream_matcher_feed(
+                        &matcher, haystack.data() + offset, chunk_length,
+                        [](void *context, sz_size_t offset) { (*reinterpret_cast<decltype(collect) *>(context))(offset); },
+                        &collect);
+                    offset += chunk_length;
+                }
+                sz_stream_matcher_free(&matcher, NULL);
+                assert(received == expected);
+                assert(reported == expected.size());
+            }
+        }
+    }
+}
+
+/**
+ *  @brief  Tests the glob-style matcher on explicit cases, and against a dynamic-programming baseline
+ *          on random patterns, mixing stars, wildcards, classes, and literals.
+ */
+static void test_glob_matcher() {
+    struct {
+        char const *pattern;
+        char const *text;
+        bool matches;
+    } explicit_cases[] = {
+        {"", "", true},
+        {"", "a", false},
+        {"*", "", true},
+        {"**", "anything", true},
+        {"?", "", false},
+        {"?", "a", true},
+        {"*.log", "server.log", true},
+        {"*.log", "server.log.gz", false},
+        {"*.log", ".log", true},
+        {"GET /api/*/users?id=*", "GET /api/v2/users?id=42", true},
+        {"GET /api/*/users?id=*", "GET /api/v2/users/id=42", true}, // `?` matches the slash
+        {"GET /api/*/users?id=*", "POST /api/v2/users?id=42", false},
+        {"a*b*c", "abc", true},
+        {"a*b*c", "acb", false},
+        {"a*b*c", "aXbYbZc", true},
+        {"a*bc*bc", "abcbc", true},
+        {"a*bc*bc", "abc", false}, // pieces can't overlap
+        {"*ab*ab*", "xabyab", true},
+        {"*ab*ab*", "xaby", false},
+        {"[abc]", "b", true},
+        {"[abc]", "d", false},
+        {"[a-z][0-9]", "q7", true},
+        {"[a-z][0-9]", "Q7", false},
+        {"[!a-z]*", "Zebra", true},
+        {"[^a-z]*", "zebra", false},
+        {"[]]", "]", true},
+        {"[!]]", "]", false},
+        {"[a-]", "-", true},
+        {"x[", "x[", true}, // unterminated class is a literal
+        {"\\*", "*", true},
+        {"\\*", "a", false},
+        {"[\\]]", "]", true},
+        {"*[0-9]", "abc5", true},
+        {"*[0-9]*", "abc", false},
+        {"*?*?*", "a", false},
+        {"*?*?*", "ab", true},
+    };
+    for (auto const &case_ : explicit_cases) {
+        sz::glob_matcher matcher(case_.pattern);
+        assert(matcher.match(case_.text) == case_.matches);
+    }
+
+    // Binary strings, including the NUL bytes
+    {
+        sz::glob_matcher matcher(sz::string_view("a\0*\0", 4));
+        assert(matcher.match(sz::string_view("a\0xyz\0", 6)));
+        assert(!matcher.match(sz::string_view("a\0xyz", 5)));
+        assert(matcher.min_length() == 3);
+        sz::glob_matcher moved(std::move(matcher));
+        assert(moved.match(sz::string_view("a\0\0", 3)) && !matcher.match(""));
+    }
+
+    // The baseline operates on a list of atoms, where an empty set stands for a star.
+    std::mt19937 &generator = global_random_generator();
+    for (std::size_t experiment_idx = 0; experiment_idx != 2000; ++experiment_idx) {
+        std::string pattern;
+        std::vector<sz::char_set> atoms;
+        std::size_t const pattern_atoms = generator() % 8;
+        for (std::size_t i = 0; i != pattern_atoms; ++i) {
+            switch (generator() % 6) {
+            case 0: pattern += '*', atoms.push_back(sz::char_set {}); break;
+            case 1: pattern += '?', atoms.push_back(sz::char_set {}.inverted()); break;
+            case 2: pattern += "[ab]", atoms.push_back(sz::char_set {"ab"}); break;
+            case 3: pattern += "[!a]", atoms.push_back(sz::char_set {"a"}.inverted()); break;
+            default: {
+                char c = "abc"[generator() % 3];
+                pattern += c, atoms.push_back(sz::char_set {c});
+            }
+            }
+        }
+        std::string text = random_string(generator() % 12, "abc", 3);
+
+        // `reachable[j]` - whether the first `i` atoms can match the first `j` bytes of text.
+        std::vector<bool> reachable(text.size() + 1, false);
+        reachable[0] = true;
+        for (auto const &atom : atoms) {
+            bool is_star = !atom.contains('a') && !atom.contains('b') && !atom.contains('c') && !atom.contains('d');
+            std::vector<bool> next(text.size() + 1, false);
+            for (std::size_t j = 0; j <= text.size(); ++j) {
+                if (is_star) next[j] = reachable[j] || (j && next[j - 1]);
+                else next[j] = j && reachable[j - 1] && atom.contains(text[j - 1]);
+            }
+            reachable = next;
+        }
+
+        sz::glob_matcher matcher(pattern);
+        assert(matcher.match(text) == reachable[text.size()]);
+    }
+}
+
 /**
  *  @brief  Tests the correctness of the string class Levenshtein distance computation,
  *          as well as the similarity scoring functions for bioinformatics-like workloads.
@@ -1471,6 +2088,512 @@ static void test_levenshtein_distances() {
             second.clear();
         }
     }
+
+    // The bit-parallel kernels cover the shorter strings up to 128 bytes, spanning one or two machine words,
+    // so let's check the lengths around those boundaries with and without the early-exit bounds.
+    for (std::size_t shorter_length : {1, 2, 63, 64, 65, 66, 127, 128, 129}) {
+        for (std::size_t iteration = 0; iteration != 20; ++iteration) {
+            std::string shorter = sz::scripts::random_string(shorter_length, "acgt", 4);
+            std::string longer = sz::scripts::random_string(shorter_length + generator() % 100, "acgt", 4);
+            std::size_t expected = levenshtein_baseline(shorter.c_str(), shorter.size(), longer.c_str(), longer.size());
+            sz::string_view shorter_view(shorter), longer_view(longer);
+            assert(sz::edit_distance(shorter_view, longer_view) == expected);
+            assert(sz::edit_distance(longer_view, shorter_view) == expected);
+            assert(sz_edit_distance_serial(shorter.data(), shorter.size(), longer.data(), longer.size(), 0, NULL) ==
+                   expected);
+            for (std::size_t bound : {1, 5, 50}) {
+                std::size_t bounded = std::min(expected, bound);
+                assert(sz::edit_distance(shorter_view, longer_view, bound) == bounded);
+                assert(sz_edit_distance_serial(shorter.data(), shorter.size(), longer.data(), longer.size(), bound,
+                                               NULL) == bounded);
+            }
+        }
+    }
+
+    // Small bounds on long strings are evaluated only within a narrow band around the main diagonal,
+    // so let's mutate a few characters of the same string to produce distances around the bound.
+    {
+        char const *runes[4] = {"a", "\xC3\xA9", "\xCE\xB2", "\xF0\xA0\x9C\x8E"}; // "a", "é", "β", "𠜎"
+        for (std::size_t iteration = 0; iteration != 100; ++iteration) {
+            std::size_t length = 130 + generator() % 300;
+            std::vector<std::size_t> original(length), mutated;
+            for (auto &rune : original) rune = generator() % 4;
+            mutated = original;
+            for (std::size_t edits = generator() % 8; edits; --edits) {
+                std::size_t position = generator() % mutated.size();
+                switch (generator() % 3) {
+                case 0: mutated[position] = generator() % 4; break;
+                case 1: mutated.erase(mutated.begin() + position); break;
+                default: mutated.insert(mutated.begin() + position, generator() % 4); break;
+                }
+            }
+
+            std::string ascii_first, ascii_second, utf8_first, utf8_second;
+            for (auto rune : original) ascii_first.push_back("acgt"[rune]), utf8_first.append(runes[rune]);
+            for (auto rune : mutated) ascii_second.push_back("acgt"[rune]), utf8_second.append(runes[rune]);
+            std::size_t expected = levenshtein_baseline(ascii_first.c_str(), ascii_first.size(), ascii_second.c_str(),
+                                                        ascii_second.size());
+            sz::string_view ascii_first_view(ascii_first), ascii_second_view(ascii_second);
+            sz::string_view utf8_first_view(utf8_first), utf8_second_view(utf8_second);
+            assert(sz::edit_distance_utf8(utf8_first_view, utf8_second_view) == expected);
+            for (std::size_t bound : {1, 2, 3, 5, 8, 20}) {
+                std::size_t bounded = std::min(expected, bound);
+                assert(sz::edit_distance(ascii_first_view, ascii_second_view, bound) == bounded);
+                assert(sz::edit_distance(ascii_second_view, ascii_first_view, bound) == bounded);
+                assert(sz::edit_distance_utf8(utf8_first_view, utf8_second_view, bound) == bounded);
+                assert(sz::edit_distance_utf8(utf8_second_view, utf8_first_view, bound) == bounded);
+            }
+        }
+    }
+
+    // Batched computations against many candidates must match the pairwise ones for every query length,
+    // including the bit-parallel kernels for queries up to 64 bytes and the odd-sized groups of candidates.
+    for (std::size_t query_length : {0, 1, 7, 63, 64, 65, 200}) {
+        std::string query = sz::scripts::random_string(query_length, "acgt", 4);
+        std::vector<std::string> candidates;
+        for (std::size_t i = 0; i != 37; ++i)
+            candidates.push_back(sz::scripts::random_string(generator() % 150, "acgt", 4));
+        candidates.push_back(query);
+        candidates.push_back(query + "a");
+
+        sz_sequence_t sequence;
+        sequence.count = candidates.size();
+        sequence.handle = &candidates;
+        sequence.get_start = [](sz_sequence_t const *seq, sz_size_t i) -> sz_cptr_t {
+            return (*reinterpret_cast<std::vector<std::string> const *>(seq->handle))[i].data();
+        };
+        sequence.get_length = [](sz_sequence_t const *seq, sz_size_t i) -> sz_size_t {
+            return (*reinterpret_cast<std::vector<std::string> const *>(seq->handle))[i].size();
+        };
+
+        for (std::size_t bound : {0, 3, 40}) {
+            std::vector<std::size_t> distances = sz::edit_distances(sz::string_view(query), candidates, bound);
+            std::vector<sz_size_t> serial_distances(candidates.size());
+            sz_edit_distances_serial(query.data(), query.size(), &sequence, bound, NULL, serial_distances.data());
+            for (std::size_t i = 0; i != candidates.size(); ++i) {
+                std::size_t expected = levenshtein_baseline(query.c_str(), query.size(), candidates[i].c_str(),
+                                                            candidates[i].size());
+                if (bound) expected = std::min(expected, bound);
+                assert(distances[i] == expected);
+                assert(serial_distances[i] == expected);
+            }
+        }
+    }
+}
+
+/**
+ *  @brief  Checks the global and local alignment scores of every backend against the serial row-by-row ones,
+ *          covering both the saturating 16-bit and the 32-bit anti-diagonal kernels, and the batched variants.
+ */
+static void test_alignment_scores() {
+    std::mt19937 &generator = global_random_generator();
+    using matrix_t = std::int8_t[256][256];
+
+    // Matches score +2, mismatches -1, like in the classic Smith-Waterman examples.
+    std::vector<std::int8_t> simple_vector(256 * 256);
+    for (std::size_t i = 0; i != 256 * 256; ++i) simple_vector[i] = (i / 256 == i % 256) ? 2 : -1;
+    matrix_t &simple = *reinterpret_cast<matrix_t *>(simple_vector.data());
+    assert(sz::local_alignment_score(sz::string_view("xxabcdyy"), sz::string_view("zzabcdzz"), simple, -1) == 8);
+    assert(sz::local_alignment_score(sz::string_view("abcd"), sz::string_view("abxcd"), simple, -1) == 7);
+    assert(sz::local_alignment_score(sz::string_view("abc"), sz::string_view("xyz"), simple, -1) == 0);
+    assert(sz::local_alignment_score(sz::string_view(""), sz::string_view("abc"), simple, -1) == 0);
+    assert(sz::alignment_score(sz::string_view("abcd"), sz::string_view("abxcd"), simple, -1) == 7);
+
+    // Random asymmetric matrices with the full range of costs, and small symmetric ones, typical for DNA.
+    std::vector<std::int8_t> wide_vector(256 * 256), narrow_vector(256 * 256);
+    std::uniform_int_distribution<int> wide_distribution(-128, 127), narrow_distribution(-3, 3);
+    for (std::size_t i = 0; i != 256 * 256; ++i) wide_vector[i] = (std::int8_t)wide_distribution(generator);
+    for (std::size_t i = 0; i != 256; ++i)
+        for (std::size_t j = 0; j <= i; ++j)
+            narrow_vector[i * 256 + j] = narrow_vector[j * 256 + i] = (std::int8_t)narrow_distribution(generator);
+    std::vector<std::int8_t> unary_vector = unary_substitution_costs();
+
+    struct {
+        std::vector<std::int8_t> const *costs;
+        char const *alphabet;
+        std::size_t cardinality;
+        bool symmetric;
+    } const configurations[] = {
+        {&unary_vector, "acgt", 4, true},
+        {&narrow_vector, "acgt", 4, true},
+        {&narrow_vector, "ACDEFGHIKLMNPQRSTVWY", 20, true},
+        {&wide_vector, "abcdefghijklmnopqrstuvwxyz", 26, false},
+    };
+    std::size_t const lengths[] = {0, 1, 3, 4, 15, 16, 17, 33, 100, 300, 1000};
+
+    for (auto const &configuration : configurations) {
+        sz_error_cost_t const *costs = reinterpret_cast<sz_error_cost_t const *>(configuration.costs->data());
+        matrix_t const &costs_matrix = *reinterpret_cast<matrix_t const *>(configuration.costs->data());
+        for (sz_error_cost_t gap : {-1, -4, -128, 0, 3}) {
+            for (std::size_t first_length : lengths) {
+                std::size_t second_length = lengths[generator() % (sizeof(lengths) / sizeof(lengths[0]))];
+                std::string first = sz::scripts::random_string(first_length, configuration.alphabet,
+                                                               configuration.cardinality);
+                std::string second = sz::scripts::random_string(second_length, configuration.alphabet,
+                                                                configuration.cardinality);
+                // Make the strings similar, to produce long positive stretches for the local alignment.
+                if (first_length && second_length && (generator() & 1))
+                    second.replace(0, std::min(first_length, second_length) / 2, first, 0,
+                                   std::min(first_length, second_length) / 2);
+
+                sz_ssize_t global_expected = sz_alignment_score_serial(first.data(), first.size(), second.data(),
+                                                                       second.size(), costs, gap, NULL);
+                sz_ssize_t local_expected = sz_local_alignment_score_serial(first.data(), first.size(), second.data(),
+                                                                            second.size(), costs, gap, NULL);
+                assert(local_expected >= 0);
+                assert(gap > 0 || local_expected >= global_expected);
+                assert(sz::local_alignment_score(sz::string_view(first), sz::string_view(second), costs_matrix,
+                                                 gap) == local_expected);
+                assert(sz::alignment_score(sz::string_view(first), sz::string_view(second), costs_matrix, gap) ==
+                       global_expected);
+#if SZ_USE_X86_AVX512
+                // The row-wise AVX-512 kernel picks the substitution costs in a different order, only equivalent
+                // for symmetric matrices.
+                if (configuration.symmetric)
+                    assert(sz_alignment_score_avx512(first.data(), first.size(), second.data(), second.size(), costs,
+                                                     gap, NULL) == global_expected);
+#endif
+#if SZ_USE_X86_AVX2
+                assert(sz_alignment_score_avx2(first.data(), first.size(), second.data(), second.size(), costs, gap,
+                                               NULL) == global_expected);
+                assert(sz_local_alignment_score_avx2(first.data(), first.size(), second.data(), second.size(), costs,
+                                                     gap, NULL) == local_expected);
+#endif
+#if SZ_USE_ARM_NEON
+                assert(sz_alignment_score_neon(first.data(), first.size(), second.data(), second.size(), costs, gap,
+                                               NULL) == global_expected);
+                assert(sz_local_alignment_score_neon(first.data(), first.size(), second.data(), second.size(), costs,
+                                                     gap, NULL) == local_expected);
+#endif
+            }
+
+            // Batched computations against many candidates must match the pairwise ones, with the query
+            // being both the longer and the shorter argument.
+            std::string query = sz::scripts::random_string(generator() % 300, configuration.alphabet,
+                                                           configuration.cardinality);
+            std::vector<std::string> candidates;
+            for (std::size_t i = 0; i != 13; ++i)
+                candidates.push_back(sz::scripts::random_string(generator() % 400, configuration.alphabet,
+                                                                configuration.cardinality));
+            candidates.push_back(query);
+            candidates.push_back("");
+            for (bool local : {false, true}) {
+                std::vector<std::ptrdiff_t> scores =
+                    sz::alignment_scores(sz::string_view(query), candidates, costs_matrix, gap, local);
+                for (std::size_t i = 0; i != candidates.size(); ++i) {
+                    auto pairwise = local ? sz_local_alignment_score_serial : sz_alignment_score_serial;
+                    assert(scores[i] == pairwise(query.data(), query.size(), candidates[i].data(),
+                                                 candidates[i].size(), costs, gap, NULL));
+                }
+            }
+        }
+    }
+}
+
+/**
+ *  @brief  Checks that every hashing backend produces the same results, for all lengths around the
+ *          16-byte short-string threshold and the 64-byte stripes, as well as misaligned inputs.
+ */
+static void test_hashing() {
+    std::mt19937 &generator = global_random_generator();
+    std::vector<std::string> strings;
+    for (std::size_t length = 0; length != 300; ++length) {
+        std::string text(length + 1, '\0');
+        for (char &c : text) c = (char)(generator() & 0xFF);
+        strings.push_back(text.substr(0, length));
+        strings.push_back(text.substr(1, length)); // Misaligned copy
+
+        sz_u64_t expected = sz_hash_serial(text.data() + 1, length);
+        assert(sz_hash(text.data() + 1, length) == expected);
+#if SZ_USE_X86_AVX2
+        assert(sz_hash_avx2(text.data() + 1, length) == expected);
+#endif
+#if SZ_USE_X86_AVX512
+        assert(sz_hash_avx512(text.data() + 1, length) == expected);
+#endif
+#if SZ_USE_ARM_NEON
+        assert(sz_hash_neon(text.data() + 1, length) == expected);
+#endif
+        assert(sz::string_view(text.data() + 1, length).hash() == expected);
+    }
+
+    // Batched hashing must match the individual results, mixing short and long keys in the same lane groups.
+    std::vector<std::uint64_t> batch = sz::hash_batch(strings);
+    for (std::size_t i = 0; i != strings.size(); ++i)
+        assert(batch[i] == sz_hash_serial(strings[i].data(), strings[i].size()));
+    std::vector<sz::string_view> short_keys;
+    for (std::string const &key : strings)
+        if (key.size() <= 16) short_keys.push_back(key);
+    batch = sz::hash_batch(short_keys);
+    for (std::size_t i = 0; i != short_keys.size(); ++i)
+        assert(batch[i] == sz_hash_serial(short_keys[i].data(), short_keys[i].size()));
+
+    // Trailing zeros, single-bit flips, and permuted stripes must all change the hash.
+    std::unordered_map<sz_u64_t, std::string> seen;
+    auto expect_unique = [&](std::string const &text) {
+        auto inserted = seen.emplace(sz_hash_serial(text.data(), text.size()), text);
+        assert(inserted.second || inserted.first->second == text);
+    };
+    for (std::size_t length = 0; length != 20; ++length) expect_unique(std::string(length, '\0'));
+    for (std::size_t first = 0; first != 256; ++first)
+        for (std::size_t second = 0; second != 256; ++second) expect_unique({(char)first, (char)second});
+    std::string base = random_string(1000, "abcdefghijklmnopqrstuvwxyz", 26);
+    for (std::size_t bit = 0; bit < base.size() * 8; bit += 7) {
+        std::string flipped = base;
+        flipped[bit / 8] ^= (char)(1 << (bit % 8));
+        expect_unique(flipped);
+    }
+    for (std::size_t stripe = 64; stripe + 64 <= base.size(); stripe += 64) {
+        std::string permuted = base.substr(stripe, 64) + base.substr(0, stripe) + base.substr(stripe + 64);
+        expect_unique(permuted);
+    }
+
+    // Rolling hashes of all backends must report the same windows for every step, in any order,
+    // each starting at the reported offset and matching the hash of that window computed from scratch.
+    struct rolling_t {
+        sz_cptr_t start;
+        std::vector<std::pair<std::size_t, sz_u64_t>> windows;
+        static void append(sz_cptr_t window, sz_size_t, sz_u64_t hash, void *handle) {
+            rolling_t &rolling = *reinterpret_cast<rolling_t *>(handle);
+            rolling.windows.emplace_back(static_cast<std::size_t>(window - rolling.start), hash);
+        }
+    };
+    auto rolling_hashes = [](sz_hashes_t function, std::string const &text, std::size_t window_length,
+                             std::size_t step) {
+        rolling_t rolling;
+        rolling.start = text.data();
+        function(text.data(), text.size(), window_length, step, &rolling_t::append, &rolling);
+        std::sort(rolling.windows.begin(), rolling.windows.end());
+        return rolling.windows;
+    };
+    for (std::size_t length : {0, 1, 7, 31, 64, 100, 257, 1000, 4099})
+        for (std::size_t window_length : {1, 2, 3, 7, 8, 16, 33, 100})
+            for (std::size_t step : {1, 2, 4, 16}) {
+                std::string text(length, '\0');
+                for (char &c : text) c = (char)(generator() & 0xFF);
+                auto expected = rolling_hashes(sz_hashes_serial, text, window_length, step);
+                assert(expected.size() == (length >= window_length ? (length - window_length) / step + 1 : 0));
+                for (std::size_t i = 0; i != expected.size(); ++i) {
+                    assert(expected[i].first == i * step);
+                    if (length > 300) continue;
+                    auto from_scratch = rolling_hashes(sz_hashes_serial, text.substr(i * step, window_length),
+                                                       window_length, 1);
+                    assert(from_scratch.size() == 1 && from_scratch[0].second == expected[i].second);
+                }
+                assert(rolling_hashes(sz_hashes, text, window_length, step) == expected);
+#if SZ_USE_X86_AVX2
+                assert(rolling_hashes(sz_hashes_avx2, text, window_length, step) == expected);
+#endif
+#if SZ_USE_X86_AVX512
+                assert(rolling_hashes(sz_hashes_avx512, text, window_length, step) == expected);
+#endif
+#if SZ_USE_ARM_NEON
+                assert(rolling_hashes(sz_hashes_neon, text, window_length, step) == expected);
+#endif
+#if SZ_USE_ARM_SVE
+                assert(rolling_hashes(sz_hashes_sve, text, window_length, step) == expected);
+#endif
+            }
+}
+
+/**
+ *  @brief  Cross-checks the MinHash kernels of all available backends against a reference built on top of the
+ *          `sz_hashes` callback, and checks that the banded LSH index finds near-duplicates but not strangers.
+ */
+static void test_minhash() {
+    struct reference_t {
+        std::vector<sz_u64_t> hashes;
+        static void append(sz_cptr_t, sz_size_t, sz_u64_t hash, void *handle) {
+            reinterpret_cast<reference_t *>(handle)->hashes.push_back(hash);
+        }
+    };
+
+    auto check = [](std::string const &text, std::size_t window_length, std::size_t count) {
+        reference_t reference;
+        sz_hashes_serial(text.data(), text.size(), window_length, 1, &reference_t::append, &reference);
+        std::vector<sz_u32_t> expected(count, 0xFFFFFFFFu);
+        for (std::size_t i = 0; i != count; ++i) {
+            sz_u32_t multiplier_low, multiplier_high;
+            sz_u64_t addend;
+            _sz_hashes_minhash_seeds(i, &multiplier_low, &multiplier_high, &addend);
+            for (sz_u64_t hash : reference.hashes) {
+                sz_u64_t mixed = (hash & 0xFFFFFFFFu) * multiplier_low + (hash >> 32) * multiplier_high + addend;
+                expected[i] = std::min(expected[i], (sz_u32_t)(mixed >> 32));
+            }
+        }
+
+        std::vector<sz_u32_t> received(count + 1, 0xABCDu);
+        sz_hashes_minhash_serial(text.data(), text.size(), window_length, count, received.data());
+        assert(std::equal(expected.begin(), expected.end(), received.begin()) && received[count] == 0xABCDu);
+        sz_hashes_minhash(text.data(), text.size(), window_length, count, received.data());
+        assert(std::equal(expected.begin(), expected.end(), received.begin()) && received[count] == 0xABCDu);
+#if SZ_USE_X86_AVX2
+        sz_hashes_minhash_avx2(text.data(), text.size(), window_length, count, received.data());
+        assert(std::equal(expected.begin(), expected.end(), received.begin()) && received[count] == 0xABCDu);
+#endif
+#if SZ_USE_X86_AVX512
+        sz_hashes_minhash_avx512(text.data(), text.size(), window_length, count, received.data());
+        assert(std::equal(expected.begin(), expected.end(), received.begin()) && received[count] == 0xABCDu);
+#endif
+#if SZ_USE_ARM_NEON
+        sz_hashes_minhash_neon(text.data(), text.size(), window_length, count, received.data());
+        assert(std::equal(expected.begin(), expected.end(), received.begin()) && received[count] == 0xABCDu);
+#endif
+    };
+
+    // Cover the empty inputs, the windows longer than the text, the odd signature tails of every backend,
+    // and the texts spanning several batches of buffered rolling hashes.
+    for (std::size_t length : {0, 1, 4, 5, 63, 64, 300, 1000})
+        for (std::size_t window_length : {0, 1, 3, 5, 8, 64, 100})
+            for (std::size_t count : {0, 1, 3, 7, 8, 9, 16, 17, 33, 100}) {
+                std::string text = random_string(length, "abcdefghijklmnopqrstuvwxyz", 26);
+                check(text, window_length, count);
+            }
+
+    // Near-duplicates must share many signatures and end up as LSH candidates, while unrelated texts must not.
+    constexpr std::size_t bands = 16, rows_per_band = 4, count = bands * rows_per_band;
+    std::vector<std::string> documents;
+    for (std::size_t i = 0; i != 100; ++i) documents.push_back(random_string(2000, "abcdefghijklmnopqrstuvwxyz", 26));
+    sz::lsh_index index(bands, rows_per_band);
+    assert(index.signature_length() == count && index.empty());
+    for (std::size_t i = 0; i != documents.size(); ++i)
+        index.insert(sz::hashes_minhash<count>(sz::string_view(documents[i]), 5).data(), i);
+    assert(index.size() == documents.size());
+
+    for (std::size_t i = 0; i != documents.size(); ++i) {
+        std::string edited = documents[i];
+        edited.replace(100, 10, "0123456789");
+        std::array<std::uint32_t, count> signature = sz::hashes_minhash<count>(sz::string_view(edited), 5);
+        std::vector<sz::lsh_index::id_type> candidates = index.candidates(signature.data());
+        assert(candidates.size() == 1 && candidates[0] == i);
+    }
+    std::string stranger = random_string(2000, "0123456789", 10);
+    assert(index.candidates(sz::hashes_minhash<count>(sz::string_view(stranger), 5).data()).empty());
+    index.clear();
+    assert(index.empty());
+    assert(index.candidates(sz::hashes_minhash<count>(sz::string_view(documents[0]), 5).data()).empty());
+}
+
+/**
+ *  Cross-checks the UTF8 validation, counting, decoding, and indexing kernels of all available backends,
+ *  shifting every input across the 16-, 32-, and 64-byte block boundaries of the vectorized ones.
+ */
+static void test_utf8() {
+    struct {
+        char const *text;
+        bool valid;
+    } explicit_cases[] = {
+        {"", true},
+        {"abc", true},
+        {"\xC3\xA9", true},                 // "é", 2 bytes
+        {"\xE2\x82\xAC", true},             // "€", 3 bytes
+        {"\xF0\x9F\x98\x80", true},         // "😀", 4 bytes
+        {"\xED\x9F\xBF\xEE\x80\x80", true}, // U+D7FF and U+E000 around the surrogates
+        {"\xF4\x8F\xBF\xBF", true},         // U+10FFFF, the largest codepoint
+        {"\x80", false},                    // stray continuation byte
+        {"a\xC3\xA9\xA9", false},           // extra continuation byte
+        {"\xC3", false},                    // truncated 2-byte rune
+        {"\xE2\x82", false},                // truncated 3-byte rune
+        {"\xF0\x9F\x98", false},            // truncated 4-byte rune
+        {"\xC3" "a", false},                // missing continuation byte
+        {"\xC0\x80", false},                // overlong 2-byte "\0"
+        {"\xE0\x80\xAF", false},            // overlong 3-byte "/"
+        {"\xF0\x80\x80\xAF", false},        // overlong 4-byte "/"
+        {"\xED\xA0\x80", false},            // UTF16 surrogate U+D800
+        {"\xF4\x90\x80\x80", false},        // U+110000
+        {"\xF8\x88\x80\x80\x80", false},    // 5-byte sequences aren't allowed
+    };
+
+    auto check_text = [](std::string const &text) {
+        sz_cptr_t data = text.data();
+        sz_size_t length = text.size();
+        sz_bool_t valid = sz_utf8_validate_serial(data, length);
+        sz_size_t count = sz_utf8_count_serial(data, length);
+        std::vector<sz_rune_t> expected(length + 1), received(length + 1);
+        assert(sz_utf8_to_utf32_serial(data, length, expected.data()) == count);
+        assert(sz_utf8_validate(data, length) == valid);
+        assert(sz_utf8_count(data, length) == count);
+        assert(sz_utf8_to_utf32(data, length, received.data()) == count);
+        assert(std::equal(expected.begin(), expected.begin() + count, received.begin()));
+        for (sz_size_t n = 0; n <= count; ++n) {
+            sz_cptr_t nth = sz_utf8_find_nth_serial(data, length, n);
+            assert(n == count ? nth == NULL : nth != NULL);
+            assert(sz_utf8_find_nth(data, length, n) == nth);
+        }
+#define check_backend(suffix)                                                                     \
+    assert(sz_utf8_validate_##suffix(data, length) == valid);                                     \
+    assert(sz_utf8_count_##suffix(data, length) == count);                                        \
+    assert(sz_utf8_to_utf32_##suffix(data, length, received.data()) == count);                    \
+    assert(std::equal(expected.begin(), expected.begin() + count, received.begin()));             \
+    for (sz_size_t n = 0; n <= count; n += 1 + n / 8)                                             \
+        assert(sz_utf8_find_nth_##suffix(data, length, n) == sz_utf8_find_nth_serial(data, length, n));
+#if SZ_USE_X86_AVX2
+        check_backend(avx2);
+#endif
+#if SZ_USE_X86_AVX512
+        check_backend(avx512);
+#endif
+#if SZ_USE_ARM_NEON
+        check_backend(neon);
+#endif
+#undef check_backend
+        return valid == sz_true_k;
+    };
+
+    for (auto explicit_case : explicit_cases)
+        for (std::size_t prefix : {0, 1, 13, 14, 15, 29, 30, 31, 32, 61, 62, 63, 64, 100})
+            for (std::size_t suffix : {0, 1, 2, 3, 17, 70}) {
+                std::string text = std::string(prefix, 'a') + explicit_case.text + std::string(suffix, 'z');
+                assert(check_text(text) == explicit_case.valid);
+            }
+
+    // Randomized tests, mixing runes of different lengths, and then corrupting them.
+    std::mt19937 &generator = global_random_generator();
+    std::uniform_int_distribution<std::size_t> length_distribution(0, 300);
+    sz_rune_t const rune_ranges[4][2] = {{0, 0x7F}, {0x80, 0x7FF}, {0x800, 0xFFFF}, {0x10000, 0x10FFFF}};
+    for (std::size_t iteration = 0; iteration != 1000; ++iteration) {
+        std::string text;
+        std::vector<sz_rune_t> runes;
+        std::size_t const runes_count = length_distribution(generator);
+        std::size_t const ranges_mask = 1 + generator() % 15; // Which rune lengths to sample from
+        while (runes.size() != runes_count) {
+            std::size_t range = generator() % 4;
+            if (!(ranges_mask & (1u << range))) continue;
+            sz_rune_t rune = rune_ranges[range][0] + generator() % (rune_ranges[range][1] - rune_ranges[range][0] + 1);
+            if (rune >= 0xD800 && rune <= 0xDFFF) continue; // Skip the surrogates
+            runes.push_back(rune);
+            if (rune < 0x80) { text.push_back((char)rune); }
+            else if (rune < 0x800) {
+                text.push_back((char)(0xC0 | (rune >> 6)));
+                text.push_back((char)(0x80 | (rune & 0x3F)));
+            }
+            else if (rune < 0x10000) {
+                text.push_back((char)(0xE0 | (rune >> 12)));
+                text.push_back((char)(0x80 | ((rune >> 6) & 0x3F)));
+                text.push_back((char)(0x80 | (rune & 0x3F)));
+            }
+            else {
+                text.push_back((char)(0xF0 | (rune >> 18)));
+                text.push_back((char)(0x80 | ((rune >> 12) & 0x3F)));
+                text.push_back((char)(0x80 | ((rune >> 6) & 0x3F)));
+                text.push_back((char)(0x80 | (rune & 0x3F)));
+            }
+        }
+
+        assert(check_text(text));
+        std::vector<sz_rune_t> decoded(text.size() + 1);
+        assert(sz_utf8_to_utf32(text.data(), text.size(), decoded.data()) == runes.size());
+        assert(std::equal(runes.begin(), runes.end(), decoded.begin()));
+        if (text.empty()) continue;
+
+        // The corrupted strings must be handled identically by all backends, even if they aren't necessarily invalid.
+        for (std::size_t corruption = 0; corruption != 4; ++corruption) {
+            std::string corrupted = text;
+            corrupted[generator() % corrupted.size()] = (char)(generator() & 0xFF);
+            check_text(corrupted);
+            check_text(corrupted.substr(0, generator() % corrupted.size()));
+        }
+    }
 }
 
 /**
@@ -1501,6 +2624,69 @@ void test_replacements(std::size_t lookup_tables_to_try = 128, std::size_t slice
             }
         }
     }
+
+    // Compare all the backends on short and misaligned inputs, both into a separate buffer and in-place.
+    std::string expected, in_place;
+    for (std::size_t lookup_table_variation = 0; lookup_table_variation != 16; ++lookup_table_variation) {
+        sz::look_up_table lut;
+        for (std::size_t i = 0; i < 256; i++) lut[(char)i] = (char)(std::rand() % 256);
+        sz_cptr_t const table = lut.raw();
+
+        for (std::size_t slice_length = 0; slice_length <= 300; slice_length += 1 + slice_length / 16) {
+            std::size_t const slice_offset = std::rand() % 64;
+            sz_cptr_t const source = body.data() + slice_offset;
+            sz_ptr_t const target = &transformed[0] + slice_offset;
+            expected.resize(slice_length);
+            sz_look_up_transform_serial(source, slice_length, table, &expected[0]);
+            for (std::size_t i = 0; i != slice_length; ++i) assert(expected[i] == lut[source[i]]);
+
+#define check_backend(suffix)                                                         \
+    sz_look_up_transform_##suffix(source, slice_length, table, target);                \
+    assert(std::memcmp(target, expected.data(), slice_length) == 0);                   \
+    in_place.assign(source, slice_length);                                             \
+    sz_look_up_transform_##suffix(in_place.data(), slice_length, table, &in_place[0]); \
+    assert(in_place == expected);
+            check_backend(serial);
+#if SZ_USE_X86_AVX2
+            check_backend(avx2);
+#endif
+#if SZ_USE_X86_AVX512
+            check_backend(avx512);
+#endif
+#if SZ_USE_ARM_NEON
+            check_backend(neon);
+#endif
+#if SZ_USE_ARM_SVE
+            check_backend(sve);
+#endif
+#undef check_backend
+        }
+    }
+
+    // Case mappings are table look-ups as well, so compare them against the per-character helpers.
+    std::string lowered(body.size(), '\0'), upped(body.size(), '\0'), asciied(body.size(), '\0');
+    sz_tolower(body.data(), body.size(), &lowered[0]);
+    sz_toupper(body.data(), body.size(), &upped[0]);
+    sz_toascii(body.data(), body.size(), &asciied[0]);
+    for (std::size_t i = 0; i != body.size(); ++i) {
+        unsigned char const c = (unsigned char)body[i];
+        bool const is_latin1_upper = c >= 0xC0 && c <= 0xDE && c != 0xD7;
+        bool const is_latin1_lower = c >= 0xE0 && c <= 0xFE && c != 0xF7;
+        unsigned char const expected_lower = (c >= 'A' && c <= 'Z') || is_latin1_upper ? c + 32 : c;
+        unsigned char const expected_upper = (c >= 'a' && c <= 'z') || is_latin1_lower ? c - 32 : c;
+        assert((unsigned char)lowered[i] == expected_lower);
+        assert((unsigned char)upped[i] == expected_upper);
+        assert((unsigned char)asciied[i] == (c & 0x7F));
+    }
+
+    // The same conversions in-place, through the C++ wrappers.
+    std::string text = "Hello, World! \xC0\xE0\xD7\xF7\xDF\xFF";
+    sz::to_lower(sz::string_span(&text[0], text.size()));
+    assert(text == "hello, world! \xE0\xE0\xD7\xF7\xDF\xFF");
+    sz::to_upper(sz::string_span(&text[0], text.size()));
+    assert(text == "HELLO, WORLD! \xC0\xC0\xD7\xF7\xDF\xFF");
+    sz_toascii(text.data(), text.size(), &text[0]);
+    assert(text == "HELLO, WORLD! \x40\x40\x57\x77\x5F\x7F");
 }
 
 /**
@@ -1528,6 +2714,158 @@ static void test_sequence_algorithms() {
             for (std::size_t i = 1; i != dataset_size; ++i) { assert(dataset[order[i - 1]] <= dataset[order[i]]); }
         }
     }
+
+    // Long shared prefixes, exhausted keys, and embedded zeros go through multiple rounds of radix partitioning.
+    for (std::size_t prefix_length : {0, 3, 4, 7, 40, 1500}) {
+        strs_t dataset;
+        std::string prefix = sz::scripts::random_string(prefix_length, "ab", 2);
+        for (std::size_t i = 0; i != 3000; ++i)
+            dataset.push_back(prefix.substr(0, prefix_length - i % 3 * (prefix_length / 3)) +
+                              sz::scripts::random_string(i % 11, "ab\0", 3));
+        std::shuffle(dataset.begin(), dataset.end(), global_random_generator());
+        auto order = sz::sorted_order(dataset);
+        for (std::size_t i = 1; i != dataset.size(); ++i) { assert(dataset[order[i - 1]] <= dataset[order[i]]); }
+    }
+
+    // Partial sorts must produce the same top-k, as the full ones, and keep all of the other indices.
+    for (std::size_t prefix_length : {0, 5, 40}) {
+        strs_t dataset;
+        std::string prefix = sz::scripts::random_string(prefix_length, "ab", 2);
+        for (std::size_t i = 0; i != 5000; ++i)
+            dataset.push_back(prefix + sz::scripts::random_string(i % 13, "abc", 3));
+        std::shuffle(dataset.begin(), dataset.end(), global_random_generator());
+        strs_t sorted = dataset;
+        std::sort(sorted.begin(), sorted.end());
+        for (std::size_t k : {0, 1, 2, 17, 100, 4999, 5000, 6000}) {
+            order_t order = sz::partial_sorted_order(dataset, k);
+            assert(order.size() == sz_min_of_two(k, dataset.size()));
+            for (std::size_t i = 0; i != order.size(); ++i) assert(dataset[order[i]] == sorted[i]);
+
+            order_t full_order(dataset.size());
+            sz::partial_sorted_order(dataset.data(), dataset.data() + dataset.size(), full_order.data(), k,
+                                     [](std::string const &s) -> sz::string_view { return s; });
+            assert(std::equal(order.begin(), order.end(), full_order.begin()));
+            std::sort(full_order.begin(), full_order.end());
+            for (std::size_t i = 0; i != full_order.size(); ++i) assert(full_order[i] == i);
+        }
+    }
+
+    // Parallel sorting must produce exactly the same permutation, including the order of duplicates.
+    for (std::size_t dataset_size : {100000, 300000}) {
+        strs_t dataset;
+        for (std::size_t i = 0; i != dataset_size; ++i)
+            dataset.push_back(sz::scripts::random_string(i % 9, "abcd", 4));
+        std::shuffle(dataset.begin(), dataset.end(), global_random_generator());
+
+        auto serial_order = sz::sorted_order(dataset);
+        for (std::size_t threads : {2, 3, 16}) assert(sz::sorted_order(dataset, threads) == serial_order);
+
+        // User-supplied executor, running the tasks in reverse order on the calling thread.
+        auto reverse_executor = [](void *, sz_parallel_task_t task, void *context, sz_size_t tasks_count) {
+            for (sz_size_t i = tasks_count; i != 0; --i) task(context, i - 1);
+        };
+        order_t custom_order(dataset_size);
+        sz::sorted_order(
+            dataset.data(), dataset.data() + dataset_size, custom_order.data(),
+            [](std::string const &s) -> sz::string_view { return s; }, +reverse_executor, nullptr);
+        assert(custom_order == serial_order);
+    }
+
+    // Gathering into tapes must preserve the contents, the order, and produce the same offsets on any thread count.
+    {
+        strs_t dataset;
+        for (std::size_t i = 0; i != 20000; ++i)
+            dataset.push_back(sz::scripts::random_string(i % 601, "abcd", 4));
+        std::shuffle(dataset.begin(), dataset.end(), global_random_generator());
+
+        std::string tape;
+        std::vector<std::uint64_t> offsets = sz::gather_tape(dataset, tape);
+        assert(offsets.size() == dataset.size() + 1 && offsets.back() == tape.size());
+        for (std::size_t i = 0; i != dataset.size(); ++i)
+            assert(tape.substr(offsets[i], offsets[i + 1] - offsets[i]) == dataset[i]);
+        for (std::size_t threads : {2, 3, 16}) {
+            std::string parallel_tape;
+            assert(sz::gather_tape(dataset, parallel_tape, threads) == offsets && parallel_tape == tape);
+        }
+
+        // Gather the tape once more in the sorted order, using the C interface and a custom executor.
+        auto reverse_executor = [](void *, sz_parallel_task_t task, void *context, sz_size_t tasks_count) {
+            for (sz_size_t i = tasks_count; i != 0; --i) task(context, i - 1);
+        };
+        order_t order = sz::sorted_order(dataset);
+        sz_sequence_t sequence;
+        sz_sequence_tape_t source;
+        sz_sequence_from_u64tape(&source, tape.data(), reinterpret_cast<sz_u64_t const *>(offsets.data()),
+                                 dataset.size(), &sequence);
+        sequence.order = order.data();
+        std::vector<std::uint32_t> sorted_offsets(dataset.size() + 1);
+        std::string sorted_tape(sz_sequence_to_u32tape(&sequence, sorted_offsets.data(), NULL, NULL, NULL), '\0');
+        assert(sorted_tape.size() == tape.size());
+        sz_sequence_to_u32tape(&sequence, sorted_offsets.data(), &sorted_tape[0], +reverse_executor, NULL);
+        for (std::size_t i = 0; i != dataset.size(); ++i)
+            assert(sorted_tape.substr(sorted_offsets[i], sorted_offsets[i + 1] - sorted_offsets[i]) ==
+                   dataset[order[i]]);
+    }
+
+    // Apache Arrow layouts are addressed in place: tapes, offsets, validity bitmaps, and string views.
+    {
+        char const tape[] = "bananaapplecherry-with-a-long-tail";
+        std::uint32_t const offsets32[] = {0, 6, 11, 34, 34};
+        std::uint64_t const offsets64[] = {0, 6, 11, 34, 34};
+        strs_t expected = {"banana", "apple", "cherry-with-a-long-tail", ""};
+        auto check = [&](sz_sequence_t &sequence, std::size_t first) {
+            assert(sequence.count == expected.size() - first);
+            for (std::size_t i = 0; i != sequence.count; ++i)
+                assert(std::string(sequence.get_start(&sequence, i), sequence.get_length(&sequence, i)) ==
+                       expected[first + i]);
+        };
+
+        sz_sequence_t sequence;
+        sz_sequence_tape_t tape32, tape64;
+        sz_sequence_from_u32tape(&tape32, tape, offsets32, 4, &sequence);
+        check(sequence, 0);
+        sz_sequence_from_u64tape(&tape64, tape, offsets64, 4, &sequence);
+        check(sequence, 0);
+
+        // Arrow arrays with an offset of one, and the last element marked as null.
+        std::uint8_t const validity = 0x07;
+        void const *buffers[3] = {&validity, offsets32, tape};
+        struct ArrowArray array;
+        std::memset(&array, 0, sizeof(array));
+        array.length = 3, array.offset = 1, array.n_buffers = 3, array.buffers = buffers;
+        array.release = [](struct ArrowArray *) {};
+        assert(sz_sequence_from_arrow("u", &array, &sequence) == sz_true_k);
+        check(sequence, 1);
+        buffers[1] = offsets64;
+        assert(sz_sequence_from_arrow("Z", &array, &sequence) == sz_true_k);
+        check(sequence, 1);
+        assert(sz_sequence_from_arrow("i", &array, &sequence) == sz_false_k);
+        assert(sz_sequence_from_arrow("uu", &array, &sequence) == sz_false_k);
+
+        // The same strings as views, with the longest one in a variadic buffer.
+        char views[4][16] = {};
+        for (std::size_t i = 0; i != 4; ++i) {
+            std::int32_t length = (std::int32_t)expected[i].size();
+            std::memcpy(views[i], &length, 4);
+            if (length <= 12) { std::memcpy(views[i] + 4, expected[i].data(), length); continue; }
+            std::int32_t buffer_index = 0, offset = 11;
+            std::memcpy(views[i] + 4, tape + offset, 4);
+            std::memcpy(views[i] + 8, &buffer_index, 4);
+            std::memcpy(views[i] + 12, &offset, 4);
+        }
+        std::int64_t const variadic_sizes[1] = {sizeof(tape) - 1};
+        void const *view_buffers[4] = {nullptr, views, tape, variadic_sizes};
+        array.length = 4, array.offset = 0, array.n_buffers = 4, array.buffers = view_buffers;
+        assert(sz_sequence_from_arrow("vu", &array, &sequence) == sz_true_k);
+        check(sequence, 0);
+
+        // Sorting the Arrow column only needs the order array.
+        order_t order(4);
+        for (std::size_t i = 0; i != 4; ++i) order[i] = i;
+        sequence.order = order.data();
+        sz_sort(&sequence);
+        assert(order == order_t({3u, 1u, 0u, 2u}));
+    }
 }
 
 /**
@@ -1545,6 +2883,206 @@ static void test_stl_containers() {
     assert(words_stl.empty());
 }
 
+/**
+ *  @brief  Tests the open-addressing string map and set against `std::unordered_map`.
+ */
+static void test_string_maps() {
+    sz::string_map<int> words;
+    assert(words.empty() && words.find("missing") == words.end());
+    assert(words.erase("missing") == 0);
+
+    // Basic updates, including the empty key.
+    words["hello"] = 1;
+    words["world"] = 2;
+    words[""] = 3;
+    assert(words.size() == 3 && words.at("hello") == 1 && words.at("") == 3);
+    assert(!words.try_emplace("hello", 42).second && words["hello"] == 1);
+    assert(!words.insert_or_assign("hello", 42).second && words["hello"] == 42);
+    assert(words.contains("world") && !words.contains("worlds") && words.count("") == 1);
+    assert(words.erase("world") == 1 && !words.contains("world") && words.size() == 2);
+    bool threw = false;
+    try {
+        words.at("world");
+    }
+    catch (std::out_of_range const &) {
+        threw = true;
+    }
+    assert(threw);
+
+    // The keys are copied, so the original strings may be freed.
+    {
+        std::string temporary = "temporary key, long enough to not fit into any buffer";
+        words[temporary] = 4;
+    }
+    assert(words.at("temporary key, long enough to not fit into any buffer") == 4);
+
+    // Random workload with many rehashes and tombstones, compared to the STL.
+    std::mt19937 &generator = global_random_generator();
+    std::unordered_map<std::string, int> expected;
+    sz::string_map<int> actual;
+    for (std::size_t iteration = 0; iteration != 20000; ++iteration) {
+        std::string key = random_string(generator() % 12, "abcd", 4);
+        switch (generator() % 4) {
+        case 0:
+        case 1:
+            expected[key] += (int)iteration;
+            actual[key] += (int)iteration;
+            break;
+        case 2: assert(expected.erase(key) == actual.erase(key)); break;
+        case 3: {
+            auto expected_it = expected.find(key);
+            auto actual_it = actual.find(key);
+            assert((expected_it == expected.end()) == (actual_it == actual.end()));
+            if (actual_it != actual.end()) assert(actual_it->second == expected_it->second);
+        } break;
+        }
+        assert(actual.size() == expected.size());
+    }
+    std::size_t visited = 0;
+    for (auto const &entry : actual) {
+        assert(expected.at(std::string(entry.first.data(), entry.first.size())) == entry.second);
+        ++visited;
+    }
+    assert(visited == expected.size());
+    assert(actual.load_factor() <= 0.875f);
+
+    // Copies, moves, and clearing.
+    sz::string_map<int> copy = actual;
+    sz::string_map<int> moved = std::move(actual);
+    assert(copy.size() == expected.size() && moved.size() == expected.size() && actual.empty());
+    for (auto const &entry : expected) assert(copy.at(entry.first) == entry.second && moved.at(entry.first) == entry.second);
+    moved.clear();
+    assert(moved.empty() && moved.find(expected.begin()->first) == moved.end() && moved.keys_bytes() == 0);
+    moved["reused"] = 1;
+    assert(moved.size() == 1 && moved.at("reused") == 1);
+
+    // Values with non-trivial destructors.
+    sz::string_map<std::string> texts;
+    texts.reserve(1000);
+    std::size_t capacity = texts.capacity();
+    for (std::size_t i = 0; i != 1000; ++i) texts[std::to_string(i)] = std::string(100, 'a' + (i % 26));
+    assert(texts.capacity() == capacity && texts.at("999") == std::string(100, 'a' + (999 % 26)));
+    for (std::size_t i = 0; i != 1000; i += 2) texts.erase(std::to_string(i));
+    assert(texts.size() == 500 && !texts.contains("998") && texts.contains("997"));
+
+    // Sets share the same logic.
+    sz::string_set set = {"a", "b", "c", "b"};
+    assert(set.size() == 3 && set.contains("b") && !set.contains("d"));
+    assert(set.insert("d").second && !set.insert("d").second && *set.find("d") == "d");
+    assert(set.erase("a") == 1 && set.size() == 3);
+    std::size_t set_visited = 0;
+    for (sz::string_view key : set) assert(key.size() == 1), ++set_visited;
+    assert(set_visited == 3);
+}
+
+/**
+ *  @brief  Tests the front-coded sorted strings against binary searches over `std::vector`.
+ */
+static void test_sorted_strings() {
+    using strs_t = std::vector<std::string>;
+    sz::sorted_strings empty;
+    assert(empty.empty() && empty.lower_bound("a") == 0 && empty.find("a") == sz::sorted_strings::npos);
+
+    // Long shared prefixes, duplicates, empty strings, prefixes of other strings, and bytes above 127.
+    strs_t dataset = {"", "", "a", "ab", "ab", "abc", "b", "\x80", "\xFF\xFF"};
+    std::mt19937 &generator = global_random_generator();
+    for (std::size_t i = 0; i != 3000; ++i)
+        dataset.push_back("https://example.com/" + random_string(generator() % 6, "ab/\x90", 4));
+    std::shuffle(dataset.begin(), dataset.end(), generator);
+    strs_t sorted = dataset;
+    std::sort(sorted.begin(), sorted.end());
+    strs_t queries = sorted;
+    for (std::size_t i = 0; i != 1000; ++i)
+        queries.push_back("https://example.com/" + random_string(generator() % 7, "ab/c\x90", 5));
+    queries.push_back("https://example.com/\xFF"), queries.push_back("\xFF\xFF\xFF"), queries.push_back("0");
+
+    for (std::size_t block_size : {1, 2, 16, 100000}) {
+        sz::sorted_strings strings(dataset, block_size);
+        assert(strings.size() == sorted.size() && strings.block_size() == block_size);
+        for (std::size_t i = 0; i != sorted.size(); ++i) assert(strings[i] == sorted[i]);
+        strings.for_each([&](std::size_t i, sz::string_view s) { assert(s == sz::string_view(sorted[i])); });
+        assert(strings.at(sorted.size() - 1) == sorted.back());
+
+        // Serialize into an unaligned buffer and address it in place, like a memory-mapped file.
+        sz::string_view serialized = strings.serialized();
+        std::string buffer = " " + std::string(serialized.data(), serialized.size());
+        sz::sorted_strings mapped = sz::sorted_strings::view(sz::string_view(buffer).sub(1));
+        assert(mapped.serialized() == serialized && mapped.size() == strings.size());
+
+        for (std::string const &query : queries) {
+            std::size_t expected = std::lower_bound(sorted.begin(), sorted.end(), query) - sorted.begin();
+            bool expected_found = expected != sorted.size() && sorted[expected] == query;
+            assert(strings.lower_bound(query) == expected && mapped.lower_bound(query) == expected);
+            assert(strings.find(query) == (expected_found ? expected : sz::sorted_strings::npos));
+            assert(mapped.contains(query) == expected_found);
+        }
+    }
+
+    // Building from a sorted C sequence, that only references the original strings.
+    std::vector<sz::sorted_idx_t> order = sz::sorted_order(dataset);
+    std::string tape;
+    std::vector<std::uint64_t> offsets = sz::gather_tape(dataset, tape);
+    sz_sequence_t sequence;
+    sz_sequence_tape_t tape_handle;
+    sz_sequence_from_u64tape(&tape_handle, tape.data(), reinterpret_cast<sz_u64_t const *>(offsets.data()),
+                             dataset.size(), &sequence);
+    sequence.order = order.data();
+    sz::sorted_strings from_sequence(sequence);
+    assert(from_sequence.serialized() == sz::sorted_strings(dataset).serialized());
+
+    // Front-coding must save space on shared prefixes.
+    std::size_t tape_length = 0;
+    for (std::string const &s : dataset) tape_length += s.size();
+    assert(from_sequence.serialized().size() * 3 < tape_length);
+
+    // Malformed buffers are rejected.
+    auto is_rejected = [](std::string const &buffer) {
+        try {
+            sz::sorted_strings::view(buffer);
+        }
+        catch (std::invalid_argument const &) {
+            return true;
+        }
+        return false;
+    };
+    sz::string_view valid = from_sequence.serialized();
+    assert(is_rejected(std::string(valid.data(), 40)));
+    assert(is_rejected(std::string(valid.data(), valid.size() - 1)));
+
+    // Including the ones with a consistent header, but corrupted offsets or entries in the middle.
+    std::vector<std::string> small_dataset = {"a", "ab", "abc", "abd", "b", "ba", "bab", "c", "ca", "cab", "cb"};
+    sz::sorted_strings small(small_dataset, 4);
+    sz::string_view small_serialized = small.serialized();
+    std::string const pristine(small_serialized.data(), small_serialized.size());
+    std::size_t const table = sz::sorted_strings::header_length_k, payload = table + 4 * 8;
+    std::string corrupted = pristine;
+    corrupted[table + 8] = corrupted[payload]; //< The second block starts before the end of the first one
+    assert(is_rejected(corrupted));
+    corrupted = pristine;
+    corrupted[table + 16] = '\x7F'; //< The third block starts beyond the payload
+    assert(is_rejected(corrupted));
+    corrupted = pristine;
+    corrupted[payload] = '\x7F'; //< The first head is longer than its block
+    assert(is_rejected(corrupted));
+    corrupted = pristine;
+    corrupted[payload + 2] = '\x05'; //< The second entry inherits more than the head has
+    assert(is_rejected(corrupted));
+
+    // Any single corrupted byte is either rejected, or yields a structurally valid array.
+    for (std::size_t i = 0; i != pristine.size(); ++i) {
+        for (char value : {'\x00', '\x01', '\x7F', '\x80', '\xFF'}) {
+            corrupted = pristine;
+            corrupted[i] = value;
+            if (is_rejected(corrupted)) continue;
+            sz::sorted_strings mapped = sz::sorted_strings::view(corrupted);
+            std::size_t visited = 0;
+            mapped.for_each([&](std::size_t, sz::string_view) { ++visited; });
+            assert(visited == mapped.size());
+            for (std::string const &query : small_dataset) assert(mapped.lower_bound(query) <= mapped.size());
+        }
+    }
+}
+
 int main(int argc, char const **argv) {
 
     // Let's greet the user nicely
@@ -1558,7 +3096,11 @@ int main(int argc, char const **argv) {
     // Basic utilities
     test_arithmetical_utilities();
     test_memory_utilities();
+    test_memory_utilities_huge();
     test_replacements();
+    test_hashing();
+    test_minhash();
+    test_utf8();
 
 // Compatibility with STL
 #if SZ_DETECT_CPP_17 && __cpp_lib_string_view
@@ -1580,22 +3122,31 @@ int main(int argc, char const **argv) {
     test_constructors();
     test_memory_stability_for_length(1024);
     test_memory_stability_for_length(14);
+    test_arena_allocation();
     test_updates();
 
     // Advanced search operations
     test_stl_conversions();
     test_comparisons();
     test_search();
+    test_search_caseless();
+    test_find_all();
 #if SZ_DETECT_CPP_17 && __cpp_lib_string_view
     test_search_with_misaligned_repetitions();
 #endif
+    test_multi_search();
+    test_stream_search();
+    test_glob_matcher();
 
     // Similarity measures and fuzzy search
     test_levenshtein_distances();
+    test_alignment_scores();
 
     // Sequences of strings
     test_sequence_algorithms();
     test_stl_containers();
+    test_string_maps();
+    test_sorted_strings();
 
     std::printf("All tests passed... Unbelievable!\n");
     return 0;
@@ -68,3 +68,29 @@ test('Count Words - Empty String Inputs', () => {
     const result_3 = stringzilla.count('', '');
     assert.strictEqual(result_3, 0n);
 });
+
+test('Binary Inputs - Buffers and TypedArrays are searched in-place', () => {
+    const haystack = Buffer.from('hello world, hello john');
+    assert.strictEqual(stringzilla.indexOf(haystack, 'john'), 19n);
+    assert.strictEqual(stringzilla.indexOf(haystack.subarray(1), Buffer.from('hello')), 12n);
+    assert.strictEqual(stringzilla.count(new Uint8Array(haystack), 'hello'), 2n);
+    assert.strictEqual(stringzilla.count(new Uint8Array(4), new Uint8Array(2), true), 3n);
+    assert.throws(() => stringzilla.indexOf(42, 'a'), TypeError);
+});
+
+test('Find All - Offsets of every occurrence', () => {
+    assert.deepStrictEqual(stringzilla.findAll('abababab', 'aba'), new BigUint64Array([0n, 4n]));
+    assert.deepStrictEqual(stringzilla.findAll('abababab', 'aba', true), new BigUint64Array([0n, 2n, 4n]));
+    assert.deepStrictEqual(stringzilla.findAll('a,b,,c', ','), new BigUint64Array([1n, 3n, 4n]));
+    assert.deepStrictEqual(stringzilla.findAll('hello', 'z'), new BigUint64Array([]));
+});
+
+test('Batches - Many haystacks in one call', () => {
+    const haystacks = ['hello world', Buffer.from('say hello'), '', 'hhhello', 'hi'];
+    assert.deepStrictEqual(stringzilla.indexOfBatch(haystacks, 'hello'), new BigInt64Array([0n, 4n, -1n, 2n, -1n]));
+    assert.deepStrictEqual(stringzilla.indexOfBatch(haystacks, ''), new BigInt64Array([0n, 0n, 0n, 0n, 0n]));
+    assert.deepStrictEqual(stringzilla.countBatch(haystacks, 'h'), new BigUint64Array([1n, 1n, 0n, 3n, 1n]));
+    assert.deepStrictEqual(stringzilla.editDistances('hello', haystacks), new BigUint64Array([6n, 4n, 5n, 2n, 4n]));
+    assert.deepStrictEqual(stringzilla.editDistances('hello', haystacks, 3), new BigUint64Array([3n, 3n, 3n, 2n, 3n]));
+    assert.throws(() => stringzilla.countBatch('hello', 'h'), TypeError);
+});
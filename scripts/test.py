@@ -1,4 +1,5 @@
 from random import choice, randint
+from collections import Counter
 from string import ascii_lowercase
 from typing import Optional, Sequence, Dict
 import tempfile
@@ -40,6 +41,31 @@ def test_library_properties():
     assert "serial" in sz.__capabilities__.split(","), "Serial backend must be present"
 
 
+def test_dispatch_backends():
+    haystack = "".join(choice("ab") for _ in range(10_000)) + "needle"
+    kernels = sz.kernels()
+    assert kernels["find"].startswith("sz_find_")
+
+    try:
+        assert sz.use_backend("serial") == "serial,"
+        assert all(not any(isa in kernel for isa in ("avx", "neon", "sve")) for kernel in sz.kernels().values())
+        assert Str(haystack).find("needle") == haystack.find("needle")
+        assert sz.hash(haystack) == sz.hash(haystack.encode())
+    finally:
+        sz.use_backend("any")
+    assert sz.kernels() == kernels
+
+    with pytest.raises(ValueError):
+        sz.use_backend("mmx")
+
+    sz.reset_stats()
+    stats = sz.stats()
+    if stats is not None:
+        Str(haystack).find("needle")
+        calls, bytes_count = sz.stats()["find"]
+        assert calls >= 1 and bytes_count >= len(haystack)
+
+
 @pytest.mark.parametrize("native_type", [str, bytes, bytearray])
 def test_unit_construct(native_type):
     native = "aaaaa"
@@ -78,6 +104,34 @@ def test_unit_contains():
     assert "xxx" not in big
 
 
+def test_unit_ignore_case():
+    big = Str("Hello, World! HELLO, world!")
+    assert big.find("hello", ignore_case=True) == 0
+    assert big.find("world", ignore_case=True) == 7
+    assert big.rfind("HeLLo", ignore_case=True) == 14
+    assert big.find("hello", ignore_case=False) == -1
+    assert big.index("WORLD", ignore_case=True) == 7
+    assert big.rindex("WORLD", ignore_case=True) == 21
+    assert big.contains("WoRlD!", ignore_case=True)
+    assert not big.contains("WoRlD?", ignore_case=True)
+    assert big.count("hello", ignore_case=True) == 2
+    assert big.count("l", ignore_case=True) == 6
+    assert big.partition("WORLD", ignore_case=True)[2] == "! HELLO, world!"
+    assert big.rpartition("hello", ignore_case=True)[0] == "Hello, World! "
+    assert big.split("O, ", ignore_case=True) == ["Hell", "World! HELL", "world!"]
+    assert big.rsplit("o, ", ignore_case=True, maxsplit=1) == ["Hello, World! HELL", "world!"]
+    assert list(big.split_iter("O, ", ignore_case=True)) == ["Hell", "World! HELL", "world!"]
+    assert sz.find("ABC", "b", ignore_case=True) == 1
+
+    # Only ASCII letters are folded, so neighboring symbols and multi-byte runes must match exactly
+    assert Str("[@`{").find("{", ignore_case=True) == 3
+    assert Str("@").find("`", ignore_case=True) == -1
+    assert Str("Ёжик").find("ё", ignore_case=True) == -1
+
+    with pytest.raises(TypeError):
+        big.find_first_of("h", ignore_case=True)
+
+
 def test_unit_str_rich_comparisons():
     # Equality
     assert Str("aa") == "aa"
@@ -160,6 +214,33 @@ def test_str_write_to():
         os.remove(temp_filename)
 
 
+def test_file_mapping_hints():
+    native = "\n".join(str(i) for i in range(10_000))
+    with tempfile.NamedTemporaryFile(delete=False) as tmpfile:
+        temp_filename = tmpfile.name
+    try:
+        Str(native).write_to(temp_filename)
+        for access in ["normal", "sequential", "random"]:
+            for populate in [False, True]:
+                file = sz.File(temp_filename, access=access, populate=populate, hugepages=populate)
+                assert str(Str(file)) == native
+
+        # Small read-ahead windows re-issue the hint many times along the way
+        for readahead in [0, 1, 100, 1 << 20]:
+            file = sz.File(temp_filename, readahead=readahead)
+            assert [str(s) for s in Str(file).split_iter("\n")] == native.split("\n")
+            assert [str(s) for s in Str(file)[3:-3].rsplit_iter("\n")] == list(
+                reversed(native[3:-3].split("\n"))
+            )
+
+        with pytest.raises(ValueError):
+            sz.File(temp_filename, access="backwards")
+        with pytest.raises(ValueError):
+            sz.File(temp_filename, readahead=-1)
+    finally:
+        os.remove(temp_filename)
+
+
 def test_unit_split():
     native = "line1\nline2\nline3"
     big = Str(native)
@@ -217,6 +298,19 @@ def test_unit_split():
         sz.rsplit_charset(big, "")
 
 
+def test_unit_split_many_parts():
+    # The separators are located in batches, so the number of parts should cross the batch boundaries
+    for count in [255, 256, 257, 1000]:
+        native = "\n".join(str(i) for i in range(count))
+        big = Str(native)
+        assert native.split("\n") == list(big.split("\n"))
+        assert native.splitlines() == list(big.splitlines())
+        assert native.split("\n", maxsplit=count - 2) == list(big.split("\n", maxsplit=count - 2))
+        assert native.split("1\n") == list(big.split("1\n"))
+        assert native.count("1") == big.count("1")
+        assert native.count("11") == big.count("11")
+
+
 def test_unit_split_iterators():
     """
     Test the iterator-based split methods.
@@ -284,6 +378,74 @@ def test_unit_split_iterators():
         sz.rsplit_charset_iter(big, "")
 
 
+def test_unit_stream_matcher():
+    matcher = sz.StreamMatcher("aa")
+    assert matcher.feed("xa") == []
+    assert matcher.feed(b"aa") == [1]
+    assert matcher.feed(Str("")) == []
+    assert matcher.feed(Str("baab")) == [5]
+    assert matcher.offset == 8 and matcher.needle == b"aa"
+    matcher.reset()
+    assert matcher.offset == 0 and matcher.feed("aaa") == [0]
+
+    overlapping = sz.StreamMatcher("aa", allowoverlap=True)
+    assert overlapping.feed("a") + overlapping.feed("aa") + overlapping.feed("a") == [0, 1, 2]
+
+    with pytest.raises(ValueError):
+        sz.StreamMatcher("")
+
+
+@pytest.mark.repeat(30)
+@pytest.mark.parametrize("needle_length", [1, 2, 5, 17])
+@pytest.mark.parametrize("allowoverlap", [False, True])
+def test_stream_matcher_random(needle_length: int, allowoverlap: bool):
+    needle = "".join(choice("ab") for _ in range(needle_length))
+    haystack = "".join(choice("ab") for _ in range(randint(0, 500)))
+    expected = []
+    offset = haystack.find(needle)
+    while offset != -1:
+        expected.append(offset)
+        offset = haystack.find(needle, offset + (1 if allowoverlap else needle_length))
+
+    matcher = sz.StreamMatcher(needle, allowoverlap=allowoverlap)
+    received, offset = [], 0
+    while offset < len(haystack):
+        chunk_length = randint(0, needle_length * 2)
+        received += matcher.feed(haystack[offset : offset + chunk_length])
+        offset += chunk_length
+    assert received == expected
+
+
+def test_unit_glob():
+    matcher = sz.Glob("GET /api/*/users?id=*")
+    assert matcher.match("GET /api/v2/users?id=42")
+    assert matcher.match(b"GET /api/v2/users/id=42")
+    assert not matcher.match(Str("POST /api/v2/users?id=42"))
+    assert matcher.min_length == len("GET /api//users?id=")
+
+    assert sz.Glob("[a-z][!0-9]\\*").match("ab*")
+    assert not sz.Glob("[a-z][!0-9]\\*").match("a1*")
+    assert sz.Glob("").match("") and not sz.Glob("").match("a")
+
+    lines = Str("server.log\nserver.log.gz\n.log\nlog").splitlines()
+    assert sz.Glob("*.log").filter(lines) == [0, 2]
+    with pytest.raises(TypeError):
+        sz.Glob("*.log").filter(["server.log"])
+
+
+@pytest.mark.repeat(30)
+@pytest.mark.parametrize("pattern_length", [1, 3, 7])
+def test_glob_random(pattern_length: int):
+    from fnmatch import fnmatchcase
+
+    atoms = ["a", "b", "c", "*", "?", "[ab]", "[!a]"]
+    pattern = "".join(choice(atoms) for _ in range(pattern_length))
+    matcher = sz.Glob(pattern)
+    for _ in range(20):
+        text = "".join(choice("abc") for _ in range(randint(0, 10)))
+        assert matcher.match(text) == fnmatchcase(text, pattern), f"{pattern=} {text=}"
+
+
 def test_unit_strs_sequence():
     native = "p3\np2\np1"
     big = Str(native)
@@ -452,6 +614,13 @@ def test_unit_globals():
     assert sz.translate("ABC", {"A": "X", "B": "Y"}, start=1, end=-1) == "YC"
     assert sz.translate("ABC", bytes(range(256))) == "ABC"
 
+    # In-place translations, long enough to reach the SIMD kernels
+    upper_table = bytes(range(97)) + bytes(range(65, 91)) + bytes(range(123, 256))
+    buffer = bytearray(b"Hello, World! " * 20)
+    assert sz.translate(memoryview(buffer), upper_table, inplace=True) is None
+    assert buffer == b"HELLO, WORLD! " * 20
+    assert sz.translate(b"Hello, World! " * 20, upper_table) == b"HELLO, WORLD! " * 20
+
 
 def test_string_lengths():
     assert 4 == len(sz.Str("abcd"))
@@ -466,6 +635,7 @@ def test_string_lengths():
         (b"hello world", "ascii", "hello world"),
         (b"\xf0hello world", "latin-1", "ðhello world"),
         (b"", "utf-8", ""),  # Empty string case
+        ("αβγδ 😁 中文".encode() * 20, "utf-8", "αβγδ 😁 中文" * 20),  # Long enough for SIMD
     ],
 )
 def test_decoding_valid_strings(byte_string, encoding, expected):
@@ -478,6 +648,7 @@ def test_decoding_valid_strings(byte_string, encoding, expected):
     [
         (b"\xff", "utf-8"),  # Invalid UTF-8 byte
         (b"\x80hello", "ascii"),  # Non-ASCII byte in ASCII string
+        ("αβγδ".encode() * 20 + b"\xed\xa0\x80", "utf-8"),  # UTF-16 surrogate after a long prefix
     ],
 )
 def test_decoding_exceptions(byte_string, encoding):
@@ -487,6 +658,26 @@ def test_decoding_exceptions(byte_string, encoding):
         sz.Str(byte_string).decode(encoding)
 
 
+@pytest.mark.parametrize(
+    "byte_string, is_valid",
+    [
+        (b"", True),
+        ("héllo wörld 😁".encode(), True),
+        ("中文".encode() * 100, True),
+        (b"\xc3", False),  # Truncated rune
+        (b"\xc0\x80", False),  # Overlong encoding
+        (b"\xf4\x90\x80\x80", False),  # Beyond U+10FFFF
+        (b"a" * 100 + b"\x80", False),  # Stray continuation byte
+    ],
+)
+def test_utf8_validation_and_counting(byte_string, is_valid):
+    assert sz.Str(byte_string).isutf8() == is_valid
+    assert sz.isutf8(byte_string) == is_valid
+    if is_valid:
+        assert sz.Str(byte_string).utf8_count() == len(byte_string.decode())
+        assert sz.utf8_count(byte_string) == len(byte_string.decode())
+
+
 def test_slice_of_split():
     def impl(native_str: str):
         native_split = native_str.split()
@@ -622,6 +813,18 @@ def test_fuzzy_substrings(pattern_length: int, haystack_length: int, variability
     ), f"Failed to locate {pattern} at offset {native.find(pattern)} in {native}"
 
 
+@pytest.mark.parametrize("pattern_length", [1, 2, 3, 5, 17])
+@pytest.mark.parametrize("haystack_length", [1, 7, 31, 64, 65, 200])
+@pytest.mark.repeat(10)
+def test_fuzzy_substrings_ignore_case(pattern_length: int, haystack_length: int):
+    native = "".join(choice("aAbBzZ@`") for _ in range(haystack_length))
+    pattern = "".join(choice("aAbBzZ@`") for _ in range(pattern_length))
+    big = Str(native)
+    assert native.lower().find(pattern.lower()) == big.find(pattern, ignore_case=True)
+    assert native.lower().rfind(pattern.lower()) == big.rfind(pattern, ignore_case=True)
+    assert native.lower().count(pattern.lower()) == big.count(pattern, ignore_case=True)
+
+
 @pytest.mark.repeat(100)
 @pytest.mark.parametrize("max_edit_distance", [150])
 def test_edit_distance_insertions(max_edit_distance: int):
@@ -638,6 +841,20 @@ def test_edit_distance_insertions(max_edit_distance: int):
         assert sz.edit_distance(a, b, bound=200) == i + 1
 
 
+@pytest.mark.repeat(30)
+@pytest.mark.parametrize("bound", [1, 2, 3, 10])
+def test_edit_distance_small_bounds(bound: int):
+    a = get_random_string(length=500)
+    b = a
+    for _ in range(randint(0, 12)):
+        offset = randint(0, len(b) - 1)
+        b = b[:offset] + choice(ascii_lowercase) + b[offset + 1 :]
+    expected = sz.edit_distance(a, b)
+    assert sz.edit_distance(a, b, bound=bound) == min(expected, bound)
+    assert sz.edit_distance(b, a, bound=bound) == min(expected, bound)
+    assert sz.edit_distance_unicode("ф" + a, "ф" + b, bound=bound) == min(expected, bound)
+
+
 def test_edit_distances():
 
     assert sz.hamming_distance("hello", "hello") == 0
@@ -698,6 +915,21 @@ def test_edit_distance_random(first_length: int, second_length: int):
     assert sz.edit_distance(a, b) == baseline_edit_distance(a, b)
 
 
+@pytest.mark.repeat(10)
+@pytest.mark.parametrize("query_length", [0, 7, 64, 65, 100])
+@pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
+def test_edit_distances_batch(query_length: int):
+    query = get_random_string(length=query_length)
+    candidates = [get_random_string(length=randint(0, 100)) for _ in range(20)]
+    strs: Strs = Str("\n".join(candidates)).split("\n")
+    expected = [baseline_edit_distance(query, c) for c in candidates]
+    assert list(strs.edit_distances(query)) == expected
+    assert list(strs[::2].edit_distances(query)) == expected[::2]
+    assert list(strs.edit_distances(query, bound=5)) == [
+        sz.edit_distance(query, c, bound=5) for c in candidates
+    ]
+
+
 @pytest.mark.repeat(30)
 @pytest.mark.parametrize("first_length", [20, 100])
 @pytest.mark.parametrize("second_length", [20, 100])
@@ -841,6 +1073,108 @@ def test_fuzzy_sorting(list_length: int, part_length: int, variability: int):
         assert native_str == str(big_str), "Order is wrong"
 
 
+@pytest.mark.parametrize("threads", [0, 2, 7])
+def test_parallel_sorting(threads: int):
+    native_list = [
+        get_random_string(variability=3, length=randint(0, 8))
+        for _ in range(100_000)
+    ]
+    big_list = Str("\n".join(native_list)).split("\n")
+
+    assert big_list.order(threads=threads) == big_list.order(), "Order differs"
+    big_list.sort(threads=threads)
+    assert [str(s) for s in big_list] == sorted(native_list), "Order is wrong"
+
+
+@pytest.mark.parametrize("k", [0, 1, 7, 100, 9_999, 10_000, 20_000])
+def test_partial_sorting(k: int):
+    native_list = [
+        get_random_string(variability=3, length=randint(0, 8))
+        for _ in range(10_000)
+    ]
+    big_list = Str("\n".join(native_list)).split("\n")
+    expected = sorted(native_list)[:k]
+
+    order = big_list.order(k=k)
+    assert len(order) == min(k, len(native_list))
+    assert [native_list[i] for i in order] == expected, "Order is wrong"
+    assert big_list.order(k=k, reverse=True) == big_list.order(reverse=True)[:k]
+
+    big_list.sort(k=k)
+    assert len(big_list) == len(native_list)
+    assert [str(s) for s in big_list][:k] == expected, "Order is wrong"
+    assert sorted(str(s) for s in big_list) == sorted(native_list), "Elements were lost"
+
+    with pytest.raises(ValueError):
+        big_list.order(k=-1)
+
+
+@pytest.mark.parametrize("threads", [1, 2, 0])
+def test_unique_counts(threads: int):
+    native_list = [
+        get_random_string(variability=3, length=randint(0, 4))
+        for _ in range(20_000)
+    ]
+    big_list = Str("\n".join(native_list)).split("\n")
+    expected = Counter(native_list)  # Keeps the order of first occurrences
+
+    assert [str(s) for s in big_list.unique(threads=threads)] == list(expected)
+    firsts = big_list.argunique(threads=threads)
+    assert [native_list[i] for i in firsts] == list(expected)
+    assert list(firsts) == sorted(firsts)
+    unique, counts = big_list.counts(threads=threads)
+    assert dict(zip((str(s) for s in unique), counts)) == expected
+
+    # Reordered layouts and empty collections
+    big_list.sort()
+    assert [str(s) for s in big_list.unique(threads=threads)] == sorted(expected)
+    assert len(big_list[:0].unique()) == 0
+    assert big_list[:0].counts() == (big_list[:0], ())
+
+
+@pytest.mark.parametrize("threads", [1, 2, 0])
+def test_compact(threads: int):
+    native_list = [
+        get_random_string(variability=4, length=randint(0, 600))
+        for _ in range(20_000)
+    ]
+    big_list = Str("\n".join(native_list)).split("\n")
+    big_list.shuffle(seed=42)
+    shuffled = [str(s) for s in big_list]
+
+    compact = big_list.compact(threads=threads)
+    assert len(compact) == len(native_list)
+    assert [str(s) for s in compact] == shuffled
+    assert [str(s) for s in compact[100:200]] == shuffled[100:200]
+    assert [str(s) for s in compact.compact()] == shuffled
+    assert len(big_list[:0].compact()) == 0
+
+
+@pytest.mark.parametrize("threads", [2, 3, 0])
+@pytest.mark.parametrize("needle", ["a", "ab", "aaa", "abba"])
+def test_parallel_search(threads: int, needle: str):
+    # Long runs of the same character make the partitions' boundaries hard to place
+    native = get_random_string(variability=2, length=400_000) + "a" * 200_000
+    big = Str(native)
+    assert sz.count(big, needle, threads=threads) == native.count(needle)
+    assert big.count(needle, allowoverlap=True, threads=threads) == big.count(needle, allowoverlap=True)
+    assert big.split(needle, threads=threads) == big.split(needle)
+    assert big.split(needle, keepseparator=True, threads=threads) == big.split(needle, keepseparator=True)
+    assert big.split_charset(needle, threads=threads) == big.split_charset(needle)
+    assert [str(s) for s in big.split(needle, threads=threads)] == native.split(needle)
+
+
+@pytest.mark.parametrize("threads", [2, 4])
+@pytest.mark.parametrize("needle", ["aa", "aaa", "abab"])
+def test_parallel_search_periodic(threads: int, needle: str):
+    # Self-overlapping needles on periodic haystacks chain their occurrences across every partition boundary
+    native = "ab" * 300_000 if needle == "abab" else "a" * 600_000
+    big = Str(native)
+    assert big.count(needle, threads=threads) == native.count(needle)
+    assert big.count(needle, allowoverlap=True, threads=threads) == big.count(needle, allowoverlap=True)
+    assert big.split(needle, threads=threads) == big.split(needle)
+
+
 @pytest.mark.skipif(not pyarrow_available, reason="PyArrow is not installed")
 def test_pyarrow_str_conversion():
     native = "hello"
@@ -852,6 +1186,47 @@ def test_pyarrow_str_conversion():
     assert arrow_buffer.to_pybytes() == native.encode("utf-8")
 
 
+def test_arrow_c_array_roundtrip():
+    native = "alpha beta gamma-delta epsilon zeta-with-a-long-tail omega"
+    big = Str(native)
+
+    # Views layout for splits with separators, tape layout for splits without them
+    for parts, expected in [
+        (big.split(" "), native.split(" ")),
+        (big.split(" ", keepseparator=True), [s + " " for s in native.split(" ")[:-1]] + ["omega"]),
+        (big.split(" ")[::2], native.split(" ")[::2]),
+        (Strs.from_arrow(big.split(" "))[1:4], native.split(" ")[1:4]),
+    ]:
+        schema_capsule, array_capsule = parts.__arrow_c_array__()
+        assert schema_capsule is not None and array_capsule is not None
+        imported = Strs.from_arrow(parts)
+        assert len(imported) == len(expected)
+        assert [str(s) for s in imported] == expected
+        assert [str(s) for s in imported[1:]] == expected[1:]
+        assert list(imported.order()) == sorted(range(len(expected)), key=lambda i: expected[i])
+        imported.sort()
+        assert [str(s) for s in imported] == sorted(expected)
+
+    # The imported strings keep the Arrow buffers alive
+    survivor = Strs.from_arrow(Str("first second").split(" "))[1]
+    assert str(survivor) == "second"
+
+    with pytest.raises(TypeError):
+        Strs.from_arrow("not an arrow array")
+
+
+@pytest.mark.skipif(not pyarrow_available, reason="PyArrow is not installed")
+def test_pyarrow_strs_conversion():
+    native = ["hello", "world", "a considerably longer string than twelve bytes", ""]
+    for arrow_type in [pa.utf8(), pa.large_utf8()]:
+        column = pa.array(native + [None], type=arrow_type)
+        strs = Strs.from_arrow(column)
+        assert [str(s) for s in strs] == native + [""]
+
+    exported = pa.array(Str(" ".join(native)).split(" "))
+    assert exported.to_pylist() == native
+
+
 if __name__ == "__main__":
     import sys
 
@@ -0,0 +1,73 @@
+#undef NDEBUG // Enable all assertions
+
+/**
+ *  @brief  Checks the dispatch table of the dynamic library, which must be compiled with `SZ_ENABLE_STATS=1`.
+ *          If the `SZ_BACKEND` environment variable is set to "serial", also checks that no SIMD kernels are in use.
+ */
+#define SZ_DYNAMIC_DISPATCH 1
+#include <stringzilla/stringzilla.h>
+
+#include <assert.h> // `assert`
+#include <stdio.h>  // `printf`
+#include <stdlib.h> // `getenv`
+#include <string.h> // `strcmp`
+
+static sz_size_t dispatch_operation_index(sz_cptr_t name) {
+    for (sz_size_t i = 0; i != sz_dispatch_count(); ++i)
+        if (strcmp(sz_dispatch_operation(i), name) == 0) return i;
+    assert(0 && "Unknown operation");
+    return 0;
+}
+
+static int ends_with(sz_cptr_t text, sz_cptr_t suffix) {
+    size_t text_length = strlen(text), suffix_length = strlen(suffix);
+    return text_length >= suffix_length && strcmp(text + text_length - suffix_length, suffix) == 0;
+}
+
+static void test_stats(void) {
+    char const haystack[] = "the quick brown fox jumps over the lazy dog";
+    sz_size_t const find_index = dispatch_operation_index("find");
+    sz_u64_t calls, bytes;
+
+    sz_dispatch_stats_reset();
+    assert(sz_dispatch_stats(find_index, &calls, &bytes) && "Compile the library with SZ_ENABLE_STATS=1");
+    assert(calls == 0 && bytes == 0);
+
+    assert(sz_find(haystack, sizeof(haystack) - 1, "lazy", 4) == haystack + 35);
+    assert(sz_find(haystack, sizeof(haystack) - 1, "cat", 3) == SZ_NULL);
+    sz_dispatch_stats(find_index, &calls, &bytes);
+    assert(calls == 2 && bytes == 2 * (sizeof(haystack) - 1));
+
+    sz_dispatch_stats_reset();
+    for (sz_size_t i = 0; i != sz_dispatch_count(); ++i) {
+        sz_dispatch_stats(i, &calls, &bytes);
+        assert(calls == 0 && bytes == 0);
+    }
+}
+
+static void test_backend(void) {
+    sz_capability_t expected = sz_capabilities();
+    sz_capability_t const requested = sz_capabilities_from_names(getenv("SZ_BACKEND"));
+    if (requested) expected = (sz_capability_t)((expected & requested) | sz_cap_serial_k);
+    assert(sz_dispatch_capabilities() == expected);
+
+    if (expected != sz_cap_serial_k) return;
+    for (sz_size_t i = 0; i != sz_dispatch_count(); ++i) {
+        sz_cptr_t kernel = sz_dispatch_kernel(i);
+        assert(kernel && (ends_with(kernel, "_serial") || ends_with(kernel, "_dispatched")));
+    }
+
+    // Switching back to all of the capabilities should upgrade the table in place.
+    assert(sz_dispatch_use(sz_capabilities()) == sz_capabilities());
+    assert(sz_dispatch_use(sz_cap_serial_k) == sz_cap_serial_k);
+}
+
+int main(void) {
+    printf("Testing the dispatch table of the dynamic library\n");
+    for (sz_size_t i = 0; i != sz_dispatch_count(); ++i)
+        printf("- %s: %s\n", sz_dispatch_operation(i), sz_dispatch_kernel(i));
+    test_stats();
+    test_backend();
+    printf("All tests passed... Unbelievable!\n");
+    return 0;
+}
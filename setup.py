@@ -140,7 +140,8 @@ ext_modules = [
         include_dirs=["include"],
         extra_compile_args=compile_args,
         extra_link_args=link_args,
-        define_macros=[("SZ_DYNAMIC_DISPATCH", "1")] + macros_args,
+        define_macros=[("SZ_DYNAMIC_DISPATCH", "1"), ("SZ_ENABLE_STATS", os.environ.get("SZ_ENABLE_STATS", "0"))]
+        + macros_args,
     ),
 ]
 
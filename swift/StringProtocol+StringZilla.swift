@@ -277,4 +277,114 @@ public extension StringZillaViewable {
         return result
     }
     
+    /// Finds all occurrences of the specified substring within the receiver, exporting them in bulk.
+    /// - Parameters:
+    ///   - needle: The substring to search for.
+    ///   - allowOverlap: Whether the occurrences may overlap, like "aa" found twice in "aaa".
+    /// - Returns: The indices of all found occurrences, or an empty array, if the substring is empty.
+    @_specialize(where Self == String, S == String)
+    @_specialize(where Self == String.UTF8View, S == String.UTF8View)
+    func findAll<S: StringZillaViewable>(substring needle: S, allowOverlap: Bool = false) -> [Index] {
+        var result: [Index] = []
+        withStringZillaScope { hPointer, hLength in
+            needle.withStringZillaScope { nPointer, nLength in
+                let overlap = allowOverlap ? sz_true_k : sz_false_k
+                let count = sz_count(hPointer, hLength, nPointer, nLength, overlap)
+                if count == 0 { return }
+                var offsets = [sz_size_t](repeating: 0, count: Int(count))
+                sz_find_all(hPointer, hLength, nPointer, nLength, overlap, &offsets, count)
+                result = offsets.map { self.stringZillaByteOffset(forByte: hPointer + Int($0), after: hPointer) }
+            }
+        }
+        return result
+    }
+}
+
+/// The offset reported by the batched C functions, when the needle is missing, equal to `SZ_SIZE_MAX`.
+fileprivate let missingOffset = ~sz_size_t(0)
+
+fileprivate extension Collection where Element: StringZillaViewable {
+    
+    /// Concatenates the UTF-8 bytes of all elements into a single tape, and exposes it as a C sequence.
+    /// Bridging every element once and crossing into C just once is much cheaper, than doing both per element.
+    ///
+    /// - Parameters:
+    ///   - body: A closure that takes a pointer to the sequence, valid only for the duration of the closure.
+    /// - Returns: Returns a value of type R, which is the result of the closure.
+    func withStringZillaSequence<R>(_ body: (UnsafePointer<sz_sequence_t>) throws -> R) rethrows -> R {
+        var bytes: [CChar] = []
+        var offsets: [sz_u64_t] = [0]
+        offsets.reserveCapacity(underestimatedCount + 1)
+        for element in self {
+            element.withStringZillaScope { pointer, length in
+                bytes.append(contentsOf: UnsafeBufferPointer(start: pointer, count: Int(length)))
+            }
+            offsets.append(sz_u64_t(bytes.count))
+        }
+        return try bytes.withUnsafeBufferPointer { bytesBuffer in
+            try offsets.withUnsafeBufferPointer { offsetsBuffer in
+                var tape = sz_sequence_tape_t()
+                var sequence = sz_sequence_t()
+                return try withUnsafeMutablePointer(to: &tape) { tapePointer in
+                    sz_sequence_from_u64tape(tapePointer, bytesBuffer.baseAddress, offsetsBuffer.baseAddress,
+                                             sz_size_t(offsetsBuffer.count - 1), &sequence)
+                    return try body(&sequence)
+                }
+            }
+        }
+    }
+}
+
+public extension Collection where Element: StringZillaViewable {
+    
+    /// Finds the first occurrence of the specified substring within every element, in a single call into C.
+    /// - Parameter needle: The substring to search for.
+    /// - Returns: The index of the found occurrence in every element, or `nil` where it's not found.
+    func findFirst<S: StringZillaViewable>(substring needle: S) -> [Element.Index?] {
+        let offsets: [sz_size_t] = withStringZillaSequence { sequence in
+            var offsets = [sz_size_t](repeating: 0, count: Int(sequence.pointee.count))
+            needle.withStringZillaScope { nPointer, nLength in
+                sz_find_batch(sequence, nPointer, nLength, &offsets)
+            }
+            return offsets
+        }
+        return zip(self, offsets).map { element, offset -> Element.Index? in
+            if offset == missingOffset { return nil }
+            return element.withStringZillaScope { pointer, _ in
+                element.stringZillaByteOffset(forByte: pointer + Int(offset), after: pointer)
+            }
+        }
+    }
+    
+    /// Counts the occurrences of the specified substring within every element, in a single call into C.
+    /// - Parameters:
+    ///   - needle: The substring to count. Empty substrings are never counted.
+    ///   - allowOverlap: Whether the occurrences may overlap, like "aa" found twice in "aaa".
+    /// - Returns: The number of occurrences in every element.
+    func count<S: StringZillaViewable>(substring needle: S, allowOverlap: Bool = false) -> [Int] {
+        return withStringZillaSequence { sequence in
+            var counts = [sz_size_t](repeating: 0, count: Int(sequence.pointee.count))
+            needle.withStringZillaScope { nPointer, nLength in
+                sz_count_batch(sequence, nPointer, nLength, allowOverlap ? sz_true_k : sz_false_k, &counts)
+            }
+            return counts.map { Int($0) }
+        }
+    }
+    
+    /// Computes the Levenshtein edit distances between the query and every element, in a single call into C.
+    /// - Parameters:
+    ///   - query: A string-like collection of characters to compare against.
+    ///   - bound: The upper bound on the distances, that allows to exit early. Zero means no bound.
+    /// - Returns: The edit distance to every element, as unsigned integers.
+    /// - Throws: If a memory allocation error has happened.
+    func editDistances<S: StringZillaViewable>(from query: S, bound: UInt64 = 0) throws -> [UInt64] {
+        return try withStringZillaSequence { sequence in
+            var distances = [sz_size_t](repeating: 0, count: Int(sequence.pointee.count))
+            let success = query.withStringZillaScope { qPointer, qLength in
+                sz_edit_distances(qPointer, qLength, sequence, sz_size_t(bound), nil, &distances)
+            }
+            if success == sz_false_k { throw StringZillaError.memoryAllocationFailed }
+            return distances.map { UInt64($0) }
+        }
+    }
 }
@@ -61,4 +61,20 @@ class StringZillaTests: XCTestCase {
         let index = "aeiou".findLast(characterNotFrom: "aeiou")
         XCTAssertNil(index)
     }
+    
+    func testFindAllSubstrings() {
+        let indices = testString.findAll(substring: "o")
+        XCTAssertEqual(indices.map { testString.distance(from: testString.startIndex, to: $0) }, [4, 8, 18, 23])
+        XCTAssertEqual("aaaa".findAll(substring: "aa").count, 2)
+        XCTAssertEqual("aaaa".findAll(substring: "aa", allowOverlap: true).count, 3)
+    }
+    
+    func testBatches() {
+        let strings = [testString!, "Hello", "", "world, world"]
+        let indices = strings.findFirst(substring: "world")
+        XCTAssertEqual(zip(strings, indices).map { string, index in index.map { String(string[$0...]) } },
+                       ["world! Welcome to StringZilla. 👋", nil, nil, "world, world"])
+        XCTAssertEqual(strings.count(substring: "o"), [4, 1, 0, 2])
+        XCTAssertEqual(try? strings.editDistances(from: "Hello"), [37, 0, 5, 10])
+    }
 }